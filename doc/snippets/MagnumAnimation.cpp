@@ -24,12 +24,14 @@
 */
 
 #include <vector>
+#include <Corrade/Containers/Array.h>
 
 #include "Magnum/Timeline.h"
 #include "Magnum/Math/Bezier.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Quaternion.h"
 #include "Magnum/Math/Packing.h"
+#include "Magnum/Animation/Compression.h"
 #include "Magnum/Animation/Easing.h"
 #include "Magnum/Animation/Player.h"
 
@@ -191,6 +193,23 @@ player.addWithCallback(translation,
 }
 #endif
 
+{
+std::size_t jointCount{};
+/* [Player-usage-batch] */
+/* Keyframes shared by all joints, rotations of all joints for a particular
+   keyframe next to each other */
+Containers::ArrayView<const Float> keys;
+Containers::StridedArrayView2D<const Quaternion> rotations;
+
+/* Interpolated rotations of all joints */
+Containers::Array<Quaternion> jointRotations{jointCount};
+
+Animation::Player<Float> player;
+player.addBatch(keys, rotations, Math::slerp,
+    Containers::stridedArrayView(jointRotations));
+/* [Player-usage-batch] */
+}
+
 {
 /* [Player-usage-playback] */
 Animation::Player<Float> player;
@@ -361,4 +380,51 @@ static_cast<void>(position);
 static_cast<void>(rotation);
 }
 
+
+{
+Containers::StridedArrayView1D<const Float> keys;
+Containers::StridedArrayView1D<const Quaternion> rotations;
+/* [packQuaternion] */
+Containers::Array<Vector3us> packed{Containers::NoInit, rotations.size()};
+for(std::size_t i = 0; i != rotations.size(); ++i)
+    packed[i] = Animation::packQuaternion(rotations[i]);
+
+Animation::TrackView<const Float, const Vector3us, Quaternion> track{
+    keys, packed, Animation::unpack<Vector3us, Quaternion,
+        Math::slerpShortestPath, Animation::unpackQuaternion>()};
+/* [packQuaternion] */
+static_cast<void>(track);
+}
+
+{
+Containers::StridedArrayView1D<const Float> keys;
+Containers::StridedArrayView1D<const Vector3> positions;
+Float time{};
+/* [quantizeInto] */
+Containers::Array<Vector3us> packed{Containers::NoInit, positions.size()};
+Range3D range = Animation::quantizeInto(positions, packed);
+
+Animation::TrackView<const Float, const Vector3us, Vector3> track{
+    keys, packed, Animation::unpack<Vector3us, Vector3,
+        Math::lerp, Animation::unpackQuantized>()};
+
+Vector3 position = Animation::dequantize(range, track.at(time));
+/* [quantizeInto] */
+static_cast<void>(position);
+}
+
+{
+Containers::StridedArrayView1D<Float> keys;
+Containers::StridedArrayView1D<Quaternion> rotations;
+/* [reduceKeyframesInPlace] */
+std::size_t count = Animation::reduceKeyframesInPlace<Float, Quaternion>(
+    keys, rotations, Math::slerp, Float(Rad(0.1_degf)),
+    [](const Quaternion& a, const Quaternion& b) {
+        return Float(Math::angle(a, b));
+    });
+keys = keys.prefix(count);
+rotations = rotations.prefix(count);
+/* [reduceKeyframesInPlace] */
+}
+
 }
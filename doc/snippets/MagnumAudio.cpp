@@ -23,8 +23,16 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/PluginManager/Manager.h>
+
+#include "Magnum/Audio/AbstractImporter.h"
+#include "Magnum/Audio/BufferFormat.h"
 #include "Magnum/Audio/Context.h"
 #include "Magnum/Audio/Extensions.h"
+#include "Magnum/Audio/Source.h"
+#include "Magnum/Audio/Stream.h"
 
 using namespace Magnum;
 
@@ -46,4 +54,38 @@ MAGNUM_ASSERT_AUDIO_EXTENSION_SUPPORTED(Audio::Extensions::ALC::SOFTX::HRTF);
 /* [MAGNUM_ASSERT_AUDIO_EXTENSION_SUPPORTED] */
 }
 
+{
+PluginManager::Manager<Audio::AbstractImporter> manager;
+Containers::Pointer<Audio::AbstractImporter> importer = manager.loadAndInstantiate("WavAudioImporter");
+/* [AbstractImporter-streaming] */
+importer->openFile("music.wav");
+
+Containers::Array<char> chunk{16384};
+while(std::size_t frameCount = importer->readFrames(chunk)) {
+    Containers::ArrayView<const char> data = chunk.prefix(
+        frameCount*Audio::bufferFormatFrameSize(importer->format()));
+
+    // process the data ...
+    static_cast<void>(data);
+}
+/* [AbstractImporter-streaming] */
+}
+
+{
+PluginManager::Manager<Audio::AbstractImporter> manager;
+Containers::Pointer<Audio::AbstractImporter> importer = manager.loadAndInstantiate("WavAudioImporter");
+/* [Stream-usage] */
+importer->openFile("music.wav");
+
+Audio::Source source;
+Audio::Stream stream{*importer, source};
+stream.setLooping(true)
+    .start();
+source.play();
+
+// every frame of the application
+stream.update();
+/* [Stream-usage] */
+}
+
 }
@@ -35,6 +35,7 @@
 #include "Magnum/MeshTools/GenerateNormals.h"
 #include "Magnum/MeshTools/Interleave.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/MeshTools/Simplify.h"
 #include "Magnum/MeshTools/Transform.h"
 #include "Magnum/Primitives/Cube.h"
 #include "Magnum/Trade/MeshData.h"
@@ -180,6 +181,15 @@ CORRADE_IGNORE_DEPRECATED_POP
 }
 #endif
 
+{
+Trade::MeshData mesh{MeshPrimitive::Triangles, 0};
+/* [simplifyLods] */
+const UnsignedInt indexCount = mesh.indexCount();
+Containers::Array<Trade::MeshData> lods = MeshTools::simplifyLods(mesh,
+    {indexCount/2, indexCount/4, indexCount/8});
+/* [simplifyLods] */
+}
+
 {
 /* [transformVectors] */
 std::vector<Vector3> vectors;
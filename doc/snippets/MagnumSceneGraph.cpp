@@ -35,6 +35,8 @@
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/DrawableBatch.h"
+#include "Magnum/SceneGraph/FlatHierarchy.h"
 #include "Magnum/SceneGraph/Object.h"
 #include "Magnum/SceneGraph/Scene.h"
 
@@ -387,4 +389,72 @@ camera.draw(drawableTransformations);
 /* [Drawable-culling] */
 }
 
+{
+/* [FlatHierarchy-usage] */
+SceneGraph::FlatHierarchy3D hierarchy;
+UnsignedInt car = hierarchy.add(-1, Matrix4::translation({5.0f, 0.0f, 0.0f}));
+UnsignedInt wheel = hierarchy.add(car, Matrix4::translation({1.0f, -0.5f, 1.0f}));
+
+/* Calculate absolute transformations */
+hierarchy.setClean();
+Matrix4 wheelTransformation = hierarchy.absoluteTransformations()[wheel];
+
+/* Rotate the wheel, next setClean() recalculates only this node */
+hierarchy.setTransformation(wheel, Matrix4::translation({1.0f, -0.5f, 1.0f})*
+                                   Matrix4::rotationZ(15.0_degf));
+hierarchy.setClean();
+/* [FlatHierarchy-usage] */
+static_cast<void>(wheelTransformation);
+}
+
+{
+SceneGraph::FlatHierarchy3D hierarchy;
+Object3D cameraObject;
+SceneGraph::Camera3D camera{cameraObject};
+UnsignedInt car{}, wheel{};
+struct MeshDrawable: SceneGraph::Drawable3D {
+    explicit MeshDrawable(Object3D& object): SceneGraph::Drawable3D{object} {}
+    void draw(const Matrix4&, SceneGraph::Camera3D&) override {}
+};
+/* [FlatHierarchy-drawables] */
+/* Drawables need an object, but its transformation isn't used */
+Object3D placeholder;
+MeshDrawable& carDrawable = *new MeshDrawable{placeholder};
+MeshDrawable& wheelDrawable = *new MeshDrawable{placeholder};
+
+camera.draw(hierarchy.drawableTransformations({
+    {carDrawable, car},
+    {wheelDrawable, wheel}
+}, camera.cameraMatrix()));
+/* [FlatHierarchy-drawables] */
+}
+
+{
+Object3D cameraObject;
+SceneGraph::Camera3D camera{cameraObject};
+SceneGraph::DrawableGroup3D drawableGroup;
+/* [DrawableBatch-usage] */
+struct MeshDrawable: SceneGraph::Drawable3D {
+    Range3D bounds;                 /* Mesh bounds */
+    UnsignedInt shaderId, meshId;
+
+    // ...
+};
+
+/* Add all drawables, sorting them by shader and then by mesh */
+SceneGraph::DrawableBatch3D batch;
+batch.reserve(drawableGroup.size());
+for(std::size_t i = 0; i != drawableGroup.size(); ++i) {
+    auto& drawable = static_cast<MeshDrawable&>(drawableGroup[i]);
+    batch.add(drawable, drawable.bounds,
+        UnsignedLong(drawable.shaderId) << 32 | drawable.meshId);
+}
+
+/* Every frame update the transformations and draw what's visible, culling
+   in all available threads */
+batch.updateTransformations();
+batch.draw(camera, 0);
+/* [DrawableBatch-usage] */
+}
+
 }
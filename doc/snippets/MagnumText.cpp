@@ -34,7 +34,9 @@
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Shaders/Vector.h"
 #include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/BatchLayout.h"
 #include "Magnum/Text/DistanceFieldGlyphCache.h"
+#include "Magnum/Text/LayoutCache.h"
 #include "Magnum/Text/Renderer.h"
 
 using namespace Magnum;
@@ -187,4 +189,50 @@ shader.setTransformationProjectionMatrix(projectionMatrix)
 /* [Renderer-usage2] */
 }
 
+{
+Matrix3 projectionMatrix;
+Containers::Pointer<Text::AbstractFont> font;
+Text::GlyphCache cache{Vector2i{512}};
+Shaders::Vector2D shader;
+/* [BatchLayout-usage] */
+Text::BatchLayout layout{*font, cache, 0.15f};
+
+/* Add static labels and a counter that gets updated every frame */
+layout.add("Score:", {-0.9f, 0.9f});
+layout.add("Lives:", {-0.9f, 0.8f});
+UnsignedInt score = layout.add("0", {-0.5f, 0.9f});
+
+// …
+
+layout.setText(score, "1250");
+/* [BatchLayout-usage] */
+
+/* [BatchRenderer-usage] */
+Text::BatchRenderer2D renderer{layout};
+
+/* Upload only the glyphs that changed since the last frame and draw all
+   texts at once */
+renderer.update();
+shader.setTransformationProjectionMatrix(projectionMatrix)
+    .setColor(0xffffff_rgbf)
+    .bindVectorTexture(cache.texture())
+    .draw(renderer.mesh());
+/* [BatchRenderer-usage] */
+}
+
+{
+Containers::Pointer<Text::AbstractFont> font;
+Text::GlyphCache cache{Vector2i{512}};
+/* [LayoutCache-usage] */
+/* Cache up to 256 most recently laid out texts */
+font->setLayoutCacheCapacity(256);
+
+// …
+
+/* Check how efficient the cache is */
+Debug{} << "Layout cache hit rate:" << font->layoutCache()->hitRate()
+    << "with" << font->layoutCache()->evictionCount() << "evictions";
+/* [LayoutCache-usage] */
+}
+
 }
@@ -40,6 +40,7 @@
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AnimationData.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImportBatch.h"
 #include "Magnum/Trade/MaterialData.h"
 #include "Magnum/Trade/MeshData.h"
 #include "Magnum/Trade/ObjectData2D.h"
@@ -48,6 +49,7 @@
 #include "Magnum/Trade/PbrSpecularGlossinessMaterialData.h"
 #include "Magnum/Trade/PbrMetallicRoughnessMaterialData.h"
 #include "Magnum/Trade/PhongMaterialData.h"
+#include "Magnum/Trade/SceneData.h"
 #ifdef MAGNUM_TARGET_GL
 #include "Magnum/GL/Texture.h"
 #include "Magnum/GL/Mesh.h"
@@ -135,6 +137,37 @@ if(data && data->instanceType() == Trade::ObjectInstanceType3D::Mesh) {
 static_cast<void>(materialIndex);
 }
 
+{
+Containers::Pointer<Trade::AbstractImporter> importer;
+/* [AbstractImporter-zero-copy] */
+importer->setFlags(Trade::ImporterFlag::ZeroCopy);
+importer->openFile("image.tga");
+
+Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+if(!(image->dataFlags() & Trade::DataFlag::Owned)) {
+    // the data point into the opened file, use them before closing the
+    // importer or make a copy
+}
+/* [AbstractImporter-zero-copy] */
+}
+
+{
+PluginManager::Manager<Trade::AbstractImporter> manager;
+/* [ImportBatch-usage] */
+Trade::ImportBatch batch{manager, "AnyImageImporter"};
+if(!batch.openFile("textures.ktx2")) Fatal{} << "Can't open the file";
+
+Containers::Array<Containers::Optional<Trade::ImageData2D>> images{
+    batch.importer().image2DCount()};
+for(UnsignedInt i = 0; i != images.size(); ++i)
+    batch.addImage2D(i, images[i]);
+
+if(!batch.execute()) {
+    // some images failed to import, their slots are Containers::NullOpt
+}
+/* [ImportBatch-usage] */
+}
+
 {
 Containers::Pointer<Trade::AbstractImporter> importer;
 /* [AbstractImporter-setFileCallback] */
@@ -742,4 +775,47 @@ Matrix4 transformation =
 static_cast<void>(transformation);
 }
 
+{
+Containers::Pointer<Trade::AbstractImporter> importer;
+/* [SceneData-usage] */
+Containers::Optional<Trade::SceneData> scene = importer->flatScene(0);
+if(!scene || scene->is2D()) Fatal{} << "Oh no!";
+
+Containers::Array<Int> parents = scene->parentsAsArray();
+Containers::Array<Matrix4> transformations = scene->transformations3DAsArray();
+Containers::Array<Int> meshes = scene->meshesAsArray();
+for(UnsignedInt i = 0; i != scene->objectCount(); ++i) {
+    if(meshes[i] == -1) continue;
+
+    // draw mesh meshes[i] with transformations[i] relative to parents[i] …
+}
+/* [SceneData-usage] */
+static_cast<void>(parents);
+static_cast<void>(transformations);
+}
+
+{
+std::size_t objectCount{};
+/* [SceneData-populating] */
+struct Object {
+    Int parent;
+    Int mesh;
+    Matrix4 transformation;
+};
+
+Containers::Array<char> data{objectCount*sizeof(Object)};
+auto objects = Containers::arrayCast<Object>(data);
+// fill the objects …
+
+Trade::SceneData scene{UnsignedInt(objectCount), std::move(data), {
+    Trade::SceneFieldData{Trade::SceneField::Parent,
+        Containers::stridedArrayView(objects).slice(&Object::parent)},
+    Trade::SceneFieldData{Trade::SceneField::Mesh,
+        Containers::stridedArrayView(objects).slice(&Object::mesh)},
+    Trade::SceneFieldData{Trade::SceneField::Transformation,
+        Containers::stridedArrayView(objects).slice(&Object::transformation)}
+}};
+/* [SceneData-populating] */
+}
+
 }
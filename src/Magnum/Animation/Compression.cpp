@@ -0,0 +1,100 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Compression.h"
+
+#include "Magnum/Math/FunctionsBatch.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/Quaternion.h"
+
+namespace Magnum { namespace Animation {
+
+Vector3us packQuaternion(const Quaternion& quaternion) {
+    CORRADE_ASSERT(quaternion.isNormalized(),
+        "Animation::packQuaternion():" << quaternion << "is not normalized", {});
+
+    /* Find the largest component, flip the quaternion so it's positive */
+    const Vector4 data{quaternion.vector(), quaternion.scalar()};
+    UnsignedInt largest = 0;
+    for(UnsignedInt i = 1; i != 4; ++i)
+        if(Math::abs(data[i]) > Math::abs(data[largest])) largest = i;
+    const Float sign = data[largest] < 0.0f ? -1.0f : 1.0f;
+
+    /* Remap the remaining three from [-1/sqrt(2), 1/sqrt(2)] to [0, 1] and
+       pack them to 15 bits */
+    Vector3us out;
+    for(UnsignedInt i = 0, j = 0; i != 4; ++i) {
+        if(i == largest) continue;
+        const Float normalized = Math::clamp((sign*data[i]*Constants::sqrt2() + 1.0f)*0.5f, 0.0f, 1.0f);
+        out[j++] = Math::pack<UnsignedShort, 15>(normalized);
+    }
+
+    /* The index of the dropped component goes into the top bits */
+    out[0] |= UnsignedShort((largest & 1) << 15);
+    out[1] |= UnsignedShort((largest >> 1) << 15);
+    return out;
+}
+
+Quaternion unpackQuaternion(const Vector3us& packed) {
+    const UnsignedInt largest = (packed[0] >> 15)|((packed[1] >> 15) << 1);
+
+    Vector4 data;
+    Float lengthSquared = 0.0f;
+    for(UnsignedInt i = 0, j = 0; i != 4; ++i) {
+        if(i == largest) continue;
+        data[i] = (Math::unpack<Float, 15>(UnsignedShort(packed[j++] & 0x7fff))*2.0f - 1.0f)*Constants::sqrtHalf();
+        lengthSquared += data[i]*data[i];
+    }
+
+    /* Reconstruct the dropped component. Quantization can make the length
+       slightly larger than 1, so clamp to avoid a NaN. */
+    data[largest] = std::sqrt(Math::max(1.0f - lengthSquared, 0.0f));
+    return {data.xyz(), data.w()};
+}
+
+Range3D quantizeInto(const Containers::StridedArrayView1D<const Vector3>& src, const Containers::StridedArrayView1D<Vector3us>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Animation::quantizeInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), {});
+
+    const Range3D range = Math::minmax(src);
+
+    /* Components with zero range would divide by zero, make them all zero
+       instead */
+    const Vector3 size = range.size();
+    Vector3 scale{NoInit};
+    for(std::size_t i = 0; i != 3; ++i)
+        scale[i] = size[i] > 0.0f ? 1.0f/size[i] : 0.0f;
+
+    for(std::size_t i = 0; i != src.size(); ++i)
+        dst[i] = Math::pack<Vector3us>(Math::clamp((src[i] - range.min())*scale, 0.0f, 1.0f));
+
+    return range;
+}
+
+Vector3 unpackQuantized(const Vector3us& packed) {
+    return Math::unpack<Vector3>(packed);
+}
+
+}}
@@ -0,0 +1,226 @@
+#ifndef Magnum_Animation_Compression_h
+#define Magnum_Animation_Compression_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Animation::packQuaternion(), @ref Magnum::Animation::unpackQuaternion(), @ref Magnum::Animation::quantizeInto(), @ref Magnum::Animation::unpackQuantized(), @ref Magnum::Animation::dequantize(), @ref Magnum::Animation::uniformKeyStep(), @ref Magnum::Animation::reduceKeyframesInPlace()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum { namespace Animation {
+
+/**
+@brief Pack a quaternion into 48 bits
+@m_since_latest
+
+Uses the *smallest three* encoding --- the largest component of a normalized
+quaternion is dropped and reconstructed from the remaining three in
+@ref unpackQuaternion(). The remaining components are in range
+@f$ [-\frac{1}{\sqrt{2}} ; \frac{1}{\sqrt{2}}] @f$ and are stored with 15
+bits of precision each, the index of the dropped component is stored in the
+highest bits of the first two components. The maximal error of a single
+component is around @f$ 5 \cdot 10^{-5} @f$. Expects that the quaternion is
+normalized.
+
+Because @f$ q @f$ and @f$ -q @f$ represent the same rotation, the quaternion
+is flipped so the dropped component is positive. Two consecutive keyframes can
+thus end up in opposite hemispheres, so interpolate the unpacked values with
+@ref Math::slerpShortestPath(const Quaternion<T>&, const Quaternion<T>&, T)
+or @ref Math::lerpShortestPath(const Quaternion<T>&, const Quaternion<T>&, T):
+
+@snippet MagnumAnimation.cpp packQuaternion
+@experimental
+*/
+MAGNUM_EXPORT Vector3us packQuaternion(const Quaternion& quaternion);
+
+/**
+@brief Unpack a quaternion packed with @ref packQuaternion()
+@m_since_latest
+
+Usable as an unpacker function in @ref unpack() and @ref unpackEase().
+@experimental
+*/
+MAGNUM_EXPORT Quaternion unpackQuaternion(const Vector3us& packed);
+
+/**
+@brief Quantize vectors into 16 bits per component
+@param[in]  src     Source vectors
+@param[out] dst     Destination quantized vectors
+@return Range of the source vectors
+@m_since_latest
+
+Each component is remapped from the returned range to @f$ [0 ; 1] @f$ and
+then packed using @ref Math::pack(). Components that have the same value in
+all vectors are packed to zero. The maximal error is a @f$ 2^{-17} @f$
+fraction of the range size in given component. Expects that @p src and @p dst
+have the same size.
+
+Interpolate the quantized values with @ref unpackQuantized() as the unpacker
+and then apply the returned range with @ref dequantize(). Because the
+remapping is affine, it gives the same result as interpolating the dequantized
+values with @ref Math::lerp():
+
+@snippet MagnumAnimation.cpp quantizeInto
+@experimental
+*/
+MAGNUM_EXPORT Range3D quantizeInto(const Containers::StridedArrayView1D<const Vector3>& src, const Containers::StridedArrayView1D<Vector3us>& dst);
+
+/**
+@brief Unpack a vector quantized with @ref quantizeInto()
+@m_since_latest
+
+Returns the value in the @f$ [0 ; 1] @f$ range, pass it to @ref dequantize()
+together with the range returned from @ref quantizeInto() to get the original
+value back. Usable as an unpacker function in @ref unpack() and
+@ref unpackEase().
+@experimental
+*/
+MAGNUM_EXPORT Vector3 unpackQuantized(const Vector3us& packed);
+
+/**
+@brief Dequantize a vector
+@param range        Range returned from @ref quantizeInto()
+@param normalized   Value returned from @ref unpackQuantized() or an
+    interpolation of those
+@m_since_latest
+
+@experimental
+*/
+inline Vector3 dequantize(const Range3D& range, const Vector3& normalized) {
+    return range.min() + normalized*range.size();
+}
+
+/**
+@brief Check whether keys are uniformly spaced
+@param keys         Keys
+@param maxError     Max allowed difference from an uniformly spaced key
+@return Distance between two consecutive keys or @ref Containers::NullOpt
+@m_since_latest
+
+If all keys are at most @p maxError far from a key uniformly distributed
+between the first and last key, returns the distance between two consecutive
+keys. The keys can be then dropped and the track evaluated with
+@ref interpolateUniform() using the first key and the returned step. Returns
+@ref Containers::NullOpt if the keys aren't uniformly spaced, if they're not
+increasing or if there's less than two keys.
+@experimental
+*/
+template<class K> Containers::Optional<K> uniformKeyStep(const Containers::StridedArrayView1D<const K>& keys, K maxError);
+
+/**
+@brief Remove keyframes that can be reconstructed from their neighbors
+@param keys         Keys
+@param values       Values
+@param interpolator Interpolator function
+@param maxError     Max allowed error
+@param distance     Distance function
+@return Count of keyframes that were kept
+@m_since_latest
+
+Greedily drops keyframes that can be interpolated from the closest kept
+keyframes before and after with an error that's not larger than @p maxError.
+The error of each dropped keyframe is measured as @p distance between its
+original value and the value interpolated with @p interpolator at its key. The
+first and last keyframes are always kept. The kept keyframes are moved to the
+front of @p keys and @p values, preserving their order, the rest is left in an
+unspecified state.
+
+The @p distance is a function taking two values and returning a @ref Float,
+such as a difference of two positions or an angle between two rotations:
+
+@snippet MagnumAnimation.cpp reduceKeyframesInPlace
+
+The reduction needs to be done before quantization and the reduced keys are
+no longer uniformly spaced. Expects that @p keys and @p values have the same
+size.
+@experimental
+*/
+template<class K, class V, class D> std::size_t reduceKeyframesInPlace(const Containers::StridedArrayView1D<K>& keys, const Containers::StridedArrayView1D<V>& values, V(*interpolator)(const V&, const V&, Float), Float maxError, D distance);
+
+template<class K> Containers::Optional<K> uniformKeyStep(const Containers::StridedArrayView1D<const K>& keys, const K maxError) {
+    if(keys.size() < 2) return {};
+
+    const K step = (keys[keys.size() - 1] - keys[0])/K(keys.size() - 1);
+    if(!(step > K{})) return {};
+
+    for(std::size_t i = 1; i != keys.size() - 1; ++i)
+        if(Math::abs(keys[i] - (keys[0] + step*K(i))) > maxError) return {};
+
+    return step;
+}
+
+template<class K, class V, class D> std::size_t reduceKeyframesInPlace(const Containers::StridedArrayView1D<K>& keys, const Containers::StridedArrayView1D<V>& values, V(*const interpolator)(const V&, const V&, Float), const Float maxError, D distance) {
+    CORRADE_ASSERT(keys.size() == values.size(),
+        "Animation::reduceKeyframesInPlace(): expected key and value views to have the same size but got" << keys.size() << "and" << values.size(), {});
+
+    if(keys.size() < 3) return keys.size();
+
+    /* The first keyframe is always kept. The output is never ahead of the
+       input so the kept keyframes can be written in place, the last kept
+       keyframe is copied aside as it can get overwritten. */
+    std::size_t count = 1;
+    std::size_t anchor = 0;
+    K anchorKey = keys[0];
+    V anchorValue = values[0];
+    for(std::size_t i = 2; i != keys.size(); ++i) {
+        /* Check if all keyframes between the anchor and i can be
+           interpolated from these two */
+        bool fits = true;
+        for(std::size_t j = anchor + 1; j != i; ++j) {
+            const Float t = Math::lerpInverted(Float(anchorKey), Float(keys[i]), Float(keys[j]));
+            if(distance(interpolator(anchorValue, values[i], t), values[j]) > maxError) {
+                fits = false;
+                break;
+            }
+        }
+        if(fits) continue;
+
+        /* If not, keep the previous keyframe and continue from there */
+        anchor = i - 1;
+        anchorKey = keys[anchor];
+        anchorValue = values[anchor];
+        keys[count] = anchorKey;
+        values[count] = anchorValue;
+        ++count;
+    }
+
+    /* The last keyframe is always kept */
+    keys[count] = keys[keys.size() - 1];
+    values[count] = values[values.size() - 1];
+    return count + 1;
+}
+
+}}
+
+#endif
@@ -26,7 +26,7 @@
 */
 
 /** @file
- * @brief Alias @ref Magnum::Animation::ResultOf, enum @ref Magnum::Animation::Interpolation. @ref Magnum::Animation::Extrapolation, function @ref Magnum::Animation::interpolatorFor(), @ref Magnum::Animation::interpolate(), @ref Magnum::Animation::interpolateStrict(), @ref Magnum::Animation::ease(), @ref Magnum::Animation::easeClamped() @ref Magnum::Animation::unpack(), @ref Magnum::Animation::unpackEase(), @ref Magnum::Animation::unpackEaseClamped()
+ * @brief Alias @ref Magnum::Animation::ResultOf, enum @ref Magnum::Animation::Interpolation. @ref Magnum::Animation::Extrapolation, function @ref Magnum::Animation::interpolatorFor(), @ref Magnum::Animation::interpolate(), @ref Magnum::Animation::interpolateStrict(), @ref Magnum::Animation::interpolateInto(), @ref Magnum::Animation::interpolateUniform(), @ref Magnum::Animation::ease(), @ref Magnum::Animation::easeClamped() @ref Magnum::Animation::unpack(), @ref Magnum::Animation::unpackEase(), @ref Magnum::Animation::unpackEaseClamped()
  */
 
 #include <Corrade/Containers/StridedArrayView.h>
@@ -175,9 +175,10 @@ MAGNUM_EXPORT Debug& operator<<(Debug& debug, Extrapolation value);
 @param frame        Frame at which to interpolate
 @param hint         Hint for keyframe search
 
-Does a linear search over the keyframes until it finds last keyframe which is
-not larger than @p frame. Once the keyframe is found, reference to it and the immediately following keyframe is passed to @p interpolator along with
-calculated interpolation factor, returning the interpolated value.
+Searches the keyframes for the last keyframe which is not larger than
+@p frame. Once the keyframe is found, reference to it and the immediately
+following keyframe is passed to @p interpolator along with calculated
+interpolation factor, returning the interpolated value.
 
 -   In case the first keyframe is already larger than @p frame or @p frame is
     larger or equal to the last keyframe, either the first two or last two
@@ -187,14 +188,20 @@ calculated interpolation factor, returning the interpolated value.
     the interpolator.
 -   In case no keyframes are present, default-constructed value is returned.
 
-The @p hint parameter hints where to start the linear search and is updated
-with keyframe index matching @p frame. If @p frame is earlier than @p hint, the
-search is restarted from the beginning.
+The @p hint parameter hints where to start the search and is updated with
+keyframe index matching @p frame. The search first checks the keyframe at
+@p hint and its immediate neighbors, which is the common case when advancing
+an animation by small steps, and then gallops with exponentially growing steps
+forward or backward from @p hint, finishing with a binary search. That makes
+the lookup @f$ \mathcal{O}(1) @f$ for sequential playback and
+@f$ \mathcal{O}(\log n) @f$ for arbitrary seeks, independently of where the
+previous lookup ended.
 
 Used internally from @ref Track::at() / @ref TrackView::at(), see @ref Track
 documentation for more information.
 
-@see @ref interpolateStrict(), @ref Math::select(), @ref Math::lerp(),
+@see @ref interpolateStrict(), @ref interpolateInto(), @ref Math::select(),
+    @ref Math::lerp(),
     @ref Math::slerp(), @ref Math::sclerp()
 @experimental
 */
@@ -203,12 +210,12 @@ template<class K, class V, class R = ResultOf<V>> R interpolate(const Containers
 /**
 @brief Interpolate animation value with strict constraints
 
-Does a linear search over the keyframes until it finds last keyframe which is
-not larger than @p frame. Once the keyframe is found, reference to it and the immediately following keyframe is passed to @p interpolator along with
-calculated interpolation factor, returning the interpolated value. The @p hint
-parameter hints where to start the linear search and is updated with keyframe
-index matching @p frame. If @p frame is earlier than @p hint, the search is
-restarted from the beginning.
+Searches the keyframes for the last keyframe which is not larger than
+@p frame. Once the keyframe is found, reference to it and the immediately
+following keyframe is passed to @p interpolator along with calculated
+interpolation factor, returning the interpolated value. The @p hint parameter
+hints where to start the search and is updated with keyframe index matching
+@p frame, see @ref interpolate() for details about the search.
 
 This is a stricter but more performant version of @ref interpolate() with
 implicit @ref Extrapolation::Extrapolated behavior. Expects that there are
@@ -223,6 +230,61 @@ Used internally from @ref Track::atStrict() / @ref TrackView::atStrict(), see
 */
 template<class K, class V, class R = ResultOf<V>> R interpolateStrict(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView1D<const V>& values, R(*interpolator)(const V&, const V&, Float), K frame, std::size_t& hint);
 
+/**
+@brief Interpolate multiple animation values sharing the same keys
+@tparam K           Key type
+@tparam V           Value type
+@tparam R           Result type
+@param keys         Keys
+@param values       Values. First dimension is keyframes, second is tracks.
+@param before       Extrapolation mode before first keyframe
+@param after        Extrapolation mode after last keyframe
+@param interpolator Interpolator function
+@param frame        Frame at which to interpolate
+@param hint         Hint for keyframe search
+@param destination  Where to put the results
+@m_since_latest
+
+Equivalent to calling @ref interpolate() for each column of @p values and
+putting the result into the corresponding item of @p destination, but the
+keyframe search and interpolation factor calculation is done only once for all
+tracks. For best memory locality, the @p values should have the second
+dimension contiguous --- i.e., values of all tracks for a particular keyframe
+next to each other. Expects that @p keys have the same size as the first
+dimension of @p values and @p destination has the same size as the second
+dimension of @p values.
+
+Used internally from @ref Player::addBatch().
+@experimental
+*/
+template<class K, class V, class R = ResultOf<V>> void interpolateInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, Extrapolation before, Extrapolation after, R(*interpolator)(const V&, const V&, Float), K frame, std::size_t& hint, const Containers::StridedArrayView1D<R>& destination);
+
+/**
+@brief Interpolate animation value with uniformly spaced keys
+@tparam K           Key type
+@tparam V           Value type
+@tparam R           Result type
+@param begin        Key of the first keyframe
+@param step         Distance between two consecutive keys
+@param values       Values
+@param before       Extrapolation mode before first keyframe
+@param after        Extrapolation mode after last keyframe
+@param interpolator Interpolator function
+@param frame        Frame at which to interpolate
+@m_since_latest
+
+Equivalent to calling @ref interpolate() with keys
+@f$ k_i = b + i s @f$, where @f$ b @f$ is @p begin and @f$ s @f$ is @p step,
+but without the keys having to be stored anywhere. As the keyframe index is
+calculated directly from @p frame, there's no search and no hint needed.
+Useful for sampled animations such as motion capture data, where the keys are
+often a significant part of the data size. Use @ref uniformKeyStep() to check
+whether a key list can be replaced with @p begin and @p step. Expects that
+@p step is positive if there's more than one keyframe.
+@experimental
+*/
+template<class K, class V, class R = ResultOf<V>> R interpolateUniform(K begin, K step, const Containers::StridedArrayView1D<const V>& values, Extrapolation before, Extrapolation after, R(*interpolator)(const V&, const V&, Float), K frame);
+
 /**
 @brief Combine easing function and an interpolator
 
@@ -260,8 +322,8 @@ expressions give the same result:
 
 @see @ref unpackEase()
 */
-template<class T, class V, ResultOf<V>(*interpolator)(const V&, const V&, Float), V(*unpacker)(const T&)> constexpr auto unpack() -> ResultOf<V>(*)(const V&, const V&, Float) {
-    return [](const V& a, const V& b, Float t) { return interpolator(unpacker(a), unpacker(b), t); };
+template<class T, class V, ResultOf<V>(*interpolator)(const V&, const V&, Float), V(*unpacker)(const T&)> constexpr auto unpack() -> ResultOf<V>(*)(const T&, const T&, Float) {
+    return [](const T& a, const T& b, Float t) { return interpolator(unpacker(a), unpacker(b), t); };
 }
 
 /**
@@ -274,8 +336,8 @@ give the same result:
 
 @snippet MagnumAnimation.cpp unpackEase
 */
-template<class T, class V, ResultOf<V>(*interpolator)(const V&, const V&, Float), V(*unpacker)(const T&), Float(*easer)(Float)> constexpr auto unpackEase() -> ResultOf<V>(*)(const V&, const V&, Float) {
-    return [](const V& a, const V& b, Float t) { return interpolator(unpacker(a), unpacker(b), easer(t)); };
+template<class T, class V, ResultOf<V>(*interpolator)(const V&, const V&, Float), V(*unpacker)(const T&), Float(*easer)(Float)> constexpr auto unpackEase() -> ResultOf<V>(*)(const T&, const T&, Float) {
+    return [](const T& a, const T& b, Float t) { return interpolator(unpacker(a), unpacker(b), easer(t)); };
 }
 
 /**
@@ -285,8 +347,8 @@ In addition to @ref unpackEase() clamps value coming to @p easer to range
 @f$ [0 ; 1] @f$. Useful when extrapolating with @ref Easing functions that have
 bad behavior outside of this range.
 */
-template<class T, class V, ResultOf<V>(*interpolator)(const V&, const V&, Float), V(*unpacker)(const T&), Float(*easer)(Float)> constexpr auto unpackEaseClamped() -> ResultOf<V>(*)(const V&, const V&, Float) {
-    return [](const V& a, const V& b, Float t) { return interpolator(unpacker(a), unpacker(b), easer(Math::clamp(t, 0.0f, 1.0f))); };
+template<class T, class V, ResultOf<V>(*interpolator)(const V&, const V&, Float), V(*unpacker)(const T&), Float(*easer)(Float)> constexpr auto unpackEaseClamped() -> ResultOf<V>(*)(const T&, const T&, Float) {
+    return [](const T& a, const T& b, Float t) { return interpolator(unpacker(a), unpacker(b), easer(Math::clamp(t, 0.0f, 1.0f))); };
 }
 
 namespace Implementation {
@@ -415,6 +477,51 @@ template<class V, class R> auto interpolatorFor(Interpolation interpolation) ->
     return Implementation::TypeTraits<typename std::remove_const<V>::type, R>::interpolator(interpolation);
 }
 
+namespace Implementation {
+
+/* Returns the index of the last keyframe that's not larger than frame,
+   clamped to [0, keys.size() - 2]. Expects at least two keys. The keyframe at
+   hint and the one right after are checked first, which is the common case
+   for sequential playback; if that misses, it gallops from hint in the
+   direction of frame with exponentially growing steps and then does a binary
+   search in the bracketed range. */
+template<class K> std::size_t findKeyframe(const Containers::StridedArrayView1D<const K>& keys, const K frame, std::size_t hint) {
+    const std::size_t last = keys.size() - 2;
+    if(hint > last) hint = last;
+
+    /* Invariant for the binary search below: keys[lo] <= frame (unless lo is
+       0) and frame < keys[hi] (unless hi is last + 1) */
+    std::size_t lo, hi;
+    if(frame < keys[hint]) {
+        if(!hint) return 0;
+        hi = hint;
+        lo = hint - 1;
+        for(std::size_t step = 1; lo && frame < keys[lo]; step *= 2) {
+            hi = lo;
+            lo = lo > step ? lo - step : 0;
+        }
+        if(frame < keys[lo]) return 0;
+    } else {
+        lo = hint;
+        hi = hint + 1;
+        for(std::size_t step = 1; hi <= last && frame >= keys[hi]; step *= 2) {
+            lo = hi;
+            hi = lo + step;
+        }
+        if(hi > last + 1) hi = last + 1;
+    }
+
+    while(hi - lo > 1) {
+        const std::size_t mid = lo + (hi - lo)/2;
+        if(frame >= keys[mid]) lo = mid;
+        else hi = mid;
+    }
+
+    return lo;
+}
+
+}
+
 template<class K, class V, class R> R interpolate(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView1D<const V>& values, const Extrapolation before, const Extrapolation after, R(*const interpolator)(const V&, const V&, Float), K frame, std::size_t& hint) {
     CORRADE_ASSERT(keys.size() == values.size(), "Animation::interpolate(): keys and values don't have the same size", {});
 
@@ -430,12 +537,8 @@ template<class K, class V, class R> R interpolate(const Containers::StridedArray
         return interpolator(values[0], values[0], 0.0f);
     }
 
-    /* Rewind from the beginning if hint is too late */
-    if(hint >= keys.size() || frame < keys[hint]) hint = 0;
-
-    /* Go through the keys until we find a pair that is around given time */
-    while(hint + 2 < keys.size() && frame >= keys[hint + 1])
-        ++hint;
+    /* Find a pair of keys that is around given time */
+    hint = Implementation::findKeyframe(keys, frame, hint);
 
     /* Special extrapolation outside of range. Usual extrapolation is handled
        below. */
@@ -455,17 +558,104 @@ template<class K, class V, class R> R interpolateStrict(const Containers::Stride
     CORRADE_ASSERT(keys.size() >= 2, "Animation::interpolateStrict(): at least two keyframes required", {});
     CORRADE_ASSERT(keys.size() == values.size(), "Animation::interpolateStrict(): keys and values don't have the same size", {});
 
-    /* Rewind from the beginning if hint is too late */
-    if(hint >= keys.size() || frame < keys[hint]) hint = 0;
-
-    /* Go through the keys until we find a pair that is around given time */
-    while(hint + 2 < keys.size() && frame >= keys[hint + 1])
-        ++hint;
+    /* Find a pair of keys that is around given time */
+    hint = Implementation::findKeyframe(keys, frame, hint);
 
     return interpolator(values[hint], values[hint + 1],
         Math::lerpInverted(Float(keys[hint]), Float(keys[hint + 1]), Float(frame)));
 }
 
+template<class K, class V, class R> void interpolateInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, const Extrapolation before, const Extrapolation after, R(*const interpolator)(const V&, const V&, Float), K frame, std::size_t& hint, const Containers::StridedArrayView1D<R>& destination) {
+    CORRADE_ASSERT(keys.size() == values.size()[0], "Animation::interpolateInto(): expected" << keys.size() << "keyframes in values but got" << values.size()[0], );
+    CORRADE_ASSERT(destination.size() == values.size()[1], "Animation::interpolateInto(): expected" << values.size()[1] << "destination items but got" << destination.size(), );
+
+    /* No data, return default-constructed values */
+    if(!keys.size()) {
+        for(R& i: destination) i = R{};
+        return;
+    }
+
+    /* Only one frame, return it verbatim (or default-constructed, if
+       desired) */
+    if(keys.size() == 1) {
+        if((frame < keys[0] && before == Extrapolation::DefaultConstructed) ||
+           (frame > keys[0] && after == Extrapolation::DefaultConstructed)) {
+            for(R& i: destination) i = R{};
+            return;
+        }
+
+        const Containers::StridedArrayView1D<const V> first = values[0];
+        for(std::size_t i = 0; i != destination.size(); ++i)
+            destination[i] = interpolator(first[i], first[i], 0.0f);
+        return;
+    }
+
+    /* Find a pair of keys that is around given time, once for all tracks */
+    hint = Implementation::findKeyframe(keys, frame, hint);
+
+    /* Special extrapolation outside of range. Usual extrapolation is handled
+       below. */
+    if(frame < keys[hint]) {
+        if(before == Extrapolation::DefaultConstructed) {
+            for(R& i: destination) i = R{};
+            return;
+        }
+        if(before == Extrapolation::Constant) frame = keys[hint];
+    } else if(frame >= keys[hint + 1]) {
+        if(after == Extrapolation::DefaultConstructed) {
+            for(R& i: destination) i = R{};
+            return;
+        }
+        if(after == Extrapolation::Constant) frame = keys[hint + 1];
+    }
+
+    const Float t = Math::lerpInverted(Float(keys[hint]), Float(keys[hint + 1]), Float(frame));
+    const Containers::StridedArrayView1D<const V> a = values[hint];
+    const Containers::StridedArrayView1D<const V> b = values[hint + 1];
+    for(std::size_t i = 0; i != destination.size(); ++i)
+        destination[i] = interpolator(a[i], b[i], t);
+}
+
+template<class K, class V, class R> R interpolateUniform(const K begin, const K step, const Containers::StridedArrayView1D<const V>& values, const Extrapolation before, const Extrapolation after, R(*const interpolator)(const V&, const V&, Float), const K frame) {
+    /* No data, return default-constructed value */
+    if(!values.size()) return {};
+
+    /* Only one frame, return it verbatim (or default-constructed, if desired) */
+    if(values.size() == 1) {
+        if((frame < begin && before == Extrapolation::DefaultConstructed) ||
+           (frame > begin && after == Extrapolation::DefaultConstructed))
+            return {};
+
+        return interpolator(values[0], values[0], 0.0f);
+    }
+
+    CORRADE_ASSERT(step > K{}, "Animation::interpolateUniform(): expected a positive step but got" << step, {});
+
+    /* Calculate the keyframe directly instead of searching for it. Special
+       extrapolation outside of range is handled the same way as in
+       interpolate(). */
+    /* Subtracting in floats, as frame - begin would wrap around for unsigned
+       key types when the frame is before the first key */
+    const Float position = (Float(frame) - Float(begin))/Float(step);
+    const std::size_t last = values.size() - 1;
+    std::size_t i;
+    Float t;
+    if(position < 0.0f) {
+        if(before == Extrapolation::DefaultConstructed) return {};
+        i = 0;
+        t = before == Extrapolation::Constant ? 0.0f : position;
+    } else if(position >= Float(last)) {
+        if(after == Extrapolation::DefaultConstructed) return {};
+        i = last - 1;
+        t = after == Extrapolation::Constant ? 1.0f : position - Float(i);
+    } else {
+        i = std::size_t(position);
+        t = position - Float(i);
+    }
+
+    return interpolator(values[i], values[i + 1], t);
+}
+
 }}
 
 #endif
@@ -118,6 +118,18 @@ interpolated value changes, which is useful for triggering other events. See
 @ref addRawCallback() that allows for greater control and further performance
 optimizations. See its documentation for a usage example code snippet.
 
+@subsection Animation-Player-setup-batch Batched tracks
+
+When animating a large amount of tracks that share the same keys --- for
+example all joints of a skeleton sampled at the same frames --- it's more
+efficient to add them all at once using @ref addBatch(). The values are passed
+as a 2D view with keyframes in the first dimension and tracks in the second,
+and the results are written into a contiguous destination view. The keyframe
+search and interpolation factor calculation is then done just once for the
+whole batch, with no indirect call per track:
+
+@snippet MagnumAnimation.cpp Player-usage-batch
+
 The animation is implicitly played only once, use @ref setPlayCount() to set a
 number of repeats or make it repeat indefinitely. By default, the
 @ref duration() of an animation is calculated implicitly from all added tracks.
@@ -265,6 +277,35 @@ template<class T, class K
          */
         static void advance(T time, std::initializer_list<Containers::Reference<Player<T, K>>> players);
 
+        /**
+         * @brief Advance multiple players at the same time in parallel
+         * @param time          Time
+         * @param players       Players to advance
+         * @param threadCount   Count of threads to use. @cpp 0 @ce means all
+         *      available hardware threads.
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref advance(T) for each item in @p players,
+         * except that the work is split into chunks of players processed on
+         * up to @p threadCount threads. Only tracks added with @ref add() and
+         * batches added with @ref addBatch() are advanced on the worker
+         * threads. Tracks with callbacks added with @ref addWithCallback(),
+         * @ref addWithCallbackOnChange() and @ref addRawCallback() are
+         * advanced afterwards on the calling thread, in order of @p players
+         * and in order they were added to each player, which means the
+         * callbacks can safely access any state the application has. As a
+         * consequence, the callbacks are fired only after all destinations of
+         * all players were updated. The players are expected to be all
+         * distinct and the destinations of tracks in different players
+         * shouldn't overlap.
+         *
+         * Because the threads are spawned for each call, it only pays off
+         * when advancing thousands of players at once. With @p threadCount
+         * set to @cpp 1 @ce or for small amounts of players it's done on the
+         * calling thread only.
+         */
+        static void advance(T time, const Containers::StridedArrayView1D<Player<T, K>>& players, UnsignedInt threadCount = 1);
+
         /** @brief Constructor */
         explicit Player();
 
@@ -347,8 +388,11 @@ template<class T, class K
         /**
          * @brief Whether the player is empty
          *
-         * @see @ref size(), @ref add(), @ref addWithCallback(),
-         *      @ref addWithCallbackOnChange(), @ref addRawCallback()
+         * Returns @cpp true @ce if there are neither any tracks nor any track
+         * batches.
+         * @see @ref size(), @ref batchCount(), @ref add(),
+         *      @ref addWithCallback(), @ref addWithCallbackOnChange(),
+         *      @ref addRawCallback(), @ref addBatch()
          */
         bool isEmpty() const;
 
@@ -368,6 +412,14 @@ template<class T, class K
          */
         const TrackViewStorage<const K>& track(std::size_t i) const;
 
+        /**
+         * @brief Count of track batches managed by this player
+         * @m_since_latest
+         *
+         * @see @ref isEmpty(), @ref size(), @ref addBatch()
+         */
+        std::size_t batchCount() const;
+
         /**
          * @brief Add a track with a result destination
          *
@@ -633,6 +685,39 @@ template<class T, class K
         }
         #endif
 
+        /**
+         * @brief Add a batch of tracks sharing the same keys
+         * @m_since_latest
+         *
+         * The @p values are expected to have keyframes in the first
+         * dimension and tracks in the second, with the first dimension having
+         * the same size as @p keys and the second dimension having the same
+         * size as @p destination. For best memory locality, the second
+         * dimension should be contiguous. Each item of @p destination is
+         * updated with a value interpolated from the corresponding column of
+         * @p values after each call to @ref advance() as long as the
+         * animation is playing, using @ref interpolateInto().
+         *
+         * Batches are advanced after all tracks added with @ref add(),
+         * @ref addWithCallback(), @ref addWithCallbackOnChange() and
+         * @ref addRawCallback(), in the order they were added. The views are
+         * not copied and you have to ensure the data stay in scope for the
+         * whole lifetime of the @ref Player instance.
+         * @see @ref Animation-Player-setup-batch
+         */
+        template<class V, class R = ResultOf<V>> Player<T, K>& addBatch(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, R(*interpolator)(const V&, const V&, Float), const Containers::StridedArrayView1D<R>& destination, Extrapolation before, Extrapolation after);
+
+        /**
+         * @overload
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref addBatch(const Containers::StridedArrayView1D<const K>&, const Containers::StridedArrayView2D<const V>&, R(*)(const V&, const V&, Float), const Containers::StridedArrayView1D<R>&, Extrapolation, Extrapolation)
+         * with both @p before and @p after set to @p extrapolation.
+         */
+        template<class V, class R = ResultOf<V>> Player<T, K>& addBatch(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, R(*interpolator)(const V&, const V&, Float), const Containers::StridedArrayView1D<R>& destination, Extrapolation extrapolation = Extrapolation::Constant) {
+            return addBatch(keys, values, interpolator, destination, extrapolation, extrapolation);
+        }
+
         /**
          * @brief State
          *
@@ -763,7 +848,8 @@ template<class T, class K
          * tracks added with @ref add(), @ref addWithCallback() or
          * @ref addWithCallbackOnChange() in order they were added and updates
          * the destination locations and/or fires the callbacks with
-         * interpolation results.
+         * interpolation results. After that, all track batches added with
+         * @ref addBatch() are evaluated in order they were added.
          *
          * If @ref state() is @ref State::Paused or @ref State::Stopped, the
          * function does nothing. If @p time is less than time that was passed
@@ -803,12 +889,15 @@ template<class T, class K
 
     private:
         struct Track;
+        struct Batch;
 
-        Player<T, K>& addInternal(const TrackViewStorage<const K>& track, void (*advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), void* destination, void(*userCallback)(), void* userCallbackData);
+        Player<T, K>& addInternal(const TrackViewStorage<const K>& track, void (*advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), void* destination, void(*userCallback)(), void* userCallbackData, bool hasCallback);
+        Player<T, K>& addBatchInternal(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView3D<const char>& values, void(*interpolator)(), const Containers::StridedArrayView2D<char>& destination, Extrapolation before, Extrapolation after, void(*advancer)(const Containers::StridedArrayView1D<const K>&, const Containers::StridedArrayView3D<const char>&, void(*)(), const Containers::StridedArrayView2D<char>&, Extrapolation, Extrapolation, K, std::size_t&));
 
         Containers::Optional<std::pair<UnsignedInt, K>> elapsedInternal(T time, T& updatedStartTime, T& updatedPauseTime, State& updatedState) const;
 
         Containers::Array<Track> _tracks;
+        Containers::Array<Batch> _batches;
         Math::Range1D<K> _duration;
         UnsignedInt _playCount{1};
         State _state{State::Stopped};
@@ -820,7 +909,17 @@ template<class T, class K> template<class V, class R> Player<T, K>& Player<T, K>
     return addInternal(track,
         [](const TrackViewStorage<const K>& track, K key, std::size_t& hint, void* destination, void(*)(), void*) {
             *static_cast<R*>(destination) = static_cast<const TrackView<const K, const V, R>&>(track).at(key, hint);
-        }, &destination, nullptr, nullptr);
+        }, &destination, nullptr, nullptr, false);
+}
+
+template<class T, class K> template<class V, class R> Player<T, K>& Player<T, K>::addBatch(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, R(*const interpolator)(const V&, const V&, Float), const Containers::StridedArrayView1D<R>& destination, const Extrapolation before, const Extrapolation after) {
+    /* The views are type-erased to keep the storage non-templated, the last
+       dimension is restored back in the advancer. Sizes are checked in
+       addBatchInternal(). */
+    return addBatchInternal(keys, Containers::arrayCast<3, const char>(values), reinterpret_cast<void(*)()>(interpolator), Containers::arrayCast<2, char>(destination), before, after,
+        [](const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView3D<const char>& values, void(*interpolator)(), const Containers::StridedArrayView2D<char>& destination, Extrapolation before, Extrapolation after, K key, std::size_t& hint) {
+            interpolateInto(keys, Containers::arrayCast<2, const V>(values), before, after, reinterpret_cast<R(*)(const V&, const V&, Float)>(interpolator), key, hint, Containers::arrayCast<1, R>(destination));
+        });
 }
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -830,7 +929,7 @@ template<class T, class K> template<class V, class R, class Callback> Player<T,
         [](const TrackViewStorage<const K>& track, K key, std::size_t& hint, void*, void(*callback)(), void* userData) {
             /** @todo try to use atStrict() if possible */
             reinterpret_cast<void(*)(K, const R&, void*)>(callback)(key, static_cast<const TrackView<const K, const V, R>&>(track).at(key, hint), userData);
-        }, nullptr, reinterpret_cast<void(*)()>(callbackPtr), userData);
+        }, nullptr, reinterpret_cast<void(*)()>(callbackPtr), userData, true);
 }
 
 template<class T, class K> template<class V, class R, class U, class Callback> Player<T, K>& Player<T, K>::addWithCallback(const TrackView<const K, const V, R>& track, Callback callback, U& userData) {
@@ -839,7 +938,7 @@ template<class T, class K> template<class V, class R, class U, class Callback> P
         [](const TrackViewStorage<const K>& track, K key, std::size_t& hint, void*, void(*callback)(), void* userData) {
             /** @todo try to use atStrict() if possible */
             reinterpret_cast<void(*)(K, const R&, U&)>(callback)(key, static_cast<const TrackView<const K, const V, R>&>(track).at(key, hint), *static_cast<U*>(userData));
-        }, nullptr, reinterpret_cast<void(*)()>(callbackPtr), &userData);
+        }, nullptr, reinterpret_cast<void(*)()>(callbackPtr), &userData, true);
 }
 
 template<class T, class K> template<class V, class R, class Callback> Player<T, K>& Player<T, K>::addWithCallbackOnChange(const TrackView<const K, const V, R>& track, Callback callback, R& destination, void* userData) {
@@ -851,7 +950,7 @@ template<class T, class K> template<class V, class R, class Callback> Player<T,
             if(result == *static_cast<R*>(destination)) return;
             reinterpret_cast<void(*)(K, const R&, void*)>(callback)(key, result, userData);
             *static_cast<R*>(destination) = result;
-        }, &destination, reinterpret_cast<void(*)()>(callbackPtr), userData);
+        }, &destination, reinterpret_cast<void(*)()>(callbackPtr), userData, true);
 }
 
 template<class T, class K> template<class V, class R, class U, class Callback> Player<T, K>& Player<T, K>::addWithCallbackOnChange(const TrackView<const K, const V, R>& track, Callback callback, R& destination, U& userData) {
@@ -863,12 +962,12 @@ template<class T, class K> template<class V, class R, class U, class Callback> P
             if(result == *static_cast<R*>(destination)) return;
             reinterpret_cast<void(*)(K, const R&, U&)>(callback)(key, result, *static_cast<U*>(userData));
             *static_cast<R*>(destination) = result;
-        }, &destination, reinterpret_cast<void(*)()>(callbackPtr), &userData);
+        }, &destination, reinterpret_cast<void(*)()>(callbackPtr), &userData, true);
 }
 
 template<class T, class K> template<class V, class R, class Callback> Player<T, K>& Player<T, K>::addRawCallback(const TrackView<const K, const V, R>& track, Callback callback, void* destination, void(*userCallback)(), void* userData) {
     auto callbackPtr = static_cast<void(*)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*)>(callback);
-    return addInternal(track, callbackPtr, destination, userCallback, userData);
+    return addInternal(track, callbackPtr, destination, userCallback, userData, true);
 }
 #endif
 
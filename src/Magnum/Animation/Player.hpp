@@ -35,6 +35,8 @@
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Reference.h>
 
+#include "Magnum/Implementation/parallelFor.h"
+
 namespace Magnum { namespace Animation {
 
 namespace Implementation {
@@ -61,13 +63,28 @@ namespace Implementation {
 template<class T, class K> struct Player<T, K>::Track  {
     /* Not sure why is this still needed for emplace_back(). It's 2018,
        COME ON  ¯\_(ツ)_/¯ */
-    /*implicit*/ Track(const TrackViewStorage<const K>& track, void (*advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), void* destination, void(*userCallback)(), void* userCallbackData, std::size_t hint) noexcept: track{track}, advancer{advancer}, destination{destination}, userCallback{userCallback}, userCallbackData{userCallbackData}, hint{hint} {}
+    /*implicit*/ Track(const TrackViewStorage<const K>& track, void (*advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), void* destination, void(*userCallback)(), void* userCallbackData, bool hasCallback, std::size_t hint) noexcept: track{track}, advancer{advancer}, destination{destination}, userCallback{userCallback}, userCallbackData{userCallbackData}, hasCallback{hasCallback}, hint{hint} {}
 
     TrackViewStorage<const K> track;
     void (*advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*);
     void* destination;
     void(*userCallback)();
     void* userCallbackData;
+    /* If set, the track is advanced on the calling thread in the parallel
+       advance() */
+    bool hasCallback;
+    std::size_t hint;
+};
+
+template<class T, class K> struct Player<T, K>::Batch  {
+    /*implicit*/ Batch(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView3D<const char>& values, void(*interpolator)(), const Containers::StridedArrayView2D<char>& destination, Extrapolation before, Extrapolation after, void(*advancer)(const Containers::StridedArrayView1D<const K>&, const Containers::StridedArrayView3D<const char>&, void(*)(), const Containers::StridedArrayView2D<char>&, Extrapolation, Extrapolation, K, std::size_t&), std::size_t hint) noexcept: keys{keys}, values{values}, interpolator{interpolator}, destination{destination}, before{before}, after{after}, advancer{advancer}, hint{hint} {}
+
+    Containers::StridedArrayView1D<const K> keys;
+    Containers::StridedArrayView3D<const char> values;
+    void(*interpolator)();
+    Containers::StridedArrayView2D<char> destination;
+    Extrapolation before, after;
+    void(*advancer)(const Containers::StridedArrayView1D<const K>&, const Containers::StridedArrayView3D<const char>&, void(*)(), const Containers::StridedArrayView2D<char>&, Extrapolation, Extrapolation, K, std::size_t&);
     std::size_t hint;
 };
 #endif
@@ -87,7 +104,7 @@ template<class T, class K> Player<T, K>::Player(Scaler scaler): _scaler{scaler}
 template<class T, class K> Player<T, K>::~Player() = default;
 
 template<class T, class K> bool Player<T, K>::isEmpty() const {
-    return _tracks.empty();
+    return _tracks.empty() && _batches.empty();
 }
 
 template<class T, class K> std::size_t Player<T, K>::size() const {
@@ -101,12 +118,32 @@ template<class T, class K> const TrackViewStorage<const K>& Player<T, K>::track(
     return _tracks[i].track;
 }
 
-template<class T, class K> Player<T, K>& Player<T, K>::addInternal(const TrackViewStorage<const K>& track, void(*const advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), void* const destination, void(*const userCallback)(), void* const userCallbackData) {
-    if(_tracks.empty() && _duration == Math::Range1D<K>{})
+template<class T, class K> std::size_t Player<T, K>::batchCount() const {
+    return _batches.size();
+}
+
+template<class T, class K> Player<T, K>& Player<T, K>::addInternal(const TrackViewStorage<const K>& track, void(*const advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), void* const destination, void(*const userCallback)(), void* const userCallbackData, const bool hasCallback) {
+    if(isEmpty() && _duration == Math::Range1D<K>{})
         _duration = track.duration();
     else
         _duration = Math::join(track.duration(), _duration);
-    arrayAppend(_tracks, Containers::InPlaceInit, track, advancer, destination, userCallback, userCallbackData, 0u);
+    arrayAppend(_tracks, Containers::InPlaceInit, track, advancer, destination, userCallback, userCallbackData, hasCallback, 0u);
+    return *this;
+}
+
+template<class T, class K> Player<T, K>& Player<T, K>::addBatchInternal(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView3D<const char>& values, void(*const interpolator)(), const Containers::StridedArrayView2D<char>& destination, const Extrapolation before, const Extrapolation after, void(*const advancer)(const Containers::StridedArrayView1D<const K>&, const Containers::StridedArrayView3D<const char>&, void(*)(), const Containers::StridedArrayView2D<char>&, Extrapolation, Extrapolation, K, std::size_t&)) {
+    CORRADE_ASSERT(keys.size() == values.size()[0],
+        "Animation::Player::addBatch(): expected" << keys.size() << "keyframes in values but got" << values.size()[0], *this);
+    CORRADE_ASSERT(destination.size()[0] == values.size()[1],
+        "Animation::Player::addBatch(): expected" << values.size()[1] << "destination items but got" << destination.size()[0], *this);
+
+    /* Same as TrackViewStorage::duration() */
+    const Math::Range1D<K> duration = keys.empty() ? Math::Range1D<K>{} : Math::Range1D<K>{keys.front(), keys.back()};
+    if(isEmpty() && _duration == Math::Range1D<K>{})
+        _duration = duration;
+    else
+        _duration = Math::join(duration, _duration);
+    arrayAppend(_batches, Containers::InPlaceInit, keys, values, interpolator, destination, before, after, advancer, 0u);
     return *this;
 }
 
@@ -302,12 +339,56 @@ template<class T, class K> Player<T, K>& Player<T, K>::advance(const T time) {
     if(!elapsed) return *this;
 
     /* Advance all tracks. Properly handle durations that don't start at 0. */
+    const K key = _duration.min() + elapsed->second;
     for(Track& t: _tracks)
-        t.advancer(t.track, _duration.min() + elapsed->second, t.hint, t.destination, t.userCallback, t.userCallbackData);
+        t.advancer(t.track, key, t.hint, t.destination, t.userCallback, t.userCallbackData);
+
+    /* Advance all batches, each doing a single keyframe search for all its
+       tracks */
+    for(Batch& b: _batches)
+        b.advancer(b.keys, b.values, b.interpolator, b.destination, b.before, b.after, key, b.hint);
 
     return *this;
 }
 
+template<class T, class K> void Player<T, K>::advance(const T time, const Containers::StridedArrayView1D<Player<T, K>>& players, const UnsignedInt threadCount) {
+    /* Keys at which each player got advanced, NullOpt if it didn't */
+    Containers::Array<Containers::Optional<K>> keys{Containers::ValueInit, players.size()};
+
+    /* Update the player state and advance all tracks without callbacks in
+       parallel. Each player is touched by just one thread. */
+    struct State {
+        const Containers::StridedArrayView1D<Player<T, K>>& players;
+        Containers::ArrayView<Containers::Optional<K>> keys;
+        T time;
+    } state{players, keys, time};
+    /* Advancing a single player is cheap, so don't spawn threads for small
+       amounts */
+    Magnum::Implementation::parallelFor(players.size(), threadCount, 256, [](void* state, std::size_t begin, std::size_t end) {
+        State& s = *static_cast<State*>(state);
+        for(std::size_t i = begin; i != end; ++i) {
+            Player<T, K>& p = s.players[i];
+            const Containers::Optional<std::pair<UnsignedInt, K>> elapsed = Implementation::playerElapsed(p._duration.size(), p._playCount, p._scaler, s.time, p._startTime, p._stopPauseTime, p._state);
+            if(!elapsed) continue;
+
+            const K key = p._duration.min() + elapsed->second;
+            s.keys[i] = key;
+            for(Track& t: p._tracks) if(!t.hasCallback)
+                t.advancer(t.track, key, t.hint, t.destination, t.userCallback, t.userCallbackData);
+            for(Batch& b: p._batches)
+                b.advancer(b.keys, b.values, b.interpolator, b.destination, b.before, b.after, key, b.hint);
+        }
+    }, &state);
+
+    /* Advance the tracks with callbacks on the calling thread, so user code
+       doesn't need to be thread-safe */
+    for(std::size_t i = 0; i != players.size(); ++i) {
+        if(!keys[i]) continue;
+        for(Track& t: players[i]._tracks) if(t.hasCallback)
+            t.advancer(t.track, *keys[i], t.hint, t.destination, t.userCallback, t.userCallbackData);
+    }
+}
+
 }}
 
 #endif
@@ -39,6 +39,7 @@ struct Benchmark: TestSuite::Tester {
     void atEmpty();
     void at();
     void atHint();
+    void atHintReverse();
     void atStrict();
     void atStrictInterleaved();
     void atStrictInterleavedDirectInterpolator();
@@ -49,6 +50,8 @@ struct Benchmark: TestSuite::Tester {
     void playerAdvanceCallback();
     void playerAdvanceRawCallback();
     void playerAdvanceRawCallbackDirectInterpolator();
+    void playerAdvanceTracks();
+    void playerAdvanceBatch();
 
     Containers::Array<Float> _keys;
     Containers::Array<Int> _values;
@@ -57,10 +60,11 @@ struct Benchmark: TestSuite::Tester {
     Containers::StridedArrayView1D<const Int> _valuesInterleaved;
     TrackView<const Float, const Int> _track;
     TrackView<const Float, const Int> _trackInterleaved;
+    Containers::Array<Int> _batchValues;
 };
 
 namespace {
-    enum: std::size_t { DataSize = 2000 };
+    enum: std::size_t { DataSize = 2000, BatchSize = 64 };
 }
 
 Benchmark::Benchmark() {
@@ -71,6 +75,7 @@ Benchmark::Benchmark() {
                    &Benchmark::atEmpty,
                    &Benchmark::at,
                    &Benchmark::atHint,
+                   &Benchmark::atHintReverse,
                    &Benchmark::atStrict,
                    &Benchmark::atStrictInterleaved,
                    &Benchmark::atStrictInterleavedDirectInterpolator,
@@ -80,7 +85,9 @@ Benchmark::Benchmark() {
                    &Benchmark::playerAdvance,
                    &Benchmark::playerAdvanceCallback,
                    &Benchmark::playerAdvanceRawCallback,
-                   &Benchmark::playerAdvanceRawCallbackDirectInterpolator}, 10);
+                   &Benchmark::playerAdvanceRawCallbackDirectInterpolator,
+                   &Benchmark::playerAdvanceTracks,
+                   &Benchmark::playerAdvanceBatch}, 10);
 
     _keys = Containers::Array<Float>{DataSize};
     _values = Containers::Array<Int>{Containers::DirectInit, DataSize, 1};
@@ -94,6 +101,10 @@ Benchmark::Benchmark() {
     _track = TrackView<const Float, const Int>{
         Containers::arrayView(_keys), Containers::arrayView(_values), Math::select};
     _trackInterleaved = {_keysInterleaved, _valuesInterleaved, Math::select};
+
+    /* BatchSize tracks sharing the same keys, values for one keyframe next to
+       each other */
+    _batchValues = Containers::Array<Int>{Containers::DirectInit, DataSize*BatchSize, 1};
 }
 
 void Benchmark::interpolateEmpty() {
@@ -154,6 +165,17 @@ void Benchmark::atHint() {
     CORRADE_COMPARE(result, 125000);
 }
 
+void Benchmark::atHintReverse() {
+    /* Going backwards, the hint misses every time the keyframe changes */
+    Int result{};
+    CORRADE_BENCHMARK(250) {
+        std::size_t hint{};
+        for(Float i = 500.0f; i > 0.0f; i -= 1.0f)
+            result += _track.at(i, hint);
+    }
+    CORRADE_COMPARE(result, 125000);
+}
+
 void Benchmark::atStrict() {
     Int result{};
     CORRADE_BENCHMARK(250) {
@@ -260,6 +282,49 @@ void Benchmark::playerAdvanceRawCallbackDirectInterpolator() {
     CORRADE_COMPARE(result, 125000);
 }
 
+void Benchmark::playerAdvanceTracks() {
+    /* Each of the BatchSize tracks added separately, to compare the per-track
+       cost with playerAdvanceBatch() */
+    Containers::StridedArrayView2D<const Int> values{Containers::arrayView(_batchValues), {DataSize, BatchSize}, {BatchSize*sizeof(Int), sizeof(Int)}};
+    Containers::Array<TrackView<const Float, const Int>> tracks{BatchSize};
+    Int result[BatchSize]{};
+    Player<Float> player;
+    for(std::size_t i = 0; i != BatchSize; ++i) {
+        tracks[i] = TrackView<const Float, const Int>{Containers::arrayView(_keys), values.transposed<0, 1>()[i], Math::select};
+        player.add(tracks[i], result[i]);
+    }
+    player.play({});
+
+    CORRADE_BENCHMARK(250) {
+        for(Float i = 0.0f; i < 500.0f; i += 1.0f)
+            player.advance(i);
+    }
+
+    Int sum{};
+    for(Int i: result) sum += i;
+    CORRADE_COMPARE(sum, Int(BatchSize));
+}
+
+void Benchmark::playerAdvanceBatch() {
+    /* The same as playerAdvanceTracks(), but doing a single keyframe search
+       for all tracks */
+    Int result[BatchSize]{};
+    Player<Float> player;
+    player.addBatch(Containers::StridedArrayView1D<const Float>{_keys},
+        Containers::StridedArrayView2D<const Int>{Containers::arrayView(_batchValues), {DataSize, BatchSize}, {BatchSize*sizeof(Int), sizeof(Int)}},
+        Math::select, Containers::stridedArrayView(result))
+        .play({});
+
+    CORRADE_BENCHMARK(250) {
+        for(Float i = 0.0f; i < 500.0f; i += 1.0f)
+            player.advance(i);
+    }
+
+    Int sum{};
+    for(Int i: result) sum += i;
+    CORRADE_COMPARE(sum, Int(BatchSize));
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Animation::Test::Benchmark)
@@ -0,0 +1,343 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Animation/Compression.h"
+#include "Magnum/Animation/Interpolation.h"
+#include "Magnum/Animation/Track.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Vector4.h"
+
+namespace Magnum { namespace Animation { namespace Test { namespace {
+
+struct CompressionTest: TestSuite::Tester {
+    explicit CompressionTest();
+
+    void packQuaternion();
+    void packQuaternionRoundtrip();
+    void packQuaternionNotNormalized();
+    void packQuaternionInterpolate();
+
+    void quantize();
+    void quantizeEmpty();
+    void quantizeInterpolate();
+    void quantizeWrongSize();
+
+    void uniformKeyStep();
+
+    void reduceKeyframes();
+    void reduceKeyframesTooFew();
+    void reduceKeyframesQuaternion();
+    void reduceKeyframesWrongSize();
+};
+
+using namespace Math::Literals;
+
+const struct {
+    const char* name;
+    Quaternion quaternion;
+} QuaternionData[]{
+    {"identity", Quaternion{}},
+    {"negative identity", -Quaternion{}},
+    {"largest X", Quaternion::rotation(160.0_degf, Vector3{1.0f, 0.2f, -0.1f}.normalized())},
+    {"largest Y", Quaternion::rotation(170.0_degf, Vector3{0.1f, -1.0f, 0.3f}.normalized())},
+    {"largest Z", Quaternion::rotation(-150.0_degf, Vector3{-0.2f, 0.3f, 1.0f}.normalized())},
+    {"largest W", Quaternion::rotation(35.0_degf, Vector3{0.5f, 0.7f, -0.3f}.normalized())},
+    {"largest negative W", -Quaternion::rotation(35.0_degf, Vector3{0.5f, 0.7f, -0.3f}.normalized())},
+    {"two largest the same", Quaternion{{Constants::sqrtHalf(), 0.0f, 0.0f}, Constants::sqrtHalf()}}
+};
+
+const struct {
+    const char* name;
+    Float keys[4];
+    bool uniform;
+    Float expectedStep;
+} UniformKeyStepData[]{
+    {"uniform", {0.5f, 1.0f, 1.5f, 2.0f}, true, 0.5f},
+    {"uniform within error", {0.5f, 1.0009f, 1.4991f, 2.0f}, true, 0.5f},
+    {"non-uniform", {0.5f, 1.0f, 1.75f, 2.0f}, false, {}},
+    {"non-uniform just outside error", {0.5f, 1.0011f, 1.5f, 2.0f}, false, {}},
+    {"all the same", {1.0f, 1.0f, 1.0f, 1.0f}, false, {}},
+    {"decreasing", {2.0f, 1.5f, 1.0f, 0.5f}, false, {}}
+};
+
+const struct {
+    const char* name;
+    Float values[5];
+    Float maxError;
+    std::size_t expectedCount;
+    Float expectedKeys[5];
+} ReduceKeyframesData[]{
+    {"linear", {0.0f, 1.0f, 2.0f, 3.0f, 4.0f}, 0.0001f,
+        2, {0.0f, 4.0f}},
+    {"corner", {0.0f, 1.0f, 2.0f, 1.0f, 0.0f}, 0.0001f,
+        3, {0.0f, 2.0f, 4.0f}},
+    {"within error", {0.0f, 1.005f, 2.0f, 2.995f, 4.0f}, 0.01f,
+        2, {0.0f, 4.0f}},
+    {"outside error", {0.0f, 1.005f, 2.0f, 2.995f, 4.0f}, 0.001f,
+        4, {0.0f, 1.0f, 3.0f, 4.0f}},
+    {"constant with a spike", {1.0f, 1.0f, 1.0f, 3.0f, 1.0f}, 0.5f,
+        4, {0.0f, 2.0f, 3.0f, 4.0f}}
+};
+
+CompressionTest::CompressionTest() {
+    addInstancedTests({&CompressionTest::packQuaternion},
+        Containers::arraySize(QuaternionData));
+
+    addTests({&CompressionTest::packQuaternionRoundtrip,
+              &CompressionTest::packQuaternionNotNormalized,
+              &CompressionTest::packQuaternionInterpolate,
+
+              &CompressionTest::quantize,
+              &CompressionTest::quantizeEmpty,
+              &CompressionTest::quantizeInterpolate,
+              &CompressionTest::quantizeWrongSize});
+
+    addInstancedTests({&CompressionTest::uniformKeyStep},
+        Containers::arraySize(UniformKeyStepData));
+
+    addInstancedTests({&CompressionTest::reduceKeyframes},
+        Containers::arraySize(ReduceKeyframesData));
+
+    addTests({&CompressionTest::reduceKeyframesTooFew,
+              &CompressionTest::reduceKeyframesQuaternion,
+              &CompressionTest::reduceKeyframesWrongSize});
+}
+
+void CompressionTest::packQuaternion() {
+    auto&& data = QuaternionData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Quaternion unpacked = unpackQuaternion(Animation::packQuaternion(data.quaternion));
+    CORRADE_VERIFY(unpacked.isNormalized());
+
+    /* The unpacked quaternion can be negated, which is the same rotation */
+    const Float sign = Math::dot(unpacked, data.quaternion) < 0.0f ? -1.0f : 1.0f;
+    const Vector4 expected{sign*data.quaternion.vector(), sign*data.quaternion.scalar()};
+    const Vector4 actual{unpacked.vector(), unpacked.scalar()};
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_WITH(actual[i], expected[i],
+            TestSuite::Compare::around(0.00006f));
+    }
+}
+
+void CompressionTest::packQuaternionRoundtrip() {
+    /* Identity has the W component dropped, X, Y and Z are in the middle of
+       the 15-bit range */
+    CORRADE_COMPARE(Animation::packQuaternion(Quaternion{}),
+        (Vector3us{0x8000|16384, 0x8000|16384, 16384}));
+    CORRADE_COMPARE(Animation::packQuaternion(-Quaternion{}),
+        (Vector3us{0x8000|16384, 0x8000|16384, 16384}));
+
+    /* Packing an unpacked value again should give the same result */
+    const Vector3us packed = Animation::packQuaternion(Quaternion::rotation(
+        73.0_degf, Vector3{0.3f, -0.4f, 0.8f}.normalized()));
+    CORRADE_COMPARE(Animation::packQuaternion(unpackQuaternion(packed)), packed);
+}
+
+void CompressionTest::packQuaternionNotNormalized() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Animation::packQuaternion(Quaternion{{1.0f, 2.0f, 3.0f}, 4.0f});
+    CORRADE_COMPARE(out.str(),
+        "Animation::packQuaternion(): Quaternion({1, 2, 3}, 4) is not normalized\n");
+}
+
+void CompressionTest::packQuaternionInterpolate() {
+    /* The second rotation has a negative W, so it gets flipped when packing
+       and a plain slerp() would go the longer way */
+    const Float keys[]{0.0f, 1.0f};
+    const Vector3us values[]{
+        Animation::packQuaternion(Quaternion::rotation(10.0_degf, Vector3::xAxis())),
+        Animation::packQuaternion(Quaternion::rotation(350.0_degf, Vector3::xAxis()))
+    };
+    TrackView<const Float, const Vector3us, Quaternion> track{keys, values,
+        Animation::unpack<Vector3us, Quaternion, Math::slerpShortestPath, unpackQuaternion>()};
+
+    /* Halfway between +10° and -10° is the identity */
+    const Quaternion result = track.at(0.5f);
+    CORRADE_COMPARE_WITH(result.scalar(), 1.0f,
+        TestSuite::Compare::around(0.0001f));
+    CORRADE_COMPARE_WITH(result.vector().length(), 0.0f,
+        TestSuite::Compare::around(0.0001f));
+}
+
+void CompressionTest::quantize() {
+    const Vector3 data[]{
+        {1.0f, 2.0f, 3.0f},
+        {3.0f, 2.0f, -1.0f},
+        {2.0f, 2.0f, 1.0f}
+    };
+    Vector3us packed[3];
+    const Range3D range = quantizeInto(data, packed);
+    CORRADE_COMPARE(range, (Range3D{{1.0f, 2.0f, -1.0f}, {3.0f, 2.0f, 3.0f}}));
+
+    /* Components that don't change are zero */
+    CORRADE_COMPARE(packed[0], (Vector3us{0, 0, 65535}));
+    CORRADE_COMPARE(packed[1], (Vector3us{65535, 0, 0}));
+    CORRADE_COMPARE(packed[2], (Vector3us{32768, 0, 32768}));
+
+    CORRADE_COMPARE(dequantize(range, unpackQuantized(packed[0])), data[0]);
+    CORRADE_COMPARE(dequantize(range, unpackQuantized(packed[1])), data[1]);
+}
+
+void CompressionTest::quantizeEmpty() {
+    CORRADE_COMPARE(quantizeInto(nullptr, nullptr), Range3D{});
+}
+
+void CompressionTest::quantizeInterpolate() {
+    const Vector3 data[]{
+        {1.0f, 2.0f, 3.0f},
+        {3.0f, 2.0f, -1.0f}
+    };
+    Vector3us packed[2];
+    const Range3D range = quantizeInto(data, packed);
+
+    const Float keys[]{0.0f, 1.0f};
+    TrackView<const Float, const Vector3us, Vector3> track{keys, packed,
+        Animation::unpack<Vector3us, Vector3, Math::lerp, unpackQuantized>()};
+
+    /* Dequantizing the interpolated value is the same as interpolating the
+       dequantized values */
+    CORRADE_COMPARE(dequantize(range, track.at(0.25f)),
+        Math::lerp(data[0], data[1], 0.25f));
+}
+
+void CompressionTest::quantizeWrongSize() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const Vector3 data[3]{};
+    Vector3us packed[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    quantizeInto(data, packed);
+    CORRADE_COMPARE(out.str(),
+        "Animation::quantizeInto(): wrong destination size, got 2 but expected 3\n");
+}
+
+void CompressionTest::uniformKeyStep() {
+    auto&& data = UniformKeyStepData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Optional<Float> step = Animation::uniformKeyStep<Float>(data.keys, 0.001f);
+    if(!data.uniform) {
+        CORRADE_VERIFY(!step);
+        return;
+    }
+
+    CORRADE_VERIFY(step);
+    CORRADE_COMPARE(*step, data.expectedStep);
+}
+
+void CompressionTest::reduceKeyframes() {
+    auto&& data = ReduceKeyframesData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Float keys[]{0.0f, 1.0f, 2.0f, 3.0f, 4.0f};
+    Float values[5];
+    for(std::size_t i = 0; i != 5; ++i) values[i] = data.values[i];
+
+    const std::size_t count = reduceKeyframesInPlace<Float, Float>(keys, values,
+        Math::lerp, data.maxError,
+        [](const Float& a, const Float& b) { return Math::abs(a - b); });
+    CORRADE_COMPARE(count, data.expectedCount);
+    for(std::size_t i = 0; i != count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(keys[i], data.expectedKeys[i]);
+        CORRADE_COMPARE(values[i], data.values[std::size_t(data.expectedKeys[i])]);
+    }
+}
+
+void CompressionTest::reduceKeyframesTooFew() {
+    Float keys[]{0.0f, 1.0f};
+    Float values[]{3.0f, 3.0f};
+
+    /* The first and last keyframe is always kept */
+    CORRADE_COMPARE((reduceKeyframesInPlace<Float, Float>(keys, values,
+        Math::lerp, 1.0f,
+        [](const Float& a, const Float& b) { return Math::abs(a - b); })), 2);
+    CORRADE_COMPARE((reduceKeyframesInPlace<Float, Float>(
+        Containers::arrayView(keys).prefix(1),
+        Containers::arrayView(values).prefix(1),
+        Math::lerp, 1.0f,
+        [](const Float& a, const Float& b) { return Math::abs(a - b); })), 1);
+    CORRADE_COMPARE((reduceKeyframesInPlace<Float, Float>(nullptr, nullptr,
+        Math::lerp, 1.0f,
+        [](const Float& a, const Float& b) { return Math::abs(a - b); })), 0);
+}
+
+void CompressionTest::reduceKeyframesQuaternion() {
+    /* A rotation with a constant speed and then a stop */
+    Float keys[]{0.0f, 1.0f, 2.0f, 3.0f, 4.0f};
+    Quaternion values[]{
+        Quaternion::rotation(0.0_degf, Vector3::yAxis()),
+        Quaternion::rotation(20.0_degf, Vector3::yAxis()),
+        Quaternion::rotation(40.0_degf, Vector3::yAxis()),
+        Quaternion::rotation(60.0_degf, Vector3::yAxis()),
+        Quaternion::rotation(60.0_degf, Vector3::yAxis())
+    };
+
+    CORRADE_COMPARE((reduceKeyframesInPlace<Float, Quaternion>(keys, values,
+        Math::slerp, 0.001f,
+        [](const Quaternion& a, const Quaternion& b) {
+            return Float(Math::angle(a, b));
+        })), 3);
+    CORRADE_COMPARE(keys[0], 0.0f);
+    CORRADE_COMPARE(keys[1], 3.0f);
+    CORRADE_COMPARE(keys[2], 4.0f);
+    CORRADE_COMPARE(values[1], Quaternion::rotation(60.0_degf, Vector3::yAxis()));
+}
+
+void CompressionTest::reduceKeyframesWrongSize() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Float keys[3]{};
+    Float values[2]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    reduceKeyframesInPlace<Float, Float>(keys, values, Math::lerp, 1.0f,
+        [](const Float& a, const Float& b) { return Math::abs(a - b); });
+    CORRADE_COMPARE(out.str(),
+        "Animation::reduceKeyframesInPlace(): expected key and value views to have the same size but got 3 and 2\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::CompressionTest)
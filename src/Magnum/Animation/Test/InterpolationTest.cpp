@@ -68,6 +68,8 @@ struct InterpolationTest: TestSuite::Tester {
 
     void interpolateHint();
     void interpolateStrictHint();
+    void interpolateHintSearch();
+    void interpolateStrictHintSearch();
 
     void interpolateDifferentResultType();
     void interpolateStrictDifferentResultType();
@@ -78,6 +80,19 @@ struct InterpolationTest: TestSuite::Tester {
     void interpolateIntegerKey();
     void interpolateStrictIntegerKey();
 
+    void interpolateInto();
+    void interpolateIntoSingleKeyframe();
+    void interpolateIntoNoKeyframe();
+    void interpolateIntoHint();
+    void interpolateIntoError();
+
+    void interpolateUniform();
+    void interpolateUniformSingleKeyframe();
+    void interpolateUniformNoKeyframe();
+    void interpolateUniformConsistency();
+    void interpolateUniformUnsignedBefore();
+    void interpolateUniformError();
+
     void ease();
     void easeClamped();
     void unpack();
@@ -156,6 +171,57 @@ const struct {
     {"out of bounds", 405780454}
 };
 
+const struct {
+    const char* name;
+    std::size_t hint;
+    Float time;
+    std::size_t expectedHint;
+} HintSearchData[] {
+    {"same", 50, 50.5f, 50},
+    {"next", 49, 50.5f, 50},
+    {"previous", 51, 50.5f, 50},
+    {"far forward", 3, 90.25f, 90},
+    {"far backward", 95, 7.5f, 7},
+    {"exactly at a key forward", 10, 64.0f, 64},
+    {"exactly at a key backward", 80, 16.0f, 16},
+    {"to the end", 0, 99.0f, 98},
+    {"to the beginning", 98, 0.5f, 0},
+    {"out of bounds", 405780454, 33.75f, 33}
+};
+
+const struct {
+    const char* name;
+    Extrapolation extrapolationBefore;
+    Extrapolation extrapolationAfter;
+    Float time;
+    Float expectedValue;
+} UniformData[] {
+    {"before default-constructed",
+        Extrapolation::DefaultConstructed, Extrapolation::Extrapolated,
+        -1.0f, 0.0f},
+    {"before constant",
+        Extrapolation::Constant, Extrapolation::Extrapolated,
+        -1.0f, 3.0f},
+    {"before extrapolated",
+        Extrapolation::Extrapolated, Extrapolation::DefaultConstructed,
+        -1.0f, 4.0f},
+    {"during first",
+        Extrapolation::DefaultConstructed, Extrapolation::DefaultConstructed,
+        1.0f, 2.0f},
+    {"during last",
+        Extrapolation::DefaultConstructed, Extrapolation::DefaultConstructed,
+        5.0f, 1.5f},
+    {"after default-constructed",
+        Extrapolation::Extrapolated, Extrapolation::DefaultConstructed,
+        7.0f, 0.0f},
+    {"after constant",
+        Extrapolation::Extrapolated, Extrapolation::Constant,
+        7.0f, 0.5f},
+    {"after extrapolated",
+        Extrapolation::DefaultConstructed, Extrapolation::Extrapolated,
+        7.0f, -0.5f}
+};
+
 InterpolationTest::InterpolationTest() {
     addTests({&InterpolationTest::interpolatorFor,
               &InterpolationTest::interpolatorForInvalid,
@@ -191,6 +257,10 @@ InterpolationTest::InterpolationTest() {
                        &InterpolationTest::interpolateStrictHint},
                        Containers::arraySize(HintData));
 
+    addInstancedTests({&InterpolationTest::interpolateHintSearch,
+                       &InterpolationTest::interpolateStrictHintSearch},
+                       Containers::arraySize(HintSearchData));
+
     addTests({&InterpolationTest::interpolateDifferentResultType,
               &InterpolationTest::interpolateStrictDifferentResultType,
 
@@ -198,7 +268,31 @@ InterpolationTest::InterpolationTest() {
               &InterpolationTest::interpolateStrictError,
 
               &InterpolationTest::interpolateIntegerKey,
-              &InterpolationTest::interpolateStrictIntegerKey,
+              &InterpolationTest::interpolateStrictIntegerKey});
+
+    addInstancedTests({&InterpolationTest::interpolateInto},
+                       Containers::arraySize(Data));
+
+    addInstancedTests({&InterpolationTest::interpolateIntoSingleKeyframe},
+                       Containers::arraySize(SingleKeyframeData));
+
+    addTests({&InterpolationTest::interpolateIntoNoKeyframe});
+
+    addInstancedTests({&InterpolationTest::interpolateIntoHint},
+                       Containers::arraySize(HintSearchData));
+
+    addTests({&InterpolationTest::interpolateIntoError});
+
+    addInstancedTests({&InterpolationTest::interpolateUniform},
+                       Containers::arraySize(UniformData));
+
+    addInstancedTests({&InterpolationTest::interpolateUniformSingleKeyframe},
+                       Containers::arraySize(SingleKeyframeData));
+
+    addTests({&InterpolationTest::interpolateUniformNoKeyframe,
+              &InterpolationTest::interpolateUniformConsistency,
+              &InterpolationTest::interpolateUniformUnsignedBefore,
+              &InterpolationTest::interpolateUniformError,
 
               &InterpolationTest::ease,
               &InterpolationTest::easeClamped,
@@ -518,6 +612,43 @@ void InterpolationTest::interpolateStrictHint() {
     CORRADE_COMPARE(hint, 2);
 }
 
+struct LongTrack {
+    LongTrack() {
+        for(std::size_t i = 0; i != Containers::arraySize(keys); ++i) {
+            keys[i] = Float(i);
+            values[i] = Float(i)*10.0f;
+        }
+    }
+
+    Float keys[100];
+    Float values[100];
+};
+
+void InterpolationTest::interpolateHintSearch() {
+    const auto& data = HintSearchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    LongTrack track;
+    std::size_t hint = data.hint;
+    CORRADE_COMPARE((Animation::interpolate<Float, Float>(
+        track.keys, track.values, Extrapolation::Extrapolated,
+        Extrapolation::Extrapolated, Math::lerp, data.time, hint)),
+        data.time*10.0f);
+    CORRADE_COMPARE(hint, data.expectedHint);
+}
+
+void InterpolationTest::interpolateStrictHintSearch() {
+    const auto& data = HintSearchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    LongTrack track;
+    std::size_t hint = data.hint;
+    CORRADE_COMPARE((Animation::interpolateStrict<Float, Float>(
+        track.keys, track.values, Math::lerp, data.time, hint)),
+        data.time*10.0f);
+    CORRADE_COMPARE(hint, data.expectedHint);
+}
+
 using namespace Math::Literals;
 
 const Half HalfValues[]{3.0_h, 1.0_h, 2.5_h, 0.5_h};
@@ -556,6 +687,188 @@ void InterpolationTest::interpolateStrictIntegerKey() {
     CORRADE_COMPARE(hint, 2);
 }
 
+/* Values of the second track are the first track multiplied by two, third
+   track is the first track negated */
+constexpr Float MultiValues[][3]{
+    {3.0f, 6.0f, -3.0f},
+    {1.0f, 2.0f, -1.0f},
+    {2.5f, 5.0f, -2.5f},
+    {0.5f, 1.0f, -0.5f}
+};
+
+Containers::StridedArrayView2D<const Float> multiValues() {
+    return {MultiValues, {4, 3}, {3*sizeof(Float), sizeof(Float)}};
+}
+
+void InterpolationTest::interpolateInto() {
+    const auto& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    std::size_t hint{};
+    Float out[3];
+    Animation::interpolateInto<Float, Float>(Keys,
+        multiValues(),
+        data.extrapolationBefore, data.extrapolationAfter, Math::lerp,
+        data.time, hint, Containers::stridedArrayView(out));
+    CORRADE_COMPARE(out[0], data.expectedValue);
+    CORRADE_COMPARE(out[1], data.expectedValue*2.0f);
+    CORRADE_COMPARE(out[2], -data.expectedValue);
+    CORRADE_COMPARE(hint, data.expectedHint);
+}
+
+void InterpolationTest::interpolateIntoSingleKeyframe() {
+    const auto& data = SingleKeyframeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    std::size_t hint{};
+    Float out[3];
+    Animation::interpolateInto<Float, Float>(
+        Containers::arrayView(Keys).prefix(1),
+        multiValues().prefix(1),
+        data.extrapolation, data.extrapolation, Math::lerp,
+        data.time, hint, Containers::stridedArrayView(out));
+    CORRADE_COMPARE(out[0], data.expectedValue);
+    CORRADE_COMPARE(out[1], data.expectedValue*2.0f);
+    CORRADE_COMPARE(out[2], -data.expectedValue);
+    CORRADE_COMPARE(hint, 0);
+}
+
+void InterpolationTest::interpolateIntoNoKeyframe() {
+    std::size_t hint{};
+    Float out[]{1.0f, 2.0f};
+    Animation::interpolateInto<Float, Float>(nullptr,
+        Containers::StridedArrayView2D<const Float>{nullptr, {0, 2}, {0, 0}},
+        Extrapolation::Extrapolated, Extrapolation::Extrapolated, Math::lerp,
+        3.5f, hint, Containers::stridedArrayView(out));
+    CORRADE_COMPARE(out[0], Float{});
+    CORRADE_COMPARE(out[1], Float{});
+    CORRADE_COMPARE(hint, 0);
+}
+
+void InterpolationTest::interpolateIntoHint() {
+    const auto& data = HintSearchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    LongTrack track;
+    std::size_t hint = data.hint;
+    Float out[2];
+    /* Both tracks share the same values, with the second dimension having a
+       zero stride */
+    Animation::interpolateInto<Float, Float>(track.keys,
+        Containers::StridedArrayView2D<const Float>{track.values, {100, 2}, {sizeof(Float), 0}},
+        Extrapolation::Extrapolated, Extrapolation::Extrapolated, Math::lerp,
+        data.time, hint, Containers::stridedArrayView(out));
+    CORRADE_COMPARE(out[0], data.time*10.0f);
+    CORRADE_COMPARE(out[1], data.time*10.0f);
+    CORRADE_COMPARE(hint, data.expectedHint);
+}
+
+void InterpolationTest::interpolateIntoError() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Float destination[3];
+    {
+        std::size_t hint{};
+        Animation::interpolateInto<Float, Float>(
+            Containers::arrayView(Keys).prefix(3),
+            multiValues(),
+            Extrapolation::Extrapolated, Extrapolation::Extrapolated,
+            Math::lerp, 0.0f, hint, Containers::stridedArrayView(destination));
+    } {
+        std::size_t hint{};
+        Animation::interpolateInto<Float, Float>(Keys,
+            multiValues(),
+            Extrapolation::Extrapolated, Extrapolation::Extrapolated,
+            Math::lerp, 0.0f, hint, Containers::stridedArrayView(destination).prefix(2));
+    }
+
+    CORRADE_COMPARE(out.str(),
+        "Animation::interpolateInto(): expected 3 keyframes in values but got 4\n"
+        "Animation::interpolateInto(): expected 3 destination items but got 2\n");
+}
+
+void InterpolationTest::interpolateUniform() {
+    auto&& data = UniformData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Same as Values, but with implicit keys 0, 2, 4, 6 */
+    CORRADE_COMPARE((Animation::interpolateUniform<Float, Float>(
+        0.0f, 2.0f, Values, data.extrapolationBefore, data.extrapolationAfter,
+        Math::lerp, data.time)), data.expectedValue);
+}
+
+void InterpolationTest::interpolateUniformSingleKeyframe() {
+    const auto& data = SingleKeyframeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* The step should be ignored in this case */
+    CORRADE_COMPARE((Animation::interpolateUniform<Float, Float>(
+        0.0f, 0.0f, Containers::arrayView(Values).prefix(1),
+        data.extrapolation, data.extrapolation,
+        Math::lerp, data.time)), data.expectedValue);
+}
+
+void InterpolationTest::interpolateUniformNoKeyframe() {
+    CORRADE_COMPARE((Animation::interpolateUniform<Float, Float>(
+        0.0f, 2.0f, nullptr, Extrapolation::Extrapolated,
+        Extrapolation::Extrapolated, Math::lerp, 3.5f)), Float{});
+}
+
+void InterpolationTest::interpolateUniformConsistency() {
+    /* Should give the same results as interpolate() with explicit keys */
+    const Float keys[]{1.5f, 2.0f, 2.5f, 3.0f};
+    for(Float time: {0.0f, 1.5f, 1.75f, 2.0f, 2.25f, 2.8f, 3.0f, 4.0f}) {
+        CORRADE_ITERATION(time);
+        std::size_t hint{};
+        CORRADE_COMPARE((Animation::interpolateUniform<Float, Float>(
+            1.5f, 0.5f, Values, Extrapolation::Extrapolated,
+            Extrapolation::Extrapolated, Math::lerp, time)),
+            (Animation::interpolate<Float, Float>(
+            keys, Values, Extrapolation::Extrapolated,
+            Extrapolation::Extrapolated, Math::lerp, time, hint)));
+    }
+}
+
+void InterpolationTest::interpolateUniformUnsignedBefore() {
+    /* Implicit keys 4, 6, 8, 10. A frame before the first key shouldn't wrap
+       around and end up being treated as after the last one. */
+    CORRADE_COMPARE((Animation::interpolateUniform<UnsignedInt, Float>(
+        4, 2, Values, Extrapolation::Extrapolated,
+        Extrapolation::Extrapolated, Math::lerp, 2)), 5.0f);
+    CORRADE_COMPARE((Animation::interpolateUniform<UnsignedInt, Float>(
+        4, 2, Values, Extrapolation::Constant,
+        Extrapolation::DefaultConstructed, Math::lerp, 2)), 3.0f);
+    CORRADE_COMPARE((Animation::interpolateUniform<UnsignedInt, Float>(
+        4, 2, Values, Extrapolation::DefaultConstructed,
+        Extrapolation::Constant, Math::lerp, 0)), 0.0f);
+    CORRADE_COMPARE((Animation::interpolateUniform<UnsignedInt, Float>(
+        4, 2, Values, Extrapolation::Extrapolated,
+        Extrapolation::Extrapolated, Math::lerp, 5)), 2.0f);
+}
+
+void InterpolationTest::interpolateUniformError() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Animation::interpolateUniform<Float, Float>(0.0f, 0.0f, Values,
+        Extrapolation::Extrapolated, Extrapolation::Extrapolated,
+        Math::lerp, 0.0f);
+    Animation::interpolateUniform<Float, Float>(0.0f, -1.0f, Values,
+        Extrapolation::Extrapolated, Extrapolation::Extrapolated,
+        Math::lerp, 0.0f);
+    CORRADE_COMPARE(out.str(),
+        "Animation::interpolateUniform(): expected a positive step but got 0\n"
+        "Animation::interpolateUniform(): expected a positive step but got -1\n");
+}
+
 void InterpolationTest::interpolateError() {
     #ifdef CORRADE_NO_ASSERT
     CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
@@ -62,6 +62,8 @@ struct PlayerTest: TestSuite::Tester {
     void advancePlayCountInfinite();
     void advanceChrono();
     void advanceList();
+    void advanceParallel();
+    void advanceParallelSingleThread();
     void advanceZeroDurationStop();
     void advanceZeroDurationPause();
     void advanceZeroDurationInfinitePlayCount();
@@ -86,6 +88,10 @@ struct PlayerTest: TestSuite::Tester {
     template<class T> void addWithCallbackOnChange();
     template<class T> void addWithCallbackOnChangeTemplate();
     template<class T> void addRawCallback();
+    void addBatch();
+    void addBatchExtrapolation();
+    void addBatchWithTracks();
+    void addBatchInvalidSize();
 
     void runFor100YearsFloat();
     void runFor100YearsChrono();
@@ -153,6 +159,8 @@ PlayerTest::PlayerTest() {
               &PlayerTest::advancePlayCountInfinite,
               &PlayerTest::advanceChrono,
               &PlayerTest::advanceList,
+              &PlayerTest::advanceParallel,
+              &PlayerTest::advanceParallelSingleThread,
               &PlayerTest::advanceZeroDurationStop,
               &PlayerTest::advanceZeroDurationPause,
               &PlayerTest::advanceZeroDurationInfinitePlayCount,
@@ -181,7 +189,11 @@ PlayerTest::PlayerTest() {
               &PlayerTest::addWithCallbackOnChangeTemplate<Track<Float, Float>>,
               &PlayerTest::addWithCallbackOnChangeTemplate<TrackView<Float, Float>>,
               &PlayerTest::addRawCallback<Track<Float, Float>>,
-              &PlayerTest::addRawCallback<TrackView<Float, Float>>});
+              &PlayerTest::addRawCallback<TrackView<Float, Float>>,
+              &PlayerTest::addBatch,
+              &PlayerTest::addBatchExtrapolation,
+              &PlayerTest::addBatchWithTracks,
+              &PlayerTest::addBatchInvalidSize});
 
     addInstancedTests({
         &PlayerTest::runFor100YearsFloat,
@@ -199,6 +211,7 @@ void PlayerTest::constructEmpty() {
     CORRADE_COMPARE(player.state(), State::Stopped);
     CORRADE_VERIFY(player.isEmpty());
     CORRADE_COMPARE(player.size(), 0);
+    CORRADE_COMPARE(player.batchCount(), 0);
 }
 
 const Animation::Track<Float, Float> Track{{
@@ -804,6 +817,87 @@ void PlayerTest::advanceList() {
     CORRADE_COMPARE(valueB, 2.75f);
 }
 
+namespace {
+
+struct ParallelCallback {
+    Containers::Array<UnsignedInt>* order;
+    const Float* destination;
+    UnsignedInt id;
+    Float seen;
+};
+
+}
+
+void PlayerTest::advanceParallel() {
+    /* Enough players to have the work split across more than one thread */
+    constexpr UnsignedInt Count = 1000;
+
+    Containers::Array<UnsignedInt> order;
+    Containers::Array<Float> values{Containers::DirectInit, Count, -1.0f};
+    Containers::Array<ParallelCallback> callbacks{Count};
+    Containers::Array<Player<Float>> players{Count};
+    for(UnsignedInt i = 0; i != Count; ++i) {
+        callbacks[i] = ParallelCallback{&order, &values[i], i, -1.0f};
+
+        /* The callback track is added first, but it's deferred after all
+           tracks writing to a destination, so it sees the updated value */
+        players[i]
+            .addWithCallback(Track, [](Float, const Float&, ParallelCallback& callback) {
+                arrayAppend(*callback.order, callback.id);
+                callback.seen = *callback.destination;
+            }, callbacks[i])
+            .add(Track, values[i]);
+
+        /* Every third player is stopped and thus shouldn't get advanced */
+        if(i % 3) players[i].play(2.0f);
+    }
+
+    /* 1.75 secs in */
+    Player<Float>::advance(3.75f, Containers::arrayView(players), 4);
+
+    Containers::Array<UnsignedInt> expectedOrder;
+    for(UnsignedInt i = 0; i != Count; ++i) {
+        CORRADE_ITERATION(i);
+        if(i % 3) {
+            CORRADE_COMPARE(players[i].state(), State::Playing);
+            CORRADE_COMPARE(values[i], 4.0f);
+            CORRADE_COMPARE(callbacks[i].seen, 4.0f);
+            arrayAppend(expectedOrder, i);
+        } else {
+            CORRADE_COMPARE(players[i].state(), State::Stopped);
+            CORRADE_COMPARE(values[i], -1.0f);
+            CORRADE_COMPARE(callbacks[i].seen, -1.0f);
+        }
+    }
+
+    /* Callbacks are fired on the calling thread in player order */
+    CORRADE_COMPARE_AS(order, expectedOrder, TestSuite::Compare::Container);
+}
+
+void PlayerTest::advanceParallelSingleThread() {
+    Float valueA = -1.0f, valueB = -1.0f;
+    Player<std::chrono::nanoseconds, Float> players[2];
+    players[0].add(Track, valueA)
+        .play(std::chrono::seconds{2});
+    players[1].add(Track, valueB)
+        .setPlayCount(1)
+        .play(std::chrono::seconds{1});
+
+    /* 1.75 secs in for A, 2.75 seconds in for B */
+    Player<std::chrono::nanoseconds, Float>::advance(std::chrono::milliseconds{3750}, players);
+    CORRADE_COMPARE(players[0].state(), State::Playing);
+    CORRADE_COMPARE(players[1].state(), State::Playing);
+    CORRADE_COMPARE(valueA, 4.0f);
+    CORRADE_COMPARE(valueB, 2.75f);
+
+    /* 5.75 secs in for B, which is after its only round, so it gets stopped
+       and the value at the stop time is written */
+    Player<std::chrono::nanoseconds, Float>::advance(std::chrono::milliseconds{6750}, players);
+    CORRADE_COMPARE(players[0].state(), State::Playing);
+    CORRADE_COMPARE(players[1].state(), State::Stopped);
+    CORRADE_COMPARE(valueB, 2.0f);
+}
+
 void PlayerTest::advanceZeroDurationStop() {
     Float value = -1.0f;
     Player<Float> player;
@@ -1330,6 +1424,126 @@ template<class T> void PlayerTest::addRawCallback() {
         TestSuite::Compare::Container);
 }
 
+/* Same keys as Track, the first column has the same values as Track, second
+   is the values multiplied by two and third negated */
+const Float BatchKeys[]{1.0f, 2.5f, 3.0f, 4.0f};
+const Float BatchValues[][3]{
+    {1.5f, 3.0f, -1.5f},
+    {3.0f, 6.0f, -3.0f},
+    {5.0f, 10.0f, -5.0f},
+    {2.0f, 4.0f, -2.0f}
+};
+
+Containers::StridedArrayView2D<const Float> batchValues() {
+    return {BatchValues, {4, 3}, {3*sizeof(Float), sizeof(Float)}};
+}
+
+void PlayerTest::addBatch() {
+    Float values[]{-1.0f, -1.0f, -1.0f};
+    Player<Float> player;
+    player.addBatch(Containers::StridedArrayView1D<const Float>{BatchKeys},
+        batchValues(), Math::lerp, Containers::stridedArrayView(values))
+        .play(2.0f);
+
+    CORRADE_VERIFY(!player.isEmpty());
+    CORRADE_COMPARE(player.size(), 0);
+    CORRADE_COMPARE(player.batchCount(), 1);
+    CORRADE_COMPARE(player.duration(), (Range1D{1.0f, 4.0f}));
+    CORRADE_COMPARE(player.state(), State::Playing);
+    CORRADE_COMPARE_AS(Containers::arrayView(values),
+        Containers::arrayView({-1.0f, -1.0f, -1.0f}),
+        TestSuite::Compare::Container);
+
+    /* 1.75 secs in, same as in add() */
+    player.advance(3.75f);
+    CORRADE_COMPARE(player.state(), State::Playing);
+    CORRADE_COMPARE_AS(Containers::arrayView(values),
+        Containers::arrayView({4.0f, 8.0f, -4.0f}),
+        TestSuite::Compare::Container);
+
+    /* Going back, the search should find the first keyframe again */
+    player.seekBy(-1.5f);
+    player.advance(3.75f);
+    CORRADE_COMPARE_AS(Containers::arrayView(values),
+        Containers::arrayView({1.75f, 3.5f, -1.75f}),
+        TestSuite::Compare::Container);
+
+    /* After the end it's parked at the last keyframe */
+    player.advance(10.0f);
+    CORRADE_COMPARE(player.state(), State::Stopped);
+    CORRADE_COMPARE_AS(Containers::arrayView(values),
+        Containers::arrayView({2.0f, 4.0f, -2.0f}),
+        TestSuite::Compare::Container);
+}
+
+void PlayerTest::addBatchExtrapolation() {
+    Float values[]{-1.0f, -1.0f, -1.0f};
+    Player<Float> player;
+    player.addBatch(Containers::StridedArrayView1D<const Float>{BatchKeys},
+        batchValues(), Math::lerp, Containers::stridedArrayView(values),
+        Extrapolation::DefaultConstructed, Extrapolation::Extrapolated)
+        .setDuration({0.0f, 5.0f})
+        .play(0.0f);
+
+    /* Before the first keyframe */
+    player.advance(0.5f);
+    CORRADE_COMPARE_AS(Containers::arrayView(values),
+        Containers::arrayView({0.0f, 0.0f, 0.0f}),
+        TestSuite::Compare::Container);
+
+    /* After the last keyframe */
+    player.advance(4.5f);
+    CORRADE_COMPARE_AS(Containers::arrayView(values),
+        Containers::arrayView({0.5f, 1.0f, -0.5f}),
+        TestSuite::Compare::Container);
+}
+
+void PlayerTest::addBatchWithTracks() {
+    const Float keys[]{0.5f, 3.0f};
+    const Float data[]{1.0f, 2.0f, 2.0f, 4.0f};
+
+    Float value = -1.0f;
+    Float values[]{-1.0f, -1.0f};
+    Player<Float> player;
+    player.addBatch(Containers::StridedArrayView1D<const Float>{keys},
+            Containers::StridedArrayView2D<const Float>{data, {2, 2}, {2*sizeof(Float), sizeof(Float)}},
+            Math::lerp, Containers::stridedArrayView(values))
+        .add(Track, value)
+        .play(0.0f);
+
+    /* Duration is a union of both */
+    CORRADE_COMPARE(player.size(), 1);
+    CORRADE_COMPARE(player.batchCount(), 1);
+    CORRADE_COMPARE(player.duration(), (Range1D{0.5f, 4.0f}));
+
+    /* 1.75 secs in, i.e. at key 2.25 */
+    player.advance(1.75f);
+    CORRADE_COMPARE(value, 2.75f);
+    CORRADE_COMPARE_AS(Containers::arrayView(values),
+        Containers::arrayView({1.7f, 3.4f}),
+        TestSuite::Compare::Container);
+}
+
+void PlayerTest::addBatchInvalidSize() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Float values[3];
+    Player<Float> player;
+    player.addBatch(Containers::StridedArrayView1D<const Float>{BatchKeys}.prefix(3),
+        batchValues(), Math::lerp, Containers::stridedArrayView(values));
+    player.addBatch(Containers::StridedArrayView1D<const Float>{BatchKeys},
+        batchValues(), Math::lerp, Containers::stridedArrayView(values).prefix(2));
+
+    CORRADE_COMPARE(out.str(),
+        "Animation::Player::addBatch(): expected 3 keyframes in values but got 4\n"
+        "Animation::Player::addBatch(): expected 3 destination items but got 2\n");
+}
+
 void PlayerTest::runFor100YearsFloat() {
     auto&& data = RunFor100YearsData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -118,6 +118,18 @@ an indirect function call.
 Note that when constructing the track by just passing @ref Interpolator to the
 constructor, the function is chosen by @ref interpolatorFor(), which favors
 correctness over performance. See its documentation for more information.
+
+@subsection Animation-Track-performance-compression Compressed data
+
+For large amounts of animation data, such as motion capture, the memory usage
+can be reduced by storing the values in a packed form and unpacking them on
+the fly with an interpolator created by @ref unpack(). Rotations can be packed
+to 48 bits using @ref packQuaternion() and positions to 16 bits per component
+relative to the track bounds using @ref quantizeInto(). Redundant keyframes
+can be removed with @ref reduceKeyframesInPlace() and if the keys are
+uniformly spaced, which can be checked with @ref uniformKeyStep(), they don't
+need to be stored at all and the values can be interpolated with
+@ref interpolateUniform().
 @experimental
 */
 template<class K, class V, class R
@@ -38,7 +38,7 @@
 namespace Magnum { namespace Audio {
 
 std::string AbstractImporter::pluginInterface() {
-    return "cz.mosra.magnum.Audio.AbstractImporter/0.1";
+    return "cz.mosra.magnum.Audio.AbstractImporter/0.1.1";
 }
 
 #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
@@ -125,6 +125,38 @@ Containers::Array<char> AbstractImporter::data() {
     return out;
 }
 
+std::size_t AbstractImporter::readFrames(const Containers::ArrayView<char> destination) {
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::readFrames(): no file opened", {});
+    CORRADE_ASSERT(features() & ImporterFeature::Streaming,
+        "Audio::AbstractImporter::readFrames(): feature not supported", {});
+
+    const std::size_t frameSize = bufferFormatFrameSize(doFormat());
+    CORRADE_ASSERT(destination.size() >= frameSize,
+        "Audio::AbstractImporter::readFrames(): expected space for at least one frame of" << frameSize << "bytes but got" << destination.size(), {});
+
+    const std::size_t frameCount = destination.size()/frameSize;
+    const std::size_t readFrameCount = doReadFrames(destination.prefix(frameCount*frameSize));
+    CORRADE_ASSERT(readFrameCount <= frameCount,
+        "Audio::AbstractImporter::readFrames(): implementation reported" << readFrameCount << "frames read but there's space for only" << frameCount, {});
+    return readFrameCount;
+}
+
+std::size_t AbstractImporter::doReadFrames(Containers::ArrayView<char>) {
+    CORRADE_ASSERT_UNREACHABLE("Audio::AbstractImporter::readFrames(): feature advertised but not implemented", {});
+}
+
+void AbstractImporter::seekFrame(const std::size_t frame) {
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::seekFrame(): no file opened", );
+    CORRADE_ASSERT(features() & ImporterFeature::Streaming,
+        "Audio::AbstractImporter::seekFrame(): feature not supported", );
+
+    doSeekFrame(frame);
+}
+
+void AbstractImporter::doSeekFrame(std::size_t) {
+    CORRADE_ASSERT_UNREACHABLE("Audio::AbstractImporter::seekFrame(): feature advertised but not implemented", );
+}
+
 Debug& operator<<(Debug& debug, const ImporterFeature value) {
     debug << "Audio::ImporterFeature" << Debug::nospace;
 
@@ -132,6 +164,7 @@ Debug& operator<<(Debug& debug, const ImporterFeature value) {
         /* LCOV_EXCL_START */
         #define _c(v) case ImporterFeature::v: return debug << "::" #v;
         _c(OpenData)
+        _c(Streaming)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -141,7 +174,8 @@ Debug& operator<<(Debug& debug, const ImporterFeature value) {
 
 Debug& operator<<(Debug& debug, const ImporterFeatures value) {
     return Containers::enumSetDebugOutput(debug, value, "Audio::ImporterFeatures{}", {
-        ImporterFeature::OpenData});
+        ImporterFeature::OpenData,
+        ImporterFeature::Streaming});
 }
 
 }}
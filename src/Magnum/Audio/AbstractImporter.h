@@ -44,7 +44,14 @@ namespace Magnum { namespace Audio {
 */
 enum class ImporterFeature: UnsignedByte {
     /** Opening files from raw data using @ref AbstractImporter::openData() */
-    OpenData = 1 << 0
+    OpenData = 1 << 0,
+
+    /**
+     * Reading the data in chunks using @ref AbstractImporter::readFrames()
+     * and @ref AbstractImporter::seekFrame()
+     * @m_since_latest
+     */
+    Streaming = 1 << 1
 };
 
 /**
@@ -70,6 +77,18 @@ Provides interface for importing various audio formats. See @ref plugins for
 more information and `*Importer` classes in @ref Audio namespace for available
 importer plugins.
 
+@section Audio-AbstractImporter-streaming Streaming
+
+The @ref data() function returns all data at once, which for long tracks can
+mean hundreds of megabytes allocated and decoded before playback can start.
+If the importer supports @ref ImporterFeature::Streaming, the data can be
+instead read in chunks of a fixed size into a caller-provided buffer using
+@ref readFrames(), making the memory use proportional just to the chunk size.
+See the @ref Stream class for playing a file this way through a
+@ref Source.
+
+@snippet MagnumAudio.cpp AbstractImporter-streaming
+
 @section Audio-AbstractImporter-data-dependency Data dependency
 
 The data returned from various functions *by design* have no dependency on the
@@ -84,6 +103,9 @@ destructing such instances after the plugin module has been unloaded.
 Plugin implements function @ref doFeatures(), @ref doIsOpened(), one of or both
 @ref doOpenData() and @ref doOpenFile() functions, function @ref doClose() and
 data access functions @ref doFormat(), @ref doFrequency() and @ref doData().
+If @ref ImporterFeature::Streaming is supported, the plugin implements also
+@ref doReadFrames() and @ref doSeekFrame(). The stream position is expected
+to be at the beginning after a file is opened.
 
 You don't need to do most of the redundant sanity checks, these things are
 checked by the implementation:
@@ -124,7 +146,7 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          * @brief Plugin interface
          *
          * @code{.cpp}
-         * "cz.mosra.magnum.Audio.AbstractImporter/0.1"
+         * "cz.mosra.magnum.Audio.AbstractImporter/0.1.1"
          * @endcode
          */
         static std::string pluginInterface();
@@ -194,6 +216,35 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /** @brief Sample data */
         Containers::Array<char> data();
 
+        /**
+         * @brief Read frames
+         * @param destination   Where to put the data
+         * @return Count of frames read
+         * @m_since_latest
+         *
+         * Reads at most @cpp destination.size()/bufferFormatFrameSize(format()) @ce
+         * frames, starting at current stream position, and advances the
+         * position. Returns less than that if the end of the data was
+         * reached, @cpp 0 @ce if there's nothing left to read. Available only
+         * if @ref ImporterFeature::Streaming is supported. Expects that a file
+         * is opened and that @p destination is large enough for at least one
+         * frame. The position is independent of @ref data().
+         * @see @ref features(), @ref seekFrame(), @ref bufferFormatFrameSize()
+         */
+        std::size_t readFrames(Containers::ArrayView<char> destination);
+
+        /**
+         * @brief Seek to given frame
+         * @m_since_latest
+         *
+         * Sets stream position for subsequent @ref readFrames() calls. A
+         * position past the end is clamped to the end. Available only if
+         * @ref ImporterFeature::Streaming is supported. Expects that a file is
+         * opened.
+         * @see @ref features()
+         */
+        void seekFrame(std::size_t frame);
+
         /* Since 1.8.17, the original short-hand group closing doesn't work
            anymore. FFS. */
         /**
@@ -230,6 +281,21 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractManagi
 
         /** @brief Implementation for @ref data() */
         virtual Containers::Array<char> doData() = 0;
+
+        /**
+         * @brief Implementation for @ref readFrames()
+         * @m_since_latest
+         *
+         * The @p destination is guaranteed to have a size that's a non-zero
+         * multiple of the frame size. Return count of frames written to it.
+         */
+        virtual std::size_t doReadFrames(Containers::ArrayView<char> destination);
+
+        /**
+         * @brief Implementation for @ref seekFrame()
+         * @m_since_latest
+         */
+        virtual void doSeekFrame(std::size_t frame);
 };
 
 }}
@@ -26,7 +26,7 @@
 */
 
 /** @file
- * @brief Enum @ref Magnum::Audio::BufferFormat
+ * @brief Enum @ref Magnum::Audio::BufferFormat, function @ref Magnum::Audio::bufferFormatFrameSize()
  */
 
 #include <al.h>
@@ -190,6 +190,16 @@ enum class BufferFormat: ALenum {
     Surround71Channel32 = AL_FORMAT_71CHN32
 };
 
+/**
+@brief Size of a single frame in given buffer format
+@m_since_latest
+
+Size of one sample for all channels, in bytes. Expects that @p format is
+valid.
+@see @ref AbstractImporter::readFrames()
+*/
+MAGNUM_AUDIO_EXPORT UnsignedInt bufferFormatFrameSize(BufferFormat format);
+
 /** @debugoperatorenum{BufferFormat} */
 MAGNUM_AUDIO_EXPORT Debug& operator<<(Debug& debug, BufferFormat value);
 
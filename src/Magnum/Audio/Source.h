@@ -47,8 +47,8 @@ namespace Magnum { namespace Audio {
 /**
 @brief Source
 
-Manages positional audio source.
-@todo Expose convenient API for buffer queuing
+Manages positional audio source. See the @ref Stream class for a convenient
+way to play long files using buffer queuing.
 */
 class MAGNUM_AUDIO_EXPORT Source {
     public:
@@ -542,6 +542,27 @@ class MAGNUM_AUDIO_EXPORT Source {
          */
         std::size_t unqueueBuffers(Containers::ArrayView<Containers::Reference<Buffer>> buffers);
 
+        /**
+         * @brief Count of queued buffers
+         * @m_since_latest
+         *
+         * Includes also the buffers that were already processed.
+         * @see @ref processedBufferCount(), @ref queueBuffers(),
+         *      @fn_al_keyword{GetSourcei} with @def_al{BUFFERS_QUEUED}
+         */
+        Int queuedBufferCount() const;
+
+        /**
+         * @brief Count of processed buffers
+         * @m_since_latest
+         *
+         * Count of queued buffers that were already played and can be
+         * unqueued.
+         * @see @ref queuedBufferCount(), @ref unqueueBuffers(),
+         *      @fn_al_keyword{GetSourcei} with @def_al{BUFFERS_PROCESSED}
+         */
+        Int processedBufferCount() const;
+
         /* Since 1.8.17, the original short-hand group closing doesn't work
            anymore. FFS. */
         /**
@@ -804,6 +825,18 @@ inline Float Source::offsetInSeconds() const {
     return offset;
 }
 
+inline Int Source::queuedBufferCount() const {
+    Int count;
+    alGetSourcei(_id, AL_BUFFERS_QUEUED, &count);
+    return count;
+}
+
+inline Int Source::processedBufferCount() const {
+    Int count;
+    alGetSourcei(_id, AL_BUFFERS_PROCESSED, &count);
+    return count;
+}
+
 inline Int Source::offsetInBytes() const {
     Int offset;
     alGetSourcei(_id, AL_BYTE_OFFSET, &offset);
@@ -0,0 +1,127 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Stream.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Audio/AbstractImporter.h"
+#include "Magnum/Audio/Source.h"
+
+namespace Magnum { namespace Audio {
+
+Stream::Stream(AbstractImporter& importer, Source& source, const UnsignedInt bufferCount, const std::size_t bufferSize): _importer{&importer}, _source{&source} {
+    CORRADE_ASSERT(importer.isOpened(),
+        "Audio::Stream: no file opened", );
+    CORRADE_ASSERT(importer.features() & ImporterFeature::Streaming,
+        "Audio::Stream: importer doesn't support streaming", );
+    CORRADE_ASSERT(bufferCount,
+        "Audio::Stream: expected at least one buffer", );
+
+    _format = importer.format();
+    _frequency = importer.frequency();
+    _frameSize = bufferFormatFrameSize(_format);
+    CORRADE_ASSERT(bufferSize >= _frameSize,
+        "Audio::Stream: expected buffer size to be at least one frame of" << _frameSize << "bytes but got" << bufferSize, );
+
+    _buffers = Containers::Array<Buffer>{bufferCount};
+    _data = Containers::Array<char>{Containers::NoInit, bufferSize/_frameSize*_frameSize};
+}
+
+Stream::Stream(Stream&&) noexcept = default;
+
+Stream::~Stream() = default;
+
+Stream& Stream::operator=(Stream&&) noexcept = default;
+
+bool Stream::fill(Buffer& buffer) {
+    std::size_t frameCount = _importer->readFrames(_data);
+
+    /* If at the end, continue from the beginning for a looping stream. If the
+       data are empty, there's nothing to loop over. */
+    if(!frameCount && _looping) {
+        _importer->seekFrame(0);
+        frameCount = _importer->readFrames(_data);
+    }
+
+    if(!frameCount) {
+        _finished = true;
+        return false;
+    }
+
+    buffer.setData(_format, _data.prefix(frameCount*_frameSize), _frequency);
+    return true;
+}
+
+Stream& Stream::start() {
+    /* Detach everything that's queued */
+    _source->setBuffer(nullptr);
+
+    _importer->seekFrame(0);
+    _finished = false;
+
+    for(Buffer& buffer: _buffers) {
+        if(!fill(buffer)) break;
+
+        ALuint id = buffer.id();
+        alSourceQueueBuffers(_source->id(), 1, &id);
+    }
+
+    return *this;
+}
+
+UnsignedInt Stream::update() {
+    const Int processedCount = _source->processedBufferCount();
+    if(!processedCount) return 0;
+
+    /* Refill the played buffers in the order they were queued and queue them
+       again until we run out of data */
+    UnsignedInt refilledCount = 0;
+    for(Int i = 0; i != processedCount; ++i) {
+        ALuint id;
+        alSourceUnqueueBuffers(_source->id(), 1, &id);
+        if(_finished) continue;
+
+        for(Buffer& buffer: _buffers) {
+            if(buffer.id() != id) continue;
+
+            if(fill(buffer)) {
+                alSourceQueueBuffers(_source->id(), 1, &id);
+                ++refilledCount;
+            }
+            break;
+        }
+    }
+
+    /* If update() wasn't called often enough, the source played all queued
+       buffers and stopped. It has to be restarted, otherwise the refilled
+       buffers would never get played. */
+    if(refilledCount && _source->state() == Source::State::Stopped)
+        _source->play();
+
+    return refilledCount;
+}
+
+}}
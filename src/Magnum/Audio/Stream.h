@@ -0,0 +1,190 @@
+#ifndef Magnum_Audio_Stream_h
+#define Magnum_Audio_Stream_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Audio::Stream
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Audio/Audio.h"
+#include "Magnum/Audio/Buffer.h"
+#include "Magnum/Audio/BufferFormat.h"
+#include "Magnum/Audio/visibility.h"
+
+namespace Magnum { namespace Audio {
+
+/**
+@brief Streaming playback
+@m_since_latest
+
+Plays audio data from an @ref AbstractImporter supporting
+@ref ImporterFeature::Streaming through a @ref Source using a fixed set of
+queued buffers. Only as much data as fits into the buffers is decoded at a
+time, so the memory use is independent of the file length and the playback
+can start right after the first buffers get filled.
+
+@section Audio-Stream-usage Usage
+
+Call @ref start() to fill and queue all buffers, then play the source as
+usual. Then, periodically --- for example once every frame --- call
+@ref update(), which refills the buffers that were already played and queues
+them again:
+
+@snippet MagnumAudio.cpp Stream-usage
+
+The @ref update() has to be called often enough so the source doesn't run
+out of queued buffers, otherwise it stops and there's an audible gap until
+@ref update() restarts it. A total buffer length of at least
+a few frames is recommended --- for example three buffers of 16 kB each, which
+for a 16-bit stereo 48 kHz file is about a quarter of a second of audio.
+
+The importer and the source are expected to stay alive for the whole lifetime
+of the stream. The importer is expected to not be closed or reopened during
+that time.
+*/
+class MAGNUM_AUDIO_EXPORT Stream {
+    public:
+        /**
+         * @brief Constructor
+         * @param importer      Importer with an opened file
+         * @param source        Source to play the stream through
+         * @param bufferCount   Count of buffers to queue
+         * @param bufferSize    Size of each buffer in bytes
+         *
+         * Expects that @p importer has a file opened and supports
+         * @ref ImporterFeature::Streaming and that @p bufferCount is not zero.
+         * The @p bufferSize is rounded down to a multiple of the frame size,
+         * but has to be large enough for at least one frame. Creates the
+         * buffers but doesn't queue anything, call @ref start() for that.
+         */
+        explicit Stream(AbstractImporter& importer, Source& source, UnsignedInt bufferCount = 3, std::size_t bufferSize = 16384);
+
+        /** @brief Copying is not allowed */
+        Stream(const Stream&) = delete;
+
+        /** @brief Move constructor */
+        Stream(Stream&&) noexcept;
+
+        ~Stream();
+
+        /** @brief Copying is not allowed */
+        Stream& operator=(const Stream&) = delete;
+
+        /** @brief Move assignment */
+        Stream& operator=(Stream&&) noexcept;
+
+        /** @brief Importer */
+        AbstractImporter& importer() { return *_importer; }
+
+        /** @brief Source */
+        Source& source() { return *_source; }
+
+        /** @brief Count of buffers */
+        UnsignedInt bufferCount() const { return _buffers.size(); }
+
+        /**
+         * @brief Size of each buffer in bytes
+         *
+         * The size passed to the constructor rounded down to a multiple of
+         * the frame size.
+         */
+        std::size_t bufferSize() const { return _data.size(); }
+
+        /** @brief Whether the stream is looping */
+        bool isLooping() const { return _looping; }
+
+        /**
+         * @brief Set whether the stream is looping
+         * @return Reference to self (for method chaining)
+         *
+         * If enabled, once the end of the data is reached, the stream
+         * continues from the beginning. Disabled by default. Note that
+         * @ref Source::setLooping() can't be used with streaming sources.
+         */
+        Stream& setLooping(bool looping) {
+            _looping = looping;
+            return *this;
+        }
+
+        /**
+         * @brief Whether all data were queued
+         *
+         * Set once the end of the data is reached and the stream is not
+         * looping. The source can still be playing the remaining queued
+         * buffers.
+         */
+        bool isFinished() const { return _finished; }
+
+        /**
+         * @brief Start the stream
+         * @return Reference to self (for method chaining)
+         *
+         * Detaches all buffers from the source, seeks the importer to the
+         * beginning and fills and queues as many buffers as there are data
+         * for. Expects that the source is not playing. Call
+         * @ref Source::play() after to start the playback.
+         * @see @ref Source::setBuffer(), @ref AbstractImporter::seekFrame()
+         */
+        Stream& start();
+
+        /**
+         * @brief Update the stream
+         * @return Count of buffers that were refilled and queued again
+         *
+         * Unqueues buffers that were already played by the source, refills
+         * them with subsequent data and queues them again. Buffers for which
+         * there are no data left stay unqueued.
+         *
+         * If the source played all queued buffers before this function got
+         * called, it's in the @ref Source::State::Stopped state. In that
+         * case, if any buffers got refilled, the source is started again
+         * using @ref Source::play(). That also means a stream can't be
+         * stopped by just stopping the source --- stop calling this function
+         * as well.
+         * @see @ref Source::processedBufferCount(), @ref Source::state()
+         */
+        UnsignedInt update();
+
+    private:
+        MAGNUM_AUDIO_LOCAL bool fill(Buffer& buffer);
+
+        AbstractImporter* _importer;
+        Source* _source;
+        BufferFormat _format;
+        UnsignedInt _frequency;
+        UnsignedInt _frameSize;
+        bool _looping{}, _finished{};
+        Containers::Array<Buffer> _buffers;
+        Containers::Array<char> _data;
+};
+
+}}
+
+#endif
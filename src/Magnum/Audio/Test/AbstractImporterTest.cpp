@@ -63,6 +63,17 @@ struct AbstractImporterTest: TestSuite::Tester {
     void dataNoFile();
     void dataCustomDeleter();
 
+    void readFrames();
+    void readFramesNoFile();
+    void readFramesNotSupported();
+    void readFramesNotImplemented();
+    void readFramesTooSmall();
+    void readFramesInvalidCount();
+    void seekFrame();
+    void seekFrameNoFile();
+    void seekFrameNotSupported();
+    void seekFrameNotImplemented();
+
     void debugFeature();
     void debugFeatures();
 };
@@ -88,6 +99,17 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::dataNoFile,
               &AbstractImporterTest::dataCustomDeleter,
 
+              &AbstractImporterTest::readFrames,
+              &AbstractImporterTest::readFramesNoFile,
+              &AbstractImporterTest::readFramesNotSupported,
+              &AbstractImporterTest::readFramesNotImplemented,
+              &AbstractImporterTest::readFramesTooSmall,
+              &AbstractImporterTest::readFramesInvalidCount,
+              &AbstractImporterTest::seekFrame,
+              &AbstractImporterTest::seekFrameNoFile,
+              &AbstractImporterTest::seekFrameNotSupported,
+              &AbstractImporterTest::seekFrameNotImplemented,
+
               &AbstractImporterTest::debugFeature,
               &AbstractImporterTest::debugFeatures});
 }
@@ -389,6 +411,240 @@ void AbstractImporterTest::dataCustomDeleter() {
     CORRADE_COMPARE(out.str(), "Audio::AbstractImporter::data(): implementation is not allowed to use a custom Array deleter\n");
 }
 
+void AbstractImporterTest::readFrames() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::Streaming; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return BufferFormat::Stereo16; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+
+        std::size_t doReadFrames(Containers::ArrayView<char> destination) override {
+            /* The view should be cut to whole frames */
+            CORRADE_COMPARE(destination.size(), 8);
+            destination[0] = 'H';
+            destination[4] = 'i';
+            return 2;
+        }
+    } importer;
+
+    char out[11]{};
+    CORRADE_COMPARE(importer.readFrames(out), 2);
+    CORRADE_COMPARE(out[0], 'H');
+    CORRADE_COMPARE(out[4], 'i');
+}
+
+void AbstractImporterTest::readFramesNoFile() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::Streaming; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    char data[4];
+    importer.readFrames(data);
+    CORRADE_COMPARE(out.str(), "Audio::AbstractImporter::readFrames(): no file opened\n");
+}
+
+void AbstractImporterTest::readFramesNotSupported() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return BufferFormat::Mono8; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    char data[4];
+    importer.readFrames(data);
+    CORRADE_COMPARE(out.str(), "Audio::AbstractImporter::readFrames(): feature not supported\n");
+}
+
+void AbstractImporterTest::readFramesNotImplemented() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::Streaming; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return BufferFormat::Mono8; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    char data[4];
+    importer.readFrames(data);
+    CORRADE_COMPARE(out.str(), "Audio::AbstractImporter::readFrames(): feature advertised but not implemented\n");
+}
+
+void AbstractImporterTest::readFramesTooSmall() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::Streaming; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return BufferFormat::StereoFloat; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+
+        std::size_t doReadFrames(Containers::ArrayView<char>) override {
+            CORRADE_VERIFY(!"this shouldn't be called");
+            return {};
+        }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    char data[7];
+    importer.readFrames(data);
+    CORRADE_COMPARE(out.str(), "Audio::AbstractImporter::readFrames(): expected space for at least one frame of 8 bytes but got 7\n");
+}
+
+void AbstractImporterTest::readFramesInvalidCount() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::Streaming; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return BufferFormat::Mono16; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+
+        std::size_t doReadFrames(Containers::ArrayView<char>) override {
+            return 3;
+        }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    char data[5];
+    importer.readFrames(data);
+    CORRADE_COMPARE(out.str(), "Audio::AbstractImporter::readFrames(): implementation reported 3 frames read but there's space for only 2\n");
+}
+
+void AbstractImporterTest::seekFrame() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::Streaming; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+
+        void doSeekFrame(std::size_t frame) override { seeked = frame; }
+
+        std::size_t seeked{};
+    } importer;
+
+    importer.seekFrame(1337);
+    CORRADE_COMPARE(importer.seeked, 1337);
+}
+
+void AbstractImporterTest::seekFrameNoFile() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::Streaming; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    importer.seekFrame(0);
+    CORRADE_COMPARE(out.str(), "Audio::AbstractImporter::seekFrame(): no file opened\n");
+}
+
+void AbstractImporterTest::seekFrameNotSupported() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    importer.seekFrame(0);
+    CORRADE_COMPARE(out.str(), "Audio::AbstractImporter::seekFrame(): feature not supported\n");
+}
+
+void AbstractImporterTest::seekFrameNotImplemented() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::Streaming; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    importer.seekFrame(0);
+    CORRADE_COMPARE(out.str(), "Audio::AbstractImporter::seekFrame(): feature advertised but not implemented\n");
+}
+
 void AbstractImporterTest::debugFeature() {
     std::ostringstream out;
 
@@ -399,8 +655,8 @@ void AbstractImporterTest::debugFeature() {
 void AbstractImporterTest::debugFeatures() {
     std::ostringstream out;
 
-    Debug{&out} << ImporterFeature::OpenData << ImporterFeatures{};
-    CORRADE_COMPARE(out.str(), "Audio::ImporterFeature::OpenData Audio::ImporterFeatures{}\n");
+    Debug{&out} << (ImporterFeature::OpenData|ImporterFeature::Streaming) << ImporterFeatures{};
+    CORRADE_COMPARE(out.str(), "Audio::ImporterFeature::OpenData|Audio::ImporterFeature::Streaming Audio::ImporterFeatures{}\n");
 }
 
 }}}}
@@ -0,0 +1,271 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/System.h>
+
+#include "Magnum/Audio/AbstractImporter.h"
+#include "Magnum/Audio/BufferFormat.h"
+#include "Magnum/Audio/Context.h"
+#include "Magnum/Audio/Source.h"
+#include "Magnum/Audio/Stream.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Audio { namespace Test { namespace {
+
+struct StreamALTest: TestSuite::Tester {
+    explicit StreamALTest();
+
+    void construct();
+    void constructNotSupported();
+    void constructZeroBuffers();
+    void constructBufferTooSmall();
+
+    void start();
+    void startShortData();
+    void update();
+    void updateLooping();
+    void updateUnderrun();
+
+    Context _context;
+};
+
+StreamALTest::StreamALTest():
+    TestSuite::Tester{TestSuite::Tester::TesterConfiguration{}.setSkippedArgumentPrefixes({"magnum"})},
+    _context{arguments().first, arguments().second}
+{
+    addTests({&StreamALTest::construct,
+              &StreamALTest::constructNotSupported,
+              &StreamALTest::constructZeroBuffers,
+              &StreamALTest::constructBufferTooSmall,
+
+              &StreamALTest::start,
+              &StreamALTest::startShortData,
+              &StreamALTest::update,
+              &StreamALTest::updateLooping,
+              &StreamALTest::updateUnderrun});
+}
+
+/* Mono16 importer producing given count of frames with a value equal to
+   the frame index */
+struct Importer: AbstractImporter {
+    explicit Importer(std::size_t frameCount, ImporterFeatures features = ImporterFeature::Streaming): _frameCount{frameCount}, _features{features} {}
+
+    ImporterFeatures doFeatures() const override { return _features; }
+    bool doIsOpened() const override { return true; }
+    void doClose() override {}
+
+    BufferFormat doFormat() const override { return BufferFormat::Mono16; }
+    UnsignedInt doFrequency() const override { return 22050; }
+    Containers::Array<char> doData() override { return nullptr; }
+
+    std::size_t doReadFrames(Containers::ArrayView<char> destination) override {
+        const Containers::ArrayView<UnsignedShort> frames = Containers::arrayCast<UnsignedShort>(destination);
+        std::size_t i = 0;
+        for(; i != frames.size() && _position != _frameCount; ++i, ++_position)
+            frames[i] = _position;
+        return i;
+    }
+
+    void doSeekFrame(std::size_t frame) override {
+        _position = Math::min(frame, _frameCount);
+    }
+
+    std::size_t _frameCount, _position{};
+    ImporterFeatures _features;
+};
+
+void StreamALTest::construct() {
+    Importer importer{100};
+    Source source;
+
+    /* Size rounded down to whole frames */
+    Stream stream{importer, source, 4, 31};
+    CORRADE_COMPARE(&stream.importer(), &importer);
+    CORRADE_COMPARE(&stream.source(), &source);
+    CORRADE_COMPARE(stream.bufferCount(), 4);
+    CORRADE_COMPARE(stream.bufferSize(), 30);
+    CORRADE_VERIFY(!stream.isLooping());
+    CORRADE_VERIFY(!stream.isFinished());
+
+    /* Nothing is queued yet */
+    CORRADE_COMPARE(source.queuedBufferCount(), 0);
+}
+
+void StreamALTest::constructNotSupported() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Importer importer{100, {}};
+    Source source;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Stream{importer, source};
+    CORRADE_COMPARE(out.str(), "Audio::Stream: importer doesn't support streaming\n");
+}
+
+void StreamALTest::constructZeroBuffers() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Importer importer{100};
+    Source source;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Stream{importer, source, 0};
+    CORRADE_COMPARE(out.str(), "Audio::Stream: expected at least one buffer\n");
+}
+
+void StreamALTest::constructBufferTooSmall() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Importer importer{100};
+    Source source;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Stream{importer, source, 3, 1};
+    CORRADE_COMPARE(out.str(), "Audio::Stream: expected buffer size to be at least one frame of 2 bytes but got 1\n");
+}
+
+void StreamALTest::start() {
+    Importer importer{100};
+    Source source;
+
+    Stream stream{importer, source, 3, 20};
+    stream.start();
+    CORRADE_COMPARE(source.queuedBufferCount(), 3);
+    CORRADE_COMPARE(source.processedBufferCount(), 0);
+    CORRADE_COMPARE(importer._position, 30);
+    CORRADE_VERIFY(!stream.isFinished());
+
+    /* Starting again rewinds the importer and replaces the queue */
+    stream.start();
+    CORRADE_COMPARE(source.queuedBufferCount(), 3);
+    CORRADE_COMPARE(importer._position, 30);
+}
+
+void StreamALTest::startShortData() {
+    Importer importer{15};
+    Source source;
+
+    /* There's data for only two buffers */
+    Stream stream{importer, source, 3, 20};
+    stream.start();
+    CORRADE_COMPARE(source.queuedBufferCount(), 2);
+    CORRADE_VERIFY(stream.isFinished());
+}
+
+void StreamALTest::update() {
+    Importer importer{50};
+    Source source;
+
+    Stream stream{importer, source, 2, 20};
+    stream.start();
+    CORRADE_COMPARE(stream.update(), 0);
+
+    /* Stopping the source marks all queued buffers as processed, which then
+       get refilled with the next data */
+    source.stop();
+    CORRADE_COMPARE(source.processedBufferCount(), 2);
+    CORRADE_COMPARE(stream.update(), 2);
+    CORRADE_COMPARE(source.queuedBufferCount(), 2);
+    CORRADE_COMPARE(importer._position, 40);
+    CORRADE_VERIFY(!stream.isFinished());
+
+    /* Only one buffer gets refilled with the remaining 10 frames, the other
+       is unqueued */
+    source.play();
+    source.stop();
+    CORRADE_COMPARE(stream.update(), 1);
+    CORRADE_COMPARE(source.queuedBufferCount(), 1);
+    CORRADE_VERIFY(stream.isFinished());
+
+    /* Nothing more to refill */
+    source.play();
+    source.stop();
+    CORRADE_COMPARE(stream.update(), 0);
+    CORRADE_COMPARE(source.queuedBufferCount(), 0);
+}
+
+void StreamALTest::updateLooping() {
+    Importer importer{15};
+    Source source;
+
+    Stream stream{importer, source, 2, 20};
+    stream.setLooping(true);
+    CORRADE_VERIFY(stream.isLooping());
+    stream.start();
+    CORRADE_COMPARE(source.queuedBufferCount(), 2);
+    CORRADE_COMPARE(importer._position, 15);
+
+    /* The importer is rewound once it reaches the end */
+    source.stop();
+    CORRADE_COMPARE(stream.update(), 2);
+    CORRADE_COMPARE(source.queuedBufferCount(), 2);
+    CORRADE_COMPARE(importer._position, 15);
+    CORRADE_VERIFY(!stream.isFinished());
+}
+
+void StreamALTest::updateUnderrun() {
+    Importer importer{10000};
+    Source source;
+
+    /* Two buffers of 2205 frames, each a tenth of a second long */
+    Stream stream{importer, source, 2, 4410};
+    stream.start();
+    source.play();
+
+    /* Don't call update() until the source plays everything and stops on its
+       own */
+    for(std::size_t i = 0; i != 100 && source.state() != Source::State::Stopped; ++i)
+        Utility::System::sleep(10);
+    CORRADE_COMPARE(source.state(), Source::State::Stopped);
+    CORRADE_COMPARE(source.processedBufferCount(), 2);
+
+    /* The refilled buffers would never get played if the source wasn't
+       restarted */
+    CORRADE_COMPARE(stream.update(), 2);
+    CORRADE_COMPARE(source.queuedBufferCount(), 2);
+    CORRADE_COMPARE(source.state(), Source::State::Playing);
+
+    /* Once there's nothing to refill, the source is left stopped */
+    source.stop();
+    importer.seekFrame(10000);
+    CORRADE_COMPARE(stream.update(), 0);
+    CORRADE_COMPARE(source.state(), Source::State::Stopped);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Audio::Test::StreamALTest)
@@ -0,0 +1,84 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "parallelFor.h"
+
+#include <Corrade/configure.h>
+
+/* Corrade without CORRADE_BUILD_MULTITHREADED is meant for environments where
+   threads are not available, and the same holds for Emscripten without
+   pthreads. The condition has to match the one in CMakeLists.txt that decides
+   whether the threading library is linked. */
+#if defined(CORRADE_BUILD_MULTITHREADED) && (!defined(CORRADE_TARGET_EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__))
+#define _MAGNUM_PARALLEL_FOR_USE_THREADS
+#endif
+
+#ifdef _MAGNUM_PARALLEL_FOR_USE_THREADS
+#include <thread>
+#include <Corrade/Containers/Array.h>
+#endif
+
+namespace Magnum { namespace Implementation {
+
+UnsignedInt parallelThreadCount(UnsignedInt threadCount) {
+    #ifdef _MAGNUM_PARALLEL_FOR_USE_THREADS
+    if(!threadCount) threadCount = std::thread::hardware_concurrency();
+    return threadCount ? threadCount : 1;
+    #else
+    static_cast<void>(threadCount);
+    return 1;
+    #endif
+}
+
+void parallelFor(const std::size_t count, const UnsignedInt chunkCount, void(*const f)(void*, std::size_t, std::size_t, UnsignedInt), void* const state) {
+    if(chunkCount <= 1) {
+        f(state, 0, count, 0);
+        return;
+    }
+
+    #ifdef _MAGNUM_PARALLEL_FOR_USE_THREADS
+    Containers::Array<std::thread> threads{chunkCount - 1};
+    for(UnsignedInt i = 1; i != chunkCount; ++i)
+        threads[i - 1] = std::thread{f, state, count*i/chunkCount, count*(i + 1)/chunkCount, i};
+    f(state, 0, count/chunkCount, 0);
+    for(std::thread& thread: threads) thread.join();
+    #else
+    for(UnsignedInt i = 0; i != chunkCount; ++i)
+        f(state, count*i/chunkCount, count*(i + 1)/chunkCount, i);
+    #endif
+}
+
+void parallelFor(const std::size_t count, const UnsignedInt threadCount, const std::size_t minChunkSize, void(*const f)(void*, std::size_t, std::size_t), void* const state) {
+    struct Wrapper {
+        void(*f)(void*, std::size_t, std::size_t);
+        void* state;
+    } wrapper{f, state};
+    parallelFor(count, parallelChunkCount(count, threadCount, minChunkSize), [](void* wrapper, const std::size_t begin, const std::size_t end, UnsignedInt) {
+        Wrapper& w = *static_cast<Wrapper*>(wrapper);
+        w.f(w.state, begin, end);
+    }, &wrapper);
+}
+
+}}
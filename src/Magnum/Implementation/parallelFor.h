@@ -0,0 +1,82 @@
+#ifndef Magnum_Implementation_parallelFor_h
+#define Magnum_Implementation_parallelFor_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <type_traits>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Implementation {
+
+/* Resolves zero `threadCount` to the count of available hardware threads.
+   If Magnum is built without thread support (Corrade built without
+   CORRADE_BUILD_MULTITHREADED or Emscripten without pthreads), always returns
+   1. */
+MAGNUM_EXPORT UnsignedInt parallelThreadCount(UnsignedInt threadCount);
+
+/* Calculates how many chunks to split `count` items into for parallel
+   processing. Zero `threadCount` means all available hardware threads. Each
+   chunk gets at least `minChunkSize` items, so small workloads don't pay for
+   spawning threads. Always 1 if Magnum is built without thread support. */
+inline UnsignedInt parallelChunkCount(const std::size_t count, UnsignedInt threadCount, const std::size_t minChunkSize = 1) {
+    threadCount = parallelThreadCount(threadCount);
+
+    const std::size_t maxChunkCount = minChunkSize ? count/minChunkSize : count;
+    if(maxChunkCount < threadCount)
+        return maxChunkCount ? UnsignedInt(maxChunkCount) : 1;
+    return threadCount;
+}
+
+/* Splits the [0, count) range into `chunkCount` contiguous chunks and calls
+   `f(state, begin, end, chunk)` for each. First chunk is processed on the
+   calling thread, the others on newly spawned threads, and the function
+   returns only after all of them finish. For the same `count` and
+   `chunkCount` the ranges are always the same, which means consecutive calls
+   can share per-chunk data. With a single chunk no thread is spawned at all.
+   If Magnum is built without thread support, all chunks are processed one
+   after another on the calling thread.
+
+   Defined in a source file so the threading library is linked only to Magnum
+   itself and not to everything that includes this header. */
+MAGNUM_EXPORT void parallelFor(std::size_t count, UnsignedInt chunkCount, void(*f)(void*, std::size_t, std::size_t, UnsignedInt), void* state);
+
+/* Splits the [0, count) range into chunks of at least `minChunkSize` items
+   processed by up to `threadCount` threads and calls `f(state, begin, end)`
+   for each. Meant for templated code in *.hpp headers, which shouldn't
+   depend on the std::thread machinery. */
+MAGNUM_EXPORT void parallelFor(std::size_t count, UnsignedInt threadCount, std::size_t minChunkSize, void(*f)(void*, std::size_t, std::size_t), void* state);
+
+/* Convenience wrapper for the above, calling `f(begin, end, chunk)` */
+template<class F> void parallelFor(const std::size_t count, const UnsignedInt chunkCount, F&& f) {
+    parallelFor(count, chunkCount, [](void* state, const std::size_t begin, const std::size_t end, const UnsignedInt chunk) {
+        (*static_cast<typename std::remove_reference<F>::type*>(state))(begin, end, chunk);
+    }, const_cast<void*>(static_cast<const void*>(&f)));
+}
+
+}}
+
+#endif
@@ -25,43 +25,509 @@
 
 #include "PackingBatch.h"
 
+#include <cstring>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Utility/Assert.h>
 
 #include "Magnum/Math/Packing.h"
 #include "Magnum/Math/Implementation/halfTables.hpp"
 
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+
+/* AVX2 and F16C variants are compiled always on x86 and picked at runtime
+   based on CPUID. GCC 4.8 doesn't allow using the intrinsics without enabling
+   them for the whole file, so it gets just SSE2. */
+#if defined(CORRADE_TARGET_X86) && ((defined(CORRADE_TARGET_GCC) && (defined(CORRADE_TARGET_CLANG) || __GNUC__ >= 5)) || defined(CORRADE_TARGET_MSVC))
+#define MAGNUM_PACKING_RUNTIME_DISPATCH
+#include <immintrin.h>
+#ifdef CORRADE_TARGET_MSVC
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#if defined(CORRADE_TARGET_GCC) || defined(CORRADE_TARGET_CLANG)
+#define MAGNUM_PACKING_ENABLE_AVX2 __attribute__((__target__("avx2")))
+#define MAGNUM_PACKING_ENABLE_F16C __attribute__((__target__("avx,f16c")))
+#else
+#define MAGNUM_PACKING_ENABLE_AVX2
+#define MAGNUM_PACKING_ENABLE_F16C
+#endif
+#endif
+
+/* NEON is always present on 64-bit ARM, the 32-bit variant lacks the
+   rounding and division instructions needed here */
+#if defined(CORRADE_TARGET_ARM) && defined(__aarch64__)
+#define MAGNUM_PACKING_NEON
+#include <arm_neon.h>
+#endif
+
 namespace Magnum { namespace Math {
 
 namespace {
 
-template<class T> inline void unpackUnsignedIntoImplementation(const Corrade::Containers::StridedArrayView2D<const T>& src, const Corrade::Containers::StridedArrayView2D<Float>& dst) {
-    CORRADE_ASSERT(src.size() == dst.size(),
-        "Math::unpackInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
-    CORRADE_ASSERT(src.template isContiguous<1>() && dst.isContiguous<1>(),
-        "Math::unpackInto(): second view dimension is not contiguous", );
+/* Kernels converting a contiguous range of `count` values. The scalar ones
+   are used as a fallback and to process the remaining values that don't fill
+   a whole SIMD register. */
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
+template<class T> void unpackUnsignedScalar(const T* src, Float* dst, const std::size_t count) {
+    /* Caching values to avoid inline function calls in debug builds */
+    constexpr Float bitMax = Implementation::bitMax<T>();
+    for(std::size_t i = 0; i != count; ++i)
+        dst[i] = src[i]/bitMax;
+}
+
+template<class T> void unpackSignedScalar(const T* src, Float* dst, const std::size_t count) {
+    /* Caching values to avoid inline function calls in debug builds */
+    constexpr Float bitMax = Implementation::bitMax<T>();
+    for(std::size_t i = 0; i != count; ++i) {
+        const Float value = src[i]/bitMax;
+        /* Avoiding a max() call in Debug */
+        dst[i] = value < -1.0f ? -1.0f : value;
+    }
+}
 
-    /* Caching values to avoid inline function calls in ebug builds */
+template<class T> void packScalar(const Float* src, T* dst, const std::size_t count) {
+    /* Caching values to avoid inline function calls in debug builds */
     constexpr Float bitMax = Implementation::bitMax<T>();
+    for(std::size_t i = 0; i != count; ++i)
+        /** @todo provide a version that doesn't do rounding */
+        dst[i] = T(std::round(src[i]*bitMax));
+}
+
+void unpackHalfScalar(const UnsignedShort* src, Float* dst, const std::size_t count) {
+    UnsignedInt* dstBits = reinterpret_cast<UnsignedInt*>(dst);
+    for(std::size_t i = 0; i != count; ++i) {
+        const UnsignedShort h = src[i];
+        UnsignedInt f = HalfMantissaTable[HalfOffsetTable[h >> 10] + (h & 0x3ff)] + HalfExponentTable[h >> 10];
+        /* Make signaling NaNs quiet, same as F16C and NEON do */
+        if((h & 0x7c00) == 0x7c00 && (h & 0x03ff)) f |= 0x00400000;
+        dstBits[i] = f;
+    }
+}
+
+void packHalfScalar(const Float* src, UnsignedShort* dst, const std::size_t count) {
+    const UnsignedInt* srcBits = reinterpret_cast<const UnsignedInt*>(src);
+    for(std::size_t i = 0; i != count; ++i) {
+        const UnsignedInt f = srcBits[i];
+        UnsignedShort h = HalfBaseTable[(f >> 23) & 0x1ff] + ((f & 0x007fffff) >> HalfShiftTable[(f >> 23) & 0x1ff]);
+        /* Make NaNs quiet, same as F16C does. Without this, NaNs with the
+           payload only in the lowest 13 mantissa bits would become
+           infinities. */
+        if((f & 0x7fffffff) > 0x7f800000) h |= 0x0200;
+        dst[i] = h;
+    }
+}
+
+#ifdef CORRADE_TARGET_SSE2
+/* SSE2 loads of four integers widened to 32 bits and stores of four 32-bit
+   integers narrowed with saturation */
+inline __m128i load4Sse2(const UnsignedByte* src) {
+    Int in;
+    std::memcpy(&in, src, 4);
+    const __m128i zero = _mm_setzero_si128();
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(in), zero), zero);
+}
+inline __m128i load4Sse2(const Byte* src) {
+    Int in;
+    std::memcpy(&in, src, 4);
+    const __m128i a = _mm_cvtsi32_si128(in);
+    const __m128i b = _mm_unpacklo_epi8(a, a);
+    return _mm_srai_epi32(_mm_unpacklo_epi16(b, b), 24);
+}
+inline __m128i load4Sse2(const UnsignedShort* src) {
+    return _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)), _mm_setzero_si128());
+}
+inline __m128i load4Sse2(const Short* src) {
+    const __m128i a = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+    return _mm_srai_epi32(_mm_unpacklo_epi16(a, a), 16);
+}
+
+inline void store4Sse2(UnsignedByte* dst, const __m128i value) {
+    const __m128i a = _mm_packs_epi32(value, value);
+    const Int out = _mm_cvtsi128_si32(_mm_packus_epi16(a, a));
+    std::memcpy(dst, &out, 4);
+}
+inline void store4Sse2(Byte* dst, const __m128i value) {
+    const __m128i a = _mm_packs_epi32(value, value);
+    const Int out = _mm_cvtsi128_si32(_mm_packs_epi16(a, a));
+    std::memcpy(dst, &out, 4);
+}
+inline void store4Sse2(UnsignedShort* dst, const __m128i value) {
+    /* There's no unsigned 32-to-16-bit saturation in SSE2, so shift the range
+       to a signed one and back */
+    const __m128i a = _mm_packs_epi32(_mm_sub_epi32(value, _mm_set1_epi32(0x8000)), _mm_setzero_si128());
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_xor_si128(a, _mm_set1_epi16(-0x8000)));
+}
+inline void store4Sse2(Short* dst, const __m128i value) {
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packs_epi32(value, value));
+}
+
+/* Same as std::round(), i.e. rounding half away from zero, which isn't
+   available as a SSE instruction. Truncates and then adjusts based on the
+   (exactly representable) fractional part. */
+inline __m128i roundSse2(const __m128 value) {
+    const __m128i truncated = _mm_cvttps_epi32(value);
+    const __m128 fraction = _mm_sub_ps(value, _mm_cvtepi32_ps(truncated));
+    /* The comparisons return all ones (-1) for lanes where it's true */
+    return _mm_add_epi32(
+        _mm_sub_epi32(truncated, _mm_castps_si128(_mm_cmpge_ps(fraction, _mm_set1_ps(0.5f)))),
+        _mm_castps_si128(_mm_cmple_ps(fraction, _mm_set1_ps(-0.5f))));
+}
+
+template<class T> void unpackUnsignedSse2(const T* src, Float* dst, const std::size_t count) {
+    const __m128 bitMax = _mm_set1_ps(Implementation::bitMax<T>());
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+        _mm_storeu_ps(dst + i, _mm_div_ps(_mm_cvtepi32_ps(load4Sse2(src + i)), bitMax));
+    unpackUnsignedScalar(src + i, dst + i, count - i);
+}
+
+template<class T> void unpackSignedSse2(const T* src, Float* dst, const std::size_t count) {
+    const __m128 bitMax = _mm_set1_ps(Implementation::bitMax<T>());
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+        _mm_storeu_ps(dst + i, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(load4Sse2(src + i)), bitMax), minusOne));
+    unpackSignedScalar(src + i, dst + i, count - i);
+}
+
+template<class T> void packSse2(const Float* src, T* dst, const std::size_t count) {
+    const __m128 bitMax = _mm_set1_ps(Implementation::bitMax<T>());
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+        store4Sse2(dst + i, roundSse2(_mm_mul_ps(_mm_loadu_ps(src + i), bitMax)));
+    packScalar(src + i, dst + i, count - i);
+}
+#endif
+
+#ifdef MAGNUM_PACKING_RUNTIME_DISPATCH
+/* AVX2 loads of eight integers widened to 32 bits and stores of eight 32-bit
+   integers narrowed with saturation */
+MAGNUM_PACKING_ENABLE_AVX2 inline __m256i load8Avx2(const UnsignedByte* src) {
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+}
+MAGNUM_PACKING_ENABLE_AVX2 inline __m256i load8Avx2(const Byte* src) {
+    return _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+}
+MAGNUM_PACKING_ENABLE_AVX2 inline __m256i load8Avx2(const UnsignedShort* src) {
+    return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+}
+MAGNUM_PACKING_ENABLE_AVX2 inline __m256i load8Avx2(const Short* src) {
+    return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+}
+
+/* The 256-bit pack instructions operate on the 128-bit lanes separately, so
+   it's easier to split the value and use the 128-bit variants */
+MAGNUM_PACKING_ENABLE_AVX2 inline void store8Avx2(UnsignedByte* dst, const __m256i value) {
+    const __m128i a = _mm_packs_epi32(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(a, a));
+}
+MAGNUM_PACKING_ENABLE_AVX2 inline void store8Avx2(Byte* dst, const __m256i value) {
+    const __m128i a = _mm_packs_epi32(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packs_epi16(a, a));
+}
+MAGNUM_PACKING_ENABLE_AVX2 inline void store8Avx2(UnsignedShort* dst, const __m256i value) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi32(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1)));
+}
+MAGNUM_PACKING_ENABLE_AVX2 inline void store8Avx2(Short* dst, const __m256i value) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packs_epi32(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1)));
+}
+
+/* Rounding half away from zero, same as roundSse2() */
+MAGNUM_PACKING_ENABLE_AVX2 inline __m256i roundAvx2(const __m256 value) {
+    const __m256i truncated = _mm256_cvttps_epi32(value);
+    const __m256 fraction = _mm256_sub_ps(value, _mm256_cvtepi32_ps(truncated));
+    return _mm256_add_epi32(
+        _mm256_sub_epi32(truncated, _mm256_castps_si256(_mm256_cmp_ps(fraction, _mm256_set1_ps(0.5f), _CMP_GE_OQ))),
+        _mm256_castps_si256(_mm256_cmp_ps(fraction, _mm256_set1_ps(-0.5f), _CMP_LE_OQ)));
+}
+
+template<class T> MAGNUM_PACKING_ENABLE_AVX2 void unpackUnsignedAvx2(const T* src, Float* dst, const std::size_t count) {
+    const __m256 bitMax = _mm256_set1_ps(Implementation::bitMax<T>());
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(dst + i, _mm256_div_ps(_mm256_cvtepi32_ps(load8Avx2(src + i)), bitMax));
+    unpackUnsignedScalar(src + i, dst + i, count - i);
+}
+
+template<class T> MAGNUM_PACKING_ENABLE_AVX2 void unpackSignedAvx2(const T* src, Float* dst, const std::size_t count) {
+    const __m256 bitMax = _mm256_set1_ps(Implementation::bitMax<T>());
+    const __m256 minusOne = _mm256_set1_ps(-1.0f);
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(dst + i, _mm256_max_ps(_mm256_div_ps(_mm256_cvtepi32_ps(load8Avx2(src + i)), bitMax), minusOne));
+    unpackSignedScalar(src + i, dst + i, count - i);
+}
+
+template<class T> MAGNUM_PACKING_ENABLE_AVX2 void packAvx2(const Float* src, T* dst, const std::size_t count) {
+    const __m256 bitMax = _mm256_set1_ps(Implementation::bitMax<T>());
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+        store8Avx2(dst + i, roundAvx2(_mm256_mul_ps(_mm256_loadu_ps(src + i), bitMax)));
+    packScalar(src + i, dst + i, count - i);
+}
+
+MAGNUM_PACKING_ENABLE_F16C void unpackHalfF16c(const UnsignedShort* src, Float* dst, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+    unpackHalfScalar(src + i, dst + i, count - i);
+}
+
+MAGNUM_PACKING_ENABLE_F16C void packHalfF16c(const Float* src, UnsignedShort* dst, const std::size_t count) {
+    const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    const __m256 overflow = _mm256_set1_ps(65536.0f);
+    const __m256 infinity = _mm256_castsi256_ps(_mm256_set1_epi32(0x7f800000));
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m256 value = _mm256_loadu_ps(src + i);
+        /* The lookup tables truncate the mantissa, so round towards zero to
+           get the same result. That however turns overflows to the largest
+           finite value instead of infinity, fix those by adding one to the
+           resulting bits (0x7bff + 1 is 0x7c00) */
+        const __m256 absValue = _mm256_and_ps(value, absMask);
+        const __m256 overflown = _mm256_and_ps(
+            _mm256_cmp_ps(absValue, overflow, _CMP_GE_OQ),
+            _mm256_cmp_ps(absValue, infinity, _CMP_LT_OQ));
+        const __m128i overflownMask = _mm_packs_epi32(
+            _mm_castps_si128(_mm256_castps256_ps128(overflown)),
+            _mm_castps_si128(_mm256_extractf128_ps(overflown, 1)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_sub_epi16(
+            _mm256_cvtps_ph(value, _MM_FROUND_TO_ZERO), overflownMask));
+    }
+    packHalfScalar(src + i, dst + i, count - i);
+}
+#endif
+
+#ifdef MAGNUM_PACKING_NEON
+/* NEON loads of eight integers widened to 32 bits and stores of eight 32-bit
+   integers narrowed with saturation, split into two registers */
+inline int32x4x2_t load8Neon(const UnsignedByte* src) {
+    const uint16x8_t a = vmovl_u8(vld1_u8(src));
+    return {{vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(a))),
+             vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(a)))}};
+}
+inline int32x4x2_t load8Neon(const Byte* src) {
+    const int16x8_t a = vmovl_s8(vld1_s8(src));
+    return {{vmovl_s16(vget_low_s16(a)), vmovl_s16(vget_high_s16(a))}};
+}
+inline int32x4x2_t load8Neon(const UnsignedShort* src) {
+    const uint16x8_t a = vld1q_u16(src);
+    return {{vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(a))),
+             vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(a)))}};
+}
+inline int32x4x2_t load8Neon(const Short* src) {
+    const int16x8_t a = vld1q_s16(src);
+    return {{vmovl_s16(vget_low_s16(a)), vmovl_s16(vget_high_s16(a))}};
+}
+
+inline void store8Neon(UnsignedByte* dst, const int32x4x2_t value) {
+    vst1_u8(dst, vqmovn_u16(vcombine_u16(vqmovun_s32(value.val[0]), vqmovun_s32(value.val[1]))));
+}
+inline void store8Neon(Byte* dst, const int32x4x2_t value) {
+    vst1_s8(dst, vqmovn_s16(vcombine_s16(vqmovn_s32(value.val[0]), vqmovn_s32(value.val[1]))));
+}
+inline void store8Neon(UnsignedShort* dst, const int32x4x2_t value) {
+    vst1q_u16(dst, vcombine_u16(vqmovun_s32(value.val[0]), vqmovun_s32(value.val[1])));
+}
+inline void store8Neon(Short* dst, const int32x4x2_t value) {
+    vst1q_s16(dst, vcombine_s16(vqmovn_s32(value.val[0]), vqmovn_s32(value.val[1])));
+}
+
+template<class T> void unpackUnsignedNeon(const T* src, Float* dst, const std::size_t count) {
+    const float32x4_t bitMax = vdupq_n_f32(Implementation::bitMax<T>());
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const int32x4x2_t in = load8Neon(src + i);
+        vst1q_f32(dst + i, vdivq_f32(vcvtq_f32_s32(in.val[0]), bitMax));
+        vst1q_f32(dst + i + 4, vdivq_f32(vcvtq_f32_s32(in.val[1]), bitMax));
+    }
+    unpackUnsignedScalar(src + i, dst + i, count - i);
+}
+
+template<class T> void unpackSignedNeon(const T* src, Float* dst, const std::size_t count) {
+    const float32x4_t bitMax = vdupq_n_f32(Implementation::bitMax<T>());
+    const float32x4_t minusOne = vdupq_n_f32(-1.0f);
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const int32x4x2_t in = load8Neon(src + i);
+        vst1q_f32(dst + i, vmaxq_f32(vdivq_f32(vcvtq_f32_s32(in.val[0]), bitMax), minusOne));
+        vst1q_f32(dst + i + 4, vmaxq_f32(vdivq_f32(vcvtq_f32_s32(in.val[1]), bitMax), minusOne));
+    }
+    unpackSignedScalar(src + i, dst + i, count - i);
+}
+
+template<class T> void packNeon(const Float* src, T* dst, const std::size_t count) {
+    const float32x4_t bitMax = vdupq_n_f32(Implementation::bitMax<T>());
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        /* vcvta rounds half away from zero, same as std::round() */
+        store8Neon(dst + i, int32x4x2_t{{
+            vcvtaq_s32_f32(vmulq_f32(vld1q_f32(src + i), bitMax)),
+            vcvtaq_s32_f32(vmulq_f32(vld1q_f32(src + i + 4), bitMax))}});
+    }
+    packScalar(src + i, dst + i, count - i);
+}
+
+void unpackHalfNeon(const UnsignedShort* src, Float* dst, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+        vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+    unpackHalfScalar(src + i, dst + i, count - i);
+}
+#endif
+
+#ifdef MAGNUM_PACKING_RUNTIME_DISPATCH
+struct CpuFeatures {
+    bool avx2;
+    bool f16c;
+};
+
+#ifdef CORRADE_TARGET_CLANG_CL
+__attribute__((__target__("xsave")))
+#endif
+CpuFeatures detectCpuFeatures() {
+    /* EAX, EBX, ECX, EDX for leaf 1 and leaf 7 */
+    UnsignedInt leaf1[4]{};
+    UnsignedInt leaf7[4]{};
+    #ifdef CORRADE_TARGET_MSVC
+    Int info[4];
+    __cpuid(info, 0);
+    const UnsignedInt maxLeaf = info[0];
+    __cpuid(info, 1);
+    std::memcpy(leaf1, info, sizeof(info));
+    if(maxLeaf >= 7) {
+        __cpuidex(info, 7, 0);
+        std::memcpy(leaf7, info, sizeof(info));
+    }
+    #else
+    const UnsignedInt maxLeaf = __get_cpuid_max(0, nullptr);
+    __cpuid(1, leaf1[0], leaf1[1], leaf1[2], leaf1[3]);
+    if(maxLeaf >= 7)
+        __cpuid_count(7, 0, leaf7[0], leaf7[1], leaf7[2], leaf7[3]);
+    #endif
+
+    /* Besides the CPU supporting AVX, the OS has to save the AVX registers on
+       context switch, which is indicated by OSXSAVE and XCR0 */
+    bool avx = false;
+    if((leaf1[2] & (1u << 27)) && (leaf1[2] & (1u << 28))) {
+        #ifdef CORRADE_TARGET_MSVC
+        const UnsignedLong xcr0 = _xgetbv(0);
+        #else
+        UnsignedInt xcr0, xcr0High;
+        __asm__("xgetbv" : "=a"(xcr0), "=d"(xcr0High) : "c"(0));
+        #endif
+        avx = (xcr0 & 6) == 6;
+    }
+
+    return {avx && (leaf7[1] & (1u << 5)), avx && (leaf1[2] & (1u << 29))};
+}
+
+const CpuFeatures& cpuFeatures() {
+    static const CpuFeatures features = detectCpuFeatures();
+    return features;
+}
+#endif
+
+template<class T> using UnpackKernel = void(*)(const T*, Float*, std::size_t);
+template<class T> using PackKernel = void(*)(const Float*, T*, std::size_t);
+
+template<class T> UnpackKernel<T> unpackUnsignedKernel() {
+    #ifdef MAGNUM_PACKING_RUNTIME_DISPATCH
+    if(cpuFeatures().avx2) return unpackUnsignedAvx2<T>;
+    #endif
+    #ifdef CORRADE_TARGET_SSE2
+    return unpackUnsignedSse2<T>;
+    #elif defined(MAGNUM_PACKING_NEON)
+    return unpackUnsignedNeon<T>;
+    #else
+    return unpackUnsignedScalar<T>;
+    #endif
+}
+
+template<class T> UnpackKernel<T> unpackSignedKernel() {
+    #ifdef MAGNUM_PACKING_RUNTIME_DISPATCH
+    if(cpuFeatures().avx2) return unpackSignedAvx2<T>;
+    #endif
+    #ifdef CORRADE_TARGET_SSE2
+    return unpackSignedSse2<T>;
+    #elif defined(MAGNUM_PACKING_NEON)
+    return unpackSignedNeon<T>;
+    #else
+    return unpackSignedScalar<T>;
+    #endif
+}
+
+template<class T> PackKernel<T> packKernel() {
+    #ifdef MAGNUM_PACKING_RUNTIME_DISPATCH
+    if(cpuFeatures().avx2) return packAvx2<T>;
+    #endif
+    #ifdef CORRADE_TARGET_SSE2
+    return packSse2<T>;
+    #elif defined(MAGNUM_PACKING_NEON)
+    return packNeon<T>;
+    #else
+    return packScalar<T>;
+    #endif
+}
+
+UnpackKernel<UnsignedShort> unpackHalfKernel() {
+    #ifdef MAGNUM_PACKING_RUNTIME_DISPATCH
+    if(cpuFeatures().f16c) return unpackHalfF16c;
+    #endif
+    #ifdef MAGNUM_PACKING_NEON
+    return unpackHalfNeon;
+    #else
+    return unpackHalfScalar;
+    #endif
+}
+
+/* There's no NEON variant, as the conversion instructions can't be told to
+   truncate the mantissa the same way as the lookup tables do */
+PackKernel<UnsignedShort> packHalfKernel() {
+    #ifdef MAGNUM_PACKING_RUNTIME_DISPATCH
+    if(cpuFeatures().f16c) return packHalfF16c;
+    #endif
+    return packHalfScalar;
+}
+
+/* If both views are contiguous as a whole, the kernel is called just once on
+   all values, otherwise once for every row. For rows too short to fill a
+   SIMD register the scalar variant is called directly to avoid needless
+   overhead. */
+template<class T, class U> void convertInto(const Corrade::Containers::StridedArrayView2D<const T>& src, const Corrade::Containers::StridedArrayView2D<U>& dst, void(*const kernel)(const T*, U*, std::size_t), void(*const scalarKernel)(const T*, U*, std::size_t)) {
+    /* Caching values to avoid inline function calls in debug builds */
     const char* srcPtr = reinterpret_cast<const char*>(src.data());
     char* dstPtr = reinterpret_cast<char*>(dst.data());
     const std::ptrdiff_t srcStride = src.stride()[0];
     const std::ptrdiff_t dstStride = dst.stride()[0];
+    const std::size_t maxI = src.size()[0];
     const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const T* srcPtrI = reinterpret_cast<const T*>(srcPtr);
-        Float* dstPtrI = reinterpret_cast<Float*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j)
-            *dstPtrI++ = *srcPtrI++/bitMax;
+    if(srcStride == std::ptrdiff_t(maxJ*sizeof(T)) && dstStride == std::ptrdiff_t(maxJ*sizeof(U))) {
+        kernel(reinterpret_cast<const T*>(srcPtr), reinterpret_cast<U*>(dstPtr), maxI*maxJ);
+        return;
+    }
 
+    const auto rowKernel = maxJ >= 16 ? kernel : scalarKernel;
+    for(std::size_t i = 0; i != maxI; ++i) {
+        rowKernel(reinterpret_cast<const T*>(srcPtr), reinterpret_cast<U*>(dstPtr), maxJ);
         srcPtr += srcStride;
         dstPtr += dstStride;
     }
 }
 
+template<class T> inline void unpackUnsignedIntoImplementation(const Corrade::Containers::StridedArrayView2D<const T>& src, const Corrade::Containers::StridedArrayView2D<Float>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::unpackInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    CORRADE_ASSERT(src.template isContiguous<1>() && dst.isContiguous<1>(),
+        "Math::unpackInto(): second view dimension is not contiguous", );
+
+    static const UnpackKernel<T> kernel = unpackUnsignedKernel<T>();
+    convertInto(src, dst, kernel, unpackUnsignedScalar<T>);
+}
+
 }
 
 void unpackInto(const Corrade::Containers::StridedArrayView2D<const UnsignedByte>& src, const Corrade::Containers::StridedArrayView2D<Float>& dst) {
@@ -80,28 +546,8 @@ template<class T> inline void unpackSignedIntoImplementation(const Corrade::Cont
     CORRADE_ASSERT(src.template isContiguous<1>() && dst.isContiguous<1>(),
         "Math::unpackInto(): second view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
-
-    /* Caching values to avoid inline function calls in debug builds */
-    constexpr Float bitMax = Implementation::bitMax<T>();
-    const char* srcPtr = reinterpret_cast<const char*>(src.data());
-    char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const T* srcPtrI = reinterpret_cast<const T*>(srcPtr);
-        Float* dstPtrI = reinterpret_cast<Float*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j) {
-            const Float value = *srcPtrI++/bitMax;
-            /* Avoiding a max() call in Debug */
-            *dstPtrI++ = value < -1.0f ? -1.0f : value;
-        }
-
-        srcPtr += srcStride;
-        dstPtr += dstStride;
-    }
+    static const UnpackKernel<T> kernel = unpackSignedKernel<T>();
+    convertInto(src, dst, kernel, unpackSignedScalar<T>);
 }
 
 }
@@ -122,26 +568,8 @@ template<class T> inline void packIntoImplementation(const Corrade::Containers::
     CORRADE_ASSERT(src.isContiguous<1>() && dst.template isContiguous<1>(),
         "Math::packInto(): second view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
-
-    /* Caching values to avoid inline function calls in debug builds */
-    constexpr Float bitMax = Implementation::bitMax<T>();
-    const char* srcPtr = reinterpret_cast<const char*>(src.data());
-    char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const Float* srcPtrI = reinterpret_cast<const Float*>(srcPtr);
-        T* dstPtrI = reinterpret_cast<T*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j)
-            /** @todo provide a version that doesn't do rounding */
-            *dstPtrI++ = std::round(*srcPtrI++*bitMax);
-
-        srcPtr += srcStride;
-        dstPtr += dstStride;
-    }
+    static const PackKernel<T> kernel = packKernel<T>();
+    convertInto(src, dst, kernel, packScalar<T>);
 }
 
 }
@@ -284,23 +712,8 @@ void unpackHalfInto(const Corrade::Containers::StridedArrayView2D<const Unsigned
     CORRADE_ASSERT(src.isContiguous<1>() && dst.isContiguous<1>(),
         "Math::unpackHalfInto(): second view dimension is not contiguous", );
 
-    /* Caching values to avoid inline function calls in debug builds */
-    const char* srcPtr = reinterpret_cast<const char*>(src.data());
-    char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const UnsignedShort* srcPtrI = reinterpret_cast<const UnsignedShort*>(srcPtr);
-        UnsignedInt* dstPtrI = reinterpret_cast<UnsignedInt*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j) {
-            const UnsignedShort h = *srcPtrI++;
-            *dstPtrI++ = HalfMantissaTable[HalfOffsetTable[h >> 10] + (h & 0x3ff)] + HalfExponentTable[h >> 10];
-        }
-
-        srcPtr += srcStride;
-        dstPtr += dstStride;
-    }
+    static const UnpackKernel<UnsignedShort> kernel = unpackHalfKernel();
+    convertInto(src, dst, kernel, unpackHalfScalar);
 }
 
 void packHalfInto(const Corrade::Containers::StridedArrayView2D<const Float>& src, const Corrade::Containers::StridedArrayView2D<UnsignedShort>& dst) {
@@ -309,23 +722,8 @@ void packHalfInto(const Corrade::Containers::StridedArrayView2D<const Float>& sr
     CORRADE_ASSERT(src.isContiguous<1>() && dst.isContiguous<1>(),
         "Math::packHalfInto(): second view dimension is not contiguous", );
 
-    /* Caching values to avoid inline function calls in debug builds */
-    const char* srcPtr = reinterpret_cast<const char*>(src.data());
-    char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const UnsignedInt* srcPtrI = reinterpret_cast<const UnsignedInt*>(srcPtr);
-        UnsignedShort* dstPtrI = reinterpret_cast<UnsignedShort*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j) {
-            const UnsignedInt f = *srcPtrI++;
-            *dstPtrI++ = HalfBaseTable[(f >> 23) & 0x1ff] + ((f & 0x007fffff) >> HalfShiftTable[(f >> 23) & 0x1ff]);
-        }
-
-        srcPtr += srcStride;
-        dstPtr += dstStride;
-    }
+    static const PackKernel<UnsignedShort> kernel = packHalfKernel();
+    convertInto(src, dst, kernel, packHalfScalar);
 }
 
 }}
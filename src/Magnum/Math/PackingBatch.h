@@ -42,6 +42,17 @@ namespace Magnum { namespace Math {
 
 These functions process an ubounded range of values, as opposed to single
 vectors or scalars.
+
+The @ref unpackInto(), @ref packInto(), @ref unpackHalfInto() and
+@ref packHalfInto() functions have SIMD-accelerated variants that are picked
+at runtime based on what the CPU supports --- SSE2 and AVX2 on x86, F16C for
+the half-float conversions, and NEON on 64-bit ARM. The SIMD variants are used
+for the whole view at once if both views are contiguous and for each row
+otherwise, falling back to the scalar implementation for rows that are too
+short. Results are the same as with the scalar implementation. That includes
+NaNs in half-float conversion, which always become quiet NaNs with the payload
+truncated or zero-extended, and thus a NaN with the payload only in the lowest
+13 mantissa bits is packed to a quiet NaN and not an infinity.
 */
 
 /**
@@ -136,9 +147,11 @@ MAGNUM_EXPORT void packInto(const Corrade::Containers::StridedArrayView2D<const
 See [Wikipedia](https://en.wikipedia.org/wiki/Half-precision_floating-point_format)
 for more information about half floats. Unlike @ref packHalf() this function is
 a faster table-based implementation at the expense of using more memory, thus
-more suitable for batch conversions of large data amounts. Expects that @p src
-and @p dst have the same size and that the second dimension in both is
-contiguous.
+more suitable for batch conversions of large data amounts. Values are rounded
+towards zero and values that don't fit into the half-float range become
+infinity. On x86 CPUs with F16C support, the conversion is done using
+dedicated instructions instead of the tables. Expects that @p src and @p dst
+have the same size and that the second dimension in both is contiguous.
 
 Algorithm used: *Jeroen van der Zijp -- Fast Half Float Conversions, 2008,
 ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf*
@@ -155,9 +168,10 @@ MAGNUM_EXPORT void packHalfInto(const Corrade::Containers::StridedArrayView2D<co
 See [Wikipedia](https://en.wikipedia.org/wiki/Half-precision_floating-point_format)
 for more information about half floats. Unlike @ref unpackHalf() this function
 is a faster table-based implementation at the expense of using more memory,
-thus more suitable for batch conversions of large data amounts. Expects that
-@p src and @p dst have the same size and that the second dimension in both is
-contiguous.
+thus more suitable for batch conversions of large data amounts. On x86 CPUs
+with F16C support and on 64-bit ARM, the conversion is done using dedicated
+instructions instead of the tables. Expects that @p src and @p dst have the
+same size and that the second dimension in both is contiguous.
 
 Algorithm used: *Jeroen van der Zijp -- Fast Half Float Conversions, 2008,
 ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf*
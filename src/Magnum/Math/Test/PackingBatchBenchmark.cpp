@@ -0,0 +1,233 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/PackingBatch.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct PackingBatchBenchmark: Corrade::TestSuite::Tester {
+    explicit PackingBatchBenchmark();
+
+    template<class T> void unpackLoop();
+    template<class T> void unpack();
+    template<class T> void unpackRows();
+    template<class T> void packLoop();
+    template<class T> void pack();
+    template<class T> void packRows();
+
+    void unpackHalfLoop();
+    void unpackHalf();
+    void packHalfLoop();
+    void packHalf();
+};
+
+PackingBatchBenchmark::PackingBatchBenchmark() {
+    addBenchmarks({
+        &PackingBatchBenchmark::unpackLoop<UnsignedByte>,
+        &PackingBatchBenchmark::unpackLoop<Byte>,
+        &PackingBatchBenchmark::unpackLoop<UnsignedShort>,
+        &PackingBatchBenchmark::unpackLoop<Short>,
+        &PackingBatchBenchmark::unpack<UnsignedByte>,
+        &PackingBatchBenchmark::unpack<Byte>,
+        &PackingBatchBenchmark::unpack<UnsignedShort>,
+        &PackingBatchBenchmark::unpack<Short>,
+        &PackingBatchBenchmark::unpackRows<UnsignedByte>,
+        &PackingBatchBenchmark::unpackRows<Short>,
+
+        &PackingBatchBenchmark::packLoop<UnsignedByte>,
+        &PackingBatchBenchmark::packLoop<Byte>,
+        &PackingBatchBenchmark::packLoop<UnsignedShort>,
+        &PackingBatchBenchmark::packLoop<Short>,
+        &PackingBatchBenchmark::pack<UnsignedByte>,
+        &PackingBatchBenchmark::pack<Byte>,
+        &PackingBatchBenchmark::pack<UnsignedShort>,
+        &PackingBatchBenchmark::pack<Short>,
+        &PackingBatchBenchmark::packRows<UnsignedByte>,
+        &PackingBatchBenchmark::packRows<Short>,
+
+        &PackingBatchBenchmark::unpackHalfLoop,
+        &PackingBatchBenchmark::unpackHalf,
+        &PackingBatchBenchmark::packHalfLoop,
+        &PackingBatchBenchmark::packHalf}, 10);
+}
+
+/* 4096 vertices with 64 components each, or 64k four-component vertices */
+enum: std::size_t { Count = 4096, Components = 64 };
+
+template<class T> Corrade::Containers::Array<T> integerData() {
+    Corrade::Containers::Array<T> data{Corrade::Containers::NoInit, Count*Components};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = T(typename std::make_unsigned<T>::type(i*37));
+    return data;
+}
+
+Corrade::Containers::Array<Float> floatData() {
+    Corrade::Containers::Array<Float> data{Corrade::Containers::NoInit, Count*Components};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = Float(i % 1021)/1020.0f;
+    return data;
+}
+
+template<class T> void PackingBatchBenchmark::unpackLoop() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Corrade::Containers::Array<T> src = integerData<T>();
+    Corrade::Containers::Array<Float> dst{Corrade::Containers::NoInit, src.size()};
+
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != src.size(); ++i)
+            dst[i] = Math::unpack<Float>(src[i]);
+    }
+
+    CORRADE_COMPARE(dst[1], Math::unpack<Float>(T(37)));
+}
+
+template<class T> void PackingBatchBenchmark::unpack() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Corrade::Containers::Array<T> src = integerData<T>();
+    Corrade::Containers::Array<Float> dst{Corrade::Containers::NoInit, src.size()};
+
+    CORRADE_BENCHMARK(1) {
+        unpackInto(Corrade::Containers::StridedArrayView2D<const T>{src, {Count, Components}},
+            Corrade::Containers::StridedArrayView2D<Float>{dst, {Count, Components}});
+    }
+
+    CORRADE_COMPARE(dst[1], Math::unpack<Float>(T(37)));
+}
+
+template<class T> void PackingBatchBenchmark::unpackRows() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    /* Every row has one item less than the stride, so it's processed row by
+       row instead of all at once */
+    Corrade::Containers::Array<T> src = integerData<T>();
+    Corrade::Containers::Array<Float> dst{Corrade::Containers::NoInit, src.size()};
+
+    CORRADE_BENCHMARK(1) {
+        unpackInto(Corrade::Containers::StridedArrayView2D<const T>{src, {Count, Components}}.slice({0, 0}, {Count, Components - 1}),
+            Corrade::Containers::StridedArrayView2D<Float>{dst, {Count, Components}}.slice({0, 0}, {Count, Components - 1}));
+    }
+
+    CORRADE_COMPARE(dst[1], Math::unpack<Float>(T(37)));
+}
+
+template<class T> void PackingBatchBenchmark::packLoop() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Corrade::Containers::Array<Float> src = floatData();
+    Corrade::Containers::Array<T> dst{Corrade::Containers::NoInit, src.size()};
+
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != src.size(); ++i)
+            dst[i] = Math::pack<T>(src[i]);
+    }
+
+    CORRADE_COMPARE(dst[1020], Implementation::bitMax<T>());
+}
+
+template<class T> void PackingBatchBenchmark::pack() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Corrade::Containers::Array<Float> src = floatData();
+    Corrade::Containers::Array<T> dst{Corrade::Containers::NoInit, src.size()};
+
+    CORRADE_BENCHMARK(1) {
+        packInto(Corrade::Containers::StridedArrayView2D<const Float>{src, {Count, Components}},
+            Corrade::Containers::StridedArrayView2D<T>{dst, {Count, Components}});
+    }
+
+    CORRADE_COMPARE(dst[1020], Implementation::bitMax<T>());
+}
+
+template<class T> void PackingBatchBenchmark::packRows() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Corrade::Containers::Array<Float> src = floatData();
+    Corrade::Containers::Array<T> dst{Corrade::Containers::NoInit, src.size()};
+
+    CORRADE_BENCHMARK(1) {
+        packInto(Corrade::Containers::StridedArrayView2D<const Float>{src, {Count, Components}}.slice({0, 0}, {Count, Components - 1}),
+            Corrade::Containers::StridedArrayView2D<T>{dst, {Count, Components}}.slice({0, 0}, {Count, Components - 1}));
+    }
+
+    CORRADE_COMPARE(dst[1020], Implementation::bitMax<T>());
+}
+
+void PackingBatchBenchmark::unpackHalfLoop() {
+    Corrade::Containers::Array<UnsignedShort> src = integerData<UnsignedShort>();
+    Corrade::Containers::Array<Float> dst{Corrade::Containers::NoInit, src.size()};
+
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != src.size(); ++i)
+            dst[i] = Math::unpackHalf(src[i]);
+    }
+
+    CORRADE_COMPARE(dst[1], Math::unpackHalf(37));
+}
+
+void PackingBatchBenchmark::unpackHalf() {
+    Corrade::Containers::Array<UnsignedShort> src = integerData<UnsignedShort>();
+    Corrade::Containers::Array<Float> dst{Corrade::Containers::NoInit, src.size()};
+
+    CORRADE_BENCHMARK(1) {
+        unpackHalfInto(Corrade::Containers::StridedArrayView2D<const UnsignedShort>{src, {Count, Components}},
+            Corrade::Containers::StridedArrayView2D<Float>{dst, {Count, Components}});
+    }
+
+    CORRADE_COMPARE(dst[1], Math::unpackHalf(37));
+}
+
+void PackingBatchBenchmark::packHalfLoop() {
+    Corrade::Containers::Array<Float> src = floatData();
+    Corrade::Containers::Array<UnsignedShort> dst{Corrade::Containers::NoInit, src.size()};
+
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != src.size(); ++i)
+            dst[i] = Math::packHalf(src[i]);
+    }
+
+    CORRADE_COMPARE(dst[1020], 0x3c00);
+}
+
+void PackingBatchBenchmark::packHalf() {
+    Corrade::Containers::Array<Float> src = floatData();
+    Corrade::Containers::Array<UnsignedShort> dst{Corrade::Containers::NoInit, src.size()};
+
+    CORRADE_BENCHMARK(1) {
+        packHalfInto(Corrade::Containers::StridedArrayView2D<const Float>{src, {Count, Components}},
+            Corrade::Containers::StridedArrayView2D<UnsignedShort>{dst, {Count, Components}});
+    }
+
+    CORRADE_COMPARE(dst[1020], 0x3c00);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::PackingBatchBenchmark)
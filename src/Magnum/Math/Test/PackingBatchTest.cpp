@@ -23,7 +23,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring>
 #include <sstream>
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
@@ -52,6 +54,11 @@ struct PackingBatchTest: Corrade::TestSuite::Tester {
     void unpackHalf();
     void packHalf();
 
+    template<class T> void unpackLarge();
+    template<class T> void packLarge();
+    void unpackHalfLarge();
+    void packHalfLarge();
+
     template<class T> void castUnsignedFloat();
     template<class T> void castSignedFloat();
 
@@ -76,6 +83,17 @@ PackingBatchTest::PackingBatchTest() {
               &PackingBatchTest::unpackHalf,
               &PackingBatchTest::packHalf,
 
+              &PackingBatchTest::unpackLarge<UnsignedByte>,
+              &PackingBatchTest::unpackLarge<Byte>,
+              &PackingBatchTest::unpackLarge<UnsignedShort>,
+              &PackingBatchTest::unpackLarge<Short>,
+              &PackingBatchTest::packLarge<UnsignedByte>,
+              &PackingBatchTest::packLarge<Byte>,
+              &PackingBatchTest::packLarge<UnsignedShort>,
+              &PackingBatchTest::packLarge<Short>,
+              &PackingBatchTest::unpackHalfLarge,
+              &PackingBatchTest::packHalfLarge,
+
               &PackingBatchTest::castUnsignedFloat<UnsignedByte>,
               &PackingBatchTest::castUnsignedFloat<UnsignedShort>,
               &PackingBatchTest::castUnsignedFloat<UnsignedInt>,
@@ -414,6 +432,186 @@ void PackingBatchTest::packHalf() {
         CORRADE_COMPARE(Math::packHalf(data[i].src), data[i].dst);
 }
 
+/* Large enough to go through the SIMD code paths. The whole view is processed
+   at once, the view with padded rows is processed row by row, with each row
+   having a remainder that isn't a multiple of the SIMD width. */
+constexpr std::size_t LargeRows = 1037;
+constexpr std::size_t LargeColumns = 20;
+
+template<class T> void PackingBatchTest::unpackLarge() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Corrade::Containers::Array<T> src{Corrade::Containers::NoInit, LargeRows*LargeColumns};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        src[i] = T(typename std::make_unsigned<T>::type(i*37));
+
+    Corrade::Containers::Array<Float> expected{Corrade::Containers::NoInit, src.size()};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        expected[i] = Math::unpack<Float>(src[i]);
+
+    Corrade::Containers::StridedArrayView2D<const T> srcView{src, {LargeRows, LargeColumns}};
+
+    Corrade::Containers::Array<Float> dst{Corrade::Containers::ValueInit, src.size()};
+    unpackInto(srcView, Corrade::Containers::StridedArrayView2D<Float>{dst, {LargeRows, LargeColumns}});
+    CORRADE_COMPARE_AS(Corrade::Containers::arrayView(dst),
+        Corrade::Containers::arrayView(expected),
+        Corrade::TestSuite::Compare::Container);
+
+    Corrade::Containers::Array<Float> dstPadded{Corrade::Containers::ValueInit, src.size()};
+    unpackInto(srcView.slice({0, 0}, {LargeRows, LargeColumns - 1}),
+        Corrade::Containers::StridedArrayView2D<Float>{dstPadded, {LargeRows, LargeColumns}}.slice({0, 0}, {LargeRows, LargeColumns - 1}));
+    for(std::size_t i = 0; i != LargeRows; ++i)
+        expected[i*LargeColumns + LargeColumns - 1] = 0.0f;
+    CORRADE_COMPARE_AS(Corrade::Containers::arrayView(dstPadded),
+        Corrade::Containers::arrayView(expected),
+        Corrade::TestSuite::Compare::Container);
+}
+
+template<class T> void PackingBatchTest::packLarge() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    /* Includes values exactly halfway between two integers to verify the
+       rounding is consistent */
+    Corrade::Containers::Array<Float> src{Corrade::Containers::NoInit, LargeRows*LargeColumns};
+    for(std::size_t i = 0; i != src.size(); ++i) {
+        const Float value = Float(i % 1021)/1020.0f;
+        src[i] = std::is_signed<T>::value ? value*2.0f - 1.0f : value;
+    }
+    src[0] = 0.5f/Implementation::bitMax<T>();
+    src[1] = 1.5f/Implementation::bitMax<T>();
+
+    Corrade::Containers::Array<T> expected{Corrade::Containers::NoInit, src.size()};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        expected[i] = Math::pack<T>(src[i]);
+
+    Corrade::Containers::StridedArrayView2D<const Float> srcView{src, {LargeRows, LargeColumns}};
+
+    Corrade::Containers::Array<T> dst{Corrade::Containers::ValueInit, src.size()};
+    packInto(srcView, Corrade::Containers::StridedArrayView2D<T>{dst, {LargeRows, LargeColumns}});
+    CORRADE_COMPARE_AS(Corrade::Containers::arrayView(dst),
+        Corrade::Containers::arrayView(expected),
+        Corrade::TestSuite::Compare::Container);
+
+    Corrade::Containers::Array<T> dstPadded{Corrade::Containers::ValueInit, src.size()};
+    packInto(srcView.slice({0, 0}, {LargeRows, LargeColumns - 1}),
+        Corrade::Containers::StridedArrayView2D<T>{dstPadded, {LargeRows, LargeColumns}}.slice({0, 0}, {LargeRows, LargeColumns - 1}));
+    for(std::size_t i = 0; i != LargeRows; ++i)
+        expected[i*LargeColumns + LargeColumns - 1] = 0;
+    CORRADE_COMPARE_AS(Corrade::Containers::arrayView(dstPadded),
+        Corrade::Containers::arrayView(expected),
+        Corrade::TestSuite::Compare::Container);
+}
+
+void PackingBatchTest::unpackHalfLarge() {
+    /* All possible values. NaNs are replaced with zeros as they don't
+       compare equal, they're tested separately below. */
+    Corrade::Containers::Array<UnsignedShort> src{Corrade::Containers::NoInit, 65536};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        src[i] = (i & 0x7c00) == 0x7c00 && (i & 0x03ff) ? 0 : UnsignedShort(i);
+
+    Corrade::Containers::Array<Float> expected{Corrade::Containers::NoInit, src.size()};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        expected[i] = Math::unpackHalf(src[i]);
+
+    Corrade::Containers::Array<Float> dst{Corrade::Containers::NoInit, src.size()};
+    unpackHalfInto(Corrade::Containers::StridedArrayView2D<const UnsignedShort>{src, {src.size()/16, 16}},
+        Corrade::Containers::StridedArrayView2D<Float>{dst, {src.size()/16, 16}});
+    CORRADE_COMPARE_AS(Corrade::Containers::arrayView(dst),
+        Corrade::Containers::arrayView(expected),
+        Corrade::TestSuite::Compare::Container);
+
+    /* A NaN stays a NaN */
+    const UnsignedShort nan[]{0x7e00, 0xfe01, 0x7c01};
+    Float nanDst[3];
+    unpackHalfInto(Corrade::Containers::StridedArrayView2D<const UnsignedShort>{nan, {3, 1}},
+        Corrade::Containers::StridedArrayView2D<Float>{nanDst, {3, 1}});
+    CORRADE_VERIFY(nanDst[0] != nanDst[0]);
+    CORRADE_VERIFY(nanDst[1] != nanDst[1]);
+    CORRADE_VERIFY(nanDst[2] != nanDst[2]);
+
+    /* Signaling NaNs become quiet with the payload preserved, same in the
+       scalar and SIMD code paths. Repeated to be large enough for both. */
+    const UnsignedShort nanValues[]{0x7e00, 0xfe01, 0x7c01, 0xfdff, 0x7fff};
+    const UnsignedInt nanExpected[]{0x7fc00000, 0xffc02000, 0x7fc02000, 0xffffe000, 0x7fffe000};
+    UnsignedShort nanRepeated[45];
+    for(std::size_t i = 0; i != 45; ++i)
+        nanRepeated[i] = nanValues[i % 5];
+    Float nanOut[45];
+    unpackHalfInto(Corrade::Containers::StridedArrayView2D<const UnsignedShort>{nanRepeated, {45, 1}},
+        Corrade::Containers::StridedArrayView2D<Float>{nanOut, {45, 1}});
+    for(std::size_t i = 0; i != 45; ++i) {
+        CORRADE_ITERATION(i);
+        UnsignedInt bits;
+        std::memcpy(&bits, nanOut + i, 4);
+        CORRADE_COMPARE(bits, nanExpected[i % 5]);
+    }
+}
+
+void PackingBatchTest::packHalfLarge() {
+    /* All finite halves and infinities survive a roundtrip */
+    Corrade::Containers::Array<UnsignedShort> expected{Corrade::Containers::NoInit, 65536};
+    for(std::size_t i = 0; i != expected.size(); ++i)
+        expected[i] = (i & 0x7c00) == 0x7c00 && (i & 0x03ff) ? 0 : UnsignedShort(i);
+
+    Corrade::Containers::Array<Float> src{Corrade::Containers::NoInit, expected.size()};
+    for(std::size_t i = 0; i != expected.size(); ++i)
+        src[i] = Math::unpackHalf(expected[i]);
+
+    Corrade::Containers::Array<UnsignedShort> dst{Corrade::Containers::NoInit, expected.size()};
+    packHalfInto(Corrade::Containers::StridedArrayView2D<const Float>{src, {src.size()/16, 16}},
+        Corrade::Containers::StridedArrayView2D<UnsignedShort>{dst, {src.size()/16, 16}});
+    CORRADE_COMPARE_AS(Corrade::Containers::arrayView(dst),
+        Corrade::Containers::arrayView(expected),
+        Corrade::TestSuite::Compare::Container);
+
+    /* Values that aren't representable are rounded towards zero, values
+       outside of the range become infinity, NaNs stay NaNs. Repeated to be
+       large enough for the SIMD code paths. */
+    const Float values[]{
+        1.0009f, -1.0009f,
+        65535.0f, -65535.0f,
+        65536.0f, -65536.0f,
+        1.0e10f, -1.0e10f,
+        Constants::nan(), 0.0f
+    };
+    Float valuesRepeated[40];
+    for(std::size_t i = 0; i != 40; ++i)
+        valuesRepeated[i] = values[i % 10];
+    UnsignedShort out[40];
+    packHalfInto(Corrade::Containers::StridedArrayView2D<const Float>{valuesRepeated, {40, 1}},
+        Corrade::Containers::StridedArrayView2D<UnsignedShort>{out, {40, 1}});
+    for(std::size_t i = 0; i != 40; i += 10) {
+        CORRADE_COMPARE(out[i + 0], 0x3c00);
+        CORRADE_COMPARE(out[i + 1], 0xbc00);
+        CORRADE_COMPARE(out[i + 2], 0x7bff);
+        CORRADE_COMPARE(out[i + 3], 0xfbff);
+        CORRADE_COMPARE(out[i + 4], 0x7c00);
+        CORRADE_COMPARE(out[i + 5], 0xfc00);
+        CORRADE_COMPARE(out[i + 6], 0x7c00);
+        CORRADE_COMPARE(out[i + 7], 0xfc00);
+        CORRADE_COMPARE(out[i + 8] & 0x7c00, 0x7c00);
+        CORRADE_VERIFY(out[i + 8] & 0x03ff);
+        CORRADE_COMPARE(out[i + 9], 0);
+    }
+
+    /* NaNs become quiet NaNs with the payload truncated, same in the scalar
+       and SIMD code paths. NaNs with the payload only in the lowest 13 bits
+       thus don't become infinities. Repeated to be large enough for both
+       code paths. */
+    const UnsignedInt nanBits[]{0x7fc00000, 0xffc00001, 0x7f800001, 0xff801fff, 0x7f802000};
+    const UnsignedShort nanExpected[]{0x7e00, 0xfe00, 0x7e00, 0xfe00, 0x7e01};
+    Float nanRepeated[45];
+    for(std::size_t i = 0; i != 45; ++i)
+        std::memcpy(nanRepeated + i, nanBits + i % 5, 4);
+    UnsignedShort nanOut[45];
+    packHalfInto(Corrade::Containers::StridedArrayView2D<const Float>{nanRepeated, {45, 1}},
+        Corrade::Containers::StridedArrayView2D<UnsignedShort>{nanOut, {45, 1}});
+    for(std::size_t i = 0; i != 45; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(nanOut[i], nanExpected[i % 5]);
+    }
+}
+
 template<class T> void PackingBatchTest::castUnsignedFloat() {
     setTestCaseTemplateName(TypeTraits<T>::name());
 
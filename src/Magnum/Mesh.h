@@ -180,7 +180,20 @@ enum class MeshPrimitive: UnsignedInt {
      * half-edge mesh representation.
      * @see @ref Trade::meshAttributeCustom()
      */
-    Edges
+    Edges,
+
+    /**
+     * Per-meshlet data.
+     * @m_since_latest
+     *
+     * Can be used to annotate @ref Trade::MeshData containing data that are
+     * per-meshlet (a cluster of triangles), as opposed to per-vertex. Has no
+     * direct mapping to common GPU APIs, the data are meant to be accessed
+     * from a compute, task or mesh shader for example for cluster culling.
+     * Index buffer has a meaning defined by the producer of the data.
+     * @see @ref MeshTools::buildMeshlets()
+     */
+    Meshlets
 };
 
 /** @debugoperatorenum{MeshPrimitive} */
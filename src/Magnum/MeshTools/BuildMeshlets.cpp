@@ -0,0 +1,322 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include "BuildMeshlets.h"
+
+#include <cstddef>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/MeshTools/Implementation/Tipsify.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+struct Meshlet {
+    Vector4 boundingSphere;
+    Vector4 coneAxisCutoff;
+    Vector3 coneApex;
+    UnsignedInt indexOffset;
+    UnsignedInt indexCount;
+    UnsignedInt vertexCount;
+    /* Padding to have the stride a multiple of 16 bytes */
+    UnsignedInt padding[2];
+};
+
+static_assert(sizeof(Meshlet) == 64, "improper size of Meshlet");
+
+/* Count of vertices of a triangle that aren't in the meshlet yet. Degenerate
+   triangles have some vertices repeated, those are counted just once. */
+inline UnsignedInt newVertexCount(const UnsignedInt* const triangle, const Containers::ArrayView<const UnsignedInt> vertexMeshlet, const UnsignedInt meshlet) {
+    const UnsignedInt a = triangle[0];
+    const UnsignedInt b = triangle[1];
+    const UnsignedInt c = triangle[2];
+    return (vertexMeshlet[a] != meshlet) +
+        (vertexMeshlet[b] != meshlet && b != a) +
+        (vertexMeshlet[c] != meshlet && c != a && c != b);
+}
+
+/* Bounding sphere by Ritter, followed by a pass that grows the radius to
+   include vertices that ended up outside due to rounding */
+Vector4 boundingSphere(const Containers::ArrayView<const Vector3> positions, const Containers::ArrayView<const UnsignedInt> vertices) {
+    /* Find the extreme points along each axis and pick the most distant
+       pair */
+    UnsignedInt minIds[3]{vertices[0], vertices[0], vertices[0]};
+    UnsignedInt maxIds[3]{vertices[0], vertices[0], vertices[0]};
+    for(const UnsignedInt v: vertices) {
+        for(std::size_t i = 0; i != 3; ++i) {
+            if(positions[v][i] < positions[minIds[i]][i]) minIds[i] = v;
+            if(positions[v][i] > positions[maxIds[i]][i]) maxIds[i] = v;
+        }
+    }
+    std::size_t axis = 0;
+    Float maxDistanceSquared = -1.0f;
+    for(std::size_t i = 0; i != 3; ++i) {
+        const Float distanceSquared = (positions[maxIds[i]] - positions[minIds[i]]).dot();
+        if(distanceSquared > maxDistanceSquared) {
+            maxDistanceSquared = distanceSquared;
+            axis = i;
+        }
+    }
+
+    /* Grow the sphere to include all points */
+    Vector3 center = (positions[minIds[axis]] + positions[maxIds[axis]])*0.5f;
+    Float radius = Math::sqrt(maxDistanceSquared)*0.5f;
+    for(const UnsignedInt v: vertices) {
+        const Vector3 direction = positions[v] - center;
+        const Float distance = direction.length();
+        if(distance > radius) {
+            const Float newRadius = (radius + distance)*0.5f;
+            center += direction*((newRadius - radius)/distance);
+            radius = newRadius;
+        }
+    }
+    for(const UnsignedInt v: vertices)
+        radius = Math::max(radius, (positions[v] - center).length());
+
+    return Vector4{center, radius};
+}
+
+/* Normal cone, calculated the same way as in meshoptimizer */
+void normalCone(const Containers::ArrayView<const Vector3> positions, const Containers::ArrayView<const UnsignedInt> indices, const Vector3& center, Containers::Array<Vector3>& normals, Meshlet& out) {
+    const std::size_t triangleCount = indices.size()/3;
+    arrayResize(normals, Containers::NoInit, triangleCount);
+
+    /* Average normal of all non-degenerate triangles */
+    Vector3 normalSum;
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        const Vector3 a = positions[indices[i*3 + 0]];
+        const Vector3 normal = Math::cross(positions[indices[i*3 + 1]] - a,
+                                           positions[indices[i*3 + 2]] - a);
+        const Float length = normal.length();
+        normals[i] = length == 0.0f ? Vector3{} : normal/length;
+        normalSum += normals[i];
+    }
+
+    /* A degenerate cone that never passes the culling test, used if the
+       normals cancel each other out or diverge too much */
+    out.coneApex = center;
+    out.coneAxisCutoff = Vector4{0.0f, 0.0f, 0.0f, 1.0f};
+    const Float normalSumLength = normalSum.length();
+    if(normalSumLength == 0.0f) return;
+    const Vector3 axis = normalSum/normalSumLength;
+
+    Float minDot = 1.0f;
+    for(const Vector3& normal: normals) {
+        if(normal.isZero()) continue;
+        minDot = Math::min(minDot, Math::dot(axis, normal));
+    }
+    if(minDot <= 0.1f) return;
+
+    /* Move the apex back along the axis so it's behind all triangle planes,
+       making the test conservative for all triangles */
+    Float maxT = 0.0f;
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        if(normals[i].isZero()) continue;
+        const Float t = Math::dot(center - positions[indices[i*3]], normals[i])/Math::dot(axis, normals[i]);
+        maxT = Math::max(maxT, t);
+    }
+
+    out.coneApex = center - axis*maxT;
+    out.coneAxisCutoff = Vector4{axis, Math::sqrt(1.0f - minDot*minDot)};
+}
+
+}
+
+Trade::MeshData buildMeshlets(const Trade::MeshData& mesh, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::buildMeshlets(): expected" << MeshPrimitive::Triangles << "but got" << mesh.primitive(),
+        (Trade::MeshData{MeshPrimitive::Meshlets, 0}));
+    CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+        "MeshTools::buildMeshlets(): the mesh has no positions",
+        (Trade::MeshData{MeshPrimitive::Meshlets, 0}));
+    CORRADE_ASSERT(maxVertexCount >= 3 && maxTriangleCount >= 1,
+        "MeshTools::buildMeshlets(): expected at least 3 vertices and 1 triangle per meshlet but got" << maxVertexCount << "and" << maxTriangleCount,
+        (Trade::MeshData{MeshPrimitive::Meshlets, 0}));
+
+    /* Get indices, generate trivial ones for a non-indexed mesh */
+    const UnsignedInt vertexCount = mesh.vertexCount();
+    Containers::Array<UnsignedInt> indices;
+    if(mesh.isIndexed()) indices = mesh.indicesAsArray();
+    else {
+        indices = Containers::Array<UnsignedInt>{Containers::NoInit, vertexCount};
+        for(UnsignedInt i = 0; i != vertexCount; ++i) indices[i] = i;
+    }
+    const std::size_t triangleCount = indices.size()/3;
+    const Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+
+    /* Neighboring triangles for each vertex, per-vertex count of triangles
+       that weren't added to any meshlet yet */
+    Containers::Array<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    Implementation::buildAdjacency<UnsignedInt>(Containers::arrayView(indices).prefix(triangleCount*3), vertexCount, liveTriangleCount, neighborOffset, neighbors);
+
+    /* Per-triangle emitted bits, ID of the last meshlet for which a vertex
+       was added or a triangle was put among candidates */
+    Containers::Array<UnsignedInt> emitted{(triangleCount + 31)/32};
+    Containers::Array<UnsignedInt> vertexMeshlet{Containers::DirectInit, vertexCount, ~UnsignedInt{}};
+    Containers::Array<UnsignedInt> triangleMeshlet{Containers::DirectInit, triangleCount, ~UnsignedInt{}};
+
+    /* Output index buffer, meshlet data, list of unique vertices of the
+       current meshlet */
+    Containers::Array<char> indexData{Containers::NoInit, triangleCount*3*sizeof(UnsignedInt)};
+    const auto outputIndices = Containers::arrayCast<UnsignedInt>(indexData);
+    std::size_t outputIndex = 0;
+    Containers::Array<Meshlet> meshlets;
+    Containers::Array<UnsignedInt> meshletVertices;
+    Containers::Array<Vector3> normals;
+
+    /* Triangles adjacent to the current meshlet */
+    Containers::Array<UnsignedInt> candidates;
+
+    std::size_t cursor = 0;
+    while(outputIndex != outputIndices.size()) {
+        const UnsignedInt meshletId = UnsignedInt(meshlets.size());
+
+        /* Start next to the previous meshlet, picking the candidate that has
+           the least live neighbors, in order to not leave unfilled holes
+           behind. If there's no such triangle, take the next one that wasn't
+           emitted yet. */
+        UnsignedInt triangle = ~UnsignedInt{};
+        UnsignedInt triangleLiveCount = ~UnsignedInt{};
+        for(const UnsignedInt t: candidates) {
+            if(emitted[t >> 5] & (1u << (t & 31))) continue;
+            const UnsignedInt liveCount =
+                liveTriangleCount[indices[t*3 + 0]] +
+                liveTriangleCount[indices[t*3 + 1]] +
+                liveTriangleCount[indices[t*3 + 2]];
+            if(liveCount < triangleLiveCount) {
+                triangle = t;
+                triangleLiveCount = liveCount;
+            }
+        }
+        if(triangle == ~UnsignedInt{}) {
+            while(emitted[cursor >> 5] & (1u << (cursor & 31))) ++cursor;
+            triangle = cursor;
+        }
+        arrayResize(candidates, 0);
+        arrayResize(meshletVertices, 0);
+
+        Meshlet& meshlet = arrayAppend(meshlets, Containers::InPlaceInit);
+        meshlet.indexOffset = UnsignedInt(outputIndex);
+        for(;;) {
+            /* Emit the triangle */
+            emitted[triangle >> 5] |= 1u << (triangle & 31);
+            for(UnsignedInt i = 0; i != 3; ++i) {
+                const UnsignedInt v = indices[triangle*3 + i];
+                outputIndices[outputIndex++] = v;
+                --liveTriangleCount[v];
+            }
+
+            /* Add its new vertices to the meshlet and put not yet emitted
+               triangles around them among candidates */
+            for(UnsignedInt i = 0; i != 3; ++i) {
+                const UnsignedInt v = indices[triangle*3 + i];
+                if(vertexMeshlet[v] == meshletId) continue;
+                vertexMeshlet[v] = meshletId;
+                arrayAppend(meshletVertices, v);
+
+                for(UnsignedInt ti = neighborOffset[v]; ti != neighborOffset[v + 1]; ++ti) {
+                    const UnsignedInt t = neighbors[ti];
+                    if((emitted[t >> 5] & (1u << (t & 31))) || triangleMeshlet[t] == meshletId) continue;
+                    triangleMeshlet[t] = meshletId;
+                    arrayAppend(candidates, t);
+                }
+            }
+
+            if(outputIndex - meshlet.indexOffset == maxTriangleCount*3)
+                break;
+
+            /* Pick the next triangle, preferring ones that add the least new
+               vertices and then ones with the least live neighbors. Emitted
+               triangles are removed from the candidate list along the way. */
+            triangle = ~UnsignedInt{};
+            UnsignedInt triangleNewVertexCount = ~UnsignedInt{};
+            triangleLiveCount = ~UnsignedInt{};
+            for(std::size_t i = 0; i != candidates.size(); ) {
+                const UnsignedInt t = candidates[i];
+                if(emitted[t >> 5] & (1u << (t & 31))) {
+                    candidates[i] = candidates.back();
+                    arrayRemoveSuffix(candidates);
+                    continue;
+                }
+                ++i;
+
+                const UnsignedInt newCount = newVertexCount(indices.data() + t*3, vertexMeshlet, meshletId);
+                if(meshletVertices.size() + newCount > maxVertexCount || newCount > triangleNewVertexCount)
+                    continue;
+                const UnsignedInt liveCount =
+                    liveTriangleCount[indices[t*3 + 0]] +
+                    liveTriangleCount[indices[t*3 + 1]] +
+                    liveTriangleCount[indices[t*3 + 2]];
+                if(newCount < triangleNewVertexCount || liveCount < triangleLiveCount) {
+                    triangle = t;
+                    triangleNewVertexCount = newCount;
+                    triangleLiveCount = liveCount;
+                }
+            }
+            if(triangle == ~UnsignedInt{}) break;
+        }
+
+        meshlet.indexCount = UnsignedInt(outputIndex - meshlet.indexOffset);
+        meshlet.vertexCount = UnsignedInt(meshletVertices.size());
+        meshlet.boundingSphere = boundingSphere(positions, meshletVertices);
+        normalCone(positions, outputIndices.slice(meshlet.indexOffset, outputIndex), meshlet.boundingSphere.xyz(), normals, meshlet);
+    }
+
+    /* Copy the meshlets to a vertex data array, attributes are described
+       with offsets so this works also for an empty mesh */
+    const UnsignedInt meshletCount = UnsignedInt(meshlets.size());
+    Containers::Array<char> vertexData{Containers::NoInit, meshletCount*sizeof(Meshlet)};
+    Utility::copy(Containers::arrayCast<const char>(meshlets), vertexData);
+
+    Trade::MeshIndexData indexDataDescription{outputIndices};
+    return Trade::MeshData{MeshPrimitive::Meshlets,
+        std::move(indexData), indexDataDescription,
+        std::move(vertexData), {
+            Trade::MeshAttributeData{MeshletAttribute::BoundingSphere,
+                VertexFormat::Vector4, offsetof(Meshlet, boundingSphere),
+                meshletCount, sizeof(Meshlet)},
+            Trade::MeshAttributeData{MeshletAttribute::ConeAxisCutoff,
+                VertexFormat::Vector4, offsetof(Meshlet, coneAxisCutoff),
+                meshletCount, sizeof(Meshlet)},
+            Trade::MeshAttributeData{MeshletAttribute::ConeApex,
+                VertexFormat::Vector3, offsetof(Meshlet, coneApex),
+                meshletCount, sizeof(Meshlet)},
+            Trade::MeshAttributeData{MeshletAttribute::IndexOffset,
+                VertexFormat::UnsignedInt, offsetof(Meshlet, indexOffset),
+                meshletCount, sizeof(Meshlet)},
+            Trade::MeshAttributeData{MeshletAttribute::IndexCount,
+                VertexFormat::UnsignedInt, offsetof(Meshlet, indexCount),
+                meshletCount, sizeof(Meshlet)},
+            Trade::MeshAttributeData{MeshletAttribute::VertexCount,
+                VertexFormat::UnsignedInt, offsetof(Meshlet, vertexCount),
+                meshletCount, sizeof(Meshlet)}
+        }, meshletCount};
+}
+
+}}
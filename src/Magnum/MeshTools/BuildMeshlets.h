@@ -0,0 +1,146 @@
+#ifndef Magnum_MeshTools_BuildMeshlets_h
+#define Magnum_MeshTools_BuildMeshlets_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::buildMeshlets(), namespace @ref Magnum::MeshTools::MeshletAttribute
+ * @m_since_latest
+ */
+
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Meshlet attributes
+@m_since_latest
+
+Custom @ref Trade::MeshAttribute names describing per-meshlet data in a
+@ref MeshPrimitive::Meshlets mesh produced by @ref buildMeshlets(). The IDs are
+taken from the end of the custom attribute range in order to not clash with
+importer-specific attributes.
+*/
+namespace MeshletAttribute {
+
+/**
+ * Offset of the first index of the meshlet in the index buffer.
+ * @ref VertexFormat::UnsignedInt.
+ */
+constexpr Trade::MeshAttribute IndexOffset = Trade::meshAttributeCustom(0x7f00);
+
+/**
+ * Count of indices in the meshlet, which is three times the triangle count.
+ * @ref VertexFormat::UnsignedInt.
+ */
+constexpr Trade::MeshAttribute IndexCount = Trade::meshAttributeCustom(0x7f01);
+
+/**
+ * Count of unique vertices referenced by the meshlet.
+ * @ref VertexFormat::UnsignedInt.
+ */
+constexpr Trade::MeshAttribute VertexCount = Trade::meshAttributeCustom(0x7f02);
+
+/**
+ * Bounding sphere of the meshlet, with center in the XYZ components and
+ * radius in the W component. @ref VertexFormat::Vector4.
+ */
+constexpr Trade::MeshAttribute BoundingSphere = Trade::meshAttributeCustom(0x7f03);
+
+/**
+ * Apex of the normal cone. @ref VertexFormat::Vector3.
+ */
+constexpr Trade::MeshAttribute ConeApex = Trade::meshAttributeCustom(0x7f04);
+
+/**
+ * Normalized axis of the normal cone in the XYZ components and a cutoff value
+ * in the W component. @ref VertexFormat::Vector4.
+ */
+constexpr Trade::MeshAttribute ConeAxisCutoff = Trade::meshAttributeCustom(0x7f05);
+
+}
+
+/**
+@brief Split a triangle mesh into meshlets
+@param mesh             Input mesh
+@param maxVertexCount   Max count of unique vertices in a meshlet
+@param maxTriangleCount Max count of triangles in a meshlet
+@m_since_latest
+
+Groups triangles of @p mesh into spatially coherent clusters that reference at
+most @p maxVertexCount unique vertices and contain at most @p maxTriangleCount
+triangles, suitable for cluster culling and mesh shaders. The default limits
+are the commonly recommended values for mesh shaders. Triangles are added to a
+meshlet greedily, preferring triangles that don't introduce new vertices and
+then triangles whose vertices are shared by the fewest not-yet-processed
+triangles, which reduces fragmentation. A new meshlet is started next to the
+previous one.
+
+Expects that the mesh is @ref MeshPrimitive::Triangles with a 3D
+@ref Trade::MeshAttribute::Position attribute, @p maxVertexCount is at least
+@cpp 3 @ce and @p maxTriangleCount is at least @cpp 1 @ce. Both indexed and
+non-indexed meshes are accepted.
+
+The returned mesh is @ref MeshPrimitive::Meshlets, with one "vertex" for each
+meshlet and a @ref MeshIndexType::UnsignedInt index buffer containing all
+triangles of @p mesh, reordered so triangles of each meshlet are together. The
+index buffer refers to vertices of the original @p mesh, so it can be drawn
+with the original vertex data either as a whole or a meshlet at a time. Each
+meshlet has the following attributes, interleaved with a stride of 64 bytes so
+the vertex data can be directly uploaded to a @glsl std430 @ce GPU buffer:
+
+-   @ref MeshletAttribute::BoundingSphere at offset 0
+-   @ref MeshletAttribute::ConeAxisCutoff at offset 16
+-   @ref MeshletAttribute::ConeApex at offset 32
+-   @ref MeshletAttribute::IndexOffset at offset 44
+-   @ref MeshletAttribute::IndexCount at offset 48
+-   @ref MeshletAttribute::VertexCount at offset 52
+
+The bounding sphere contains all vertices of the meshlet and can be tested
+against a view frustum using @ref Math::Intersection::sphereFrustum(). All
+triangles of the meshlet are facing away from a camera at position @f$ \boldsymbol{c} @f$
+if the following holds for the normal cone apex @f$ \boldsymbol{a} @f$, axis
+@f$ \boldsymbol{n} @f$ and cutoff @f$ t @f$, which is the same as testing with
+@ref Math::Intersection::pointCone() with the cone origin being
+@f$ \boldsymbol{a} @f$, normal @f$ -\boldsymbol{n} @f$ and the apex angle
+@f$ 2 \arccos(t) @f$: @f[
+    \frac{(\boldsymbol{a} - \boldsymbol{c}) \cdot \boldsymbol{n}}{|\boldsymbol{a} - \boldsymbol{c}|} \ge t
+@f]
+
+If the triangle normals diverge too much for the cone to be useful, the axis
+is zero and the cutoff is @cpp 1.0f @ce, which never passes the above test.
+
+Algorithm used for the bounding sphere: *Jack Ritter --- An Efficient Bounding
+Sphere, Graphics Gems, 1990*, followed by a pass that ensures all vertices are
+inside. The normal cone is calculated like in *Arseny Kapoulkine ---
+meshoptimizer, https://github.com/zeux/meshoptimizer*.
+@see @ref tipsifyInPlace(), @ref Trade::MeshData::attribute()
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData buildMeshlets(const Trade::MeshData& mesh, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 126);
+
+}}
+
+#endif
@@ -37,6 +37,7 @@ namespace Magnum { namespace MeshTools {
 UnsignedInt primitiveCount(const MeshPrimitive primitive, const UnsignedInt elementCount) {
     if(primitive == MeshPrimitive::Points ||
        primitive == MeshPrimitive::Edges ||
+       primitive == MeshPrimitive::Meshlets ||
        primitive == MeshPrimitive::Faces ||
        primitive == MeshPrimitive::Instances)
         return elementCount;
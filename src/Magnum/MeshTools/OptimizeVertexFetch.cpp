@@ -0,0 +1,291 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "OptimizeVertexFetch.h"
+
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Calculates a full old-to-new vertex mapping, with unreferenced vertices
+   put at the end in their original order. Referenced vertices are either in
+   the order of first use or in the original order. Returns count of
+   referenced vertices or ~UnsignedInt{} if an index is out of bounds. */
+template<class T> UnsignedInt calculateRemap(const char* const prefix, const Containers::StridedArrayView1D<const T>& indices, const Containers::ArrayView<UnsignedInt> remap, const bool firstUse) {
+    for(UnsignedInt& i: remap) i = ~UnsignedInt{};
+
+    UnsignedInt usedCount = 0;
+    for(const T index: indices) {
+        CORRADE_ASSERT(index < remap.size(),
+            prefix << "index" << index << "out of bounds for" << remap.size() << "vertices", ~UnsignedInt{});
+        if(remap[index] == ~UnsignedInt{}) remap[index] = usedCount++;
+    }
+    #ifdef CORRADE_NO_ASSERT
+    static_cast<void>(prefix);
+    #endif
+
+    /* For compaction the first-use numbering is used only to mark referenced
+       vertices, renumber them in the original order */
+    if(!firstUse) {
+        UnsignedInt next = 0;
+        for(UnsignedInt& i: remap) if(i != ~UnsignedInt{}) i = next++;
+    }
+
+    UnsignedInt next = usedCount;
+    for(UnsignedInt& i: remap) if(i == ~UnsignedInt{}) i = next++;
+
+    return usedCount;
+}
+
+Containers::Array<UnsignedInt> inverseRemap(const Containers::ArrayView<const UnsignedInt> remap) {
+    Containers::Array<UnsignedInt> inverse{Containers::NoInit, remap.size()};
+    for(std::size_t i = 0; i != remap.size(); ++i) inverse[remap[i]] = UnsignedInt(i);
+    return inverse;
+}
+
+/* Moves vertex at inverse[i] to i by following the permutation cycles, which
+   needs just a single vertex of temporary storage. The visited array is a
+   scratch memory of the same size as inverse. */
+void permuteInPlace(const Containers::ArrayView<const UnsignedInt> inverse, const Containers::ArrayView<bool> visited, const Containers::StridedArrayView2D<char>& data) {
+    const std::size_t size = data.size()[1];
+    Containers::Array<char> vertex{Containers::NoInit, size};
+    for(bool& i: visited) i = false;
+
+    for(std::size_t i = 0; i != inverse.size(); ++i) {
+        if(visited[i] || inverse[i] == i) continue;
+
+        std::memcpy(vertex.data(), data[i].data(), size);
+        std::size_t j = i;
+        for(;;) {
+            visited[j] = true;
+            const std::size_t k = inverse[j];
+            if(k == i) {
+                std::memcpy(data[j].data(), vertex.data(), size);
+                break;
+            }
+            std::memcpy(data[j].data(), data[k].data(), size);
+            j = k;
+        }
+    }
+}
+
+template<class T> void remapIndicesInPlace(const Containers::ArrayView<const UnsignedInt> remap, const Containers::StridedArrayView1D<T>& indices) {
+    for(T& i: indices) i = T(remap[i]);
+}
+
+template<class T> std::size_t remapVerticesInPlaceImplementation(const char* const prefix, const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView2D<char>& data, const bool firstUse) {
+    CORRADE_ASSERT(data.empty()[0] || data.isContiguous<1>(),
+        prefix << "second data view dimension is not contiguous", {});
+
+    Containers::Array<UnsignedInt> remap{Containers::NoInit, data.size()[0]};
+    const UnsignedInt usedCount = calculateRemap<T>(prefix, indices, remap, firstUse);
+    /* An index was out of bounds, graceful assert in the above */
+    if(usedCount == ~UnsignedInt{}) return {};
+
+    const Containers::Array<UnsignedInt> inverse = inverseRemap(remap);
+    Containers::Array<bool> visited{Containers::NoInit, inverse.size()};
+    permuteInPlace(inverse, visited, data);
+    remapIndicesInPlace(remap, indices);
+    return usedCount;
+}
+
+/* Calculates the remapping table from mesh indices of any type */
+UnsignedInt calculateRemap(const char* const prefix, const Trade::MeshData& data, const Containers::ArrayView<UnsignedInt> remap, const bool firstUse) {
+    switch(data.indexType()) {
+        case MeshIndexType::UnsignedByte:
+            return calculateRemap<UnsignedByte>(prefix, data.indices<UnsignedByte>(), remap, firstUse);
+        case MeshIndexType::UnsignedShort:
+            return calculateRemap<UnsignedShort>(prefix, data.indices<UnsignedShort>(), remap, firstUse);
+        case MeshIndexType::UnsignedInt:
+            return calculateRemap<UnsignedInt>(prefix, data.indices<UnsignedInt>(), remap, firstUse);
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+void remapIndicesInPlace(const Containers::ArrayView<const UnsignedInt> remap, const MeshIndexType type, const Containers::StridedArrayView2D<char>& indices) {
+    switch(type) {
+        case MeshIndexType::UnsignedByte:
+            return remapIndicesInPlace(remap, Containers::arrayCast<1, UnsignedByte>(indices));
+        case MeshIndexType::UnsignedShort:
+            return remapIndicesInPlace(remap, Containers::arrayCast<1, UnsignedShort>(indices));
+        case MeshIndexType::UnsignedInt:
+            return remapIndicesInPlace(remap, Containers::arrayCast<1, UnsignedInt>(indices));
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+Trade::MeshData remapVertices(const char* const prefix, const Trade::MeshData& data, const bool firstUse) {
+    CORRADE_ASSERT(data.isIndexed(),
+        prefix << "mesh data not indexed",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+
+    Containers::Array<UnsignedInt> remap{Containers::NoInit, data.vertexCount()};
+    const UnsignedInt usedCount = calculateRemap(prefix, data, remap, firstUse);
+    /* An index was out of bounds, graceful assert in the above */
+    if(usedCount == ~UnsignedInt{})
+        return Trade::MeshData{MeshPrimitive::Triangles, 0};
+
+    /* Copy the indices, keeping the original type, and remap them */
+    const Containers::StridedArrayView2D<const char> indices = data.indices();
+    Containers::Array<char> indexData{Containers::NoInit, indices.size()[0]*indices.size()[1]};
+    const Containers::StridedArrayView2D<char> outputIndices{indexData, indices.size()};
+    Utility::copy(indices, outputIndices);
+    remapIndicesInPlace(remap, data.indexType(), outputIndices);
+
+    /* Gather referenced vertices of all attributes into a new interleaved
+       layout */
+    const Containers::Array<UnsignedInt> inverse = inverseRemap(remap);
+    Trade::MeshData layout = interleavedLayout(data, usedCount);
+    for(UnsignedInt i = 0; i != data.attributeCount(); ++i)
+        duplicateInto(inverse.prefix(usedCount), data.attribute(i), layout.mutableAttribute(i));
+
+    Trade::MeshIndexData indexDataDescription{data.indexType(), indexData};
+    return Trade::MeshData{data.primitive(),
+        std::move(indexData), indexDataDescription,
+        layout.releaseVertexData(), layout.releaseAttributeData(),
+        usedCount};
+}
+
+Trade::MeshData remapVertices(const char* const prefix, Trade::MeshData&& data, const bool firstUse) {
+    CORRADE_ASSERT(data.isIndexed(),
+        prefix << "mesh data not indexed",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+
+    /* If the data can't be modified, make a copy */
+    if(!(data.indexDataFlags() & Trade::DataFlag::Mutable) ||
+       !(data.vertexDataFlags() & Trade::DataFlag::Mutable))
+        return remapVertices(prefix, static_cast<const Trade::MeshData&>(data), firstUse);
+
+    Containers::Array<UnsignedInt> remap{Containers::NoInit, data.vertexCount()};
+    const UnsignedInt usedCount = calculateRemap(prefix, data, remap, firstUse);
+    /* An index was out of bounds, graceful assert in the above */
+    if(usedCount == ~UnsignedInt{})
+        return Trade::MeshData{MeshPrimitive::Triangles, 0};
+
+    /* Permute all vertex data. If the mesh is interleaved, this can be done
+       in a single pass over the whole stride, otherwise each attribute is
+       permuted separately. */
+    const Containers::Array<UnsignedInt> inverse = inverseRemap(remap);
+    Containers::Array<bool> visited{Containers::NoInit, inverse.size()};
+    if(isInterleaved(data))
+        permuteInPlace(inverse, visited, interleavedMutableData(data));
+    else for(UnsignedInt i = 0; i != data.attributeCount(); ++i)
+        permuteInPlace(inverse, visited, data.mutableAttribute(i));
+    remapIndicesInPlace(remap, data.indexType(), data.mutableIndices());
+
+    /* Route all attributes to the prefix of referenced vertices. The data
+       pointers stay the same even after the data get released below. */
+    const Containers::ArrayView<const char> vertexData = data.vertexData();
+    Containers::Array<Trade::MeshAttributeData> attributeData{data.attributeCount()};
+    for(UnsignedInt i = 0; i != data.attributeCount(); ++i)
+        attributeData[i] = Trade::MeshAttributeData{data.attributeName(i),
+            data.attributeFormat(i),
+            Containers::StridedArrayView1D<const void>{vertexData,
+                vertexData.data() + data.attributeOffset(i),
+                usedCount, data.attributeStride(i)},
+            data.attributeArraySize(i)};
+
+    /* Transfer the ownership, if the data are owned */
+    const Trade::MeshIndexData indices{data.indices()};
+    const Trade::DataFlags indexDataFlags = data.indexDataFlags();
+    const Trade::DataFlags vertexDataFlags = data.vertexDataFlags();
+    const Containers::ArrayView<const char> indexData = data.indexData();
+    const MeshPrimitive primitive = data.primitive();
+    if(indexDataFlags & Trade::DataFlag::Owned) {
+        if(vertexDataFlags & Trade::DataFlag::Owned)
+            return Trade::MeshData{primitive,
+                data.releaseIndexData(), indices,
+                data.releaseVertexData(), std::move(attributeData),
+                usedCount};
+        return Trade::MeshData{primitive,
+            data.releaseIndexData(), indices,
+            vertexDataFlags, vertexData, std::move(attributeData),
+            usedCount};
+    }
+    if(vertexDataFlags & Trade::DataFlag::Owned)
+        return Trade::MeshData{primitive,
+            indexDataFlags, indexData, indices,
+            data.releaseVertexData(), std::move(attributeData),
+            usedCount};
+    return Trade::MeshData{primitive,
+        indexDataFlags, indexData, indices,
+        vertexDataFlags, vertexData, std::move(attributeData),
+        usedCount};
+}
+
+}
+
+std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& data) {
+    return remapVerticesInPlaceImplementation("MeshTools::optimizeVertexFetchInPlace():", indices, data, true);
+}
+
+std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& data) {
+    return remapVerticesInPlaceImplementation("MeshTools::optimizeVertexFetchInPlace():", indices, data, true);
+}
+
+std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& data) {
+    return remapVerticesInPlaceImplementation("MeshTools::optimizeVertexFetchInPlace():", indices, data, true);
+}
+
+std::size_t compactVerticesInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& data) {
+    return remapVerticesInPlaceImplementation("MeshTools::compactVerticesInPlace():", indices, data, false);
+}
+
+std::size_t compactVerticesInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& data) {
+    return remapVerticesInPlaceImplementation("MeshTools::compactVerticesInPlace():", indices, data, false);
+}
+
+std::size_t compactVerticesInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& data) {
+    return remapVerticesInPlaceImplementation("MeshTools::compactVerticesInPlace():", indices, data, false);
+}
+
+Trade::MeshData optimizeVertexFetch(const Trade::MeshData& data) {
+    return remapVertices("MeshTools::optimizeVertexFetch():", data, true);
+}
+
+Trade::MeshData optimizeVertexFetch(Trade::MeshData&& data) {
+    return remapVertices("MeshTools::optimizeVertexFetch():", std::move(data), true);
+}
+
+Trade::MeshData compactVertices(const Trade::MeshData& data) {
+    return remapVertices("MeshTools::compactVertices():", data, false);
+}
+
+Trade::MeshData compactVertices(Trade::MeshData&& data) {
+    return remapVertices("MeshTools::compactVertices():", std::move(data), false);
+}
+
+}}
@@ -0,0 +1,179 @@
+#ifndef Magnum_MeshTools_OptimizeVertexFetch_h
+#define Magnum_MeshTools_OptimizeVertexFetch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::optimizeVertexFetchInPlace(), @ref Magnum::MeshTools::optimizeVertexFetch(), @ref Magnum::MeshTools::compactVerticesInPlace(), @ref Magnum::MeshTools::compactVertices()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Reorder vertices for fetch locality in-place
+@param[in,out] indices  Index array to operate on
+@param[in,out] data     Vertex data to operate on
+@return Count of vertices referenced by @p indices
+@m_since_latest
+
+Reorders vertices in @p data in the order in which they're first referenced
+by @p indices and updates @p indices accordingly, so consecutive triangles
+fetch vertices from nearby memory locations. Vertices that aren't referenced
+by any index are moved after the referenced vertices, so the returned value
+can be used to get the prefix of @p data containing only referenced vertices.
+The relative order of the unreferenced vertices is preserved.
+
+The data are permuted in-place, needing just a temporary storage for a single
+vertex in addition to the remapping tables. Meant to be called after
+@ref tipsifyInPlace() or any other operation that changes the order of
+triangles, as the vertex order then follows it.
+
+Expects that the second dimension of @p data is contiguous and all indices
+are less than the size of the first dimension of @p data.
+@see @ref compactVerticesInPlace(), @ref optimizeVertexFetch(),
+    @ref removeDuplicatesIndexedInPlace()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+@brief Remove unreferenced vertices in-place
+@param[in,out] indices  Index array to operate on
+@param[in,out] data     Vertex data to operate on
+@return Count of vertices referenced by @p indices
+@m_since_latest
+
+Moves vertices that aren't referenced by any index in @p indices after all
+referenced vertices, preserving relative order of both, and updates
+@p indices accordingly. The returned value can be used to get the prefix of
+@p data containing only referenced vertices. Unlike
+@ref optimizeVertexFetchInPlace(), if all vertices are referenced, neither
+@p indices nor @p data are modified.
+
+Expects that the second dimension of @p data is contiguous and all indices
+are less than the size of the first dimension of @p data.
+@see @ref compactVertices()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t compactVerticesInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t compactVerticesInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t compactVerticesInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+@brief Reorder mesh vertices for fetch locality
+@m_since_latest
+
+Same as @ref optimizeVertexFetchInPlace(), but operating on all attributes of
+an indexed @ref Trade::MeshData. Vertices not referenced by the index buffer
+are dropped. The original index type is preserved, the vertex data are
+copied to a new interleaved owned instance, preserving attribute offsets and
+paddings if the input is already interleaved.
+
+This function unconditionally copies the vertex and index data, if your data
+are mutable and you don't need the original instance after the process, call
+@ref optimizeVertexFetch(Trade::MeshData&&) instead to avoid the extra copy.
+
+Expects that the mesh is indexed.
+@see @ref compactVertices(), @ref removeDuplicates(const Trade::MeshData&, UnsignedInt)
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData optimizeVertexFetch(const Trade::MeshData& data);
+
+/**
+@brief Reorder mesh vertices for fetch locality
+@m_since_latest
+
+Compared to @ref optimizeVertexFetch(const Trade::MeshData&), if both index
+and vertex data of @p data are @ref Trade::DataFlag::Mutable, the operation
+is done in-place and the returned instance references the same index and vertex
+data as @p data, including its layout. Vertices not referenced by the index
+buffer are moved to the end of the vertex data and the returned instance has
+a correspondingly smaller vertex count. Ownership of the data is transferred
+to the returned instance, if @p data owns them. If the data are not mutable,
+this function falls back to @ref optimizeVertexFetch(const Trade::MeshData&).
+
+Attributes that aren't interleaved are reordered one after another and are
+thus expected to not alias each other.
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData optimizeVertexFetch(Trade::MeshData&& data);
+
+/**
+@brief Remove unreferenced mesh vertices
+@m_since_latest
+
+Same as @ref compactVerticesInPlace(), but operating on all attributes of an
+indexed @ref Trade::MeshData. The original index type is preserved, the
+vertex data are copied to a new interleaved owned instance, preserving
+attribute offsets and paddings if the input is already interleaved.
+
+This function unconditionally copies the vertex and index data, if your data
+are mutable and you don't need the original instance after the process, call
+@ref compactVertices(Trade::MeshData&&) instead to avoid the extra copy.
+
+Expects that the mesh is indexed.
+@see @ref optimizeVertexFetch()
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData compactVertices(const Trade::MeshData& data);
+
+/**
+@brief Remove unreferenced mesh vertices
+@m_since_latest
+
+Compared to @ref compactVertices(const Trade::MeshData&), if both index and
+vertex data of @p data are @ref Trade::DataFlag::Mutable, the operation is
+done in-place, with the same behavior as described in
+@ref optimizeVertexFetch(Trade::MeshData&&).
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData compactVertices(Trade::MeshData&& data);
+
+}}
+
+#endif
@@ -28,12 +28,11 @@
 #include <cstring>
 #include <limits>
 #include <numeric>
-#include <unordered_map>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Utility/Algorithms.h>
-#include <Corrade/Utility/MurmurHash2.h>
 
+#include "Magnum/Implementation/parallelFor.h"
 #include "Magnum/Math/FunctionsBatch.h"
 #include "Magnum/Math/Range.h"
 #include "Magnum/MeshTools/Reference.h"
@@ -43,89 +42,163 @@
 
 namespace Magnum { namespace MeshTools {
 
-struct ArrayEqual {
-    explicit ArrayEqual(std::size_t size): _size{size} {}
+namespace {
 
-    bool operator()(const void* a, const void* b) const {
-        return std::memcmp(a, b, _size) == 0;
-    }
+/* Key size known at compile time, allowing the hashing and comparison loops
+   to get fully unrolled for the common small vertex sizes */
+template<std::size_t size> struct FixedKeySize {
+    explicit FixedKeySize(std::size_t) {}
 
-    private: std::size_t _size;
+    constexpr std::size_t operator()() const { return size; }
 };
 
-struct ArrayHash {
-    explicit ArrayHash(std::size_t size): _size{size} {}
+/* Key size known only at runtime */
+struct RuntimeKeySize {
+    explicit RuntimeKeySize(std::size_t size): _size{size} {}
 
-    std::size_t operator()(const void* a) const {
-        return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(static_cast<const char*>(a), _size).byteArray());
-    }
+    std::size_t operator()() const { return _size; }
 
     private: std::size_t _size;
 };
 
-std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
-    /* Assuming the second dimension is contiguous so we can calculate the
-       hashes easily */
-    CORRADE_ASSERT(data.empty()[0] || data.isContiguous<1>(),
-        "MeshTools::removeDuplicatesInto(): second data view dimension is not contiguous", {});
+/* Mixing and finalization steps of MurmurHash3, processing eight bytes at a
+   time. Compared to Utility::MurmurHash2 it doesn't need to go byte-by-byte
+   and compiles down to just a few multiplications for fixed key sizes. */
+inline UnsignedLong hashCombine(UnsignedLong hash, UnsignedLong word) {
+    word *= 0x87c37b91114253d5ull;
+    word = (word << 31)|(word >> 33);
+    word *= 0x4cf5ad432745937full;
+    hash ^= word;
+    hash = (hash << 27)|(hash >> 37);
+    return hash*5 + 0x52dce729;
+}
+
+inline UnsignedLong hashFinalize(UnsignedLong hash) {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+template<class KeySize> UnsignedLong hashKey(const char* const key, const KeySize keySize) {
+    const std::size_t size = keySize();
+    UnsignedLong hash = size;
+    std::size_t i = 0;
+    for(; i + 8 <= size; i += 8) {
+        UnsignedLong word;
+        std::memcpy(&word, key + i, 8);
+        hash = hashCombine(hash, word);
+    }
+    if(i != size) {
+        UnsignedLong word = 0;
+        std::memcpy(&word, key + i, size - i);
+        hash = hashCombine(hash, word);
+    }
+    return hashFinalize(hash);
+}
+
+/* Open-addressing hash table with linear probing, mapping keys to indices of
+   their first occurence. The table doesn't store the keys, only a 32-bit
+   index together with upper 32 bits of the key hash, all in a single
+   allocation. A key for a stored index `i` is expected to be found at
+   `data + i*stride` and not change while the table is in use. The hash
+   prefix makes it possible to skip the majority of mismatched key
+   comparisons without touching the key data at all. */
+template<class KeySize> class IndexTable {
+    public:
+        explicit IndexTable(const char* const data, const std::ptrdiff_t stride, const std::size_t keySize, const std::size_t expectedSize): _data{data}, _stride{stride}, _keySize{keySize}, _size{} {
+            /* Keep the load factor below 3/4 even if all keys are unique.
+               Linear probing degrades quickly above that. */
+            std::size_t capacity = 16;
+            while(capacity < expectedSize + expectedSize/3 + 1)
+                capacity <<= 1;
+            _slots = Containers::Array<UnsignedLong>{Containers::ValueInit, capacity};
+            _mask = capacity - 1;
+        }
+
+        std::size_t size() const { return _size; }
+
+        /* If a key equal to the one at `key` is already present, returns its
+           index. Otherwise stores `index` and returns it. In that case, the
+           key data is expected to be located at `data + index*stride` from
+           now on. */
+        UnsignedInt insert(const char* const key, const UnsignedInt index) {
+            return insert(key, index, hashKey(key, _keySize));
+        }
 
+        /* Same as above, but with a hash calculated upfront using
+           hashKey() */
+        UnsignedInt insert(const char* const key, const UnsignedInt index, const UnsignedLong hash) {
+            const UnsignedLong tag = hash & 0xffffffff00000000ull;
+            for(std::size_t slot = hash & _mask; ; slot = (slot + 1) & _mask) {
+                const UnsignedLong value = _slots[slot];
+
+                /* Empty slot, the key is not in the table yet. Indices are
+                   stored incremented by one so zero-initialized memory means
+                   an empty table. */
+                if(!value) {
+                    _slots[slot] = tag|(UnsignedLong(index) + 1);
+                    ++_size;
+                    return index;
+                }
+
+                /* Compare the actual key data only if the hash matches */
+                if((value & 0xffffffff00000000ull) == tag) {
+                    const UnsignedInt existing = UnsignedInt(value) - 1;
+                    if(std::memcmp(_data + std::ptrdiff_t(existing)*_stride, key, _keySize()) == 0)
+                        return existing;
+                }
+            }
+        }
+
+        void clear() {
+            std::memset(_slots.data(), 0, _slots.size()*sizeof(UnsignedLong));
+            _size = 0;
+        }
+
+    private:
+        const char* _data;
+        std::ptrdiff_t _stride;
+        KeySize _keySize;
+        Containers::Array<UnsignedLong> _slots;
+        std::size_t _mask, _size;
+};
+
+template<class KeySize> std::size_t removeDuplicatesIntoImplementation(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
     const std::size_t dataSize = data.size()[0];
-    CORRADE_ASSERT(indices.size() == dataSize,
-        "MeshTools::removeDuplicatesInto(): output index array has" << indices.size() << "elements but expected" << dataSize, {});
 
     /* Table containing index of first occurence for each unique entry.
-       Reserving more buckets than necessary (i.e. as if each entry was
+       Reserving more slots than necessary (i.e. as if each entry was
        unique). */
-    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
-        dataSize,
-        ArrayHash{data.size()[1]},
-        ArrayEqual{data.size()[1]}};
+    IndexTable<KeySize> table{static_cast<const char*>(data.data()), data.stride()[0], data.size()[1], dataSize};
 
     /* Go through all entries */
     for(std::size_t i = 0; i != dataSize; ++i) {
         /* Try to insert new entry into the table. The inserted index points
-           into the original unchanged data array. */
-        const Containers::ArrayView<const char> entry = data[i].asContiguous();
-        const auto result = table.emplace(entry, i);
-
-        /* Put the (either new or already existing) index into the output
-           index array */
-        indices[i] = result.first->second;
+           into the original unchanged data array. Put the (either new or
+           already existing) index into the output index array. */
+        indices[i] = table.insert(static_cast<const char*>(data[i].data()), i);
     }
 
     CORRADE_INTERNAL_ASSERT(dataSize >= table.size());
     return table.size();
 }
 
-std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicates(const Containers::StridedArrayView2D<const char>& data) {
-    Containers::Array<UnsignedInt> indices{Containers::NoInit, data.size()[0]};
-    const std::size_t size = removeDuplicatesInto(data, indices);
-    return {std::move(indices), size};
-}
-
-std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
-    /* Assuming the second dimension is contiguous so we can calculate the
-       hashes easily */
-    CORRADE_ASSERT(data.empty()[0] || data.isContiguous<1>(),
-        "MeshTools::removeDuplicatesInPlaceInto(): second data view dimension is not contiguous", {});
-
+template<class KeySize> std::size_t removeDuplicatesInPlaceIntoImplementation(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
     const std::size_t dataSize = data.size()[0];
-    CORRADE_ASSERT(indices.size() == dataSize,
-        "MeshTools::removeDuplicatesInPlaceInto(): output index array has" << indices.size() << "elements but expected" << dataSize, {});
 
     /* Table containing index of first occurence for each unique entry.
-       Reserving more buckets than necessary (i.e. as if each entry was
+       Reserving more slots than necessary (i.e. as if each entry was
        unique). */
-    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
-        dataSize,
-        ArrayHash{data.size()[1]},
-        ArrayEqual{data.size()[1]}};
+    IndexTable<KeySize> table{static_cast<const char*>(data.data()), data.stride()[0], data.size()[1], dataSize};
 
     /* Go through all entries and insert them into the table. Because the keys
-       have runtime size, the table doesn't store a copy of the keys, only a
-       reference. The reference is to the original data that we mutate
-       in-place, so extra care needs to be taken to prevent already-inserted
-       keys from getting modified. */
+       have runtime size, the table doesn't store a copy of the keys, only an
+       index. The index is to the original data that we mutate in-place, so
+       extra care needs to be taken to prevent already-inserted keys from
+       getting modified. */
     for(std::size_t i = 0; i != dataSize; ++i) {
         /* First copy the key data to a potentially final no-longer-mutable
            place (except if the source and target location is the same). Data
@@ -135,35 +208,259 @@ std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<cha
            it fails the location isn't used as a key anywhere and so it can be
            reused next time for a different key.
 
-           Alternatively we could first call find() and only then conditionally
-           do a copy() and emplace(), but that means the hash & search would be
-           performed twice, which is never faster than a plain memory copy. */
-        const Containers::ArrayView<char> dst = data[table.size()].asContiguous();
-        if(i != table.size())
+           Alternatively we could first look the key up and only then
+           conditionally do a copy() and insert, but that means the hash &
+           search would be performed twice, which is never faster than a plain
+           memory copy. */
+        const std::size_t size = table.size();
+        const Containers::ArrayView<char> dst = data[size].asContiguous();
+        if(i != size)
             Utility::copy(data[i].asContiguous(), dst);
 
         /* Insert the new entry into the table. If it succeeds, dst is
-           guaranteed to not change anymore. */
-        const auto result = table.emplace(dst, table.size());
-
-        /* Put the (either new or already existing) index into the output index
-           array */
-        indices[i] = result.first->second;
+           guaranteed to not change anymore. Put the (either new or already
+           existing) index into the output index array. */
+        indices[i] = table.insert(dst.data(), size);
     }
 
     CORRADE_INTERNAL_ASSERT(dataSize >= table.size());
     return table.size();
 }
 
-std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>& data) {
+/* Parallel variant of removeDuplicatesIntoImplementation(). The data are
+   partitioned into `chunkCount` shards based on their hash, which means equal
+   items always end up in the same shard and each shard can be deduplicated
+   independently with its own table. Items in each shard are kept in their
+   original order so the first occurence in a shard is the first occurence in
+   the whole array, making the output exactly the same as with the serial
+   variant. Returns the unique count, `indices` get filled with the index of
+   the first occurence for each item. */
+template<class KeySize> std::size_t removeDuplicatesIntoParallelImplementation(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const UnsignedInt chunkCount) {
+    const std::size_t dataSize = data.size()[0];
+    const KeySize keySize{data.size()[1]};
+
+    /* One shard per chunk. Using the upper half of the hash for shard
+       assignment, as the table uses lower bits for slot position. */
+    const UnsignedInt shardCount = chunkCount;
+    auto shardFor = [shardCount](const UnsignedLong hash) {
+        return UnsignedInt(((hash >> 32)*shardCount) >> 32);
+    };
+
+    /* Calculate hashes of all items and count how many items from each chunk
+       goes into each shard */
+    Containers::Array<UnsignedLong> hashes{Containers::NoInit, dataSize};
+    Containers::Array<std::size_t> offsets{Containers::ValueInit, std::size_t(chunkCount)*shardCount};
+    Implementation::parallelFor(dataSize, chunkCount, [&](const std::size_t begin, const std::size_t end, const UnsignedInt chunk) {
+        std::size_t* const chunkOffsets = offsets.data() + std::size_t(chunk)*shardCount;
+        for(std::size_t i = begin; i != end; ++i) {
+            const UnsignedLong hash = hashKey(static_cast<const char*>(data[i].data()), keySize);
+            hashes[i] = hash;
+            ++chunkOffsets[shardFor(hash)];
+        }
+    });
+
+    /* Convert the counts to offsets into a shard-major item order, with
+       items from earlier chunks going first in each shard */
+    Containers::Array<std::size_t> shardOffsets{Containers::NoInit, std::size_t(shardCount) + 1};
+    {
+        std::size_t offset = 0;
+        for(UnsignedInt shard = 0; shard != shardCount; ++shard) {
+            shardOffsets[shard] = offset;
+            for(UnsignedInt chunk = 0; chunk != chunkCount; ++chunk) {
+                std::size_t& chunkOffset = offsets[std::size_t(chunk)*shardCount + shard];
+                const std::size_t count = chunkOffset;
+                chunkOffset = offset;
+                offset += count;
+            }
+        }
+        shardOffsets[shardCount] = offset;
+        CORRADE_INTERNAL_ASSERT(offset == dataSize);
+    }
+
+    /* Scatter item indices into their shards. The chunk ranges are the same
+       as in the first pass. */
+    Containers::Array<UnsignedInt> order{Containers::NoInit, dataSize};
+    Implementation::parallelFor(dataSize, chunkCount, [&](const std::size_t begin, const std::size_t end, const UnsignedInt chunk) {
+        std::size_t* const chunkOffsets = offsets.data() + std::size_t(chunk)*shardCount;
+        for(std::size_t i = begin; i != end; ++i)
+            order[chunkOffsets[shardFor(hashes[i])]++] = i;
+    });
+
+    /* Deduplicate each shard separately. Each index is written by exactly
+       one shard, so there's no need for any synchronization. */
+    Containers::Array<std::size_t> uniqueCounts{Containers::NoInit, shardCount};
+    Implementation::parallelFor(shardCount, chunkCount, [&](const std::size_t begin, const std::size_t end, UnsignedInt) {
+        for(std::size_t shard = begin; shard != end; ++shard) {
+            const Containers::ArrayView<const UnsignedInt> shardOrder = order.slice(shardOffsets[shard], shardOffsets[shard + 1]);
+            IndexTable<KeySize> table{static_cast<const char*>(data.data()), data.stride()[0], data.size()[1], shardOrder.size()};
+            for(const UnsignedInt i: shardOrder)
+                indices[i] = table.insert(static_cast<const char*>(data[i].data()), i, hashes[i]);
+            uniqueCounts[shard] = table.size();
+        }
+    });
+
+    std::size_t uniqueCount = 0;
+    for(const std::size_t count: uniqueCounts) uniqueCount += count;
+    CORRADE_INTERNAL_ASSERT(dataSize >= uniqueCount);
+    return uniqueCount;
+}
+
+/* Parallel variant of removeDuplicatesInPlaceIntoImplementation(). First
+   finds the first occurence for each item in parallel, then calculates the
+   position of each unique item in the output, moves the unique items to
+   their final place and remaps the indices. */
+template<class KeySize> std::size_t removeDuplicatesInPlaceIntoParallelImplementation(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const UnsignedInt chunkCount) {
+    const std::size_t dataSize = data.size()[0];
+    const std::size_t uniqueCount = removeDuplicatesIntoParallelImplementation<KeySize>(data, indices, chunkCount);
+
+    /* Count unique items in each chunk, an item is unique if it's the first
+       occurence of itself */
+    Containers::Array<std::size_t> chunkOffsets{Containers::NoInit, chunkCount};
+    Implementation::parallelFor(dataSize, chunkCount, [&](const std::size_t begin, const std::size_t end, const UnsignedInt chunk) {
+        std::size_t count = 0;
+        for(std::size_t i = begin; i != end; ++i)
+            if(indices[i] == i) ++count;
+        chunkOffsets[chunk] = count;
+    });
+    {
+        std::size_t offset = 0;
+        for(std::size_t& chunkOffset: chunkOffsets) {
+            const std::size_t count = chunkOffset;
+            chunkOffset = offset;
+            offset += count;
+        }
+        CORRADE_INTERNAL_ASSERT(offset == uniqueCount);
+    }
+
+    /* Calculate the output position for each unique item */
+    Containers::Array<UnsignedInt> uniqueIndices{Containers::NoInit, dataSize};
+    Implementation::parallelFor(dataSize, chunkCount, [&](const std::size_t begin, const std::size_t end, const UnsignedInt chunk) {
+        std::size_t offset = chunkOffsets[chunk];
+        for(std::size_t i = begin; i != end; ++i)
+            if(indices[i] == i) uniqueIndices[i] = offset++;
+    });
+
+    /* Move the unique items to their final place. The target position is
+       always before or at the source position, so doing this serially in
+       order never overwrites anything that wasn't moved yet. This is just a
+       copy, which is cheap compared to the hashing above. */
+    for(std::size_t i = 0; i != dataSize; ++i)
+        if(indices[i] == i && uniqueIndices[i] != i)
+            Utility::copy(data[i].asContiguous(), data[uniqueIndices[i]].asContiguous());
+
+    /* Remap the indices from first occurences to output positions */
+    Implementation::parallelFor(dataSize, chunkCount, [&](const std::size_t begin, const std::size_t end, UnsignedInt) {
+        for(std::size_t i = begin; i != end; ++i)
+            indices[i] = uniqueIndices[indices[i]];
+    });
+
+    return uniqueCount;
+}
+
+/* Minimal amount of items per thread to make it worth spawning it */
+constexpr std::size_t MinParallelChunkSize = 16384;
+
+}
+
+std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const UnsignedInt threadCount) {
+    /* Assuming the second dimension is contiguous so we can calculate the
+       hashes easily */
+    CORRADE_ASSERT(data.empty()[0] || data.isContiguous<1>(),
+        "MeshTools::removeDuplicatesInto(): second data view dimension is not contiguous", {});
+
+    const std::size_t dataSize = data.size()[0];
+    CORRADE_ASSERT(indices.size() == dataSize,
+        "MeshTools::removeDuplicatesInto(): output index array has" << indices.size() << "elements but expected" << dataSize, {});
+
+    /* Dispatch to implementations specialized for the most common vertex and
+       index tuple sizes, the rest goes through a generic loop */
+    const UnsignedInt chunkCount = Implementation::parallelChunkCount(dataSize, threadCount, MinParallelChunkSize);
+    if(chunkCount > 1) {
+        #define _c(size) case size: return removeDuplicatesIntoParallelImplementation<FixedKeySize<size>>(data, indices, chunkCount);
+        switch(data.size()[1]) {
+            _c(4)
+            _c(8)
+            _c(12)
+            _c(16)
+            _c(24)
+            _c(32)
+        }
+        #undef _c
+
+        return removeDuplicatesIntoParallelImplementation<RuntimeKeySize>(data, indices, chunkCount);
+    }
+
+    #define _c(size) case size: return removeDuplicatesIntoImplementation<FixedKeySize<size>>(data, indices);
+    switch(data.size()[1]) {
+        _c(4)
+        _c(8)
+        _c(12)
+        _c(16)
+        _c(24)
+        _c(32)
+    }
+    #undef _c
+
+    return removeDuplicatesIntoImplementation<RuntimeKeySize>(data, indices);
+}
+
+std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicates(const Containers::StridedArrayView2D<const char>& data, const UnsignedInt threadCount) {
+    Containers::Array<UnsignedInt> indices{Containers::NoInit, data.size()[0]};
+    const std::size_t size = removeDuplicatesInto(data, indices, threadCount);
+    return {std::move(indices), size};
+}
+
+std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const UnsignedInt threadCount) {
+    /* Assuming the second dimension is contiguous so we can calculate the
+       hashes easily */
+    CORRADE_ASSERT(data.empty()[0] || data.isContiguous<1>(),
+        "MeshTools::removeDuplicatesInPlaceInto(): second data view dimension is not contiguous", {});
+
+    const std::size_t dataSize = data.size()[0];
+    CORRADE_ASSERT(indices.size() == dataSize,
+        "MeshTools::removeDuplicatesInPlaceInto(): output index array has" << indices.size() << "elements but expected" << dataSize, {});
+
+    /* Dispatch to implementations specialized for the most common vertex and
+       index tuple sizes, the rest goes through a generic loop */
+    const UnsignedInt chunkCount = Implementation::parallelChunkCount(dataSize, threadCount, MinParallelChunkSize);
+    if(chunkCount > 1) {
+        #define _c(size) case size: return removeDuplicatesInPlaceIntoParallelImplementation<FixedKeySize<size>>(data, indices, chunkCount);
+        switch(data.size()[1]) {
+            _c(4)
+            _c(8)
+            _c(12)
+            _c(16)
+            _c(24)
+            _c(32)
+        }
+        #undef _c
+
+        return removeDuplicatesInPlaceIntoParallelImplementation<RuntimeKeySize>(data, indices, chunkCount);
+    }
+
+    #define _c(size) case size: return removeDuplicatesInPlaceIntoImplementation<FixedKeySize<size>>(data, indices);
+    switch(data.size()[1]) {
+        _c(4)
+        _c(8)
+        _c(12)
+        _c(16)
+        _c(24)
+        _c(32)
+    }
+    #undef _c
+
+    return removeDuplicatesInPlaceIntoImplementation<RuntimeKeySize>(data, indices);
+}
+
+std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>& data, const UnsignedInt threadCount) {
     Containers::Array<UnsignedInt> indices{Containers::NoInit, data.size()[0]};
-    const std::size_t size = removeDuplicatesInPlaceInto(data, indices);
+    const std::size_t size = removeDuplicatesInPlaceInto(data, indices, threadCount);
     return {std::move(indices), size};
 }
 
 namespace {
 
-template<class IndexType> std::size_t removeDuplicatesIndexedInPlaceImplementation(const Containers::StridedArrayView1D<IndexType>& indices, const Containers::StridedArrayView2D<char>& data) {
+template<class IndexType> std::size_t removeDuplicatesIndexedInPlaceImplementation(const Containers::StridedArrayView1D<IndexType>& indices, const Containers::StridedArrayView2D<char>& data, const UnsignedInt threadCount) {
     /* Somehow ~IndexType{} doesn't work for < 4byte types, as the result is
        int(-1) instead of the type I want */
     CORRADE_ASSERT(data.size()[0] <= IndexType(-1),
@@ -174,34 +471,34 @@ template<class IndexType> std::size_t removeDuplicatesIndexedInPlaceImplementati
        original order, which is an useful property. The float version has this
        inverted (having the *Indexed() variant as the main implementation)
        because the remapping there has to be done once for every dimension. */
-    std::pair<Containers::Array<UnsignedInt>, std::size_t> result = removeDuplicatesInPlace(data);
+    std::pair<Containers::Array<UnsignedInt>, std::size_t> result = removeDuplicatesInPlace(data, threadCount);
     for(auto& i: indices) i = result.first[i];
     return result.second;
 }
 
 }
 
-std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& data) {
-    return removeDuplicatesIndexedInPlaceImplementation(indices, data);
+std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& data, const UnsignedInt threadCount) {
+    return removeDuplicatesIndexedInPlaceImplementation(indices, data, threadCount);
 }
 
-std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& data) {
-    return removeDuplicatesIndexedInPlaceImplementation(indices, data);
+std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& data, const UnsignedInt threadCount) {
+    return removeDuplicatesIndexedInPlaceImplementation(indices, data, threadCount);
 }
 
-std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& data) {
-    return removeDuplicatesIndexedInPlaceImplementation(indices, data);
+std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& data, const UnsignedInt threadCount) {
+    return removeDuplicatesIndexedInPlaceImplementation(indices, data, threadCount);
 }
 
-std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<char>& data) {
+std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<char>& data, const UnsignedInt threadCount) {
     CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::removeDuplicatesIndexedInPlace(): second index view dimension is not contiguous", {});
     if(indices.size()[1] == 4)
-        return removeDuplicatesIndexedInPlace(Containers::arrayCast<1, UnsignedInt>(indices), data);
+        return removeDuplicatesIndexedInPlace(Containers::arrayCast<1, UnsignedInt>(indices), data, threadCount);
     else if(indices.size()[1] == 2)
-        return removeDuplicatesIndexedInPlace(Containers::arrayCast<1, UnsignedShort>(indices), data);
+        return removeDuplicatesIndexedInPlace(Containers::arrayCast<1, UnsignedShort>(indices), data, threadCount);
     else {
         CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::removeDuplicatesIndexedInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
-        return removeDuplicatesIndexedInPlace(Containers::arrayCast<1, UnsignedByte>(indices), data);
+        return removeDuplicatesIndexedInPlace(Containers::arrayCast<1, UnsignedByte>(indices), data, threadCount);
     }
 }
 
@@ -238,20 +535,17 @@ template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPla
        bounds. */
     epsilon = Math::max(epsilon, range/T(~std::size_t{}));
 
-    /* Table containing original vector index for each discretized vector.
-       Reserving more buckets than necessary (i.e. as if each vector was
-       unique). */
-    std::size_t dataSize = data.size()[0];
-    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
-        dataSize,
-        ArrayHash{data.size()[1]*sizeof(std::size_t)},
-        ArrayEqual{data.size()[1]*sizeof(std::size_t)}};
-
     /* Index array that'll be filled in each pass and then used for remapping
-       the `indices`; discretized storage for all map keys. */
+       the `indices`; discretized storage for all table keys. */
+    std::size_t dataSize = data.size()[0];
     Containers::Array<UnsignedInt> remapping{Containers::NoInit, dataSize};
     Containers::Array<std::size_t> discretized{Containers::NoInit, dataSize*vectorSize};
 
+    /* Table containing index of the first occurence for each discretized
+       vector, keys are stored in the `discretized` array. Reserving more
+       slots than necessary (i.e. as if each vector was unique). */
+    IndexTable<RuntimeKeySize> table{reinterpret_cast<const char*>(discretized.data()), std::ptrdiff_t(vectorSize*sizeof(std::size_t)), vectorSize*sizeof(std::size_t), dataSize};
+
     /* First go with original coordinates, then move them by epsilon/2 in each
        dimension. */
     T moveAmount = T(0.0);
@@ -259,9 +553,13 @@ template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPla
         for(std::size_t i = 0; i != dataSize; ++i) {
             /* Take the original vector and discretize it -- append the move
                amount to given dimension, subtract the minmal offset and divide
-               by epsilon. */
+               by epsilon. The discretized key is put into the first unused
+               location, similarly to what removeDuplicatesInPlaceInto() does
+               -- if it gets inserted, it won't be touched anymore, otherwise
+               the location gets reused for the next key. */
+            const std::size_t size = table.size();
             const Containers::StridedArrayView1D<T> entry = data[i];
-            const Containers::ArrayView<std::size_t> discretizedEntry = discretized.slice(i*vectorSize, (i + 1)*vectorSize);
+            const Containers::ArrayView<std::size_t> discretizedEntry = discretized.slice(size*vectorSize, (size + 1)*vectorSize);
             for(std::size_t vi = 0; vi != vectorSize; ++vi) {
                 T c = entry[vi];
                 /* In iteration `0` we're not moving in any dimension, in
@@ -275,18 +573,17 @@ template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPla
                points into the new data array that has all duplicates removed.
                This is a similar workflow to removeDuplicatesInPlaceInto() with
                the only difference that we're remapping an existing index array
-               several times over instead of creating a new one */
-            const auto result = table.emplace(discretizedEntry, table.size());
-
-            /* Add the (either new or already existing) index into the array */
-            remapping[i] = result.first->second;
+               several times over instead of creating a new one. Add the
+               (either new or already existing) index into the array. */
+            const UnsignedInt index = table.insert(reinterpret_cast<const char*>(discretizedEntry.data()), size);
+            remapping[i] = index;
 
             /* If this is a new combination, copy the data to new (earlier)
-               position in the array. Data in [table.size()-1, i) are already
-               present in the [0, table.size()-1) range from previous
-               iterations so we aren't overwriting anything. */
-            if(result.second && i != table.size() - 1)
-                Utility::copy(entry, data[table.size() - 1]);
+               position in the array. Data in [size, i) are already present in
+               the [0, size) range from previous iterations so we aren't
+               overwriting anything. */
+            if(index == size && i != size)
+                Utility::copy(entry, data[size]);
         }
 
         /* Remap the resulting index array */
@@ -396,14 +693,14 @@ std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayVi
     return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
 }
 
-Trade::MeshData removeDuplicates(const Trade::MeshData& data) {
+Trade::MeshData removeDuplicates(const Trade::MeshData& data, const UnsignedInt threadCount) {
     return removeDuplicates(Trade::MeshData{data.primitive(),
         {}, data.indexData(), Trade::MeshIndexData{data.indices()},
         {}, data.vertexData(), Trade::meshAttributeDataNonOwningArray(data.attributeData()),
-        data.vertexCount()});
+        data.vertexCount()}, threadCount);
 }
 
-Trade::MeshData removeDuplicates(Trade::MeshData&& data) {
+Trade::MeshData removeDuplicates(Trade::MeshData&& data, const UnsignedInt threadCount) {
     CORRADE_ASSERT(data.attributeCount(),
         "MeshTools::removeDuplicates(): can't remove duplicates in an attributeless mesh",
         (Trade::MeshData{MeshPrimitive::Points, 0}));
@@ -421,12 +718,12 @@ Trade::MeshData removeDuplicates(Trade::MeshData&& data) {
     Containers::Array<char> indexData;
     MeshIndexType indexType;
     if(ownedInterleaved.isIndexed()) {
-        uniqueVertexCount = removeDuplicatesIndexedInPlace(ownedInterleaved.mutableIndices(), vertexData);
+        uniqueVertexCount = removeDuplicatesIndexedInPlace(ownedInterleaved.mutableIndices(), vertexData, threadCount);
         indexData = ownedInterleaved.releaseIndexData();
         indexType = ownedInterleaved.indexType();
     } else {
         indexData = Containers::Array<char>{Containers::NoInit, ownedInterleaved.vertexCount()*sizeof(UnsignedInt)};
-        uniqueVertexCount = removeDuplicatesInPlaceInto(vertexData, Containers::arrayCast<UnsignedInt>(indexData));
+        uniqueVertexCount = removeDuplicatesInPlaceInto(vertexData, Containers::arrayCast<UnsignedInt>(indexData), threadCount);
         indexType = MeshIndexType::UnsignedInt;
     }
 
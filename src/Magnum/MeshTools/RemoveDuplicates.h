@@ -48,6 +48,8 @@ namespace Magnum { namespace MeshTools {
 @brief Remove duplicate data from given array in-place
 @param[in,out] data Data array, duplicate items will be cut away with order
     preserved
+@param[in] threadCount  Count of threads to use. Use @cpp 0 @ce for all
+    available hardware threads.
 @return The resulting index array and size of unique prefix in the cleaned up
     @p data array
 @m_since{2020,06}
@@ -55,26 +57,35 @@ namespace Magnum { namespace MeshTools {
 Removes duplicate data from given array by comparing the second dimension of
 each item, the second dimension is expected to be contiguous. A plain bit-exact
 matching is used, if you need fuzzy comparison for floating-point data, use
-@ref removeDuplicatesFuzzyInPlace() instead. If you want to remove duplicate
+@ref removeDuplicatesFuzzyInPlace() instead.
+
+If @p threadCount is larger than @cpp 1 @ce and there's enough data, the items
+are partitioned into as many shards based on their hash, each shard
+deduplicated on a separate thread and the results merged together. The output
+is exactly the same as with a single thread, i.e. with unique items in order
+of their first occurence. The parallel variant needs an additional
+@cpp 12 @ce bytes of temporary memory per item. If you want to remove duplicate
 data from an already indexed array, use
-@ref removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView2D<char>&)
+@ref removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView2D<char>&, UnsignedInt)
 instead. Usage example:
 
 @snippet MagnumMeshTools.cpp removeDuplicates
 
-See @ref removeDuplicates(const Containers::StridedArrayView2D<const char>&)
+See @ref removeDuplicates(const Containers::StridedArrayView2D<const char>&, UnsignedInt)
 for a variant that doesn't modify the input data in any way but instead returns
 an index array pointing to original data locations.
 @see @ref Corrade::Containers::StridedArrayView::isContiguous(),
     @ref removeDuplicatesInPlaceInto()
 */
-MAGNUM_MESHTOOLS_EXPORT std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>& data);
+MAGNUM_MESHTOOLS_EXPORT std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>& data, UnsignedInt threadCount = 1);
 
 /**
 @brief Remove duplicate data from given array in-place into given output index array
 @param[in,out] data     Data array, duplicate items will be cut away with order
     preserved
 @param[out]    indices  Where to put the resulting index array
+@param[in]     threadCount Count of threads to use. Use @cpp 0 @ce for all
+    available hardware threads.
 @return Size of unique prefix in the cleaned up @p data array
 @m_since{2020,06}
 
@@ -82,33 +93,37 @@ Same as above, except that the index array is not allocated but put into
 @p indices instead. Expects that @p indices has the same size as @p data.
 @see @ref removeDuplicatesInto()
 */
-MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices);
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, UnsignedInt threadCount = 1);
 
 /**
 @brief Remove duplicate data from given array
 @param[in] data     Data array
+@param[in] threadCount Count of threads to use. Use @cpp 0 @ce for all
+    available hardware threads.
 @return The resulting index array and count of unique items in the original
     @p data array
 @m_since{2020,06}
 
-Compared to @ref removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>&)
+Compared to @ref removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>&, UnsignedInt)
 this function doesn't modify the input data array in any way but instead
 returns an index array pointing to original data locations.
 */
-MAGNUM_MESHTOOLS_EXPORT std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicates(const Containers::StridedArrayView2D<const char>& data);
+MAGNUM_MESHTOOLS_EXPORT std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicates(const Containers::StridedArrayView2D<const char>& data, UnsignedInt threadCount = 1);
 
 /**
 @brief Remove duplicate data from given array into given output index array
 @param[in]  data    Data array
 @param[out] indices Where to put the resulting index array
+@param[in]  threadCount Count of threads to use. Use @cpp 0 @ce for all
+    available hardware threads.
 @return Count of unique items in the original @p data array
 @m_since{2020,06}
 
-Compared to @ref removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView1D<UnsignedInt>&)
+Compared to @ref removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView1D<UnsignedInt>&, UnsignedInt)
 this function doesn't modify the input data array in any way but instead
 makes an index array pointing to original data locations.
 */
-MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices);
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, UnsignedInt threadCount = 1);
 
 /**
 @brief Remove duplicates from indexed data in-place
@@ -116,26 +131,28 @@ MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInto(const Containers::Strid
     unique data
 @param[in,out] data     Data array, duplicate items will be cut away with order
     preserved
+@param[in]     threadCount Count of threads to use. Use @cpp 0 @ce for all
+    available hardware threads.
 @return Size of unique prefix in the cleaned up @p data array
 @m_since{2020,06}
 
-Compared to @ref removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>&)
+Compared to @ref removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>&, UnsignedInt)
 this variant is more suited for data that is already indexed as it works on
 the existing index array instead of allocating a new one.
 */
-MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& data);
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& data, UnsignedInt threadCount = 1);
 
 /**
  * @overload
  * @m_since{2020,06}
  */
-MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& data);
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& data, UnsignedInt threadCount = 1);
 
 /**
  * @overload
  * @m_since{2020,06}
  */
-MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& data);
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& data, UnsignedInt threadCount = 1);
 
 /**
 @brief Remove duplicates from indexed data in-place on a type-erased index array
@@ -143,10 +160,10 @@ MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesIndexedInPlace(const Contain
 
 Expects that the second dimension of @p indices is contiguous and represents
 the actual 1/2/4-byte index type. Based on its size then calls one of the
-@ref removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView2D<char>&)
+@ref removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView2D<char>&, UnsignedInt)
 etc. overloads.
 */
-MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<char>& data);
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<char>& data, UnsignedInt threadCount = 1);
 
 /**
 @brief Remove duplicate data from given array using fuzzy comparison in-place
@@ -162,7 +179,7 @@ Removes duplicate data from the array by collapsing them into buckets of size
 @p epsilon. First vector in given bucket is used, other ones are thrown away,
 no interpolation is done. Note that this function is meant to be used for
 floating-point data (or generally with non-zero @p epsilon), for data where
-bit-exact matching is sufficient use @ref removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>&)
+bit-exact matching is sufficient use @ref removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>&, UnsignedInt)
 instead.
 
 If you want to remove duplicate data from an already indexed array, use
@@ -304,25 +321,29 @@ and paddings are preserved.
 This function unconditionally copies and interleaves passed vertex and index
 data in order to operate on them in-place. If your data is interleaved and
 owned by the instance and you don't need the original data after the process,
-call @ref removeDuplicates(Trade::MeshData&&) instead to avoid the extra copy.
+call @ref removeDuplicates(Trade::MeshData&&, UnsignedInt) instead to avoid
+the extra copy.
+
+The @p threadCount is passed through to the above functions, use @cpp 0 @ce
+for all available hardware threads.
 */
-MAGNUM_MESHTOOLS_EXPORT Trade::MeshData removeDuplicates(const Trade::MeshData& data);
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData removeDuplicates(const Trade::MeshData& data, UnsignedInt threadCount = 1);
 
 /**
 @brief Remove mesh data duplicates
 @m_since{2020,06}
 
-Same as @ref removeDuplicates(const Trade::MeshData&), except that it operates
-in-place on the passed instance, avoiding an extra copy of vertex and index
-data.
+Same as @ref removeDuplicates(const Trade::MeshData&, UnsignedInt), except
+that it operates in-place on the passed instance, avoiding an extra copy of
+vertex and index data.
 */
-MAGNUM_MESHTOOLS_EXPORT Trade::MeshData removeDuplicates(Trade::MeshData&& data);
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData removeDuplicates(Trade::MeshData&& data, UnsignedInt threadCount = 1);
 
 /**
 @brief Remove mesh data duplicates with fuzzy comparison for floating-point attributes
 @m_since{2020,06}
 
-Compared to @ref removeDuplicates(const Trade::MeshData&), calls
+Compared to @ref removeDuplicates(const Trade::MeshData&, UnsignedInt), calls
 @ref removeDuplicatesFuzzyInPlace() or @ref removeDuplicatesFuzzyIndexedInPlace()
 on floating-point attributes. For attributes with a known range (such as
 @ref Trade::MeshAttribute::Normal being always @f$ [-1, 1] @f$ in each
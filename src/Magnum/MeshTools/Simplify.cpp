@@ -0,0 +1,524 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Simplify.h"
+
+#include <algorithm>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix.h"
+#include "Magnum/MeshTools/OptimizeVertexFetch.h"
+#include "Magnum/MeshTools/Implementation/Tipsify.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Manifold vertices can be collapsed to any neighbor, border and seam
+   vertices only along the border or seam and locked vertices not at all */
+enum class VertexKind: UnsignedByte {
+    Manifold, Border, Seam, Locked
+};
+
+/* Quadric of a sum of squared distances to planes, weighted by triangle
+   area. Evaluating it gives an area-weighted average of squared distances. */
+struct Quadric {
+    /*implicit*/ Quadric(): a{Math::ZeroInit}, b{}, c{}, weight{} {}
+
+    explicit Quadric(const Vector3& normal, Float distance, Float planeWeight): a{normal*normal.x()*planeWeight, normal*normal.y()*planeWeight, normal*normal.z()*planeWeight}, b{normal*distance*planeWeight}, c{distance*distance*planeWeight}, weight{planeWeight} {}
+
+    Quadric& operator+=(const Quadric& other) {
+        a += other.a;
+        b += other.b;
+        c += other.c;
+        weight += other.weight;
+        return *this;
+    }
+
+    Float error(const Vector3& position) const {
+        if(!weight) return 0.0f;
+        return Math::abs(Math::dot(position, a*position) + 2.0f*Math::dot(b, position) + c)/weight;
+    }
+
+    Matrix3x3 a;
+    Vector3 b;
+    Float c, weight;
+};
+
+/* Border and seam edges have a plane perpendicular to the triangle added to
+   their quadrics in order to preserve their shape. This is how much stronger
+   it is compared to the triangle planes. */
+constexpr Float EdgeWeight = 10.0f;
+
+/* Vector3::operator==() is fuzzy, vertices are considered to share a
+   position only if it's bit-exact */
+bool positionLess(const Vector3& a, const Vector3& b) {
+    if(a.x() != b.x()) return a.x() < b.x();
+    if(a.y() != b.y()) return a.y() < b.y();
+    return a.z() < b.z();
+}
+
+struct Collapse {
+    UnsignedInt from, to;
+    Float error;
+};
+
+struct Simplifier {
+    /* Returns false if the input is invalid, in which case a graceful assert
+       was fired */
+    bool setup(const char* prefix, Containers::Array<UnsignedInt>&& indices, const Containers::StridedArrayView1D<const Vector3>& positions);
+
+    /* Continues collapsing edges until there's at most targetIndexCount
+       indices or the next collapse would exceed the error */
+    void simplify(std::size_t targetIndexCount, Float targetError);
+
+    /* Whether there's a triangle with an a -> b edge */
+    bool hasEdge(UnsignedInt a, UnsignedInt b) const;
+
+    /* Whether there's an a -> b or b -> a edge but not both */
+    bool isOpenEdge(UnsignedInt a, UnsignedInt b) const {
+        return hasEdge(a, b) != hasEdge(b, a);
+    }
+
+    /* Count of open edges going from and to given vertex */
+    void countOpenEdges(UnsignedInt vertex, UnsignedInt& outgoingCount, UnsignedInt& outgoing, UnsignedInt& incomingCount, UnsignedInt& incoming) const;
+
+    /* Whether moving `from` onto `to` would flip any triangle around `from`
+       that doesn't get removed by the collapse. Adds count of the removed
+       triangles to `removed`. */
+    bool hasTriangleFlip(UnsignedInt from, UnsignedInt to, std::size_t& removed) const;
+
+    void buildAdjacency() {
+        Implementation::buildAdjacency<UnsignedInt>(indices.prefix(indexCount), positions.size(), vertexTriangleCount, triangleOffset, triangles);
+    }
+
+    Containers::Array<UnsignedInt> indices;
+    std::size_t indexCount;
+    /* Positions normalized to a unit cube so the errors are relative to the
+       mesh size */
+    Containers::Array<Vector3> positions;
+    /* First vertex with the same position and the next one in a circular
+       list */
+    Containers::Array<UnsignedInt> wedge, nextWedge;
+    Containers::Array<VertexKind> kinds;
+    /* Indexed by the first vertex with the same position */
+    Containers::Array<Quadric> quadrics;
+    /* Vertex-triangle adjacency of the current indices */
+    Containers::Array<UnsignedInt> vertexTriangleCount, triangleOffset, triangles;
+    /* Largest error of a collapse done so far, squared */
+    Float error;
+};
+
+bool Simplifier::hasEdge(const UnsignedInt a, const UnsignedInt b) const {
+    for(std::size_t i = triangleOffset[a], end = triangleOffset[a + 1]; i != end; ++i) {
+        const UnsignedInt* const triangle = indices.data() + triangles[i]*3;
+        for(UnsignedInt j = 0; j != 3; ++j)
+            if(triangle[j] == a && triangle[(j + 1) % 3] == b) return true;
+    }
+    return false;
+}
+
+void Simplifier::countOpenEdges(const UnsignedInt vertex, UnsignedInt& outgoingCount, UnsignedInt& outgoing, UnsignedInt& incomingCount, UnsignedInt& incoming) const {
+    outgoingCount = incomingCount = 0;
+    outgoing = incoming = ~UnsignedInt{};
+    for(std::size_t i = triangleOffset[vertex], end = triangleOffset[vertex + 1]; i != end; ++i) {
+        const UnsignedInt* const triangle = indices.data() + triangles[i]*3;
+        for(UnsignedInt j = 0; j != 3; ++j) {
+            if(triangle[j] != vertex) continue;
+            const UnsignedInt next = triangle[(j + 1) % 3];
+            const UnsignedInt previous = triangle[(j + 2) % 3];
+            if(!hasEdge(next, vertex)) {
+                ++outgoingCount;
+                outgoing = next;
+            }
+            if(!hasEdge(vertex, previous)) {
+                ++incomingCount;
+                incoming = previous;
+            }
+        }
+    }
+}
+
+bool Simplifier::hasTriangleFlip(const UnsignedInt from, const UnsignedInt to, std::size_t& removed) const {
+    for(std::size_t i = triangleOffset[from], end = triangleOffset[from + 1]; i != end; ++i) {
+        const UnsignedInt* const triangle = indices.data() + triangles[i]*3;
+
+        /* Triangles containing both vertices get removed */
+        if(wedge[triangle[0]] == wedge[to] ||
+           wedge[triangle[1]] == wedge[to] ||
+           wedge[triangle[2]] == wedge[to]) {
+            ++removed;
+            continue;
+        }
+
+        Vector3 a = positions[triangle[0]];
+        Vector3 b = positions[triangle[1]];
+        Vector3 c = positions[triangle[2]];
+        const Vector3 normal = Math::cross(b - a, c - a);
+        if(triangle[0] == from) a = positions[to];
+        if(triangle[1] == from) b = positions[to];
+        if(triangle[2] == from) c = positions[to];
+        if(Math::dot(normal, Math::cross(b - a, c - a)) <= 0.0f) return true;
+    }
+
+    return false;
+}
+
+bool Simplifier::setup(const char* const prefix, Containers::Array<UnsignedInt>&& indices_, const Containers::StridedArrayView1D<const Vector3>& positions_) {
+    CORRADE_ASSERT(indices_.size() % 3 == 0,
+        prefix << "expected index count divisible by 3, got" << indices_.size(), false);
+    #ifndef CORRADE_NO_ASSERT
+    for(const UnsignedInt index: indices_)
+        CORRADE_ASSERT(index < positions_.size(),
+            prefix << "index" << index << "out of bounds for" << positions_.size() << "vertices", false);
+    #else
+    static_cast<void>(prefix);
+    #endif
+
+    indices = std::move(indices_);
+    indexCount = indices.size();
+    error = 0.0f;
+    const UnsignedInt vertexCount = positions_.size();
+
+    /* Normalize the positions into a unit cube */
+    Vector3 min{Constants::inf()}, max{-Constants::inf()};
+    for(const Vector3& position: positions_) {
+        min = Math::min(min, position);
+        max = Math::max(max, position);
+    }
+    const Float size = vertexCount ? (max - min).max() : 0.0f;
+    const Float scale = size > 0.0f ? 1.0f/size : 1.0f;
+    positions = Containers::Array<Vector3>{Containers::NoInit, vertexCount};
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        positions[i] = (positions_[i] - min)*scale;
+
+    /* Find vertices sharing the same position by sorting them. Each vertex
+       points to the first vertex of the group and the group is linked into a
+       circular list. */
+    Containers::Array<UnsignedInt> sorted{Containers::NoInit, vertexCount};
+    for(UnsignedInt i = 0; i != vertexCount; ++i) sorted[i] = i;
+    std::sort(sorted.begin(), sorted.end(), [&positions_](UnsignedInt a, UnsignedInt b) {
+        if(positionLess(positions_[a], positions_[b])) return true;
+        if(positionLess(positions_[b], positions_[a])) return false;
+        return a < b;
+    });
+    wedge = Containers::Array<UnsignedInt>{Containers::NoInit, vertexCount};
+    nextWedge = Containers::Array<UnsignedInt>{Containers::NoInit, vertexCount};
+    for(std::size_t i = 0; i != vertexCount; ) {
+        std::size_t j = i + 1;
+        while(j != vertexCount && !positionLess(positions_[sorted[i]], positions_[sorted[j]])) ++j;
+        for(std::size_t k = i; k != j; ++k) {
+            wedge[sorted[k]] = sorted[i];
+            nextWedge[sorted[k]] = sorted[k + 1 == j ? i : k + 1];
+        }
+        i = j;
+    }
+
+    buildAdjacency();
+
+    /* Classify the vertices. A vertex with a single open edge in each
+       direction is on a border. If there are two vertices with the same
+       position and their open edges lead to the same positions in the
+       opposite direction, it's a seam. Everything else with open edges is
+       locked. */
+    kinds = Containers::Array<VertexKind>{Containers::NoInit, vertexCount};
+    for(UnsignedInt i = 0; i != vertexCount; ++i) {
+        UnsignedInt outgoingCount, outgoing, incomingCount, incoming;
+        countOpenEdges(i, outgoingCount, outgoing, incomingCount, incoming);
+
+        const UnsignedInt other = nextWedge[i];
+        if(other == i) {
+            if(!outgoingCount && !incomingCount)
+                kinds[i] = VertexKind::Manifold;
+            else if(outgoingCount == 1 && incomingCount == 1)
+                kinds[i] = VertexKind::Border;
+            else kinds[i] = VertexKind::Locked;
+        } else if(nextWedge[other] == i) {
+            UnsignedInt otherOutgoingCount, otherOutgoing, otherIncomingCount, otherIncoming;
+            countOpenEdges(other, otherOutgoingCount, otherOutgoing, otherIncomingCount, otherIncoming);
+            if(outgoingCount == 1 && incomingCount == 1 &&
+               otherOutgoingCount == 1 && otherIncomingCount == 1 &&
+               wedge[outgoing] == wedge[otherIncoming] &&
+               wedge[incoming] == wedge[otherOutgoing])
+                kinds[i] = VertexKind::Seam;
+            else kinds[i] = VertexKind::Locked;
+        } else kinds[i] = VertexKind::Locked;
+    }
+
+    /* Accumulate triangle planes and planes perpendicular to open edges into
+       quadrics shared by all vertices with the same position */
+    quadrics = Containers::Array<Quadric>{Containers::ValueInit, vertexCount};
+    for(std::size_t i = 0; i != indexCount; i += 3) {
+        const UnsignedInt* const triangle = indices.data() + i;
+        const Vector3 a = positions[triangle[0]];
+        const Vector3 normal = Math::cross(positions[triangle[1]] - a, positions[triangle[2]] - a);
+        const Float length = normal.length();
+        if(!length) continue;
+
+        const Vector3 normalized = normal/length;
+        const Quadric quadric{normalized, -Math::dot(normalized, a), length*0.5f};
+        for(UnsignedInt j = 0; j != 3; ++j)
+            quadrics[wedge[triangle[j]]] += quadric;
+
+        for(UnsignedInt j = 0; j != 3; ++j) {
+            const UnsignedInt from = triangle[j];
+            const UnsignedInt to = triangle[(j + 1) % 3];
+            if(hasEdge(to, from)) continue;
+
+            const Vector3 edge = positions[to] - positions[from];
+            const Float edgeLength = edge.length();
+            if(!edgeLength) continue;
+
+            const Vector3 edgeNormal = Math::cross(edge, normalized).normalized();
+            const Quadric edgeQuadric{edgeNormal, -Math::dot(edgeNormal, positions[from]), edgeLength*edgeLength*EdgeWeight};
+            quadrics[wedge[from]] += edgeQuadric;
+            quadrics[wedge[to]] += edgeQuadric;
+        }
+    }
+
+    return true;
+}
+
+void Simplifier::simplify(const std::size_t targetIndexCount, const Float targetError) {
+    const Float targetErrorSquared = targetError*targetError;
+    const UnsignedInt vertexCount = positions.size();
+    Containers::Array<Collapse> collapses;
+    Containers::Array<UnsignedInt> remap{Containers::NoInit, vertexCount};
+    Containers::Array<bool> touched{Containers::NoInit, vertexCount};
+
+    while(indexCount > targetIndexCount) {
+        buildAdjacency();
+
+        /* Pick the cheaper allowed direction of each edge */
+        arrayResize(collapses, 0);
+        for(std::size_t i = 0; i != indexCount; ++i) {
+            const UnsignedInt a = indices[i];
+            const UnsignedInt b = indices[i - i%3 + (i%3 + 1)%3];
+            if(wedge[a] == wedge[b]) continue;
+
+            Collapse collapse{0, 0, Constants::inf()};
+            for(const auto& direction: {std::make_pair(a, b), std::make_pair(b, a)}) {
+                const VertexKind kind = kinds[direction.first];
+                if(kind == VertexKind::Locked) continue;
+                if(kind != VertexKind::Manifold && kinds[direction.second] == VertexKind::Manifold) continue;
+
+                const Float collapseError = quadrics[wedge[direction.first]].error(positions[direction.second]);
+                if(collapseError < collapse.error)
+                    collapse = Collapse{direction.first, direction.second, collapseError};
+            }
+            if(collapse.error != Constants::inf())
+                arrayAppend(collapses, collapse);
+        }
+        if(collapses.empty()) break;
+
+        std::stable_sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+            return a.error < b.error;
+        });
+
+        /* As one collapse removes two triangles on average, aim for doing
+           all needed collapses in this pass, but don't go for collapses that
+           are much more expensive than the last of those in order to not
+           distort the mesh when a cheaper option would be available in the
+           next pass */
+        const std::size_t goal = Math::max((indexCount - targetIndexCount)/6, std::size_t{1});
+        const Float errorLimit = Math::min(targetErrorSquared, collapses[Math::min(goal, collapses.size()) - 1].error*1.5f);
+
+        for(UnsignedInt i = 0; i != vertexCount; ++i) remap[i] = i;
+        for(bool& i: touched) i = false;
+
+        std::size_t removed = 0;
+        std::size_t collapsed = 0;
+        for(const Collapse& collapse: collapses) {
+            if(collapse.error > errorLimit) break;
+
+            /* Triangles around vertices touched by a collapse are already
+               different from what's in the adjacency, skip them */
+            if(touched[wedge[collapse.from]] || touched[wedge[collapse.to]])
+                continue;
+
+            /* Border and seam vertices can move only along an open edge, a
+               seam vertex together with its pair on the other side */
+            UnsignedInt from[2]{collapse.from, ~UnsignedInt{}};
+            UnsignedInt to[2]{collapse.to, ~UnsignedInt{}};
+            const VertexKind kind = kinds[collapse.from];
+            if(kind != VertexKind::Manifold) {
+                if(!isOpenEdge(collapse.from, collapse.to)) continue;
+
+                if(kind == VertexKind::Seam) {
+                    from[1] = nextWedge[collapse.from];
+                    UnsignedInt vertex = collapse.to;
+                    do {
+                        if(isOpenEdge(from[1], vertex)) {
+                            to[1] = vertex;
+                            break;
+                        }
+                    } while((vertex = nextWedge[vertex]) != collapse.to);
+                    if(to[1] == ~UnsignedInt{}) continue;
+                }
+            }
+
+            std::size_t collapseRemoved = 0;
+            if(hasTriangleFlip(from[0], to[0], collapseRemoved) ||
+               (from[1] != ~UnsignedInt{} && hasTriangleFlip(from[1], to[1], collapseRemoved)))
+                continue;
+
+            for(std::size_t j = 0; j != 2 && from[j] != ~UnsignedInt{}; ++j) {
+                remap[from[j]] = to[j];
+                for(std::size_t k = triangleOffset[from[j]], end = triangleOffset[from[j] + 1]; k != end; ++k)
+                    for(std::size_t l = 0; l != 3; ++l)
+                        touched[wedge[indices[triangles[k]*3 + l]]] = true;
+            }
+
+            quadrics[wedge[collapse.to]] += quadrics[wedge[collapse.from]];
+            error = Math::max(error, collapse.error);
+            removed += collapseRemoved;
+            ++collapsed;
+            if(indexCount - Math::min(removed*3, indexCount) <= targetIndexCount)
+                break;
+        }
+        if(!collapsed) break;
+
+        /* Apply the collapses and drop triangles that became degenerate */
+        std::size_t outputIndexCount = 0;
+        for(std::size_t i = 0; i != indexCount; i += 3) {
+            const UnsignedInt a = remap[indices[i + 0]];
+            const UnsignedInt b = remap[indices[i + 1]];
+            const UnsignedInt c = remap[indices[i + 2]];
+            if(wedge[a] == wedge[b] || wedge[b] == wedge[c] || wedge[a] == wedge[c])
+                continue;
+
+            indices[outputIndexCount++] = a;
+            indices[outputIndexCount++] = b;
+            indices[outputIndexCount++] = c;
+        }
+        indexCount = outputIndexCount;
+    }
+}
+
+template<class T> std::pair<std::size_t, Float> simplifyInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float targetError) {
+    Containers::Array<UnsignedInt> indicesCopy{Containers::NoInit, indices.size()};
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        indicesCopy[i] = indices[i];
+
+    Simplifier simplifier;
+    if(!simplifier.setup("MeshTools::simplifyInPlace():", std::move(indicesCopy), positions))
+        return {}; /* Graceful assert in the above */
+    simplifier.simplify(targetIndexCount, targetError);
+
+    for(std::size_t i = 0; i != simplifier.indexCount; ++i)
+        indices[i] = T(simplifier.indices[i]);
+
+    return {simplifier.indexCount, Math::sqrt(simplifier.error)};
+}
+
+/* Makes a mesh with given indices and only the referenced vertices */
+Trade::MeshData simplifiedMesh(const Trade::MeshData& mesh, const Containers::ArrayView<const UnsignedInt> indices) {
+    /* Copy the indices, keeping the original type */
+    const MeshIndexType indexType = mesh.indexType();
+    Containers::Array<char> indexData{Containers::NoInit, indices.size()*meshIndexTypeSize(indexType)};
+    if(indexType == MeshIndexType::UnsignedInt) {
+        const auto out = Containers::arrayCast<UnsignedInt>(indexData);
+        for(std::size_t i = 0; i != indices.size(); ++i) out[i] = indices[i];
+    } else if(indexType == MeshIndexType::UnsignedShort) {
+        const auto out = Containers::arrayCast<UnsignedShort>(indexData);
+        for(std::size_t i = 0; i != indices.size(); ++i) out[i] = indices[i];
+    } else if(indexType == MeshIndexType::UnsignedByte) {
+        const auto out = Containers::arrayCast<UnsignedByte>(indexData);
+        for(std::size_t i = 0; i != indices.size(); ++i) out[i] = indices[i];
+    } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+
+    /* The vertex data are referenced, compactVertices() then copies just the
+       used vertices */
+    const Trade::MeshIndexData indexDataDescription{indexType, indexData};
+    return compactVertices(Trade::MeshData{mesh.primitive(),
+        std::move(indexData), indexDataDescription,
+        {}, mesh.vertexData(),
+        Trade::meshAttributeDataNonOwningArray(mesh.attributeData()),
+        mesh.vertexCount()});
+}
+
+Containers::Array<Trade::MeshData> simplifyLodsImplementation(const char* const prefix, const Trade::MeshData& mesh, const Containers::ArrayView<const UnsignedInt> targetIndexCounts, const Float targetError) {
+    CORRADE_ASSERT(mesh.isIndexed(),
+        prefix << "mesh data not indexed", {});
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        prefix << "expected" << MeshPrimitive::Triangles << "but got" << mesh.primitive(), {});
+    CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+        prefix << "the mesh has no positions", {});
+    for(std::size_t i = 1; i < targetIndexCounts.size(); ++i)
+        CORRADE_ASSERT(targetIndexCounts[i] <= targetIndexCounts[i - 1],
+            prefix << "expected target index counts in a non-increasing order, got" << targetIndexCounts[i - 1] << "followed by" << targetIndexCounts[i], {});
+
+    const Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+    Simplifier simplifier;
+    if(!simplifier.setup(prefix, mesh.indicesAsArray(), positions))
+        return {}; /* Graceful assert in the above */
+
+    /* Each level continues from where the previous one ended, reusing the
+       accumulated quadrics */
+    Containers::Array<Trade::MeshData> out;
+    arrayReserve(out, targetIndexCounts.size());
+    for(const UnsignedInt targetIndexCount: targetIndexCounts) {
+        simplifier.simplify(targetIndexCount, targetError);
+        arrayAppend(out, simplifiedMesh(mesh, simplifier.indices.prefix(simplifier.indexCount)));
+    }
+
+    return out;
+}
+
+}
+
+std::pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float targetError) {
+    return simplifyInPlaceImplementation(indices, positions, targetIndexCount, targetError);
+}
+
+std::pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float targetError) {
+    return simplifyInPlaceImplementation(indices, positions, targetIndexCount, targetError);
+}
+
+std::pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float targetError) {
+    return simplifyInPlaceImplementation(indices, positions, targetIndexCount, targetError);
+}
+
+Trade::MeshData simplify(const Trade::MeshData& mesh, const UnsignedInt targetIndexCount, const Float targetError) {
+    Containers::Array<Trade::MeshData> out = simplifyLodsImplementation("MeshTools::simplify():", mesh, {&targetIndexCount, 1}, targetError);
+    /* Graceful assert in the above */
+    if(out.empty()) return Trade::MeshData{MeshPrimitive::Triangles, 0};
+    return std::move(out[0]);
+}
+
+Containers::Array<Trade::MeshData> simplifyLods(const Trade::MeshData& mesh, const Containers::ArrayView<const UnsignedInt> targetIndexCounts, const Float targetError) {
+    return simplifyLodsImplementation("MeshTools::simplifyLods():", mesh, targetIndexCounts, targetError);
+}
+
+Containers::Array<Trade::MeshData> simplifyLods(const Trade::MeshData& mesh, const std::initializer_list<UnsignedInt> targetIndexCounts, const Float targetError) {
+    return simplifyLods(mesh, Containers::arrayView(targetIndexCounts), targetError);
+}
+
+}}
@@ -0,0 +1,147 @@
+#ifndef Magnum_MeshTools_Simplify_h
+#define Magnum_MeshTools_Simplify_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::simplifyInPlace(), @ref Magnum::MeshTools::simplify(), @ref Magnum::MeshTools::simplifyLods()
+ * @m_since_latest
+ */
+
+#include <initializer_list>
+#include <utility>
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Simplify a triangle mesh in-place
+@param[in,out] indices          Index array to operate on
+@param[in] positions            Vertex positions
+@param[in] targetIndexCount     Index count to reduce the mesh to
+@param[in] targetError          Max allowed error, relative to the mesh size
+@return Index count of the simplified mesh and the error it was simplified
+    with, relative to the mesh size
+@m_since_latest
+
+Reduces the triangle count by collapsing edges in the order of the smallest
+error according to a quadric error metric, until the index count is at most
+@p targetIndexCount or until the next collapse would exceed @p targetError.
+Pass @cpp 0 @ce to @p targetIndexCount to simplify only as long as the error
+bound allows. The error is a distance relative to the largest extent of the
+mesh bounding box, thus for example @cpp 1.0e-2f @ce allows the surface to
+deviate by one percent of the mesh size. The resulting index count may be
+slightly less than @p targetIndexCount, as a single collapse usually removes
+two triangles.
+
+Each edge collapse moves one vertex onto the other, no new vertices are
+created and so all other vertex attributes stay intact. Vertices that share a
+position but differ in other attributes, such as on normal or texture
+coordinate seams, are treated as a single vertex for the error metric but
+seam edges are collapsed only along the seam, moving all vertices on the seam
+together so it doesn't open. Similarly, vertices on open mesh borders are
+collapsed only along the border. Vertices where a seam or border isn't a
+simple curve, such as seam corners or non-manifold vertices, are kept in
+place. Collapses that would flip a triangle are rejected.
+
+The simplified triangles are written to a prefix of @p indices, the returned
+index count can be used to get it. The remaining vertices aren't reordered
+and vertices no longer referenced by the index buffer aren't removed, use
+@ref compactVerticesInPlace() or @ref optimizeVertexFetchInPlace() for that.
+
+Expects that the index count is divisible by 3 and all indices are less than
+the size of @p positions.
+@see @ref simplify(), @ref simplifyLods()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t targetIndexCount, Float targetError = 1.0e-2f);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t targetIndexCount, Float targetError = 1.0e-2f);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t targetIndexCount, Float targetError = 1.0e-2f);
+
+/**
+@brief Simplify a triangle mesh
+@m_since_latest
+
+Same as @ref simplifyInPlace(), but operating on an indexed
+@ref Trade::MeshData with @ref MeshPrimitive::Triangles. Vertices that are no
+longer referenced are removed using @ref compactVertices(). The original index
+type is preserved, the vertex data are copied to a new interleaved owned
+instance.
+
+Expects that the mesh is indexed, has a @ref Trade::MeshAttribute::Position
+attribute and all its indices are in bounds.
+@see @ref simplifyLods()
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData simplify(const Trade::MeshData& mesh, UnsignedInt targetIndexCount, Float targetError = 1.0e-2f);
+
+/**
+@brief Generate a chain of simplified meshes
+@param mesh                 Mesh to simplify
+@param targetIndexCounts    Target index count for each level
+@param targetError          Max allowed error, relative to the mesh size
+@m_since_latest
+
+Produces one mesh for each item in @p targetIndexCounts, in the same way as
+@ref simplify(). Compared to calling @ref simplify() repeatedly, the vertices
+sharing a position are grouped, classified and their quadrics calculated just
+once and each level continues simplifying the previous one, so the whole chain
+takes roughly the same time as simplifying to the last level. Only the
+vertex-triangle adjacency is rebuilt on every collapse pass, same as in
+@ref simplify(). Because each level starts from the previous one, the levels
+are also consistent with each other --- every coarser level is made by further
+collapsing edges of the finer one. If the error bound is reached before given index count, the remaining
+levels contain the same triangles.
+
+The input mesh isn't included in the output. Expects that
+@p targetIndexCounts are in a non-increasing order. Apart from that, the same
+expectations as for @ref simplify() apply. Example usage, producing three
+levels with half, a quarter and an eighth of the original triangles:
+
+@snippet MagnumMeshTools.cpp simplifyLods
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Trade::MeshData> simplifyLods(const Trade::MeshData& mesh, Containers::ArrayView<const UnsignedInt> targetIndexCounts, Float targetError = 1.0e-2f);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Trade::MeshData> simplifyLods(const Trade::MeshData& mesh, std::initializer_list<UnsignedInt> targetIndexCounts, Float targetError = 1.0e-2f);
+
+}}
+
+#endif
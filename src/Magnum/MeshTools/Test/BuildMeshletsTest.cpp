@@ -0,0 +1,316 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <algorithm>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/MeshTools/BuildMeshlets.h"
+#include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/Primitives/Grid.h"
+#include "Magnum/Primitives/UVSphere.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct BuildMeshletsTest: TestSuite::Tester {
+    explicit BuildMeshletsTest();
+
+    void verify(const Trade::MeshData& mesh, const Trade::MeshData& meshlets, UnsignedInt maxVertexCount, UnsignedInt maxTriangleCount);
+
+    void grid();
+    void nonIndexed();
+    void sphereNormalCone();
+    void empty();
+
+    void notTriangles();
+    void noPositions();
+    void invalidLimits();
+
+    void benchmark();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt maxVertexCount, maxTriangleCount;
+} GridData[]{
+    {"default limits", 64, 126},
+    {"vertex-limited", 16, 126},
+    {"triangle-limited", 64, 8},
+    {"single triangle", 3, 1}
+};
+
+BuildMeshletsTest::BuildMeshletsTest() {
+    addInstancedTests({&BuildMeshletsTest::grid},
+        Containers::arraySize(GridData));
+
+    addTests({&BuildMeshletsTest::nonIndexed,
+              &BuildMeshletsTest::sphereNormalCone,
+              &BuildMeshletsTest::empty,
+
+              &BuildMeshletsTest::notTriangles,
+              &BuildMeshletsTest::noPositions,
+              &BuildMeshletsTest::invalidLimits});
+
+    addBenchmarks({&BuildMeshletsTest::benchmark}, 5);
+}
+
+/* Sorted list of triangles, to compare them regardless of order */
+Containers::Array<Vector3ui> sortedTriangles(const Containers::ArrayView<const UnsignedInt> indices) {
+    Containers::Array<Vector3ui> triangles{Containers::NoInit, indices.size()/3};
+    for(std::size_t i = 0; i != triangles.size(); ++i)
+        triangles[i] = {indices[i*3 + 0], indices[i*3 + 1], indices[i*3 + 2]};
+    std::sort(triangles.begin(), triangles.end(), [](const Vector3ui& a, const Vector3ui& b) {
+        return a.x() != b.x() ? a.x() < b.x() :
+               a.y() != b.y() ? a.y() < b.y() : a.z() < b.z();
+    });
+    return triangles;
+}
+
+void BuildMeshletsTest::verify(const Trade::MeshData& mesh, const Trade::MeshData& meshlets, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    CORRADE_COMPARE(meshlets.primitive(), MeshPrimitive::Meshlets);
+    CORRADE_VERIFY(meshlets.isIndexed());
+    CORRADE_COMPARE(meshlets.indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE(meshlets.attributeCount(), 6);
+    CORRADE_COMPARE(meshlets.attributeStride(MeshletAttribute::BoundingSphere), 64);
+
+    /* All triangles of the original mesh are present exactly once */
+    const Containers::Array<UnsignedInt> indices = meshlets.indicesAsArray();
+    Containers::Array<UnsignedInt> originalIndices;
+    if(mesh.isIndexed()) originalIndices = mesh.indicesAsArray();
+    else {
+        originalIndices = Containers::Array<UnsignedInt>{Containers::NoInit, mesh.vertexCount()};
+        for(UnsignedInt i = 0; i != mesh.vertexCount(); ++i) originalIndices[i] = i;
+    }
+    CORRADE_COMPARE_AS(sortedTriangles(indices),
+        sortedTriangles(originalIndices),
+        TestSuite::Compare::Container);
+
+    /* Meshlets are consecutive, respect the limits and the bounding sphere
+       contains all their vertices */
+    const Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+    const auto indexOffset = meshlets.attribute<UnsignedInt>(MeshletAttribute::IndexOffset);
+    const auto indexCount = meshlets.attribute<UnsignedInt>(MeshletAttribute::IndexCount);
+    const auto vertexCount = meshlets.attribute<UnsignedInt>(MeshletAttribute::VertexCount);
+    const auto boundingSphere = meshlets.attribute<Vector4>(MeshletAttribute::BoundingSphere);
+    Containers::Array<UnsignedInt> usedInMeshlet{Containers::DirectInit, mesh.vertexCount(), ~UnsignedInt{}};
+    UnsignedInt expectedOffset = 0;
+    for(UnsignedInt i = 0; i != meshlets.vertexCount(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(indexOffset[i], expectedOffset);
+        CORRADE_COMPARE_AS(indexCount[i], 0,
+            TestSuite::Compare::Greater);
+        CORRADE_COMPARE_AS(indexCount[i], maxTriangleCount*3,
+            TestSuite::Compare::LessOrEqual);
+        expectedOffset += indexCount[i];
+
+        UnsignedInt uniqueVertexCount = 0;
+        for(UnsignedInt j = indexOffset[i], jMax = indexOffset[i] + indexCount[i]; j != jMax; ++j) {
+            const UnsignedInt v = indices[j];
+            if(usedInMeshlet[v] == i) continue;
+            usedInMeshlet[v] = i;
+            ++uniqueVertexCount;
+
+            CORRADE_COMPARE_AS((positions[v] - boundingSphere[i].xyz()).length(),
+                boundingSphere[i].w(),
+                TestSuite::Compare::LessOrEqual);
+        }
+        CORRADE_COMPARE(vertexCount[i], uniqueVertexCount);
+        CORRADE_COMPARE_AS(uniqueVertexCount, maxVertexCount,
+            TestSuite::Compare::LessOrEqual);
+    }
+    CORRADE_COMPARE(expectedOffset, indices.size());
+}
+
+void BuildMeshletsTest::grid() {
+    auto&& data = GridData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* A flat grid facing +Z */
+    const Trade::MeshData mesh = Primitives::grid3DSolid({15, 15});
+    const Trade::MeshData meshlets = buildMeshlets(mesh, data.maxVertexCount, data.maxTriangleCount);
+    {
+        CORRADE_ITERATION(data.name);
+        verify(mesh, meshlets, data.maxVertexCount, data.maxTriangleCount);
+    }
+
+    /* The meshlets should be reasonably full, i.e. not just a few large ones
+       and a lot of tiny leftovers */
+    const UnsignedInt triangleCount = mesh.indexCount()/3;
+    CORRADE_COMPARE_AS(meshlets.vertexCount(),
+        2*triangleCount/Math::min(data.maxTriangleCount, data.maxVertexCount) + 1,
+        TestSuite::Compare::LessOrEqual);
+
+    /* All normal cones point in the grid direction and a camera below the grid
+       sees only backfaces */
+    const auto coneApex = meshlets.attribute<Vector3>(MeshletAttribute::ConeApex);
+    const auto coneAxisCutoff = meshlets.attribute<Vector4>(MeshletAttribute::ConeAxisCutoff);
+    for(UnsignedInt i = 0; i != meshlets.vertexCount(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(coneAxisCutoff[i].xyz(), Vector3::zAxis());
+        CORRADE_COMPARE(coneAxisCutoff[i].w(), 0.0f);
+        CORRADE_COMPARE(coneApex[i].z(), 0.0f);
+
+        const Rad angle{2.0f*Math::acos(coneAxisCutoff[i].w())};
+        CORRADE_VERIFY(Math::Intersection::pointCone(Vector3{0.1f, 0.2f, -5.0f}, coneApex[i], -coneAxisCutoff[i].xyz(), angle));
+        CORRADE_VERIFY(!Math::Intersection::pointCone(Vector3{0.1f, 0.2f, 5.0f}, coneApex[i], -coneAxisCutoff[i].xyz(), angle));
+    }
+}
+
+void BuildMeshletsTest::nonIndexed() {
+    const Trade::MeshData mesh = duplicate(Primitives::grid3DSolid({7, 7}));
+    CORRADE_VERIFY(!mesh.isIndexed());
+
+    const Trade::MeshData meshlets = buildMeshlets(mesh, 16, 32);
+    verify(mesh, meshlets, 16, 32);
+
+    /* Each vertex is unique in a non-indexed mesh, so a meshlet can have at
+       most five triangles */
+    const auto indexCount = meshlets.attribute<UnsignedInt>(MeshletAttribute::IndexCount);
+    for(UnsignedInt i = 0; i != meshlets.vertexCount(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS(indexCount[i], 15,
+            TestSuite::Compare::LessOrEqual);
+    }
+}
+
+void BuildMeshletsTest::sphereNormalCone() {
+    const Trade::MeshData mesh = Primitives::uvSphereSolid(16, 32);
+    const Trade::MeshData meshlets = buildMeshlets(mesh, 32, 32);
+    verify(mesh, meshlets, 32, 32);
+
+    /* The normal cone test is conservative -- if a camera is inside the cone,
+       all triangles of the meshlet are backfacing. Additionally, at least some
+       meshlets get culled from each camera position. */
+    const Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+    const Containers::Array<UnsignedInt> indices = meshlets.indicesAsArray();
+    const auto indexOffset = meshlets.attribute<UnsignedInt>(MeshletAttribute::IndexOffset);
+    const auto indexCount = meshlets.attribute<UnsignedInt>(MeshletAttribute::IndexCount);
+    const auto coneApex = meshlets.attribute<Vector3>(MeshletAttribute::ConeApex);
+    const auto coneAxisCutoff = meshlets.attribute<Vector4>(MeshletAttribute::ConeAxisCutoff);
+    for(const Vector3 camera: {Vector3{0.0f, 0.0f, 3.0f},
+                               Vector3{-2.0f, 1.5f, 0.5f},
+                               Vector3{0.1f, -5.0f, -0.2f}}) {
+        CORRADE_ITERATION(camera);
+
+        UnsignedInt culled = 0;
+        for(UnsignedInt i = 0; i != meshlets.vertexCount(); ++i) {
+            const Vector3 direction = coneApex[i] - camera;
+            if(Math::dot(direction, coneAxisCutoff[i].xyz()) < coneAxisCutoff[i].w()*direction.length())
+                continue;
+
+            ++culled;
+            for(UnsignedInt j = indexOffset[i], jMax = indexOffset[i] + indexCount[i]; j != jMax; j += 3) {
+                const Vector3 a = positions[indices[j]];
+                const Vector3 normal = Math::cross(positions[indices[j + 1]] - a, positions[indices[j + 2]] - a);
+                CORRADE_COMPARE_AS(Math::dot(camera - a, normal), 1.0e-6f,
+                    TestSuite::Compare::LessOrEqual);
+            }
+        }
+
+        CORRADE_COMPARE_AS(culled, 0,
+            TestSuite::Compare::Greater);
+    }
+}
+
+void BuildMeshletsTest::empty() {
+    const Trade::MeshData mesh{MeshPrimitive::Triangles, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::ArrayView<const Vector3>{}}
+    }};
+
+    const Trade::MeshData meshlets = buildMeshlets(mesh);
+    CORRADE_COMPARE(meshlets.primitive(), MeshPrimitive::Meshlets);
+    CORRADE_COMPARE(meshlets.indexCount(), 0);
+    CORRADE_COMPARE(meshlets.vertexCount(), 0);
+    CORRADE_COMPARE(meshlets.attributeCount(), 6);
+}
+
+void BuildMeshletsTest::notTriangles() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const Vector3 positions[3]{};
+    const Trade::MeshData mesh{MeshPrimitive::TriangleStrip, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    buildMeshlets(mesh);
+    CORRADE_COMPARE(out.str(), "MeshTools::buildMeshlets(): expected MeshPrimitive::Triangles but got MeshPrimitive::TriangleStrip\n");
+}
+
+void BuildMeshletsTest::noPositions() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const Trade::MeshData mesh{MeshPrimitive::Triangles, 3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    buildMeshlets(mesh);
+    CORRADE_COMPARE(out.str(), "MeshTools::buildMeshlets(): the mesh has no positions\n");
+}
+
+void BuildMeshletsTest::invalidLimits() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const Trade::MeshData mesh = Primitives::grid3DSolid({1, 1});
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    buildMeshlets(mesh, 2, 126);
+    buildMeshlets(mesh, 64, 0);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::buildMeshlets(): expected at least 3 vertices and 1 triangle per meshlet but got 2 and 126\n"
+        "MeshTools::buildMeshlets(): expected at least 3 vertices and 1 triangle per meshlet but got 64 and 0\n");
+}
+
+void BuildMeshletsTest::benchmark() {
+    const Trade::MeshData mesh = Primitives::grid3DSolid({255, 255});
+
+    UnsignedInt meshletCount = 0;
+    CORRADE_BENCHMARK(1) {
+        meshletCount += buildMeshlets(mesh).vertexCount();
+    }
+
+    CORRADE_COMPARE_AS(meshletCount, 0,
+        TestSuite::Compare::Greater);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::BuildMeshletsTest)
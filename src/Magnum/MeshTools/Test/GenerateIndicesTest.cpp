@@ -202,6 +202,7 @@ GenerateIndicesTest::GenerateIndicesTest() {
 void GenerateIndicesTest::primitiveCount() {
     CORRADE_COMPARE(MeshTools::primitiveCount(MeshPrimitive::Points, 42), 42);
     CORRADE_COMPARE(MeshTools::primitiveCount(MeshPrimitive::Instances, 13), 13);
+    CORRADE_COMPARE(MeshTools::primitiveCount(MeshPrimitive::Meshlets, 7), 7);
 
     CORRADE_COMPARE(MeshTools::primitiveCount(MeshPrimitive::Lines, 4), 2);
     CORRADE_COMPARE(MeshTools::primitiveCount(MeshPrimitive::Lines, 5), 2);
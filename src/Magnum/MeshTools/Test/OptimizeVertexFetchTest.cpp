@@ -0,0 +1,380 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/MeshTools/OptimizeVertexFetch.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct OptimizeVertexFetchTest: TestSuite::Tester {
+    explicit OptimizeVertexFetchTest();
+
+    template<class T> void optimizeVertexFetchInPlace();
+    template<class T> void compactVerticesInPlace();
+    void compactVerticesInPlaceAllReferenced();
+    void inPlaceNonContiguous();
+    void inPlaceIndexOutOfBounds();
+
+    void optimizeVertexFetchMeshData();
+    void optimizeVertexFetchMeshDataRvalueOwned();
+    void optimizeVertexFetchMeshDataRvalueMutable();
+    void optimizeVertexFetchMeshDataRvalueImmutable();
+    void compactVerticesMeshData();
+    void meshDataNotIndexed();
+};
+
+OptimizeVertexFetchTest::OptimizeVertexFetchTest() {
+    addTests({&OptimizeVertexFetchTest::optimizeVertexFetchInPlace<UnsignedByte>,
+              &OptimizeVertexFetchTest::optimizeVertexFetchInPlace<UnsignedShort>,
+              &OptimizeVertexFetchTest::optimizeVertexFetchInPlace<UnsignedInt>,
+              &OptimizeVertexFetchTest::compactVerticesInPlace<UnsignedByte>,
+              &OptimizeVertexFetchTest::compactVerticesInPlace<UnsignedShort>,
+              &OptimizeVertexFetchTest::compactVerticesInPlace<UnsignedInt>,
+              &OptimizeVertexFetchTest::compactVerticesInPlaceAllReferenced,
+              &OptimizeVertexFetchTest::inPlaceNonContiguous,
+              &OptimizeVertexFetchTest::inPlaceIndexOutOfBounds,
+
+              &OptimizeVertexFetchTest::optimizeVertexFetchMeshData,
+              &OptimizeVertexFetchTest::optimizeVertexFetchMeshDataRvalueOwned,
+              &OptimizeVertexFetchTest::optimizeVertexFetchMeshDataRvalueMutable,
+              &OptimizeVertexFetchTest::optimizeVertexFetchMeshDataRvalueImmutable,
+              &OptimizeVertexFetchTest::compactVerticesMeshData,
+              &OptimizeVertexFetchTest::meshDataNotIndexed});
+}
+
+/* Vertices 2 and 4 are not referenced */
+constexpr UnsignedInt Indices[]{3, 1, 5, 1, 3, 0};
+
+template<class T> void OptimizeVertexFetchTest::optimizeVertexFetchInPlace() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(Indices)];
+    for(std::size_t i = 0; i != Containers::arraySize(Indices); ++i)
+        indices[i] = Indices[i];
+    Int data[]{0, 10, 20, 30, 40, 50};
+
+    CORRADE_COMPARE(MeshTools::optimizeVertexFetchInPlace(
+        Containers::stridedArrayView(indices),
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(data))), 4);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<T>({
+        0, 1, 2, 1, 0, 3
+    }), TestSuite::Compare::Container);
+    /* Unreferenced vertices are at the end, in the original order */
+    CORRADE_COMPARE_AS(Containers::arrayView(data), Containers::arrayView<Int>({
+        30, 10, 50, 0, 20, 40
+    }), TestSuite::Compare::Container);
+}
+
+template<class T> void OptimizeVertexFetchTest::compactVerticesInPlace() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(Indices)];
+    for(std::size_t i = 0; i != Containers::arraySize(Indices); ++i)
+        indices[i] = Indices[i];
+    Int data[]{0, 10, 20, 30, 40, 50};
+
+    CORRADE_COMPARE(MeshTools::compactVerticesInPlace(
+        Containers::stridedArrayView(indices),
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(data))), 4);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<T>({
+        2, 1, 3, 1, 2, 0
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(data), Containers::arrayView<Int>({
+        0, 10, 30, 50, 20, 40
+    }), TestSuite::Compare::Container);
+}
+
+void OptimizeVertexFetchTest::compactVerticesInPlaceAllReferenced() {
+    UnsignedInt indices[]{2, 0, 1, 1, 2, 0};
+    Int data[]{0, 10, 20};
+
+    CORRADE_COMPARE(MeshTools::compactVerticesInPlace(
+        Containers::stridedArrayView(indices),
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(data))), 3);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<UnsignedInt>({
+        2, 0, 1, 1, 2, 0
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(data), Containers::arrayView<Int>({
+        0, 10, 20
+    }), TestSuite::Compare::Container);
+}
+
+void OptimizeVertexFetchTest::inPlaceNonContiguous() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    UnsignedInt indices[]{0, 1, 2};
+    Int data[6]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetchInPlace(indices, Containers::arrayCast<2, char>(Containers::arrayView(data)).every({2, 2}));
+    MeshTools::compactVerticesInPlace(indices, Containers::arrayCast<2, char>(Containers::arrayView(data)).every({2, 2}));
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::optimizeVertexFetchInPlace(): second data view dimension is not contiguous\n"
+        "MeshTools::compactVerticesInPlace(): second data view dimension is not contiguous\n");
+}
+
+void OptimizeVertexFetchTest::inPlaceIndexOutOfBounds() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    UnsignedShort indices[]{0, 3, 2};
+    Int data[3]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetchInPlace(indices, Containers::arrayCast<2, char>(Containers::stridedArrayView(data)));
+    MeshTools::compactVerticesInPlace(indices, Containers::arrayCast<2, char>(Containers::stridedArrayView(data)));
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::optimizeVertexFetchInPlace(): index 3 out of bounds for 3 vertices\n"
+        "MeshTools::compactVerticesInPlace(): index 3 out of bounds for 3 vertices\n");
+}
+
+void OptimizeVertexFetchTest::optimizeVertexFetchMeshData() {
+    /* Deliberately not owned and not interleaved to verify that the function
+       will handle this */
+    struct Vertex {
+        Vector2 positions[6]{
+            {0.0f, 0.5f},
+            {1.0f, 1.5f},
+            {2.0f, 2.5f},
+            {3.0f, 3.5f},
+            {4.0f, 4.5f},
+            {5.0f, 5.5f}
+        };
+        Short data[6][2]{
+            {0, 0},
+            {1, -1},
+            {2, -2},
+            {3, -3},
+            {4, -4},
+            {5, -5}
+        };
+    } vertexData[1];
+
+    const UnsignedShort indexData[]{3, 1, 5, 1, 3, 0};
+
+    Trade::MeshData mesh{MeshPrimitive::Lines,
+        {}, indexData, Trade::MeshIndexData{indexData},
+        {}, vertexData, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                Containers::arrayView(vertexData->positions)},
+            Trade::MeshAttributeData{Trade::meshAttributeCustom(42),
+                VertexFormat::Short, Containers::stridedArrayView(vertexData->data), 2}
+    }};
+
+    Trade::MeshData optimized = MeshTools::optimizeVertexFetch(mesh);
+    CORRADE_COMPARE(optimized.primitive(), MeshPrimitive::Lines);
+    CORRADE_COMPARE(optimized.indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE_AS(optimized.indices<UnsignedShort>(),
+        Containers::arrayView<UnsignedShort>({0, 1, 2, 1, 0, 3}),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(optimized.vertexCount(), 4);
+    CORRADE_COMPARE(optimized.vertexDataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(optimized.attributeCount(), 2);
+    CORRADE_COMPARE_AS(optimized.attribute<Vector2>(Trade::MeshAttribute::Position),
+        Containers::arrayView<Vector2>({
+            {3.0f, 3.5f},
+            {1.0f, 1.5f},
+            {5.0f, 5.5f},
+            {0.0f, 0.5f}
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(optimized.attributeFormat(1), VertexFormat::Short);
+    CORRADE_COMPARE(optimized.attributeArraySize(1), 2);
+    CORRADE_COMPARE_AS((Containers::arrayCast<1, const Vector2s>(optimized.attribute<Short[]>(1))),
+        Containers::arrayView<Vector2s>({
+            {3, -3},
+            {1, -1},
+            {5, -5},
+            {0, 0}
+        }), TestSuite::Compare::Container);
+}
+
+struct InterleavedVertex {
+    Vector2 position;
+    UnsignedInt id;
+};
+
+void OptimizeVertexFetchTest::optimizeVertexFetchMeshDataRvalueOwned() {
+    Containers::Array<char> indexData{Containers::NoInit, 6*sizeof(UnsignedInt)};
+    const auto indices = Containers::arrayCast<UnsignedInt>(indexData);
+    for(std::size_t i = 0; i != Containers::arraySize(Indices); ++i)
+        indices[i] = Indices[i];
+
+    Containers::Array<char> vertexData{Containers::NoInit, 6*sizeof(InterleavedVertex)};
+    const auto vertices = Containers::arrayCast<InterleavedVertex>(vertexData);
+    for(std::size_t i = 0; i != vertices.size(); ++i)
+        vertices[i] = {{Float(i), 0.5f}, UnsignedInt(i)*10};
+
+    const void* const indexPointer = indexData.data();
+    const void* const vertexPointer = vertexData.data();
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        std::move(indexData), Trade::MeshIndexData{indices},
+        std::move(vertexData), {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                Containers::StridedArrayView1D<Vector2>{vertices, &vertices[0].position, vertices.size(), sizeof(InterleavedVertex)}},
+            Trade::MeshAttributeData{Trade::MeshAttribute::ObjectId,
+                Containers::StridedArrayView1D<UnsignedInt>{vertices, &vertices[0].id, vertices.size(), sizeof(InterleavedVertex)}}
+    }};
+
+    Trade::MeshData optimized = MeshTools::optimizeVertexFetch(std::move(mesh));
+
+    /* The operation was done in-place, with ownership transferred */
+    CORRADE_COMPARE(static_cast<const void*>(optimized.indexData().data()), indexPointer);
+    CORRADE_COMPARE(static_cast<const void*>(optimized.vertexData().data()), vertexPointer);
+    CORRADE_COMPARE(optimized.indexDataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(optimized.vertexDataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(optimized.attributeStride(0), sizeof(InterleavedVertex));
+
+    CORRADE_COMPARE_AS(optimized.indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 1, 0, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(optimized.vertexCount(), 4);
+    CORRADE_COMPARE_AS(optimized.attribute<UnsignedInt>(Trade::MeshAttribute::ObjectId),
+        Containers::arrayView<UnsignedInt>({30, 10, 50, 0}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(optimized.attribute<Vector2>(Trade::MeshAttribute::Position),
+        Containers::arrayView<Vector2>({
+            {3.0f, 0.5f},
+            {1.0f, 0.5f},
+            {5.0f, 0.5f},
+            {0.0f, 0.5f}
+        }), TestSuite::Compare::Container);
+
+    /* The unreferenced vertices are moved to the end */
+    CORRADE_COMPARE(vertices[4].id, 20);
+    CORRADE_COMPARE(vertices[5].id, 40);
+}
+
+void OptimizeVertexFetchTest::optimizeVertexFetchMeshDataRvalueMutable() {
+    /* Not owned and not interleaved */
+    struct Vertex {
+        UnsignedInt ids[6]{0, 10, 20, 30, 40, 50};
+        Float weights[6]{0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+    } vertexData[1];
+    UnsignedByte indexData[]{3, 1, 5, 1, 3, 0};
+
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        Trade::DataFlag::Mutable, indexData, Trade::MeshIndexData{indexData},
+        Trade::DataFlag::Mutable, vertexData, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::ObjectId,
+                Containers::arrayView(vertexData->ids)},
+            Trade::MeshAttributeData{Trade::meshAttributeCustom(1),
+                Containers::arrayView(vertexData->weights)}
+    }};
+
+    Trade::MeshData optimized = MeshTools::optimizeVertexFetch(std::move(mesh));
+    CORRADE_COMPARE(static_cast<const void*>(optimized.indexData().data()), static_cast<const void*>(indexData));
+    CORRADE_COMPARE(static_cast<const void*>(optimized.vertexData().data()), static_cast<const void*>(vertexData));
+    CORRADE_COMPARE(optimized.indexDataFlags(), Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(optimized.vertexDataFlags(), Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(optimized.vertexCount(), 4);
+
+    /* The original data got modified */
+    CORRADE_COMPARE_AS(Containers::arrayView(indexData),
+        Containers::arrayView<UnsignedByte>({0, 1, 2, 1, 0, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(vertexData->ids),
+        Containers::arrayView<UnsignedInt>({30, 10, 50, 0, 20, 40}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(vertexData->weights),
+        Containers::arrayView<Float>({3.0f, 1.0f, 5.0f, 0.0f, 2.0f, 4.0f}),
+        TestSuite::Compare::Container);
+}
+
+void OptimizeVertexFetchTest::optimizeVertexFetchMeshDataRvalueImmutable() {
+    const UnsignedInt vertexData[]{0, 10, 20, 30, 40, 50};
+    const UnsignedInt indexData[]{3, 1, 5, 1, 3, 0};
+
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indexData, Trade::MeshIndexData{indexData},
+        {}, vertexData, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::ObjectId,
+                Containers::arrayView(vertexData)}
+    }};
+
+    /* Falls back to making a copy */
+    Trade::MeshData optimized = MeshTools::optimizeVertexFetch(std::move(mesh));
+    CORRADE_COMPARE(optimized.indexDataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(optimized.vertexDataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+    CORRADE_COMPARE_AS(optimized.indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 1, 0, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(optimized.attribute<UnsignedInt>(Trade::MeshAttribute::ObjectId),
+        Containers::arrayView<UnsignedInt>({30, 10, 50, 0}),
+        TestSuite::Compare::Container);
+}
+
+void OptimizeVertexFetchTest::compactVerticesMeshData() {
+    const UnsignedInt vertexData[]{0, 10, 20, 30, 40, 50};
+    const UnsignedInt indexData[]{3, 1, 5, 1, 3, 0};
+
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indexData, Trade::MeshIndexData{indexData},
+        {}, vertexData, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::ObjectId,
+                Containers::arrayView(vertexData)}
+    }};
+
+    Trade::MeshData compacted = MeshTools::compactVertices(mesh);
+    CORRADE_COMPARE_AS(compacted.indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({2, 1, 3, 1, 2, 0}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(compacted.vertexCount(), 4);
+    CORRADE_COMPARE_AS(compacted.attribute<UnsignedInt>(Trade::MeshAttribute::ObjectId),
+        Containers::arrayView<UnsignedInt>({0, 10, 30, 50}),
+        TestSuite::Compare::Container);
+}
+
+void OptimizeVertexFetchTest::meshDataNotIndexed() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetch(Trade::MeshData{MeshPrimitive::Triangles, 5});
+    MeshTools::compactVertices(Trade::MeshData{MeshPrimitive::Triangles, 5});
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::optimizeVertexFetch(): mesh data not indexed\n"
+        "MeshTools::compactVertices(): mesh data not indexed\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::OptimizeVertexFetchTest)
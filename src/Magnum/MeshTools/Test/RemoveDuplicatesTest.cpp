@@ -24,13 +24,18 @@
 */
 
 #include <algorithm>
+#include <cstring>
 #include <random>
 #include <sstream>
+#include <unordered_map>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/DebugStl.h>
 #include <Corrade/Utility/FormatStl.h>
+#include <Corrade/Utility/MurmurHash2.h>
 
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
@@ -45,6 +50,7 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
     void removeDuplicates();
     void removeDuplicatesNonContiguous();
     void removeDuplicatesIntoWrongOutputSize();
+    void removeDuplicatesMultithreaded();
 
     template<class T> void removeDuplicatesIndexedInPlace();
     void removeDuplicatesIndexedInPlaceSmallType();
@@ -83,6 +89,9 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
     void soakTestFuzzy();
 
     void benchmark();
+    void benchmarkUnique();
+    void benchmarkUniqueStlUnorderedMap();
+    void benchmarkMultithreaded();
     void benchmarkFuzzy();
 };
 
@@ -166,6 +175,7 @@ RemoveDuplicatesTest::RemoveDuplicatesTest() {
     addTests({&RemoveDuplicatesTest::removeDuplicates,
               &RemoveDuplicatesTest::removeDuplicatesNonContiguous,
               &RemoveDuplicatesTest::removeDuplicatesIntoWrongOutputSize,
+              &RemoveDuplicatesTest::removeDuplicatesMultithreaded,
               &RemoveDuplicatesTest::removeDuplicatesIndexedInPlace<UnsignedByte>,
               &RemoveDuplicatesTest::removeDuplicatesIndexedInPlace<UnsignedShort>,
               &RemoveDuplicatesTest::removeDuplicatesIndexedInPlace<UnsignedInt>,
@@ -223,6 +233,9 @@ RemoveDuplicatesTest::RemoveDuplicatesTest() {
                       &RemoveDuplicatesTest::soakTestFuzzy}, 10);
 
     addBenchmarks({&RemoveDuplicatesTest::benchmark,
+                   &RemoveDuplicatesTest::benchmarkUnique,
+                   &RemoveDuplicatesTest::benchmarkUniqueStlUnorderedMap,
+                   &RemoveDuplicatesTest::benchmarkMultithreaded,
                    &RemoveDuplicatesTest::benchmarkFuzzy}, 10);
 }
 
@@ -282,6 +295,50 @@ void RemoveDuplicatesTest::removeDuplicatesIntoWrongOutputSize() {
         "MeshTools::removeDuplicatesInPlaceInto(): output index array has 7 elements but expected 8\n");
 }
 
+void RemoveDuplicatesTest::removeDuplicatesMultithreaded() {
+    /* Large enough to be split among all threads. Each item is there ~3
+       times, make the items 12 bytes to test the specialized codepath. */
+    Containers::Array<Vector3i> data{Containers::NoInit, 100000};
+    std::minstd_rand rand{std::random_device{}()};
+    for(Vector3i& i: data) {
+        const Int value = rand() % 33333;
+        i = {value, -value, value*7};
+    }
+
+    /* Compare against single-threaded output, it should be exactly the same
+       including the order */
+    Containers::Array<Vector3i> expectedData{Containers::NoInit, data.size()};
+    Utility::copy(data, expectedData);
+    Containers::Array<UnsignedInt> expectedIndices{Containers::NoInit, data.size()};
+    const std::size_t expectedCount = MeshTools::removeDuplicatesInPlaceInto(
+        Containers::arrayCast<2, char>(Containers::arrayView(expectedData)),
+        expectedIndices, 1);
+
+    Containers::Array<UnsignedInt> indicesInto{Containers::NoInit, data.size()};
+    const std::size_t countInto = MeshTools::removeDuplicatesInto(
+        Containers::arrayCast<2, const char>(Containers::arrayView(data)),
+        indicesInto, 4);
+    CORRADE_COMPARE(countInto, expectedCount);
+    for(std::size_t i = 0; i != data.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(data[indicesInto[i]], data[i]);
+        CORRADE_COMPARE_AS(std::size_t(indicesInto[i]), i,
+            TestSuite::Compare::LessOrEqual);
+    }
+
+    Containers::Array<UnsignedInt> indicesInPlace{Containers::NoInit, data.size()};
+    const std::size_t countInPlace = MeshTools::removeDuplicatesInPlaceInto(
+        Containers::arrayCast<2, char>(Containers::arrayView(data)),
+        indicesInPlace, 4);
+    CORRADE_COMPARE(countInPlace, expectedCount);
+    CORRADE_COMPARE_AS(Containers::arrayView(indicesInPlace),
+        Containers::arrayView(expectedIndices),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(data.prefix(countInPlace),
+        expectedData.prefix(expectedCount),
+        TestSuite::Compare::Container);
+}
+
 template<class T> void RemoveDuplicatesTest::removeDuplicatesIndexedInPlace() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
@@ -1106,6 +1163,75 @@ void RemoveDuplicatesTest::benchmark() {
     CORRADE_COMPARE(count, 100);
 }
 
+void RemoveDuplicatesTest::benchmarkUnique() {
+    /* Array of 50k unique items with 2 duplicates each, shuffled. Compared to
+       benchmark() this stresses the hash table size and memory access
+       pattern more than the key hashing. */
+    Containers::Array<Vector3i> data{Containers::NoInit, 100000};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = {Int(i/2), Int(i/2)*3, -Int(i/2)};
+    std::shuffle(data.begin(), data.end(), std::minstd_rand{std::random_device{}()});
+
+    std::size_t count;
+    Containers::Array<UnsignedInt> indices{Containers::NoInit, data.size()};
+    CORRADE_BENCHMARK(1)
+        count = MeshTools::removeDuplicatesInto(
+            Containers::arrayCast<2, const char>(Containers::arrayView(data)),
+            indices);
+
+    CORRADE_COMPARE(count, 50000);
+}
+
+void RemoveDuplicatesTest::benchmarkUniqueStlUnorderedMap() {
+    /* Same as benchmarkUnique(), but using the std::unordered_map +
+       MurmurHash2 approach that removeDuplicatesInto() was originally
+       implemented with, for comparison */
+    Containers::Array<Vector3i> data{Containers::NoInit, 100000};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = {Int(i/2), Int(i/2)*3, -Int(i/2)};
+    std::shuffle(data.begin(), data.end(), std::minstd_rand{std::random_device{}()});
+
+    struct ArrayEqual {
+        bool operator()(const void* a, const void* b) const {
+            return std::memcmp(a, b, sizeof(Vector3i)) == 0;
+        }
+    };
+
+    struct ArrayHash {
+        std::size_t operator()(const void* a) const {
+            return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(static_cast<const char*>(a), sizeof(Vector3i)).byteArray());
+        }
+    };
+
+    std::size_t count;
+    Containers::Array<UnsignedInt> indices{Containers::NoInit, data.size()};
+    CORRADE_BENCHMARK(1) {
+        std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{data.size()};
+        for(std::size_t i = 0; i != data.size(); ++i)
+            indices[i] = table.emplace(&data[i], i).first->second;
+        count = table.size();
+    }
+
+    CORRADE_COMPARE(count, 50000);
+}
+
+void RemoveDuplicatesTest::benchmarkMultithreaded() {
+    /* Same as benchmarkUnique(), but using all available threads */
+    Containers::Array<Vector3i> data{Containers::NoInit, 100000};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = {Int(i/2), Int(i/2)*3, -Int(i/2)};
+    std::shuffle(data.begin(), data.end(), std::minstd_rand{std::random_device{}()});
+
+    std::size_t count;
+    Containers::Array<UnsignedInt> indices{Containers::NoInit, data.size()};
+    CORRADE_BENCHMARK(1)
+        count = MeshTools::removeDuplicatesInto(
+            Containers::arrayCast<2, const char>(Containers::arrayView(data)),
+            indices, 0);
+
+    CORRADE_COMPARE(count, 50000);
+}
+
 void RemoveDuplicatesTest::benchmarkFuzzy() {
     /* Array of 100 unique items with 100 duplicates each, shuffled */
     Vector3 data[10000];
@@ -0,0 +1,385 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Simplify.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct SimplifyTest: TestSuite::Tester {
+    explicit SimplifyTest();
+
+    template<class T> void inPlace();
+    void inPlaceSeam();
+    void inPlaceErrorBound();
+    void inPlaceTargetAlreadyReached();
+    void inPlaceInvalidIndexCount();
+    void inPlaceIndexOutOfBounds();
+
+    void meshData();
+    void lods();
+    void meshDataInvalid();
+};
+
+SimplifyTest::SimplifyTest() {
+    addTests({&SimplifyTest::inPlace<UnsignedByte>,
+              &SimplifyTest::inPlace<UnsignedShort>,
+              &SimplifyTest::inPlace<UnsignedInt>,
+              &SimplifyTest::inPlaceSeam,
+              &SimplifyTest::inPlaceErrorBound,
+              &SimplifyTest::inPlaceTargetAlreadyReached,
+              &SimplifyTest::inPlaceInvalidIndexCount,
+              &SimplifyTest::inPlaceIndexOutOfBounds,
+
+              &SimplifyTest::meshData,
+              &SimplifyTest::lods,
+              &SimplifyTest::meshDataInvalid});
+}
+
+/* A unit square in the XY plane made of 4x4 quads, with Z optionally
+   displaced. If seam is set, vertices in the middle column are duplicated
+   for the right half of the grid, like with a texture coordinate seam. The
+   duplicates are at the end. */
+struct Grid {
+    Containers::Array<Vector3> positions;
+    Containers::Array<UnsignedInt> indices;
+};
+
+Grid grid(UnsignedInt size, bool seam, Float displacement = 0.0f) {
+    Grid out;
+    const UnsignedInt middle = size/2;
+    out.positions = Containers::Array<Vector3>{Containers::NoInit, (size + 1)*(size + 1) + (seam ? size + 1 : 0)};
+    for(UnsignedInt y = 0; y <= size; ++y)
+        for(UnsignedInt x = 0; x <= size; ++x)
+            out.positions[y*(size + 1) + x] = {Float(x)/size, Float(y)/size,
+                displacement*Math::sin(Rad(Float(x)))*Math::sin(Rad(Float(y)))};
+    if(seam) for(UnsignedInt y = 0; y <= size; ++y)
+        out.positions[(size + 1)*(size + 1) + y] = out.positions[y*(size + 1) + middle];
+
+    out.indices = Containers::Array<UnsignedInt>{Containers::NoInit, size*size*6};
+    std::size_t i = 0;
+    for(UnsignedInt y = 0; y != size; ++y) for(UnsignedInt x = 0; x != size; ++x) {
+        auto vertex = [&](UnsignedInt vx, UnsignedInt vy) {
+            if(seam && vx == middle && x >= middle)
+                return (size + 1)*(size + 1) + vy;
+            return vy*(size + 1) + vx;
+        };
+        const UnsignedInt a = vertex(x, y);
+        const UnsignedInt b = vertex(x + 1, y);
+        const UnsignedInt c = vertex(x, y + 1);
+        const UnsignedInt d = vertex(x + 1, y + 1);
+        out.indices[i++] = a;
+        out.indices[i++] = b;
+        out.indices[i++] = c;
+        out.indices[i++] = b;
+        out.indices[i++] = d;
+        out.indices[i++] = c;
+    }
+
+    return out;
+}
+
+/* Sum of triangle areas projected to the XY plane, negative for flipped
+   triangles */
+Float area(const Containers::ArrayView<const UnsignedInt> indices, const Containers::ArrayView<const Vector3> positions) {
+    Float area = 0.0f;
+    for(std::size_t i = 0; i != indices.size(); i += 3)
+        area += Math::cross(positions[indices[i + 1]] - positions[indices[i]], positions[indices[i + 2]] - positions[indices[i]]).z()*0.5f;
+    return area;
+}
+
+template<class T> void SimplifyTest::inPlace() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    Grid data = grid(4, false);
+    Containers::Array<T> indices{Containers::NoInit, data.indices.size()};
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        indices[i] = data.indices[i];
+
+    /* A flat grid collapses to just two triangles without any error */
+    const std::pair<std::size_t, Float> out = MeshTools::simplifyInPlace(
+        Containers::stridedArrayView(indices),
+        Containers::stridedArrayView(data.positions), 0);
+    CORRADE_COMPARE(out.first, 6);
+    CORRADE_COMPARE(out.second, 0.0f);
+
+    Containers::Array<UnsignedInt> result{Containers::NoInit, out.first};
+    for(std::size_t i = 0; i != out.first; ++i) {
+        result[i] = indices[i];
+        /* Only the corners are left */
+        CORRADE_ITERATION(i);
+        const Vector3 position = data.positions[result[i]];
+        CORRADE_VERIFY(position.x() == 0.0f || position.x() == 1.0f);
+        CORRADE_VERIFY(position.y() == 0.0f || position.y() == 1.0f);
+    }
+    CORRADE_COMPARE(area(result, data.positions), 1.0f);
+}
+
+void SimplifyTest::inPlaceSeam() {
+    Grid data = grid(4, true);
+
+    const std::pair<std::size_t, Float> out = MeshTools::simplifyInPlace(
+        Containers::stridedArrayView(data.indices),
+        Containers::stridedArrayView(data.positions), 0);
+
+    /* The seam column stays, splitting the grid into two halves of two
+       triangles each */
+    CORRADE_COMPARE(out.first, 12);
+    CORRADE_COMPARE(out.second, 0.0f);
+    const auto indices = data.indices.prefix(out.first);
+    CORRADE_COMPARE(area(indices, data.positions), 1.0f);
+
+    /* Each triangle uses either only the original vertices on the left or
+       only the duplicates on the right, i.e. the seam didn't get torn
+       open */
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        CORRADE_ITERATION(i/3);
+        const bool right =
+            data.positions[indices[i + 0]].x() +
+            data.positions[indices[i + 1]].x() +
+            data.positions[indices[i + 2]].x() > 1.5f;
+        for(std::size_t j = 0; j != 3; ++j) {
+            if(data.positions[indices[i + j]].x() != 0.5f) continue;
+            CORRADE_COMPARE(indices[i + j] >= 25, right);
+        }
+    }
+}
+
+void SimplifyTest::inPlaceErrorBound() {
+    Grid data = grid(16, false, 0.05f);
+
+    /* With a small error bound, the simplification stops early */
+    Containers::Array<UnsignedInt> indices{Containers::NoInit, data.indices.size()};
+    Utility::copy(Containers::arrayView(data.indices), Containers::arrayView(indices));
+    const std::pair<std::size_t, Float> bounded = MeshTools::simplifyInPlace(
+        Containers::stridedArrayView(indices),
+        Containers::stridedArrayView(data.positions), 0, 1.0e-2f);
+    CORRADE_COMPARE_AS(bounded.first, data.indices.size(),
+        TestSuite::Compare::Less);
+    CORRADE_COMPARE_AS(bounded.first, std::size_t{6},
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(bounded.second, 1.0e-2f,
+        TestSuite::Compare::LessOrEqual);
+
+    /* With a large error bound, it reaches the target index count, with a
+       larger error */
+    Utility::copy(Containers::arrayView(data.indices), Containers::arrayView(indices));
+    const std::pair<std::size_t, Float> unbounded = MeshTools::simplifyInPlace(
+        Containers::stridedArrayView(indices),
+        Containers::stridedArrayView(data.positions), 600, 0.5f);
+    CORRADE_COMPARE_AS(unbounded.first, std::size_t{600},
+        TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(unbounded.first, bounded.first,
+        TestSuite::Compare::Less);
+    CORRADE_COMPARE_AS(unbounded.second, bounded.second,
+        TestSuite::Compare::Greater);
+}
+
+void SimplifyTest::inPlaceTargetAlreadyReached() {
+    Grid data = grid(4, false);
+    Containers::Array<UnsignedInt> indices{Containers::NoInit, data.indices.size()};
+    Utility::copy(Containers::arrayView(data.indices), Containers::arrayView(indices));
+
+    const std::pair<std::size_t, Float> out = MeshTools::simplifyInPlace(
+        Containers::stridedArrayView(indices),
+        Containers::stridedArrayView(data.positions), 96);
+    CORRADE_COMPARE(out.first, 96);
+    CORRADE_COMPARE(out.second, 0.0f);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView(data.indices),
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::inPlaceInvalidIndexCount() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    UnsignedInt indices[5]{};
+    const Vector3 positions[1]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::simplifyInPlace(Containers::stridedArrayView(indices),
+        Containers::stridedArrayView(positions), 0);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::simplifyInPlace(): expected index count divisible by 3, got 5\n");
+}
+
+void SimplifyTest::inPlaceIndexOutOfBounds() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    UnsignedShort indices[]{0, 1, 3};
+    const Vector3 positions[3]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::simplifyInPlace(Containers::stridedArrayView(indices),
+        Containers::stridedArrayView(positions), 0);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::simplifyInPlace(): index 3 out of bounds for 3 vertices\n");
+}
+
+struct Vertex {
+    Vector3 position;
+    Vector2 textureCoordinates;
+};
+
+/* The seam grid with texture coordinates matching the positions on the left
+   and shifted by one on the right */
+Trade::MeshData texturedGrid(const Grid& data, MeshIndexType indexType) {
+    Containers::Array<char> vertexData{Containers::NoInit, data.positions.size()*sizeof(Vertex)};
+    const auto vertices = Containers::arrayCast<Vertex>(vertexData);
+    for(std::size_t i = 0; i != vertices.size(); ++i) {
+        vertices[i].position = data.positions[i];
+        vertices[i].textureCoordinates = data.positions[i].xy();
+        if(i >= 25) vertices[i].textureCoordinates.x() += 1.0f;
+    }
+
+    Containers::Array<char> indexData{Containers::NoInit, data.indices.size()*meshIndexTypeSize(indexType)};
+    for(std::size_t i = 0; i != data.indices.size(); ++i) {
+        if(indexType == MeshIndexType::UnsignedByte)
+            Containers::arrayCast<UnsignedByte>(indexData)[i] = data.indices[i];
+        else
+            Containers::arrayCast<UnsignedShort>(indexData)[i] = data.indices[i];
+    }
+
+    const Trade::MeshIndexData indices{indexType, indexData};
+    const Trade::MeshAttributeData attributes[]{
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            Containers::StridedArrayView1D<const Vector3>{vertices,
+                &vertices[0].position, vertices.size(), sizeof(Vertex)}},
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates,
+            Containers::StridedArrayView1D<const Vector2>{vertices,
+                &vertices[0].textureCoordinates, vertices.size(), sizeof(Vertex)}}
+    };
+    return Trade::MeshData{MeshPrimitive::Triangles,
+        std::move(indexData), indices,
+        std::move(vertexData), Trade::meshAttributeDataNonOwningArray(attributes)};
+}
+
+/* Whether the texture coordinates stayed attached to their positions */
+bool textureCoordinatesMatch(const Trade::MeshData& mesh) {
+    const Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+    const Containers::Array<Vector2> textureCoordinates = mesh.textureCoordinates2DAsArray();
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        const Float shift = textureCoordinates[i].x() - positions[i].x();
+        if((shift != 0.0f && shift != 1.0f) ||
+           textureCoordinates[i].y() != positions[i].y()) return false;
+    }
+    return true;
+}
+
+Float area(const Trade::MeshData& mesh) {
+    const Containers::Array<UnsignedInt> indices = mesh.indicesAsArray();
+    const Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+    return area(indices, positions);
+}
+
+void SimplifyTest::meshData() {
+    const Trade::MeshData mesh = texturedGrid(grid(4, true), MeshIndexType::UnsignedByte);
+
+    Trade::MeshData simplified = MeshTools::simplify(mesh, 0, 1.0e-3f);
+    CORRADE_COMPARE(simplified.primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(simplified.isIndexed());
+    CORRADE_COMPARE(simplified.indexType(), MeshIndexType::UnsignedByte);
+    CORRADE_COMPARE(simplified.indexCount(), 12);
+    /* Unreferenced vertices are removed, the seam column has two vertices on
+       each side */
+    CORRADE_COMPARE(simplified.vertexCount(), 8);
+    CORRADE_COMPARE(simplified.attributeCount(), 2);
+    CORRADE_COMPARE(simplified.attributeName(1), Trade::MeshAttribute::TextureCoordinates);
+    CORRADE_COMPARE(area(simplified), 1.0f);
+    CORRADE_VERIFY(textureCoordinatesMatch(simplified));
+}
+
+void SimplifyTest::lods() {
+    const Trade::MeshData mesh = texturedGrid(grid(4, true), MeshIndexType::UnsignedShort);
+
+    Containers::Array<Trade::MeshData> lods = MeshTools::simplifyLods(mesh, {48, 24, 0}, 1.0e-3f);
+    CORRADE_COMPARE(lods.size(), 3);
+
+    UnsignedInt previousIndexCount = mesh.indexCount();
+    UnsignedInt previousVertexCount = mesh.vertexCount();
+    const UnsignedInt targetIndexCounts[]{48, 24, 12};
+    for(std::size_t i = 0; i != lods.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(lods[i].indexType(), MeshIndexType::UnsignedShort);
+        CORRADE_COMPARE_AS(lods[i].indexCount(), targetIndexCounts[i],
+            TestSuite::Compare::LessOrEqual);
+        CORRADE_COMPARE_AS(lods[i].indexCount(), previousIndexCount,
+            TestSuite::Compare::Less);
+        CORRADE_COMPARE_AS(lods[i].vertexCount(), previousVertexCount,
+            TestSuite::Compare::Less);
+        CORRADE_COMPARE(area(lods[i]), 1.0f);
+        CORRADE_VERIFY(textureCoordinatesMatch(lods[i]));
+        previousIndexCount = lods[i].indexCount();
+        previousVertexCount = lods[i].vertexCount();
+    }
+
+    /* The last level is as far as the error bound allows */
+    CORRADE_COMPARE(lods[2].indexCount(), 12);
+}
+
+void SimplifyTest::meshDataInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const Trade::MeshData mesh = texturedGrid(grid(4, true), MeshIndexType::UnsignedShort);
+    const UnsignedShort indices[3]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::simplify(Trade::MeshData{MeshPrimitive::Triangles, 3}, 0);
+    MeshTools::simplify(Trade::MeshData{MeshPrimitive::Lines,
+        {}, indices, Trade::MeshIndexData{indices}, 3}, 0);
+    MeshTools::simplify(Trade::MeshData{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices}, 3}, 0);
+    MeshTools::simplifyLods(mesh, {48, 24, 36});
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::simplify(): mesh data not indexed\n"
+        "MeshTools::simplify(): expected MeshPrimitive::Triangles but got MeshPrimitive::Lines\n"
+        "MeshTools::simplify(): the mesh has no positions\n"
+        "MeshTools::simplifyLods(): expected target index counts in a non-increasing order, got 24 followed by 36\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SimplifyTest)
@@ -29,6 +29,7 @@
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/Tipsify.h"
 #include "Magnum/MeshTools/Implementation/Tipsify.h"
 
@@ -40,6 +41,9 @@ struct TipsifyTest: TestSuite::Tester {
     void buildAdjacency();
     template<class T> void tipsify();
     void oneDegenerateTriangle();
+    void deadEnd();
+    void deadEndStackOverflow();
+    template<class T> void overdraw();
 };
 
 /*
@@ -89,7 +93,12 @@ TipsifyTest::TipsifyTest() {
               &TipsifyTest::tipsify<UnsignedByte>,
               &TipsifyTest::tipsify<UnsignedShort>,
               &TipsifyTest::tipsify<UnsignedInt>,
-              &TipsifyTest::oneDegenerateTriangle});
+              &TipsifyTest::oneDegenerateTriangle,
+              &TipsifyTest::deadEnd,
+              &TipsifyTest::deadEndStackOverflow,
+              &TipsifyTest::overdraw<UnsignedByte>,
+              &TipsifyTest::overdraw<UnsignedShort>,
+              &TipsifyTest::overdraw<UnsignedInt>});
 }
 
 void TipsifyTest::buildAdjacency() {
@@ -179,6 +188,99 @@ void TipsifyTest::oneDegenerateTriangle() {
         TestSuite::Compare::Container);
 }
 
+/*
+
+    1         0 --- 4 --- 8
+   / \         \   / \   /
+  2 - 3          5     9
+                / \
+               6 - 7
+
+  With cache size 3, fanning goes from 0 to 5 and hits a dead end after
+  emitting 5-6-7, while 4 still has a live triangle. The disconnected
+  triangle has lower IDs, so it's what the next arbitrary vertex would be.
+*/
+constexpr UnsignedInt DeadEndIndices[]{
+    0, 4, 5,
+    5, 6, 7,
+    4, 8, 9,
+    1, 2, 3
+};
+
+void TipsifyTest::deadEnd() {
+    UnsignedInt indices[Containers::arraySize(DeadEndIndices)];
+    for(std::size_t i = 0; i != Containers::arraySize(DeadEndIndices); ++i)
+        indices[i] = DeadEndIndices[i];
+    MeshTools::tipsifyInPlace(indices, 10, 3);
+
+    /* On the dead end, 4 is found in the dead-end stack and so the fanning
+       continues from it while it's still in the cache. It used to be
+       overwritten by the next arbitrary vertex with live triangles, jumping
+       to the disconnected triangle first. */
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<UnsignedInt>({
+        0, 4, 5,
+        5, 6, 7,
+        4, 8, 9, /* from dead-end vertex stack */
+        1, 2, 3  /* arbitrary vertex */
+    }), TestSuite::Compare::Container);
+}
+
+void TipsifyTest::deadEndStackOverflow() {
+    UnsignedInt indices[Containers::arraySize(DeadEndIndices)];
+    for(std::size_t i = 0; i != Containers::arraySize(DeadEndIndices); ++i)
+        indices[i] = DeadEndIndices[i];
+    MeshTools::tipsifyInPlace(indices, 10, 1);
+
+    /* With cache size 1 the fanning goes from 0 over 4 instead, and the
+       dead-end stack holds only the last three vertices, 4, 8 and 9. Vertex
+       5 with a live triangle got pushed out of it, as it's no longer in the
+       cache anyway, so the next arbitrary vertex is taken instead. With an
+       unbounded stack the order of the last two triangles would be
+       swapped. */
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<UnsignedInt>({
+        0, 4, 5,
+        4, 8, 9,
+        1, 2, 3, /* arbitrary vertex */
+        5, 6, 7  /* arbitrary vertex */
+    }), TestSuite::Compare::Container);
+}
+
+template<class T> void TipsifyTest::overdraw() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Two disconnected triangles, both facing -Z. The first is in front of
+       the mesh centroid, facing towards it, the second behind, facing away
+       from it. Tipsify alone keeps the order, as the first triangle is
+       where it starts, but the second one is more likely to occlude the
+       first and so it should get drawn first. */
+    const Vector3 positions[]{
+        {0.0f, 0.0f,  1.0f},
+        {1.0f, 0.0f,  1.0f},
+        {0.0f, 1.0f,  1.0f},
+        {0.0f, 0.0f, -1.0f},
+        {1.0f, 0.0f, -1.0f},
+        {0.0f, 1.0f, -1.0f}
+    };
+    T indices[]{
+        0, 2, 1,
+        3, 5, 4
+    };
+
+    T tipsified[Containers::arraySize(indices)];
+    for(std::size_t i = 0; i != Containers::arraySize(indices); ++i)
+        tipsified[i] = indices[i];
+    MeshTools::tipsifyInPlace(tipsified, Containers::arraySize(positions), 3);
+    CORRADE_COMPARE_AS(Containers::arrayView(tipsified),
+        Containers::arrayView(indices),
+        TestSuite::Compare::Container);
+
+    MeshTools::tipsifyInPlace(indices, positions, 3);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<T>({
+        3, 5, 4,
+        0, 2, 1
+    }), TestSuite::Compare::Container);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::TipsifyTest)
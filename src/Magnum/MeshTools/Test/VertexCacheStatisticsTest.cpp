@@ -0,0 +1,136 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/MeshTools/VertexCacheStatistics.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct VertexCacheStatisticsTest: TestSuite::Tester {
+    explicit VertexCacheStatisticsTest();
+
+    template<class T> void averageCacheMissRatio();
+    template<class T> void averageTransformToVertexRatio();
+    void smallCache();
+    void empty();
+    void invalidIndexCount();
+    void indexOutOfBounds();
+};
+
+VertexCacheStatisticsTest::VertexCacheStatisticsTest() {
+    addTests({&VertexCacheStatisticsTest::averageCacheMissRatio<UnsignedByte>,
+              &VertexCacheStatisticsTest::averageCacheMissRatio<UnsignedShort>,
+              &VertexCacheStatisticsTest::averageCacheMissRatio<UnsignedInt>,
+              &VertexCacheStatisticsTest::averageTransformToVertexRatio<UnsignedByte>,
+              &VertexCacheStatisticsTest::averageTransformToVertexRatio<UnsignedShort>,
+              &VertexCacheStatisticsTest::averageTransformToVertexRatio<UnsignedInt>,
+              &VertexCacheStatisticsTest::smallCache,
+              &VertexCacheStatisticsTest::empty,
+              &VertexCacheStatisticsTest::invalidIndexCount,
+              &VertexCacheStatisticsTest::indexOutOfBounds});
+}
+
+/*
+    0 --- 1 --- 4
+    |   / |   / |
+    |  /  |  /  |
+    | /   | /   |
+    2 --- 3 --- 5
+*/
+template<class T> struct Indices {
+    static constexpr T Data[]{
+        0, 2, 1,
+        1, 2, 3,
+        1, 3, 4,
+        4, 3, 5
+    };
+};
+template<class T> constexpr T Indices<T>::Data[];
+
+template<class T> void VertexCacheStatisticsTest::averageCacheMissRatio() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Each vertex is transformed just once, 6 misses for 4 triangles */
+    CORRADE_COMPARE(MeshTools::averageCacheMissRatio(Containers::stridedArrayView(Indices<T>::Data), 6, 16), 1.5f);
+}
+
+template<class T> void VertexCacheStatisticsTest::averageTransformToVertexRatio() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    CORRADE_COMPARE(MeshTools::averageTransformToVertexRatio(Containers::stridedArrayView(Indices<T>::Data), 6, 16), 1.0f);
+}
+
+void VertexCacheStatisticsTest::smallCache() {
+    /* With a cache of just one vertex, only the directly repeated ones are a
+       hit, so 0 2 1 | 1 2 3 | 1 3 4 | 4 3 5 gives two hits */
+    CORRADE_COMPARE(MeshTools::averageCacheMissRatio(Containers::stridedArrayView(Indices<UnsignedInt>::Data), 6, 1), 2.5f);
+    CORRADE_COMPARE(MeshTools::averageTransformToVertexRatio(Containers::stridedArrayView(Indices<UnsignedInt>::Data), 6, 1), 10.0f/6.0f);
+}
+
+void VertexCacheStatisticsTest::empty() {
+    CORRADE_COMPARE(MeshTools::averageCacheMissRatio(Containers::StridedArrayView1D<const UnsignedInt>{}, 0, 16), 0.0f);
+    CORRADE_COMPARE(MeshTools::averageTransformToVertexRatio(Containers::StridedArrayView1D<const UnsignedInt>{}, 0, 16), 0.0f);
+}
+
+void VertexCacheStatisticsTest::invalidIndexCount() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const UnsignedInt indices[]{0, 1, 2, 3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::averageCacheMissRatio(Containers::stridedArrayView(indices), 4, 16);
+    MeshTools::averageTransformToVertexRatio(Containers::stridedArrayView(indices), 4, 16);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::averageCacheMissRatio(): expected index count divisible by 3, got 4\n"
+        "MeshTools::averageTransformToVertexRatio(): expected index count divisible by 3, got 4\n");
+}
+
+void VertexCacheStatisticsTest::indexOutOfBounds() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const UnsignedShort indices[]{0, 1, 3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::averageCacheMissRatio(Containers::stridedArrayView(indices), 3, 16);
+    MeshTools::averageTransformToVertexRatio(Containers::stridedArrayView(indices), 3, 16);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::averageCacheMissRatio(): index 3 out of bounds for 3 vertices\n"
+        "MeshTools::averageTransformToVertexRatio(): index 3 out of bounds for 3 vertices\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::VertexCacheStatisticsTest)
@@ -25,9 +25,13 @@
 
 #include "Tipsify.h"
 
-#include <Corrade/Containers/GrowableArray.h>
+#include <algorithm>
+#include <utility>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Utility/Algorithms.h>
 
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/Implementation/Tipsify.h"
 
 namespace Magnum { namespace MeshTools {
@@ -39,37 +43,46 @@ template<class T> void tipsifyInPlaceImplementation(const Containers::StridedArr
     Containers::Array<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
     Implementation::buildAdjacency<T>(indices, vertexCount, liveTriangleCount, neighborOffset, neighbors);
 
-    /* Global time, per-vertex caching timestamps, per-triangle emmited flag */
+    /* Global time, per-vertex caching timestamps, per-triangle emitted bits */
     UnsignedInt time = cacheSize+1;
     Containers::Array<UnsignedInt> timestamp{vertexCount};
-    /** @todo Have some bitset/staticbitset class for this */
-    Containers::Array<bool> emitted{indices.size()/3};
+    Containers::Array<UnsignedInt> emitted{(indices.size()/3 + 31)/32};
 
-    /* Dead-end vertex stack */
-    Containers::Array<UnsignedInt> deadEndStack;
+    /* Dead-end vertex stack. Vertices that were pushed more than three cache
+       sizes ago are no longer in the cache, so there's no point in
+       remembering them -- the stack is a fixed-size ring buffer that
+       overwrites the oldest entries when full. */
+    const std::size_t deadEndStackCapacity = Math::max(cacheSize, std::size_t{1})*3;
+    Containers::Array<UnsignedInt> deadEndStack{Containers::NoInit, deadEndStackCapacity};
+    std::size_t deadEndStackTop = 0, deadEndStackSize = 0;
 
     /* Output index buffer */
     Containers::Array<T> outputIndices{Containers::NoInit, indices.size()};
     std::size_t outputIndex = 0;
 
     /* Array with candidates for next fanning vertex (in 1-ring around
-       fanning vertex) */
-    Containers::Array<UnsignedInt> candidates;
+       fanning vertex). Each neighbor triangle adds three candidates at
+       most, so it can be allocated upfront for the vertex with the most
+       neighbors. */
+    UnsignedInt maxNeighborCount = 0;
+    for(UnsignedInt v = 0; v != vertexCount; ++v)
+        maxNeighborCount = Math::max(maxNeighborCount, liveTriangleCount[v]);
+    Containers::Array<UnsignedInt> candidates{Containers::NoInit, maxNeighborCount*3};
 
     /* Starting vertex for fanning, cursor */
     UnsignedInt fanningVertex = 0;
     UnsignedInt i = 0;
     while(fanningVertex != 0xFFFFFFFFu) {
         /* Reset the candidates for this vertex */
-        arrayResize(candidates, 0);
+        std::size_t candidateCount = 0;
 
         /* For all neighbors of fanning vertex */
         for(UnsignedInt ti = neighborOffset[fanningVertex]; ti != neighborOffset[fanningVertex+1]; ++ti) {
             const UnsignedInt t = neighbors[ti];
 
             /* Continue if already emitted */
-            if(emitted[t]) continue;
-            emitted[t] = true;
+            if(emitted[t >> 5] & (1u << (t & 31))) continue;
+            emitted[t >> 5] |= 1u << (t & 31);
 
             /* Write all vertices of the triangle to output buffer */
             for(UnsignedInt vi = 0; vi != 3; ++vi) {
@@ -78,9 +91,10 @@ template<class T> void tipsifyInPlaceImplementation(const Containers::StridedArr
                 outputIndices[outputIndex++] = v;
 
                 /* Add to dead end stack and candidates array */
-                /** @todo Limit size of dead end stack to cache size */
-                arrayAppend(deadEndStack, v);
-                arrayAppend(candidates, v);
+                deadEndStack[deadEndStackTop] = v;
+                deadEndStackTop = (deadEndStackTop + 1) % deadEndStackCapacity;
+                deadEndStackSize = Math::min(deadEndStackSize + 1, deadEndStackCapacity);
+                candidates[candidateCount++] = v;
 
                 /* Decrease live triangle count */
                 --liveTriangleCount[v];
@@ -96,7 +110,7 @@ template<class T> void tipsifyInPlaceImplementation(const Containers::StridedArr
 
         /* Go through candidates in 1-ring around fanning vertex */
         Int candidatePriority = -1;
-        for(UnsignedInt v: candidates) {
+        for(const UnsignedInt v: candidates.prefix(candidateCount)) {
             /* Skip if it doesn't have any live triangles */
             if(!liveTriangleCount[v]) continue;
 
@@ -115,9 +129,10 @@ template<class T> void tipsifyInPlaceImplementation(const Containers::StridedArr
         /* On dead-end */
         if(fanningVertex == 0xFFFFFFFFu) {
             /* Find vertex with live triangles in dead-end stack */
-            while(!deadEndStack.empty()) {
-                UnsignedInt d = deadEndStack.back();
-                arrayRemoveSuffix(deadEndStack);
+            while(deadEndStackSize) {
+                deadEndStackTop = (deadEndStackTop + deadEndStackCapacity - 1) % deadEndStackCapacity;
+                --deadEndStackSize;
+                const UnsignedInt d = deadEndStack[deadEndStackTop];
 
                 if(!liveTriangleCount[d]) continue;
                 fanningVertex = d;
@@ -126,7 +141,7 @@ template<class T> void tipsifyInPlaceImplementation(const Containers::StridedArr
 
             /* If not found, find next artbitrary vertex with live
                triangles */
-            while(++i < vertexCount) {
+            if(fanningVertex == 0xFFFFFFFFu) while(++i < vertexCount) {
                 if(!liveTriangleCount[i]) continue;
 
                 fanningVertex = i;
@@ -139,6 +154,123 @@ template<class T> void tipsifyInPlaceImplementation(const Containers::StridedArr
     Utility::copy(outputIndices, indices);
 }
 
+/* Triangle normal scaled by twice its area and a centroid scaled by the same
+   factor, to get area-weighted averages when summed */
+template<class T> void weightedNormalCentroid(const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t triangle, Vector3& normal, Vector3& centroid) {
+    const Vector3 a = positions[indices[triangle*3 + 0]];
+    const Vector3 b = positions[indices[triangle*3 + 1]];
+    const Vector3 c = positions[indices[triangle*3 + 2]];
+    const Vector3 n = Math::cross(b - a, c - a);
+    const Float area = n.length();
+    normal += n;
+    centroid += (a + b + c)*(area/3.0f);
+}
+
+template<class T> void optimizeOverdrawInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t cacheSize, const Float threshold) {
+    const std::size_t triangleCount = indices.size()/3;
+
+    /* Post-transform cache simulation, same as in tipsify(). Returns count
+       of cache misses for given triangle. */
+    UnsignedInt time = cacheSize+1;
+    Containers::Array<UnsignedInt> timestamp{positions.size()};
+    auto cacheMisses = [&](const std::size_t triangle) {
+        UnsignedInt misses = 0;
+        for(std::size_t i = 0; i != 3; ++i) {
+            const UnsignedInt v = indices[triangle*3 + i];
+            if(time - timestamp[v] > cacheSize) {
+                timestamp[v] = time++;
+                ++misses;
+            }
+        }
+        return misses;
+    };
+
+    /* Hard cluster boundaries are where the cache gets completely flushed,
+       i.e. where tipsify() hit a dead end. Reordering clusters between those
+       doesn't affect the cache efficiency. */
+    Containers::Array<UnsignedInt> hardBoundaries{Containers::NoInit, triangleCount + 1};
+    std::size_t hardBoundaryCount = 0;
+    for(std::size_t t = 0; t != triangleCount; ++t)
+        if(cacheMisses(t) == 3 || !t) hardBoundaries[hardBoundaryCount++] = t;
+    hardBoundaries[hardBoundaryCount] = triangleCount;
+
+    /* Split the hard clusters further into smaller ones as long as the cache
+       miss ratio of each doesn't get worse than the threshold. Each new
+       cluster starts with an empty cache, which is simulated by making the
+       whole cache stale. */
+    Containers::Array<UnsignedInt> boundaries{Containers::NoInit, triangleCount + 1};
+    std::size_t boundaryCount = 0;
+    for(std::size_t i = 0; i != hardBoundaryCount; ++i) {
+        const std::size_t begin = hardBoundaries[i];
+        const std::size_t end = hardBoundaries[i + 1];
+
+        time += cacheSize + 1;
+        UnsignedInt clusterMisses = 0;
+        for(std::size_t t = begin; t != end; ++t)
+            clusterMisses += cacheMisses(t);
+        const Float clusterThreshold = threshold*clusterMisses/(end - begin);
+
+        time += cacheSize + 1;
+        boundaries[boundaryCount++] = begin;
+        UnsignedInt misses = 0, triangles = 0;
+        for(std::size_t t = begin; t != end; ++t) {
+            misses += cacheMisses(t);
+            ++triangles;
+
+            /* Target cache miss ratio reached, start a new cluster with the
+               next triangle, unless it's the end */
+            if(misses <= clusterThreshold*triangles && t + 1 != end) {
+                boundaries[boundaryCount++] = t + 1;
+                time += cacheSize + 1;
+                misses = triangles = 0;
+            }
+        }
+    }
+    boundaries[boundaryCount] = triangleCount;
+
+    /* Area-weighted centroid of the whole mesh */
+    Vector3 meshNormal, meshCentroid;
+    Float meshArea = 0.0f;
+    for(std::size_t t = 0; t != triangleCount; ++t) {
+        Vector3 normal;
+        weightedNormalCentroid(indices, positions, t, normal, meshCentroid);
+        meshArea += normal.length();
+    }
+    if(meshArea) meshCentroid /= meshArea;
+
+    /* Clusters facing away from the mesh centroid are likely to occlude
+       other clusters, so those should be drawn first. Calculate a sort key
+       as a dot product of the cluster normal with a vector from mesh
+       centroid to cluster centroid and sort the clusters by it. */
+    Containers::Array<std::pair<Float, UnsignedInt>> sortKeys{Containers::NoInit, boundaryCount};
+    for(std::size_t i = 0; i != boundaryCount; ++i) {
+        Vector3 normal, centroid;
+        Float area = 0.0f;
+        for(std::size_t t = boundaries[i]; t != boundaries[i + 1]; ++t) {
+            Vector3 triangleNormal;
+            weightedNormalCentroid(indices, positions, t, triangleNormal, centroid);
+            area += triangleNormal.length();
+            normal += triangleNormal;
+        }
+        if(area) centroid /= area;
+        const Float normalLength = normal.length();
+        sortKeys[i] = {normalLength ? -Math::dot(centroid - meshCentroid, normal/normalLength) : 0.0f, UnsignedInt(i)};
+    }
+    std::stable_sort(sortKeys.begin(), sortKeys.end(),
+        [](const std::pair<Float, UnsignedInt>& a, const std::pair<Float, UnsignedInt>& b) {
+            return a.first < b.first;
+        });
+
+    /* Output the clusters in the new order */
+    Containers::Array<T> outputIndices{Containers::NoInit, triangleCount*3};
+    std::size_t outputIndex = 0;
+    for(const std::pair<Float, UnsignedInt>& key: sortKeys)
+        for(std::size_t i = boundaries[key.second]*3; i != boundaries[key.second + 1]*3; ++i)
+            outputIndices[outputIndex++] = indices[i];
+
+    Utility::copy(outputIndices, indices.prefix(triangleCount*3));
+}
+
 }
 
 void tipsifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
@@ -153,4 +285,19 @@ void tipsifyInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices,
     tipsifyInPlaceImplementation(indices, vertexCount, cacheSize);
 }
 
+void tipsifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t cacheSize, const Float overdrawThreshold) {
+    tipsifyInPlaceImplementation(indices, UnsignedInt(positions.size()), cacheSize);
+    optimizeOverdrawInPlaceImplementation(indices, positions, cacheSize, overdrawThreshold);
+}
+
+void tipsifyInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t cacheSize, const Float overdrawThreshold) {
+    tipsifyInPlaceImplementation(indices, UnsignedInt(positions.size()), cacheSize);
+    optimizeOverdrawInPlaceImplementation(indices, positions, cacheSize, overdrawThreshold);
+}
+
+void tipsifyInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t cacheSize, const Float overdrawThreshold) {
+    tipsifyInPlaceImplementation(indices, UnsignedInt(positions.size()), cacheSize);
+    optimizeOverdrawInPlaceImplementation(indices, positions, cacheSize, overdrawThreshold);
+}
+
 }}
@@ -54,6 +54,13 @@ array for beter usage of post-transform vertex cache. Algorithm used:
 * *Pedro V. Sander, Diego Nehab, and Joshua Barczak --- Fast Triangle Reordering
 for Vertex Locality and Reduced Overdraw, SIGGRAPH 2007,
 http://gfx.cs.princeton.edu/pubs/Sander_2007_%3ETR/index.php*.
+
+Apart from the index array copy and vertex-triangle adjacency, all temporary
+storage is allocated upfront and the dead-end vertex stack is limited to three
+times @p cacheSize, as vertices pushed earlier than that are no longer in the
+cache. Use @ref tipsifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, std::size_t, Float)
+to additionally reorder the triangles for reduced overdraw, and
+@ref averageCacheMissRatio() to measure the result.
 @todo Ability to compute vertex count automatically
 */
 MAGNUM_MESHTOOLS_EXPORT void tipsifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
@@ -70,6 +77,47 @@ MAGNUM_MESHTOOLS_EXPORT void tipsifyInPlace(const Containers::StridedArrayView1D
  */
 MAGNUM_MESHTOOLS_EXPORT void tipsifyInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
 
+/**
+@brief Tipsify the mesh in-place and reorder it for reduced overdraw
+@param[in,out] indices      Indices array to operate on
+@param[in] positions        Vertex positions
+@param[in] cacheSize        Post-transform vertex cache size
+@param[in] overdrawThreshold Max allowed worsening of the cache miss ratio
+    when splitting the mesh into clusters
+@m_since_latest
+
+Performs both steps of the algorithm described in
+@ref tipsifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, UnsignedInt, std::size_t).
+After optimizing for the post-transform vertex cache, the index array is
+split into clusters at places where the cache gets flushed. These are then
+further split into smaller clusters for as long as the average cache miss
+ratio of each cluster doesn't get worse than @p overdrawThreshold times the
+ratio of the original cluster. The clusters are then sorted so the ones that
+face away from the mesh centroid, and are thus more likely to occlude other
+parts of the mesh, are drawn first.
+
+Vertex count is taken from size of the @p positions array. The
+@p overdrawThreshold should be at least @cpp 1.0f @ce, where the value
+of @cpp 1.0f @ce preserves the cache efficiency of @ref tipsifyInPlace() and
+larger values trade it for less overdraw.
+
+As the triangle order changes, it's recommended to call
+@ref optimizeVertexFetch() afterwards to reorder the vertex data as well.
+*/
+MAGNUM_MESHTOOLS_EXPORT void tipsifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t cacheSize, Float overdrawThreshold = 1.05f);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void tipsifyInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t cacheSize, Float overdrawThreshold = 1.05f);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void tipsifyInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t cacheSize, Float overdrawThreshold = 1.05f);
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 /**
  * @brief @copybrief tipsifyInPlace()
@@ -0,0 +1,94 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "VertexCacheStatistics.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Same cache simulation as in tipsifyInPlace() */
+template<class T> UnsignedInt transformedVertexCount(const char* const prefix, const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        prefix << "expected index count divisible by 3, got" << indices.size(), {});
+    #ifdef CORRADE_NO_ASSERT
+    static_cast<void>(prefix);
+    #endif
+
+    UnsignedInt time = cacheSize + 1;
+    Containers::Array<UnsignedInt> timestamp{vertexCount};
+    UnsignedInt misses = 0;
+    for(const T index: indices) {
+        CORRADE_ASSERT(index < vertexCount,
+            prefix << "index" << index << "out of bounds for" << vertexCount << "vertices", {});
+        if(time - timestamp[index] > cacheSize) {
+            timestamp[index] = time++;
+            ++misses;
+        }
+    }
+
+    return misses;
+}
+
+template<class T> Float averageCacheMissRatioImplementation(const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    const UnsignedInt misses = transformedVertexCount("MeshTools::averageCacheMissRatio():", indices, vertexCount, cacheSize);
+    return indices.empty() ? 0.0f : misses*3.0f/indices.size();
+}
+
+template<class T> Float averageTransformToVertexRatioImplementation(const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    const UnsignedInt misses = transformedVertexCount("MeshTools::averageTransformToVertexRatio():", indices, vertexCount, cacheSize);
+    return vertexCount ? Float(misses)/vertexCount : 0.0f;
+}
+
+}
+
+Float averageCacheMissRatio(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    return averageCacheMissRatioImplementation(indices, vertexCount, cacheSize);
+}
+
+Float averageCacheMissRatio(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    return averageCacheMissRatioImplementation(indices, vertexCount, cacheSize);
+}
+
+Float averageCacheMissRatio(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    return averageCacheMissRatioImplementation(indices, vertexCount, cacheSize);
+}
+
+Float averageTransformToVertexRatio(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    return averageTransformToVertexRatioImplementation(indices, vertexCount, cacheSize);
+}
+
+Float averageTransformToVertexRatio(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    return averageTransformToVertexRatioImplementation(indices, vertexCount, cacheSize);
+}
+
+Float averageTransformToVertexRatio(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    return averageTransformToVertexRatioImplementation(indices, vertexCount, cacheSize);
+}
+
+}}
@@ -0,0 +1,105 @@
+#ifndef Magnum_MeshTools_VertexCacheStatistics_h
+#define Magnum_MeshTools_VertexCacheStatistics_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::averageCacheMissRatio(), @ref Magnum::MeshTools::averageTransformToVertexRatio()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Average cache miss ratio of a triangle mesh
+@param indices      Triangle indices
+@param vertexCount  Vertex count
+@param cacheSize    Post-transform vertex cache size
+@m_since_latest
+
+Simulates a FIFO post-transform vertex cache of @p cacheSize entries and
+returns the count of cache misses divided by the count of triangles, commonly
+abbreviated as ACMR. The value is between @cpp 3.0f @ce for a mesh where no
+vertex is reused and approaches @cpp 0.5f @ce for large regular meshes with an
+optimal triangle order. Useful for measuring the effect of
+@ref tipsifyInPlace(). Returns @cpp 0.0f @ce for an empty mesh.
+
+Expects that the index count is divisible by @cpp 3 @ce and all indices are
+less than @p vertexCount.
+@see @ref averageTransformToVertexRatio()
+*/
+MAGNUM_MESHTOOLS_EXPORT Float averageCacheMissRatio(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Float averageCacheMissRatio(const Containers::StridedArrayView1D<const UnsignedShort>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Float averageCacheMissRatio(const Containers::StridedArrayView1D<const UnsignedByte>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+/**
+@brief Average transform to vertex ratio of a triangle mesh
+@param indices      Triangle indices
+@param vertexCount  Vertex count
+@param cacheSize    Post-transform vertex cache size
+@m_since_latest
+
+Simulates a FIFO post-transform vertex cache of @p cacheSize entries and
+returns the count of cache misses divided by @p vertexCount, commonly
+abbreviated as ATVR. Unlike @ref averageCacheMissRatio(), the value doesn't
+depend on mesh topology --- it's @cpp 1.0f @ce if each vertex is transformed
+exactly once and grows with each vertex that has to be transformed again.
+Returns @cpp 0.0f @ce for an empty mesh.
+
+Expects that the index count is divisible by @cpp 3 @ce and all indices are
+less than @p vertexCount.
+*/
+MAGNUM_MESHTOOLS_EXPORT Float averageTransformToVertexRatio(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Float averageTransformToVertexRatio(const Containers::StridedArrayView1D<const UnsignedShort>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Float averageTransformToVertexRatio(const Containers::StridedArrayView1D<const UnsignedByte>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+}}
+
+#endif
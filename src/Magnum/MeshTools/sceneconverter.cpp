@@ -28,6 +28,7 @@
 #include <set>
 #include <sstream>
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Utility/Arguments.h>
 #include <Corrade/Utility/DebugStl.h>
 #include <Corrade/Utility/Directory.h>
@@ -38,6 +39,8 @@
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/FunctionsBatch.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/MeshTools/Simplify.h"
+#include "Magnum/MeshTools/VertexCacheStatistics.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/MaterialData.h"
 #include "Magnum/Trade/MeshData.h"
@@ -74,10 +77,12 @@ information.
 @code{.sh}
 magnum-sceneconverter [-h|--help] [--importer IMPORTER]
     [--converter CONVERTER]... [--plugin-dir DIR] [--remove-duplicates]
-    [--remove-duplicates-fuzzy EPSILON]
+    [--remove-duplicates-fuzzy EPSILON] [--simplify RATIO]
+    [--lods "RATIO RATIO …"] [--simplify-error ERROR] [--threads COUNT]
     [-i|--importer-options key=val,key2=val2,…]
     [-c|--converter-options key=val,key2=val2,…]... [--mesh MESH]
-    [--level LEVEL] [--info] [--bounds] [-v|--verbose] [--profile]
+    [--level LEVEL] [--info] [--bounds] [--vertex-cache-size SIZE]
+    [-v|--verbose] [--profile]
     [--] input output
 @endcode
 
@@ -93,10 +98,19 @@ Arguments:
 -   `--only-attributes "i j …"` --- include only attributes of given IDs in the
     output
 -   `--remove-duplicates` --- remove duplicate vertices using
-    @ref MeshTools::removeDuplicates(const Trade::MeshData&) after import
+    @ref MeshTools::removeDuplicates(const Trade::MeshData&, UnsignedInt) after
+    import
 -   `--remove-duplicates-fuzzy EPSILON` --- remove duplicate vertices using
     @ref MeshTools::removeDuplicatesFuzzy(const Trade::MeshData&, Float, Double)
     after import
+-   `--simplify RATIO` --- simplify the mesh to given ratio of its index count
+    using @ref MeshTools::simplify()
+-   `--lods "RATIO RATIO …"` --- generate levels of detail with given ratios
+    of the index count using @ref MeshTools::simplifyLods()
+-   `--simplify-error ERROR` --- max error allowed by `--simplify` and
+    `--lods`, relative to the mesh size (default: `0.01`)
+-   `--threads COUNT` --- count of threads to use for processing, @cpp 0 @ce
+    for all available hardware threads (default: `1`)
 -   `-i`, `--importer-options key=val,key2=val2,…` --- configuration options to
     pass to the importer
 -   `-c`, `--converter-options key=val,key2=val2,…` --- configuration options
@@ -105,11 +119,17 @@ Arguments:
 -   `--level LEVEL` --- mesh level to import (default: `0`)
 -   `--info` --- print info about the input file and exit
 -   `--bounds` --- show bounds of known attributes in `--info` output
+-   `--vertex-cache-size SIZE` --- post-transform vertex cache size used for
+    calculating vertex cache statistics in `--info` output (default: `32`)
 -   `-v`, `--verbose` --- verbose output from importer and converter plugins
 -   `--profile` --- measure import and conversion time
 
 If `--info` is given, the utility will print information about all meshes
-and images present in the file.
+and images present in the file. For indexed triangle meshes it additionally
+shows the average cache miss ratio (ACMR) and average transform to vertex
+ratio (ATVR) calculated using @ref MeshTools::averageCacheMissRatio() and
+@ref MeshTools::averageTransformToVertexRatio(), which can be used to measure
+the effect of @ref MeshTools::tipsifyInPlace() and other optimizations.
 
 The `-i` / `--importer-options` and `-c` / `--converter-options` arguments
 accept a comma-separated list of key/value pairs to set in the importer /
@@ -128,6 +148,13 @@ doesn't support conversion to a file,
 if no `--converter` is specified, @ref Trade::AnySceneConverter "AnySceneConverter"
 is used.
 
+The `--simplify` and `--lods` options expect an indexed triangle mesh. With
+`--lods`, each level of detail is saved to a file named after `output` with
+`.lod1`, `.lod2` and so on inserted before the extension. The ratios are
+relative to the index count after all other processing and are expected to be
+in a decreasing order. The simplification stops at given ratio or when
+reaching the `--simplify-error`, whichever comes first.
+
 @section magnum-sceneconverter-example Example usage
 
 Printing info about all meshes in a glTF file:
@@ -154,6 +181,14 @@ the processing stats:
 magnum-sceneconverter chair.obj --converter MeshOptimizerSceneConverter -c simplify=true,simplifyTargetIndexCountThreshold=0.5 chair.ply -v
 @endcode
 
+Baking three levels of detail with half, a quarter and an eighth of the
+triangles next to the converted mesh, saving `chair.ply`, `chair.lod1.ply`,
+`chair.lod2.ply` and `chair.lod3.ply`:
+
+@code{.sh}
+magnum-sceneconverter chair.obj chair.ply --lods "0.5 0.25 0.125" -v
+@endcode
+
 @see @ref magnum-imageconverter
 */
 
@@ -204,12 +239,17 @@ int main(int argc, char** argv) {
         .addOption("only-attributes").setHelp("only-attributes", "include only attributes of given IDs in the output", "\"i j …\"")
         .addBooleanOption("remove-duplicates").setHelp("remove-duplicates", "remove duplicate vertices in the mesh after import")
         .addOption("remove-duplicates-fuzzy").setHelp("remove-duplicates-fuzzy", "remove duplicate vertices with fuzzy comparison in the mesh after import", "EPSILON")
+        .addOption("simplify").setHelp("simplify", "simplify the mesh to given ratio of its index count", "RATIO")
+        .addOption("lods").setHelp("lods", "generate levels of detail with given ratios of the index count", "\"RATIO RATIO …\"")
+        .addOption("simplify-error", "0.01").setHelp("simplify-error", "max error allowed by --simplify and --lods, relative to the mesh size", "ERROR")
+        .addOption("threads", "1").setHelp("threads", "count of threads to use for processing, 0 for all available", "COUNT")
         .addOption('i', "importer-options").setHelp("importer-options", "configuration options to pass to the importer", "key=val,key2=val2,…")
         .addArrayOption('c', "converter-options").setHelp("converter-options", "configuration options to pass to the converter(s)", "key=val,key2=val2,…")
         .addOption("mesh", "0").setHelp("mesh", "mesh to import")
         .addOption("level", "0").setHelp("level", "mesh level to import")
         .addBooleanOption("info").setHelp("info", "print info about the input file and exit")
         .addBooleanOption("bounds").setHelp("bounds", "show bounds of known attributes in --info output")
+        .addOption("vertex-cache-size", "32").setHelp("vertex-cache-size", "post-transform vertex cache size for vertex cache statistics in --info output", "SIZE")
         .addBooleanOption('v', "verbose").setHelp("verbose", "verbose output from importer and converter plugins")
         .addBooleanOption("profile").setHelp("profile", "measure import and conversion time")
         .setParseErrorCallback([](const Utility::Arguments& args, Utility::Arguments::ParseError error, const std::string& key) {
@@ -223,7 +263,9 @@ int main(int argc, char** argv) {
         .setGlobalHelp(R"(Converts scenes of different formats.
 
 If --info is given, the utility will print information about all meshes and
-images present in the file.
+images present in the file. For indexed triangle meshes it additionally shows
+the average cache miss ratio (ACMR) and average transform to vertex ratio
+(ATVR) for a vertex cache of --vertex-cache-size entries.
 
 The -i / --importer-options and -c / --converter-options arguments accept a
 comma-separated list of key/value pairs to set in the importer / converter
@@ -235,7 +277,14 @@ It's possible to specify the --converter option (and correspondingly also
 together. All converters in the chain have to support the ConvertMesh feature,
 the last converter either ConvertMesh or ConvertMeshToFile. If the last
 converter doesn't support conversion to a file, AnySceneConverter is used to
-save its output; if no --converter is specified, AnySceneConverter is used.)")
+save its output; if no --converter is specified, AnySceneConverter is used.
+
+The --simplify and --lods options expect an indexed triangle mesh. With
+--lods, each level of detail is saved to a file named after the output with
+.lod1, .lod2 and so on inserted before the extension. The ratios are relative
+to the index count after all other processing and are expected to be in a
+decreasing order. The simplification stops at given ratio or when reaching
+the --simplify-error, whichever comes first.)")
         .parse(argc, argv);
 
     PluginManager::Manager<Trade::AbstractImporter> importerManager{
@@ -301,6 +350,7 @@ save its output; if no --converter is specified, AnySceneConverter is used.)")
             MeshIndexType indexType;
             Containers::Array<MeshAttributeInfo> attributes;
             std::size_t indexDataSize, vertexDataSize;
+            Float acmr, atvr;
             std::string name;
         };
 
@@ -385,6 +435,15 @@ save its output; if no --converter is specified, AnySceneConverter is used.)")
                     info.indexCount = mesh->indexCount();
                     info.indexType = mesh->indexType();
                     info.indexDataSize = mesh->indexData().size();
+
+                    /* Vertex cache statistics make sense only for
+                       triangles */
+                    if(mesh->primitive() == MeshPrimitive::Triangles && mesh->indexCount() % 3 == 0) {
+                        const Containers::Array<UnsignedInt> indices = mesh->indicesAsArray();
+                        const UnsignedInt cacheSize = args.value<UnsignedInt>("vertex-cache-size");
+                        info.acmr = MeshTools::averageCacheMissRatio(Containers::arrayView(indices), info.vertexCount, cacheSize);
+                        info.atvr = MeshTools::averageTransformToVertexRatio(Containers::arrayView(indices), info.vertexCount, cacheSize);
+                    }
                 }
                 for(UnsignedInt k = 0; k != mesh->attributeCount(); ++k) {
                     const Trade::MeshAttribute name = mesh->attributeName(k);
@@ -573,6 +632,8 @@ save its output; if no --converter is specified, AnySceneConverter is used.)")
                     << info.indexType << "(" << Debug::nospace
                     << Utility::formatString("{:.1f}", info.indexDataSize/1024.0f)
                     << "kB)";
+                if(info.acmr) d << Debug::newline << "    ACMR" << info.acmr
+                    << Debug::nospace << ", ATVR" << info.atvr;
             }
 
             for(const MeshAttributeInfo& attribute: info.attributes) {
@@ -664,7 +725,7 @@ save its output; if no --converter is specified, AnySceneConverter is used.)")
         const UnsignedInt beforeVertexCount = mesh->vertexCount();
         {
             Duration d{conversionTime};
-            mesh = MeshTools::removeDuplicates(*std::move(mesh));
+            mesh = MeshTools::removeDuplicates(*std::move(mesh), args.value<UnsignedInt>("threads"));
         }
         if(args.isSet("verbose"))
             Debug{} << "Duplicate removal:" << beforeVertexCount << "->" << mesh->vertexCount() << "vertices";
@@ -682,60 +743,117 @@ save its output; if no --converter is specified, AnySceneConverter is used.)")
             Debug{} << "Fuzzy duplicate removal:" << beforeVertexCount << "->" << mesh->vertexCount() << "vertices";
     }
 
+    /* Simplify, if requested */
+    const bool simplify = !args.value("simplify").empty();
+    const bool lods = !args.value("lods").empty();
+    if((simplify || lods) && (!mesh->isIndexed() || mesh->primitive() != MeshPrimitive::Triangles)) {
+        Error{} << "Simplification needs an indexed triangle mesh, got" << (mesh->isIndexed() ? "an indexed" : "a non-indexed") << mesh->primitive();
+        return 8;
+    }
+    if(simplify) {
+        const UnsignedInt beforeIndexCount = mesh->indexCount();
+        {
+            Duration d{conversionTime};
+            mesh = MeshTools::simplify(*mesh, UnsignedInt(beforeIndexCount*args.value<Float>("simplify")), args.value<Float>("simplify-error"));
+        }
+        if(args.isSet("verbose"))
+            Debug{} << "Simplification:" << beforeIndexCount << "->" << mesh->indexCount() << "indices";
+    }
+
+    /* Generate levels of detail, if requested */
+    Containers::Array<Trade::MeshData> levels;
+    if(lods) {
+        Containers::Array<UnsignedInt> targetIndexCounts;
+        for(const std::string& i: Utility::String::splitWithoutEmptyParts(args.value("lods"), ' ')) {
+            const UnsignedInt targetIndexCount = UnsignedInt(mesh->indexCount()*std::stof(i));
+            if(!targetIndexCounts.empty() && targetIndexCount > targetIndexCounts[targetIndexCounts.size() - 1]) {
+                Error{} << "Level of detail ratios are expected to be in a decreasing order, got" << args.value("lods");
+                return 8;
+            }
+            arrayAppend(targetIndexCounts, targetIndexCount);
+        }
+
+        {
+            Duration d{conversionTime};
+            levels = MeshTools::simplifyLods(*mesh, targetIndexCounts, args.value<Float>("simplify-error"));
+        }
+        if(args.isSet("verbose")) {
+            Debug d;
+            d << "Levels of detail:" << mesh->indexCount();
+            for(const Trade::MeshData& level: levels)
+                d << "->" << level.indexCount();
+            d << "indices";
+        }
+    }
+
     /* Load converter plugin */
     PluginManager::Manager<Trade::AbstractSceneConverter> converterManager{
         args.value("plugin-dir").empty() ? std::string{} :
         Utility::Directory::join(args.value("plugin-dir"), Trade::AbstractSceneConverter::pluginSearchPaths()[0])};
 
-    /* Assume there's always one passed --converter option less, and the last
-       is implicitly AnySceneConverter. All converters except the last one are
-       expected to support ConvertMesh and the mesh is "piped" from one to the
-       other. If the last converter supports ConvertMeshToFile instead of
-       ConvertMesh, it's used instead of the last implicit AnySceneConverter. */
-    for(std::size_t i = 0, converterCount = args.arrayValueCount("converter"); i <= converterCount; ++i) {
-        const std::string converterName = i == converterCount ?
-            "AnySceneConverter" : args.arrayValue("converter", i);
-        Containers::Pointer<Trade::AbstractSceneConverter> converter = converterManager.loadAndInstantiate(converterName);
-        if(!converter) {
-            Debug{} << "Available converter plugins:" << Utility::String::join(converterManager.aliasList(), ", ");
-            return 2;
+    /* Save the mesh and then each level of detail, if any, with the level
+       index inserted before the output file extension */
+    for(std::size_t level = 0; level <= levels.size(); ++level) {
+        std::string output = args.value("output");
+        if(level) {
+            mesh = std::move(levels[level - 1]);
+            const std::pair<std::string, std::string> nameExtension = Utility::Directory::splitExtension(output);
+            output = Utility::formatString("{}.lod{}{}", nameExtension.first, level, nameExtension.second);
+            if(args.isSet("verbose"))
+                Debug{} << "Saving level" << level << "to" << output << Debug::nospace << "...";
         }
 
-        /* Set options, if passed */
-        if(args.isSet("verbose")) converter->setFlags(Trade::SceneConverterFlag::Verbose);
-        if(i < args.arrayValueCount("converter-options"))
-            Trade::Implementation::setOptions(*converter, args.arrayValue("converter-options", i));
-
-        /* This is the last --converter (or the implicit AnySceneConverter at
-           the end), output to a file and exit the loop */
-        if(i + 1 >= converterCount && (converter->features() & Trade::SceneConverterFeature::ConvertMeshToFile)) {
-            if(converterCount > 1 && args.isSet("verbose"))
-                Debug{} << "Saving output with" << converterName << Debug::nospace << "...";
-
-            Duration d{conversionTime};
-            if(!converter->convertToFile(args.value("output"), *mesh)) {
-                Error{} << "Cannot save file" << args.value("output");
-                return 5;
+        /* Assume there's always one passed --converter option less, and the
+           last is implicitly AnySceneConverter. All converters except the
+           last one are expected to support ConvertMesh and the mesh is
+           "piped" from one to the other. If the last converter supports
+           ConvertMeshToFile instead of ConvertMesh, it's used instead of the
+           last implicit AnySceneConverter. */
+        for(std::size_t i = 0, converterCount = args.arrayValueCount("converter"); i <= converterCount; ++i) {
+            const std::string converterName = i == converterCount ?
+                "AnySceneConverter" : args.arrayValue("converter", i);
+            Containers::Pointer<Trade::AbstractSceneConverter> converter = converterManager.loadAndInstantiate(converterName);
+            if(!converter) {
+                Debug{} << "Available converter plugins:" << Utility::String::join(converterManager.aliasList(), ", ");
+                return 2;
             }
 
-            break;
+            /* Set options, if passed */
+            if(args.isSet("verbose")) converter->setFlags(Trade::SceneConverterFlag::Verbose);
+            if(i < args.arrayValueCount("converter-options"))
+                Trade::Implementation::setOptions(*converter, args.arrayValue("converter-options", i));
+
+            /* This is the last --converter (or the implicit AnySceneConverter
+               at the end), output to a file and exit the loop */
+            if(i + 1 >= converterCount && (converter->features() & Trade::SceneConverterFeature::ConvertMeshToFile)) {
+                if(converterCount > 1 && args.isSet("verbose"))
+                    Debug{} << "Saving output with" << converterName << Debug::nospace << "...";
+
+                Duration d{conversionTime};
+                if(!converter->convertToFile(output, *mesh)) {
+                    Error{} << "Cannot save file" << output;
+                    return 5;
+                }
 
-        /* This is not the last converter, expect that it's capable of
-           ConvertMesh */
-        } else {
-            CORRADE_INTERNAL_ASSERT(i < converterCount);
-            if(converterCount > 1 && args.isSet("verbose"))
-                Debug{} << "Processing (" << Debug::nospace << (i+1) << Debug::nospace << "/" << Debug::nospace << converterCount << Debug::nospace << ") with" << converterName << Debug::nospace << "...";
+                break;
 
-            if(!(converter->features() & Trade::SceneConverterFeature::ConvertMesh)) {
-                Error{} << converterName << "doesn't support mesh conversion, only" << converter->features();
-                return 6;
-            }
+            /* This is not the last converter, expect that it's capable of
+               ConvertMesh */
+            } else {
+                CORRADE_INTERNAL_ASSERT(i < converterCount);
+                if(converterCount > 1 && args.isSet("verbose"))
+                    Debug{} << "Processing (" << Debug::nospace << (i+1) << Debug::nospace << "/" << Debug::nospace << converterCount << Debug::nospace << ") with" << converterName << Debug::nospace << "...";
 
-            Duration d{conversionTime};
-            if(!(mesh = converter->convert(*mesh))) {
-                Error{} << converterName << "cannot convert the mesh";
-                return 7;
+                if(!(converter->features() & Trade::SceneConverterFeature::ConvertMesh)) {
+                    Error{} << converterName << "doesn't support mesh conversion, only" << converter->features();
+                    return 6;
+                }
+
+                Duration d{conversionTime};
+                if(!(mesh = converter->convert(*mesh))) {
+                    Error{} << converterName << "cannot convert the mesh";
+                    return 7;
+                }
             }
         }
     }
@@ -0,0 +1,226 @@
+#ifndef Magnum_SceneGraph_DrawableBatch_h
+#define Magnum_SceneGraph_DrawableBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::BasicDrawableBatch3D, typedef @ref Magnum::SceneGraph::DrawableBatch3D
+ * @m_since_latest
+ */
+
+#include <utility>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/SceneGraph/SceneGraph.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Batch of drawables for three-dimensional scenes
+@m_since_latest
+
+An alternative to drawing a @ref DrawableGroup with
+@ref Camera::draw(DrawableGroup<dimensions, T>&), suited for large amounts of
+drawables. Absolute transformations, local bounding boxes and sort keys of all
+drawables are stored in contiguous arrays. On @ref draw(), drawables outside
+of the camera frustum are culled, optionally in multiple threads, the
+remaining ones are sorted by their key and drawn in that order.
+
+@snippet MagnumSceneGraph.cpp DrawableBatch-usage
+
+@section SceneGraph-DrawableBatch3D-transformations Drawable transformations
+
+The batch doesn't track changes to the objects, the absolute transformations
+are updated explicitly either from the objects the drawables are attached to
+using @ref updateTransformations() or by filling @ref transformations()
+directly, for example with a subset of
+@ref FlatHierarchy::absoluteTransformations().
+
+@section SceneGraph-DrawableBatch3D-culling Culling and sorting
+
+Each drawable has a bounding box in its local coordinate system. In
+@ref cull(), the box is transformed using the absolute transformation and an
+axis-aligned box enclosing it is tested against the frustum using the same
+method as @ref Math::Intersection::rangeFrustum(). A default-constructed
+bounding box thus behaves like a point at the drawable origin. The visible
+drawables are then sorted by the key passed to @ref add(), with drawables
+having the same key kept in the order they were added. The key is an
+arbitrary 64-bit value, for example combining shader, mesh and material IDs
+so the drawables sharing the same state are drawn together.
+
+If @ref cull() or @ref draw() is called with a thread count other than
+@cpp 1 @ce, the culling pass is split among multiple threads. Small batches
+are always processed on the calling thread.
+
+@section SceneGraph-DrawableBatch3D-explicit-specializations Explicit template specializations
+
+The following specialization is explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref DrawableBatch.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref DrawableBatch3D
+
+@see @ref scenegraph, @ref Drawable, @ref Camera
+*/
+template<class T> class BasicDrawableBatch3D {
+    public:
+        /** @brief Constructor */
+        explicit BasicDrawableBatch3D();
+
+        /** @brief Drawable count */
+        std::size_t size() const { return _drawables.size(); }
+
+        /**
+         * @brief Reserve memory for given drawable count
+         *
+         * Useful to avoid reallocations when the final drawable count is
+         * known upfront.
+         */
+        void reserve(std::size_t capacity);
+
+        /**
+         * @brief Add a drawable
+         * @param drawable  Drawable
+         * @param bounds    Bounding box in the drawable local coordinate
+         *      system
+         * @param sortKey   Key to sort the visible drawables by
+         * @return ID of the drawable in the batch, equal to @ref size()
+         *      before the call
+         *
+         * The drawable has an identity transformation until
+         * @ref updateTransformations() is called or @ref transformations()
+         * are modified.
+         */
+        UnsignedInt add(Drawable<3, T>& drawable, const Math::Range3D<T>& bounds = {}, UnsignedLong sortKey = 0);
+
+        /**
+         * @brief Clear the batch
+         *
+         * Keeps the allocated memory for the next use.
+         */
+        void clear();
+
+        /** @brief Drawables */
+        Containers::ArrayView<Drawable<3, T>* const> drawables() const {
+            return _drawables;
+        }
+
+        /** @brief Drawable bounding boxes in their local coordinate system */
+        Containers::ArrayView<Math::Range3D<T>> bounds() { return _bounds; }
+        Containers::ArrayView<const Math::Range3D<T>> bounds() const { return _bounds; } /**< @overload */
+
+        /** @brief Drawable sort keys */
+        Containers::ArrayView<UnsignedLong> sortKeys() { return _sortKeys; }
+        Containers::ArrayView<const UnsignedLong> sortKeys() const { return _sortKeys; } /**< @overload */
+
+        /**
+         * @brief Absolute drawable transformations
+         *
+         * Can be filled directly or using @ref updateTransformations().
+         */
+        Containers::ArrayView<Math::Matrix4<T>> transformations() { return _transformations; }
+        Containers::ArrayView<const Math::Matrix4<T>> transformations() const { return _transformations; } /**< @overload */
+
+        /**
+         * @brief Update transformations from drawable objects
+         *
+         * Fills @ref transformations() with absolute transformations of
+         * objects the drawables are attached to, calculated with
+         * @ref AbstractObject::transformationMatrices(). Expects that all
+         * objects are part of the same scene.
+         */
+        void updateTransformations();
+
+        /**
+         * @brief Cull the drawables
+         * @param frustum       Frustum in the same coordinate system as
+         *      @ref transformations()
+         * @param threadCount   Count of threads to use. @cpp 0 @ce means
+         *      all hardware threads.
+         * @return Count of visible drawables
+         *
+         * Fills @ref visible() with IDs of drawables intersecting the
+         * frustum, sorted by their key. See
+         * @ref SceneGraph-DrawableBatch3D-culling for more information.
+         */
+        std::size_t cull(const Math::Frustum<T>& frustum, UnsignedInt threadCount = 1);
+
+        /**
+         * @brief IDs of visible drawables
+         *
+         * Sorted by their key, filled by @ref cull() or @ref draw().
+         */
+        Containers::ArrayView<const UnsignedInt> visible() const {
+            return _visible.prefix(_visibleCount);
+        }
+
+        /**
+         * @brief Draw the batch using given camera
+         * @param camera        Camera
+         * @param threadCount   Count of threads to use for culling. @cpp 0 @ce
+         *      means all hardware threads.
+         * @return Count of drawn drawables
+         *
+         * Cleans the camera object, calls @ref cull() with the camera
+         * frustum in the scene coordinate system and then calls
+         * @ref Drawable::draw() on all @ref visible() drawables with their
+         * transformation relative to the camera.
+         */
+        std::size_t draw(Camera<3, T>& camera, UnsignedInt threadCount = 1);
+
+    private:
+        void MAGNUM_SCENEGRAPH_LOCAL cullRange(const Math::Frustum<T>& frustum, std::size_t begin, std::size_t end);
+
+        Containers::Array<Drawable<3, T>*> _drawables;
+        Containers::Array<Math::Range3D<T>> _bounds;
+        Containers::Array<UnsignedLong> _sortKeys;
+        Containers::Array<Math::Matrix4<T>> _transformations;
+
+        /* Per-drawable visibility written by the culling threads, and then
+           the compacted and sorted IDs of visible drawables */
+        Containers::Array<bool> _visibleFlags;
+        Containers::Array<std::pair<UnsignedLong, UnsignedInt>> _sortScratch;
+        Containers::Array<UnsignedInt> _visible;
+        std::size_t _visibleCount;
+};
+
+/**
+@brief Batch of drawables for three-dimensional float scenes
+@m_since_latest
+*/
+typedef BasicDrawableBatch3D<Float> DrawableBatch3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !(defined(CORRADE_TARGET_MINGW) && !defined(CORRADE_TARGET_CLANG))
+extern template class MAGNUM_SCENEGRAPH_EXPORT BasicDrawableBatch3D<Float>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,152 @@
+#ifndef Magnum_SceneGraph_DrawableBatch_hpp
+#define Magnum_SceneGraph_DrawableBatch_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref DrawableBatch.h
+ * @m_since_latest
+ */
+
+#include <algorithm>
+#include <vector>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/SceneGraph/AbstractObject.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/DrawableBatch.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<class T> BasicDrawableBatch3D<T>::BasicDrawableBatch3D(): _visibleCount{} {}
+
+template<class T> void BasicDrawableBatch3D<T>::reserve(const std::size_t capacity) {
+    arrayReserve(_drawables, capacity);
+    arrayReserve(_bounds, capacity);
+    arrayReserve(_sortKeys, capacity);
+    arrayReserve(_transformations, capacity);
+}
+
+template<class T> UnsignedInt BasicDrawableBatch3D<T>::add(Drawable<3, T>& drawable, const Math::Range3D<T>& bounds, const UnsignedLong sortKey) {
+    const UnsignedInt id = _drawables.size();
+    arrayAppend(_drawables, &drawable);
+    arrayAppend(_bounds, bounds);
+    arrayAppend(_sortKeys, sortKey);
+    arrayAppend(_transformations, Math::Matrix4<T>{});
+    return id;
+}
+
+template<class T> void BasicDrawableBatch3D<T>::clear() {
+    arrayResize(_drawables, 0);
+    arrayResize(_bounds, 0);
+    arrayResize(_sortKeys, 0);
+    arrayResize(_transformations, 0);
+    _visibleCount = 0;
+}
+
+template<class T> void BasicDrawableBatch3D<T>::updateTransformations() {
+    if(_drawables.empty()) return;
+
+    AbstractObject<3, T>* scene = _drawables[0]->object().scene();
+    CORRADE_ASSERT(scene, "SceneGraph::DrawableBatch3D::updateTransformations(): the drawables are not part of any scene", );
+
+    std::vector<std::reference_wrapper<AbstractObject<3, T>>> objects;
+    objects.reserve(_drawables.size());
+    for(Drawable<3, T>* drawable: _drawables)
+        objects.push_back(drawable->object());
+    const std::vector<Math::Matrix4<T>> transformations = scene->transformationMatrices(objects);
+
+    /* The call asserts if the objects are not in the same scene */
+    if(transformations.size() != _transformations.size()) return;
+    std::copy(transformations.begin(), transformations.end(), _transformations.begin());
+}
+
+template<class T> void BasicDrawableBatch3D<T>::cullRange(const Math::Frustum<T>& frustum, const std::size_t begin, const std::size_t end) {
+    for(std::size_t i = begin; i != end; ++i) {
+        /* Axis-aligned box enclosing the transformed bounding box. The center
+           is transformed as a point, the half-extents by absolute values of
+           the rotation/scaling part. */
+        const Math::Matrix4<T>& transformation = _transformations[i];
+        const Math::Vector3<T> center = transformation.transformPoint(_bounds[i].center());
+        const Math::Vector3<T> halfSize = _bounds[i].size()/T(2);
+        const Math::Vector3<T> extents =
+            Math::abs(transformation[0].xyz())*halfSize.x() +
+            Math::abs(transformation[1].xyz())*halfSize.y() +
+            Math::abs(transformation[2].xyz())*halfSize.z();
+
+        _visibleFlags[i] = Math::Intersection::aabbFrustum(center, extents, frustum);
+    }
+}
+
+template<class T> std::size_t BasicDrawableBatch3D<T>::cull(const Math::Frustum<T>& frustum, const UnsignedInt threadCount) {
+    if(_visibleFlags.size() < _drawables.size())
+        arrayResize(_visibleFlags, Containers::NoInit, _drawables.size());
+
+    /* Calculate visibility of all drawables, in parallel if requested */
+    struct State {
+        BasicDrawableBatch3D<T>& batch;
+        const Math::Frustum<T>& frustum;
+    } state{*this, frustum};
+    /* Culling a single drawable is cheap, so don't spawn threads for small
+       batches */
+    Magnum::Implementation::parallelFor(_drawables.size(), threadCount, 8192, [](void* state, std::size_t begin, std::size_t end) {
+        State& s = *static_cast<State*>(state);
+        s.batch.cullRange(s.frustum, begin, end);
+    }, &state);
+
+    /* Compact the visible drawables together with their keys and sort them.
+       The ID is a secondary key to keep the order stable. */
+    arrayResize(_sortScratch, 0);
+    for(std::size_t i = 0; i != _drawables.size(); ++i)
+        if(_visibleFlags[i]) arrayAppend(_sortScratch, {_sortKeys[i], UnsignedInt(i)});
+    std::sort(_sortScratch.begin(), _sortScratch.end());
+
+    if(_visible.size() < _sortScratch.size())
+        arrayResize(_visible, Containers::NoInit, _sortScratch.size());
+    for(std::size_t i = 0; i != _sortScratch.size(); ++i)
+        _visible[i] = _sortScratch[i].second;
+    return _visibleCount = _sortScratch.size();
+}
+
+template<class T> std::size_t BasicDrawableBatch3D<T>::draw(Camera<3, T>& camera, const UnsignedInt threadCount) {
+    /* Compute camera matrix */
+    camera.object().setClean();
+    const Math::Matrix4<T> cameraMatrix = camera.cameraMatrix();
+
+    /* Culling is done in the scene coordinate system */
+    cull(Math::Frustum<T>::fromMatrix(camera.projectionMatrix()*cameraMatrix), threadCount);
+
+    for(const UnsignedInt i: visible())
+        _drawables[i]->draw(cameraMatrix*_transformations[i], camera);
+    return _visibleCount;
+}
+
+}}
+
+#endif
@@ -0,0 +1,74 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "FlatHierarchy.hpp"
+
+#include "Magnum/Implementation/parallelFor.h"
+
+namespace Magnum { namespace SceneGraph { namespace Implementation {
+
+void flatHierarchyLevels(const Containers::ArrayView<const UnsignedInt> depths, Containers::Array<UnsignedInt>& levelOrder, Containers::Array<UnsignedInt>& levelOffsets) {
+    /* Count nodes in each level, shifted by one */
+    arrayResize(levelOffsets, 0);
+    for(const UnsignedInt depth: depths) {
+        if(depth + 2 > levelOffsets.size())
+            arrayResize(levelOffsets, Containers::DirectInit, depth + 2, 0u);
+        ++levelOffsets[depth + 1];
+    }
+
+    /* Convert the counts to offsets */
+    for(std::size_t i = 1; i < levelOffsets.size(); ++i)
+        levelOffsets[i] += levelOffsets[i - 1];
+
+    /* Distribute the node IDs, which keeps them sorted inside each level */
+    Containers::Array<UnsignedInt> levelPositions{Containers::NoInit, levelOffsets.size()};
+    for(std::size_t i = 0; i != levelPositions.size(); ++i)
+        levelPositions[i] = levelOffsets[i];
+    arrayResize(levelOrder, Containers::NoInit, depths.size());
+    for(std::size_t i = 0; i != depths.size(); ++i)
+        levelOrder[levelPositions[depths[i]]++] = i;
+}
+
+void flatHierarchyUpdate(const Containers::ArrayView<const UnsignedInt> levelOrder, const Containers::ArrayView<const UnsignedInt> levelOffsets, const std::size_t dirtyBegin, const UnsignedInt threadCount, void(*const update)(void*, std::size_t), void* const state) {
+    for(std::size_t level = 0; level + 1 < levelOffsets.size(); ++level) {
+        const Containers::ArrayView<const UnsignedInt> nodes = levelOrder.slice(levelOffsets[level], levelOffsets[level + 1]);
+
+        /* Split the level among threads only if it's large enough, otherwise
+           spawning the threads would cost more than the calculation itself */
+        struct LevelState {
+            Containers::ArrayView<const UnsignedInt> nodes;
+            std::size_t dirtyBegin;
+            void(*update)(void*, std::size_t);
+            void* state;
+        } levelState{nodes, dirtyBegin, update, state};
+        Magnum::Implementation::parallelFor(nodes.size(), threadCount, 4096, [](void* state, const std::size_t begin, const std::size_t end) {
+            const LevelState& s = *static_cast<const LevelState*>(state);
+            for(std::size_t i = begin; i != end; ++i)
+                if(s.nodes[i] >= s.dirtyBegin) s.update(s.state, s.nodes[i]);
+        }, &levelState);
+    }
+}
+
+}}}
@@ -0,0 +1,261 @@
+#ifndef Magnum_SceneGraph_FlatHierarchy_h
+#define Magnum_SceneGraph_FlatHierarchy_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::FlatHierarchy, alias @ref Magnum::SceneGraph::BasicFlatHierarchy2D, @ref Magnum::SceneGraph::BasicFlatHierarchy3D, typedef @ref Magnum::SceneGraph::FlatHierarchy2D, @ref Magnum::SceneGraph::FlatHierarchy3D
+ * @m_since_latest
+ */
+
+#include <functional>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/SceneGraph/SceneGraph.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Flat transformation hierarchy
+@m_since_latest
+
+A data-oriented alternative to the @ref Object tree, storing parent indices,
+local and absolute transformations of all nodes in contiguous arrays. A node
+can be added only after its parent, so the nodes are always sorted
+topologically and absolute transformations of all nodes are calculated in a
+single linear pass over the arrays, without any pointer chasing or virtual
+calls:
+
+@snippet MagnumSceneGraph.cpp FlatHierarchy-usage
+
+@section SceneGraph-FlatHierarchy-dirty Dirty tracking
+
+Calling @ref setTransformation() marks the node dirty. The next
+@ref setClean() call then recalculates absolute transformations only for the
+dirty nodes and their descendants, and the pass starts at the first dirty
+node --- as children are always after their parents, nodes before it can't be
+affected. Modifying transformations of nodes added last is thus the cheapest.
+
+@section SceneGraph-FlatHierarchy-multithreading Multithreaded update
+
+If @ref setClean() is called with a thread count other than @cpp 1 @ce, the
+nodes are processed level by level, with nodes of each level split among the
+threads. The level order is calculated on first such call after the topology
+changed. Levels with too few nodes are processed on the calling thread, so
+it's beneficial mainly for wide hierarchies with many nodes.
+
+@section SceneGraph-FlatHierarchy-drawables Use with drawables
+
+Drawables are attached to objects, but nothing prevents them from being
+attached to a single placeholder object and their transformations taken from
+the flat hierarchy instead. The @ref drawableTransformations() function
+combines a list of drawables and node IDs with absolute transformations of
+given nodes relative to a camera. The result can be passed directly to
+@ref Camera::draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>&):
+
+@snippet MagnumSceneGraph.cpp FlatHierarchy-drawables
+
+@section SceneGraph-FlatHierarchy-explicit-specializations Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref FlatHierarchy.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref FlatHierarchy2D
+-   @ref FlatHierarchy3D
+
+@see @ref scenegraph, @ref BasicFlatHierarchy2D, @ref BasicFlatHierarchy3D
+*/
+template<UnsignedInt dimensions, class T> class FlatHierarchy {
+    public:
+        /** @brief Matrix type */
+        typedef MatrixTypeFor<dimensions, T> MatrixType;
+
+        /** @brief Constructor */
+        explicit FlatHierarchy();
+
+        /** @brief Node count */
+        std::size_t size() const { return _parents.size(); }
+
+        /**
+         * @brief Reserve memory for given node count
+         *
+         * Useful to avoid reallocations when the final node count is known
+         * upfront.
+         */
+        void reserve(std::size_t capacity);
+
+        /**
+         * @brief Add a node
+         * @param parent            Parent node ID or @cpp -1 @ce for a root
+         *      node
+         * @param transformation    Transformation relative to the parent
+         * @return ID of the newly added node, equal to @ref size() before
+         *      the call
+         *
+         * Expects that @p parent is either @cpp -1 @ce or less than
+         * @ref size(). The node is marked as dirty.
+         */
+        UnsignedInt add(Int parent, const MatrixType& transformation = MatrixType{});
+
+        /**
+         * @brief Parent node IDs
+         *
+         * Root nodes have the parent set to @cpp -1 @ce, the other have it
+         * always less than their own ID.
+         */
+        Containers::ArrayView<const Int> parents() const { return _parents; }
+
+        /** @brief Node transformations relative to their parents */
+        Containers::ArrayView<const MatrixType> transformations() const {
+            return _transformations;
+        }
+
+        /**
+         * @brief Set node transformation relative to its parent
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p id is less than @ref size(). Marks the node as
+         * dirty.
+         */
+        FlatHierarchy<dimensions, T>& setTransformation(UnsignedInt id, const MatrixType& transformation);
+
+        /**
+         * @brief Absolute node transformations
+         *
+         * Contents are up-to-date only if @ref isDirty() is @cpp false @ce,
+         * otherwise call @ref setClean() first.
+         */
+        Containers::ArrayView<const MatrixType> absoluteTransformations() const {
+            return _absoluteTransformations;
+        }
+
+        /**
+         * @brief Whether any absolute transformation is dirty
+         *
+         * @see @ref setClean()
+         */
+        bool isDirty() const { return _dirtyBegin != _parents.size(); }
+
+        /**
+         * @brief Recalculate dirty absolute transformations
+         * @param threadCount   Count of threads to use. @cpp 0 @ce means
+         *      all hardware threads.
+         *
+         * Updates @ref absoluteTransformations() of all dirty nodes and their
+         * descendants. If the hierarchy isn't dirty, the function does
+         * nothing. See @ref SceneGraph-FlatHierarchy-multithreading for more
+         * information about the @p threadCount parameter.
+         * @see @ref isDirty()
+         */
+        void setClean(UnsignedInt threadCount = 1);
+
+        /**
+         * @brief Combine drawables with absolute transformations of given nodes
+         * @param drawables     Drawables and IDs of nodes they're attached to
+         * @param cameraMatrix  Camera matrix, applied on the left-most side
+         *      of each transformation
+         *
+         * Calls @ref setClean() and then returns each drawable together with
+         * absolute transformation of its node relative to the camera. Expects
+         * that all node IDs are less than @ref size(). The result is meant to
+         * be passed to @ref Camera::draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>&),
+         * @p cameraMatrix is usually @ref Camera::cameraMatrix() or an
+         * inverse absolute transformation of a node containing the camera.
+         */
+        std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixType>> drawableTransformations(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, UnsignedInt>>& drawables, const MatrixType& cameraMatrix);
+
+    private:
+        void MAGNUM_SCENEGRAPH_LOCAL updateNode(std::size_t id);
+
+        Containers::Array<Int> _parents;
+        Containers::Array<UnsignedInt> _depths;
+        Containers::Array<MatrixType> _transformations;
+        Containers::Array<MatrixType> _absoluteTransformations;
+        /* Set for nodes with a modified transformation, during setClean()
+           reused for marking nodes whose absolute transformation changed */
+        Containers::Array<bool> _dirty;
+        /* ID of the first dirty node, size() if not dirty */
+        std::size_t _dirtyBegin;
+
+        /* Node IDs sorted by depth and offsets of each level in it, used for
+           the multithreaded update. Recalculated after the topology changes,
+           which is signalized by _levelOffsets being empty. */
+        Containers::Array<UnsignedInt> _levelOrder;
+        Containers::Array<UnsignedInt> _levelOffsets;
+};
+
+/**
+@brief Flat transformation hierarchy for two-dimensional scenes
+@m_since_latest
+
+Convenience alternative to @cpp FlatHierarchy<2, T> @ce. See
+@ref FlatHierarchy for more information.
+@see @ref FlatHierarchy2D, @ref BasicFlatHierarchy3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatHierarchy2D = FlatHierarchy<2, T>;
+#endif
+
+/**
+@brief Flat transformation hierarchy for two-dimensional float scenes
+@m_since_latest
+
+@see @ref FlatHierarchy3D
+*/
+typedef BasicFlatHierarchy2D<Float> FlatHierarchy2D;
+
+/**
+@brief Flat transformation hierarchy for three-dimensional scenes
+@m_since_latest
+
+Convenience alternative to @cpp FlatHierarchy<3, T> @ce. See
+@ref FlatHierarchy for more information.
+@see @ref FlatHierarchy3D, @ref BasicFlatHierarchy2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatHierarchy3D = FlatHierarchy<3, T>;
+#endif
+
+/**
+@brief Flat transformation hierarchy for three-dimensional float scenes
+@m_since_latest
+
+@see @ref FlatHierarchy2D
+*/
+typedef BasicFlatHierarchy3D<Float> FlatHierarchy3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !(defined(CORRADE_TARGET_MINGW) && !defined(CORRADE_TARGET_CLANG))
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatHierarchy<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatHierarchy<3, Float>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,145 @@
+#ifndef Magnum_SceneGraph_FlatHierarchy_hpp
+#define Magnum_SceneGraph_FlatHierarchy_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref FlatHierarchy.h
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/FlatHierarchy.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+    /* Sorts node IDs by their depth, filling levelOrder and levelOffsets */
+    MAGNUM_SCENEGRAPH_EXPORT void flatHierarchyLevels(Containers::ArrayView<const UnsignedInt> depths, Containers::Array<UnsignedInt>& levelOrder, Containers::Array<UnsignedInt>& levelOffsets);
+
+    /* Calls update() for all nodes in levelOrder with ID at least
+       dirtyBegin, level by level, with large levels split among threads */
+    MAGNUM_SCENEGRAPH_EXPORT void flatHierarchyUpdate(Containers::ArrayView<const UnsignedInt> levelOrder, Containers::ArrayView<const UnsignedInt> levelOffsets, std::size_t dirtyBegin, UnsignedInt threadCount, void(*update)(void*, std::size_t), void* state);
+}
+
+template<UnsignedInt dimensions, class T> FlatHierarchy<dimensions, T>::FlatHierarchy(): _dirtyBegin{} {}
+
+template<UnsignedInt dimensions, class T> void FlatHierarchy<dimensions, T>::reserve(const std::size_t capacity) {
+    arrayReserve(_parents, capacity);
+    arrayReserve(_depths, capacity);
+    arrayReserve(_transformations, capacity);
+    arrayReserve(_absoluteTransformations, capacity);
+    arrayReserve(_dirty, capacity);
+}
+
+template<UnsignedInt dimensions, class T> UnsignedInt FlatHierarchy<dimensions, T>::add(const Int parent, const MatrixType& transformation) {
+    CORRADE_ASSERT(parent >= -1 && parent < Int(_parents.size()),
+        "SceneGraph::FlatHierarchy::add(): parent index" << parent << "out of range for" << _parents.size() << "nodes", {});
+
+    /* If the hierarchy was clean, _dirtyBegin is equal to the new ID and thus
+       points to the new node, otherwise it stays pointing to an earlier one */
+    const UnsignedInt id = _parents.size();
+    arrayAppend(_parents, parent);
+    arrayAppend(_depths, parent == -1 ? 0 : _depths[parent] + 1);
+    arrayAppend(_transformations, transformation);
+    arrayAppend(_absoluteTransformations, Containers::NoInit, 1);
+    arrayAppend(_dirty, true);
+
+    /* Level order needs to be recalculated */
+    arrayResize(_levelOffsets, 0);
+    return id;
+}
+
+template<UnsignedInt dimensions, class T> FlatHierarchy<dimensions, T>& FlatHierarchy<dimensions, T>::setTransformation(const UnsignedInt id, const MatrixType& transformation) {
+    CORRADE_ASSERT(id < _parents.size(),
+        "SceneGraph::FlatHierarchy::setTransformation(): index" << id << "out of range for" << _parents.size() << "nodes", *this);
+
+    _transformations[id] = transformation;
+    _dirty[id] = true;
+    if(id < _dirtyBegin) _dirtyBegin = id;
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> void FlatHierarchy<dimensions, T>::updateNode(const std::size_t id) {
+    /* A node needs to be updated if its own transformation changed or if its
+       parent got updated. Nodes before the first dirty one can't be affected
+       and their dirty flag is always false, so it can be used to mark updated
+       nodes as well. */
+    const Int parent = _parents[id];
+    if(parent == -1) {
+        if(_dirty[id]) _absoluteTransformations[id] = _transformations[id];
+    } else if(_dirty[id] || _dirty[parent]) {
+        _absoluteTransformations[id] = _absoluteTransformations[parent]*_transformations[id];
+        _dirty[id] = true;
+    }
+}
+
+template<UnsignedInt dimensions, class T> void FlatHierarchy<dimensions, T>::setClean(const UnsignedInt threadCount) {
+    /* Nothing to do */
+    if(!isDirty()) return;
+
+    /* Multithreaded update, level by level so parents are always done before
+       their children */
+    const std::size_t dirtyBegin = _dirtyBegin;
+    if(threadCount != 1) {
+        if(_levelOffsets.empty())
+            Implementation::flatHierarchyLevels(_depths, _levelOrder, _levelOffsets);
+        Implementation::flatHierarchyUpdate(_levelOrder, _levelOffsets, dirtyBegin, threadCount, [](void* state, std::size_t id) {
+            static_cast<FlatHierarchy<dimensions, T>*>(state)->updateNode(id);
+        }, this);
+
+    /* Single-threaded, just a linear pass from the first dirty node */
+    } else for(std::size_t i = dirtyBegin; i != _parents.size(); ++i)
+        updateNode(i);
+
+    /* Reset the dirty flags back */
+    for(std::size_t i = dirtyBegin; i != _dirty.size(); ++i)
+        _dirty[i] = false;
+    _dirtyBegin = _parents.size();
+}
+
+template<UnsignedInt dimensions, class T> auto FlatHierarchy<dimensions, T>::drawableTransformations(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, UnsignedInt>>& drawables, const MatrixType& cameraMatrix) -> std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixType>> {
+    setClean();
+
+    std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixType>> combined;
+    combined.reserve(drawables.size());
+    for(const std::pair<std::reference_wrapper<Drawable<dimensions, T>>, UnsignedInt>& drawable: drawables) {
+        CORRADE_ASSERT(drawable.second < _parents.size(),
+            "SceneGraph::FlatHierarchy::drawableTransformations(): index" << drawable.second << "out of range for" << _parents.size() << "nodes", {});
+        combined.emplace_back(drawable.first, cameraMatrix*_absoluteTransformations[drawable.second]);
+    }
+
+    return combined;
+}
+
+}}
+
+#endif
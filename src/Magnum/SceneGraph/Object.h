@@ -40,8 +40,7 @@ namespace Magnum { namespace SceneGraph {
 namespace Implementation {
     enum class ObjectFlag: UnsignedByte {
         Dirty = 1 << 0,
-        Visited = 1 << 1,
-        Joint = 1 << 2
+        Visited = 1 << 1
     };
 
     typedef Containers::EnumSet<ObjectFlag> ObjectFlags;
@@ -291,6 +290,16 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
          * @p finalTransformation, if specified (it gets applied on the
          * left-most side, suitable for example for an inverse camera
          * transformation).
+         *
+         * The objects don't need to be children of this object, only part of
+         * the same tree, which doesn't need to be a @ref Scene. Each object
+         * on the paths from the objects and this object to their nearest
+         * common ancestor is visited only once, so the operation is linear in
+         * the count of objects involved, with no limit on the object count.
+         * If this object isn't the common ancestor, the result is
+         * additionally multiplied with inverse transformation of this object
+         * relative to it. Objects can appear in the list more than once.
+         * Expects that all objects are part of the same tree as this object.
          * @see @ref transformationMatrices()
          */
         /* `objects` passed by copy intentionally (to allow move from
@@ -388,8 +397,6 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
 
         std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& finalTransformationMatrix) const override final;
 
-        typename Transformation::DataType MAGNUM_SCENEGRAPH_LOCAL computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& finalTransformation) const;
-
         bool MAGNUM_SCENEGRAPH_LOCAL doIsDirty() const override final { return isDirty(); }
         void MAGNUM_SCENEGRAPH_LOCAL doSetDirty() override final { setDirty(); }
         void MAGNUM_SCENEGRAPH_LOCAL doSetClean() override final { setClean(); }
@@ -399,7 +406,9 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
 
         typedef Implementation::ObjectFlag Flag;
         typedef Implementation::ObjectFlags Flags;
-        UnsignedShort counter;
+        /* Slot index used by transformations(), ~UnsignedInt{} outside of it.
+           Mutable to allow transformations() on const objects. */
+        mutable UnsignedInt counter;
         Flags flags;
 };
 
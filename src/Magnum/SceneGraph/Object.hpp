@@ -31,6 +31,7 @@
 
 #include <algorithm>
 #include <stack>
+#include <Corrade/Containers/GrowableArray.h>
 
 #include "Magnum/SceneGraph/AbstractTransformation.h"
 #include "Magnum/SceneGraph/Object.h"
@@ -43,7 +44,7 @@ template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>::~Abstra
 
 template<UnsignedInt dimensions, class T> AbstractTransformation<dimensions, T>::AbstractTransformation() {}
 
-template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): counter(0xFFFFu), flags(Flag::Dirty) {
+template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): counter{~UnsignedInt{}}, flags{Flag::Dirty} {
     setParent(parent);
 }
 
@@ -189,149 +190,144 @@ template<class Transformation> auto Object<Transformation>::transformationMatric
 }
 
 /*
-Computing absolute transformations for given list of objects
-
-The goal is to compute absolute transformation only once for each object
-involved. Objects contained in the subtree specified by `object` list are
-divided into two groups:
- - "joints", which are either part of `object` list or they have more than one
-   child in the subtree
- - "non-joints", i.e. paths between joints
-
-Then for all joints their transformation (relative to parent joint) is
-computed and recursively concatenated together. Resulting transformations for
-joints which were originally in `object` list is then returned.
+Computing transformations for given list of objects
+
+The goal is to compute transformation of each object involved only once and
+without any limit on the object count. The `objects` list together with this
+object are the "start" objects. Each of them is walked up the hierarchy until
+an already discovered object or the root is reached, giving every newly
+discovered object a slot in the scratch arrays (the only per-object state is
+the slot index, which is reset at the end). Every object is thus visited
+exactly once and the walks form "segments" in which a parent always directly
+follows its child, except for the last object in the segment, whose parent is
+in some earlier segment.
+
+The first segment is the path from this object to the root. The nearest
+common ancestor of all start objects is then the top-most object on this path
+that either is a start object or has more than one discovered child --- all
+objects above it have just a single child and thus lie on paths of all start
+objects. Transformations are computed relative to the common ancestor by
+going through the segments in order and each segment from its end, so a
+parent is always computed before its children. If this object is the common
+ancestor (which is always the case for a scene), the final transformation is
+applied right at the common ancestor, otherwise the result is multiplied with
+inverse transformation of this object relative to the common ancestor.
 */
 template<class Transformation> std::vector<typename Transformation::DataType> Object<Transformation>::transformations(std::vector<std::reference_wrapper<Object<Transformation>>> objects, const typename Transformation::DataType& finalTransformation) const {
-    CORRADE_ASSERT(objects.size() < 0xFFFFu, "SceneGraph::Object::transformations(): too large scene", {});
-
-    /* Remember object count for later */
-    std::size_t objectCount = objects.size();
-
-    /* Mark all original objects as joints and create initial list of joints
-       from them */
-    for(std::size_t i = 0; i != objects.size(); ++i) {
-        /* Multiple occurences of one object in the array, don't overwrite it
-           with different counter */
-        if(objects[i].get().counter != 0xFFFFu) continue;
-
-        objects[i].get().counter = UnsignedShort(i);
-        objects[i].get().flags |= Flag::Joint;
-    }
-    std::vector<std::reference_wrapper<Object<Transformation>>> jointObjects(objects);
-
-    #ifndef CORRADE_NO_ASSERT
-    /* Scene object */
-    const Scene<Transformation>* scene = this->scene();
-    #endif
-
-    /* Nearest common ancestor not yet implemented - assert this is done on scene */
-    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", {});
+    /* Nothing to do, don't even bother walking up from this object */
+    if(objects.empty()) return {};
+
+    /* Discovered objects, their parent slots and count of discovered children.
+       Segments are delimited by offsets in segmentEnds. */
+    Containers::Array<const Object<Transformation>*> slotObjects;
+    Containers::Array<UnsignedInt> slotParents;
+    Containers::Array<UnsignedInt> slotChildCounts;
+    Containers::Array<bool> slotStart;
+    Containers::Array<UnsignedInt> segmentEnds;
+    arrayReserve(slotObjects, objects.size() + 1);
+    arrayReserve(slotParents, objects.size() + 1);
+    arrayReserve(slotChildCounts, objects.size() + 1);
+    arrayReserve(slotStart, objects.size() + 1);
+    arrayReserve(segmentEnds, objects.size() + 1);
+
+    /* Walk up from given object until an already discovered object or the
+       root is found. Returns false if a root different from the root of this
+       object was found. */
+    const auto walk = [&](const Object<Transformation>& start) {
+        const Object<Transformation>* o = &start;
+        /* If continuing up the hierarchy, the object has one discovered child
+           already */
+        UnsignedInt childCount = 0;
+        while(o->counter == ~UnsignedInt{}) {
+            const UnsignedInt slot = slotObjects.size();
+            o->counter = slot;
+            arrayAppend(slotObjects, o);
+            arrayAppend(slotParents, ~UnsignedInt{});
+            arrayAppend(slotChildCounts, childCount);
+            arrayAppend(slotStart, false);
+
+            /* Reached a root. If this is not the walk from this object, the
+               root is different from the one this object is in. */
+            const Object<Transformation>* const parent = o->parent();
+            if(!parent) {
+                if(!segmentEnds.empty()) return false;
+                break;
+            }
 
-    /* Mark all objects up the hierarchy as visited */
-    auto it = objects.begin();
-    while(!objects.empty()) {
-        /* Already visited, remove and continue to next (duplicate occurence) */
-        if(it->get().flags & Flag::Visited) {
-            it = objects.erase(it);
-            continue;
-        }
+            /* Parent not discovered yet, it gets the next slot */
+            if(parent->counter == ~UnsignedInt{}) {
+                slotParents[slot] = slot + 1;
+                childCount = 1;
 
-        /* Mark the object as visited */
-        it->get().flags |= Flag::Visited;
-
-        Object<Transformation>* parent = it->get().parent();
-
-        /* If this is root object, remove from list */
-        if(!parent) {
-            CORRADE_ASSERT(&it->get() == scene, "SceneGraph::Object::transformations(): the objects are not part of the same tree", {});
-            it = objects.erase(it);
-
-        /* Parent is an joint or already visited - remove current from list */
-        } else if(parent->flags & (Flag::Visited|Flag::Joint)) {
-            it = objects.erase(it);
-
-            /* If not already marked as joint, mark it as such and add it to
-               list of joint objects */
-            if(!(parent->flags & Flag::Joint)) {
-                CORRADE_ASSERT(jointObjects.size() < 0xFFFFu,
-                               "SceneGraph::Object::transformations(): too large scene", {});
-                CORRADE_INTERNAL_ASSERT(parent->counter == 0xFFFFu);
-                parent->counter = UnsignedShort(jointObjects.size());
-                parent->flags |= Flag::Joint;
-                jointObjects.push_back(*parent);
+            /* Parent discovered by some earlier walk, done */
+            } else {
+                slotParents[slot] = parent->counter;
+                ++slotChildCounts[parent->counter];
             }
 
-        /* Else go up the hierarchy */
-        } else *it = *parent;
+            o = parent;
+        }
 
-        /* Cycle if reached end */
-        if(it == objects.end()) it = objects.begin();
+        slotStart[start.counter] = true;
+        arrayAppend(segmentEnds, UnsignedInt(slotObjects.size()));
+        return true;
+    };
+
+    /* Resets the slot indices back so the objects can be used again */
+    const auto cleanup = [&]() {
+        for(const Object<Transformation>* o: slotObjects)
+            o->counter = ~UnsignedInt{};
+    };
+
+    walk(*this);
+    for(Object<Transformation>& object: objects) {
+        #ifndef CORRADE_NO_ASSERT
+        if(!walk(object)) {
+            cleanup();
+            CORRADE_ASSERT_UNREACHABLE("SceneGraph::Object::transformations(): the objects are not part of the same tree", {});
+        }
+        #else
+        walk(object);
+        #endif
     }
 
-    /* Array of absolute transformations in joints */
-    std::vector<typename Transformation::DataType> jointTransformations(jointObjects.size());
-
-    /* Compute transformations for all joints */
-    for(std::size_t i = 0; i != jointTransformations.size(); ++i)
-        computeJointTransformation(jointObjects, jointTransformations, i, finalTransformation);
-
-    /* Copy transformation for second or next occurences from first occurence
-       of duplicate object */
-    for(std::size_t i = 0; i != objectCount; ++i) {
-        if(jointObjects[i].get().counter != i)
-            jointTransformations[i] = jointTransformations[jointObjects[i].get().counter];
+    /* Find the nearest common ancestor, going from the root down the path to
+       this object */
+    UnsignedInt commonAncestor = segmentEnds[0] - 1;
+    while(!slotStart[commonAncestor] && slotChildCounts[commonAncestor] == 1)
+        --commonAncestor;
+
+    /* Compute transformations relative to the common ancestor, parents always
+       before children. If this object is the common ancestor, the final
+       transformation can be applied right at the start. */
+    const UnsignedInt thisSlot = counter;
+    Containers::Array<typename Transformation::DataType> slotTransformations{Containers::NoInit, slotObjects.size()};
+    slotTransformations[commonAncestor] = thisSlot == commonAncestor ?
+        finalTransformation : typename Transformation::DataType{};
+    for(std::size_t segment = 0; segment != segmentEnds.size(); ++segment) {
+        const UnsignedInt begin = segment ? segmentEnds[segment - 1] : 0;
+        const UnsignedInt end = segment ? segmentEnds[segment] : commonAncestor;
+        for(UnsignedInt i = end; i != begin; --i) {
+            const UnsignedInt slot = i - 1;
+            slotTransformations[slot] = Implementation::Transformation<Transformation>::compose(slotTransformations[slotParents[slot]], slotObjects[slot]->transformation());
+        }
     }
 
-    /* All visited marks are now cleaned, clean joint marks and counters */
-    for(auto i: jointObjects) {
-        /* All not-already cleaned objects (...duplicate occurences) should
-           have joint mark */
-        CORRADE_INTERNAL_ASSERT(i.get().counter == 0xFFFFu || i.get().flags & Flag::Joint);
-        i.get().flags &= ~Flag::Joint;
-        i.get().counter = 0xFFFFu;
+    /* Gather the transformations of requested objects, applying the inverse
+       transformation of this object if it's not the common ancestor */
+    std::vector<typename Transformation::DataType> transformations;
+    transformations.reserve(objects.size());
+    if(thisSlot == commonAncestor) {
+        for(Object<Transformation>& object: objects)
+            transformations.push_back(slotTransformations[object.counter]);
+    } else {
+        const typename Transformation::DataType prefix = Implementation::Transformation<Transformation>::compose(finalTransformation, Implementation::Transformation<Transformation>::inverted(slotTransformations[thisSlot]));
+        for(Object<Transformation>& object: objects)
+            transformations.push_back(Implementation::Transformation<Transformation>::compose(prefix, slotTransformations[object.counter]));
     }
 
-    /* Shrink the array to contain only transformations of requested objects and return */
-    jointTransformations.resize(objectCount);
-    return jointTransformations;
-}
-
-template<class Transformation> typename Transformation::DataType Object<Transformation>::computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& finalTransformation) const {
-    std::reference_wrapper<Object<Transformation>> o = jointObjects[joint];
-
-    /* Transformation already computed ("unvisited" by this function before
-       either due to recursion or duplicate object occurences), done */
-    if(!(o.get().flags & Flag::Visited)) return jointTransformations[joint];
-
-    /* Initialize transformation */
-    jointTransformations[joint] = o.get().transformation();
-
-    /* Go up until next joint or root */
-    for(;;) {
-        /* Clean visited mark */
-        CORRADE_INTERNAL_ASSERT(o.get().flags & Flag::Visited);
-        o.get().flags &= ~Flag::Visited;
-
-        Object<Transformation>* parent = o.get().parent();
-
-        /* Root object, compose transformation with final, done */
-        if(!parent) {
-            CORRADE_INTERNAL_ASSERT(o.get().isScene());
-            return (jointTransformations[joint] =
-                Implementation::Transformation<Transformation>::compose(finalTransformation, jointTransformations[joint]));
-
-        /* Joint object, compose transformation with the joint, done */
-        } else if(parent->flags & Flag::Joint) {
-            return (jointTransformations[joint] =
-                Implementation::Transformation<Transformation>::compose(computeJointTransformation(jointObjects, jointTransformations, parent->counter, finalTransformation), jointTransformations[joint]));
-
-        /* Else compose transformation with parent, go up the hierarchy */
-        } else {
-            jointTransformations[joint] = Implementation::Transformation<Transformation>::compose(parent->transformation(), jointTransformations[joint]);
-            o = *parent;
-        }
-    }
+    cleanup();
+    return transformations;
 }
 
 template<class Transformation> void Object<Transformation>::doSetClean(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects) {
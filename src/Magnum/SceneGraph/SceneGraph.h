@@ -101,6 +101,9 @@ typedef BasicCamera2D<Float> Camera2D;
 typedef BasicCamera3D<Float> Camera3D;
 
 template<UnsignedInt, class> class Drawable;
+template<class> class BasicDrawableBatch3D;
+typedef BasicDrawableBatch3D<Float> DrawableBatch3D;
+
 template<class T> using BasicDrawable2D = Drawable<2, T>;
 template<class T> using BasicDrawable3D = Drawable<3, T>;
 typedef BasicDrawable2D<Float> Drawable2D;
@@ -117,6 +120,12 @@ template<class Feature, class T> using BasicFeatureGroup3D = FeatureGroup<3, Fea
 template<class Feature> using FeatureGroup2D = BasicFeatureGroup2D<Feature, Float>;
 template<class Feature> using FeatureGroup3D = BasicFeatureGroup3D<Feature, Float>;
 
+template<UnsignedInt, class> class FlatHierarchy;
+template<class T> using BasicFlatHierarchy2D = FlatHierarchy<2, T>;
+template<class T> using BasicFlatHierarchy3D = FlatHierarchy<3, T>;
+typedef BasicFlatHierarchy2D<Float> FlatHierarchy2D;
+typedef BasicFlatHierarchy3D<Float> FlatHierarchy3D;
+
 template<UnsignedInt dimensions, class T> using DrawableGroup = FeatureGroup<dimensions, Drawable<dimensions, T>, T>;
 template<class T> using BasicDrawableGroup2D = DrawableGroup<2, T>;
 template<class T> using BasicDrawableGroup3D = DrawableGroup<3, T>;
@@ -0,0 +1,343 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/DrawableBatch.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test { namespace {
+
+struct DrawableBatchTest: TestSuite::Tester {
+    explicit DrawableBatchTest();
+
+    void construct();
+    void add();
+    void clear();
+
+    void updateTransformations();
+    void updateTransformationsNoScene();
+
+    void cull();
+    void cullRotatedBounds();
+    void cullLarge();
+    void sort();
+    void draw();
+
+    void benchmarkCull();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} ThreadsData[]{
+    {"", 1},
+    {"all threads", 0},
+    {"4 threads", 4}
+};
+
+DrawableBatchTest::DrawableBatchTest() {
+    addTests({&DrawableBatchTest::construct,
+              &DrawableBatchTest::add,
+              &DrawableBatchTest::clear,
+
+              &DrawableBatchTest::updateTransformations,
+              &DrawableBatchTest::updateTransformationsNoScene,
+
+              &DrawableBatchTest::cull,
+              &DrawableBatchTest::cullRotatedBounds});
+
+    addInstancedTests({&DrawableBatchTest::cullLarge},
+        Containers::arraySize(ThreadsData));
+
+    addTests({&DrawableBatchTest::sort,
+              &DrawableBatchTest::draw});
+
+    addInstancedBenchmarks({&DrawableBatchTest::benchmarkCull}, 10,
+        Containers::arraySize(ThreadsData));
+}
+
+class Drawable: public SceneGraph::Drawable3D {
+    public:
+        explicit Drawable(AbstractObject3D& object, std::vector<std::pair<Drawable*, Matrix4>>* result = nullptr): SceneGraph::Drawable3D{object}, _result(result) {}
+
+    private:
+        void draw(const Matrix4& transformationMatrix, Camera3D&) override {
+            if(_result) _result->emplace_back(this, transformationMatrix);
+        }
+
+        std::vector<std::pair<Drawable*, Matrix4>>* _result;
+};
+
+/* Orthographic camera looking down -Z at the origin, seeing [-1, 1] in X and
+   Y and [-1, -10] in Z */
+const Frustum CameraFrustum = Frustum::fromMatrix(Matrix4::orthographicProjection({2.0f, 2.0f}, 1.0f, 10.0f));
+
+void DrawableBatchTest::construct() {
+    DrawableBatch3D batch;
+    CORRADE_COMPARE(batch.size(), 0);
+    CORRADE_VERIFY(batch.drawables().empty());
+    CORRADE_VERIFY(batch.visible().empty());
+    CORRADE_COMPARE(batch.cull(CameraFrustum), 0);
+}
+
+void DrawableBatchTest::add() {
+    Object3D object;
+    Drawable a{object}, b{object};
+
+    DrawableBatch3D batch;
+    CORRADE_COMPARE(batch.add(a), 0);
+    CORRADE_COMPARE(batch.add(b, {{-1.0f, -2.0f, -3.0f}, {1.0f, 2.0f, 3.0f}}, 37), 1);
+    CORRADE_COMPARE(batch.size(), 2);
+    CORRADE_VERIFY(batch.drawables()[0] == &a);
+    CORRADE_VERIFY(batch.drawables()[1] == &b);
+    CORRADE_COMPARE_AS(batch.bounds(), Containers::arrayView<Range3D>({
+        {},
+        {{-1.0f, -2.0f, -3.0f}, {1.0f, 2.0f, 3.0f}}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(batch.sortKeys(), Containers::arrayView<UnsignedLong>({
+        0, 37
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(batch.transformations(), Containers::arrayView<Matrix4>({
+        {}, {}
+    }), TestSuite::Compare::Container);
+}
+
+void DrawableBatchTest::clear() {
+    Object3D object;
+    Drawable a{object};
+
+    DrawableBatch3D batch;
+    batch.add(a);
+    CORRADE_COMPARE(batch.cull(CameraFrustum), 0);
+    batch.transformations()[0] = Matrix4::translation(Vector3::zAxis(-5.0f));
+    CORRADE_COMPARE(batch.cull(CameraFrustum), 1);
+
+    batch.clear();
+    CORRADE_COMPARE(batch.size(), 0);
+    CORRADE_VERIFY(batch.visible().empty());
+}
+
+void DrawableBatchTest::updateTransformations() {
+    Scene3D scene;
+    Object3D first{&scene};
+    first.translate(Vector3::xAxis(3.0f));
+    Object3D second{&first};
+    second.scale(Vector3{2.0f});
+    Drawable a{second}, b{first};
+
+    DrawableBatch3D batch;
+    batch.add(a);
+    batch.add(b);
+    batch.updateTransformations();
+    CORRADE_COMPARE_AS(batch.transformations(), Containers::arrayView<Matrix4>({
+        Matrix4::translation(Vector3::xAxis(3.0f))*Matrix4::scaling(Vector3{2.0f}),
+        Matrix4::translation(Vector3::xAxis(3.0f))
+    }), TestSuite::Compare::Container);
+}
+
+void DrawableBatchTest::updateTransformationsNoScene() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Object3D object;
+    Drawable a{object};
+
+    DrawableBatch3D batch;
+    batch.add(a);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    batch.updateTransformations();
+    CORRADE_COMPARE(out.str(), "SceneGraph::DrawableBatch3D::updateTransformations(): the drawables are not part of any scene\n");
+}
+
+void DrawableBatchTest::cull() {
+    Object3D object;
+    Drawable a{object};
+
+    DrawableBatch3D batch;
+    /* 0: point in front of the camera */
+    batch.add(a);
+    batch.transformations()[0] = Matrix4::translation(Vector3::zAxis(-5.0f));
+    /* 1: point behind the camera */
+    batch.add(a);
+    batch.transformations()[1] = Matrix4::translation(Vector3::zAxis(5.0f));
+    /* 2: box to the side, but large enough to reach into the frustum */
+    batch.add(a, {{-1.5f, -0.5f, -0.5f}, {1.5f, 0.5f, 0.5f}});
+    batch.transformations()[2] = Matrix4::translation({2.0f, 0.0f, -5.0f});
+    /* 3: same box further to the side */
+    batch.add(a, {{-1.5f, -0.5f, -0.5f}, {1.5f, 0.5f, 0.5f}});
+    batch.transformations()[3] = Matrix4::translation({3.0f, 0.0f, -5.0f});
+    /* 4: box outside, but scaled up to reach into the frustum */
+    batch.add(a, {{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}});
+    batch.transformations()[4] = Matrix4::translation({0.0f, 3.0f, -5.0f})*Matrix4::scaling(Vector3{2.5f});
+
+    CORRADE_COMPARE(batch.cull(CameraFrustum), 3);
+    CORRADE_COMPARE_AS(batch.visible(), Containers::arrayView<UnsignedInt>({
+        0, 2, 4
+    }), TestSuite::Compare::Container);
+}
+
+void DrawableBatchTest::cullRotatedBounds() {
+    Object3D object;
+    Drawable a{object};
+
+    /* A thin long box that's visible only if the rotation is taken into
+       account */
+    DrawableBatch3D batch;
+    batch.add(a, {{-0.1f, -3.0f, -0.1f}, {0.1f, 3.0f, 0.1f}});
+    batch.transformations()[0] = Matrix4::translation({3.0f, 0.0f, -5.0f});
+    CORRADE_COMPARE(batch.cull(CameraFrustum), 0);
+
+    batch.transformations()[0] = Matrix4::translation({3.0f, 0.0f, -5.0f})*Matrix4::rotationZ(Deg(90.0f));
+    CORRADE_COMPARE(batch.cull(CameraFrustum), 1);
+}
+
+/* Drawables on a line going through the frustum, every fourth visible */
+void populateLine(DrawableBatch3D& batch, Drawable& drawable, const std::size_t count) {
+    batch.reserve(count);
+    for(std::size_t i = 0; i != count; ++i) {
+        batch.add(drawable, {{-0.1f, -0.1f, -0.1f}, {0.1f, 0.1f, 0.1f}}, count - i);
+        batch.transformations()[i] = Matrix4::translation({
+            i % 4 ? 5.0f : 0.0f, 0.0f, -5.0f});
+    }
+}
+
+void DrawableBatchTest::cullLarge() {
+    auto&& data = ThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Object3D object;
+    Drawable a{object};
+
+    DrawableBatch3D batch;
+    populateLine(batch, a, 100000);
+    CORRADE_COMPARE(batch.cull(CameraFrustum, data.threadCount), 25000);
+
+    /* Sorted in reverse order */
+    CORRADE_COMPARE(batch.visible()[0], 99996);
+    CORRADE_COMPARE(batch.visible()[24999], 0);
+    for(std::size_t i = 0; i != batch.visible().size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(batch.visible()[i], 99996 - i*4);
+    }
+}
+
+void DrawableBatchTest::sort() {
+    Object3D object;
+    Drawable a{object};
+
+    /* Drawables with the same key should stay in the original order */
+    DrawableBatch3D batch;
+    batch.add(a, {}, 3);
+    batch.add(a, {}, 1);
+    batch.add(a, {}, 3);
+    batch.add(a, {}, 0xffffffffffffffffull);
+    batch.add(a, {}, 1);
+    for(Matrix4& transformation: batch.transformations())
+        transformation = Matrix4::translation(Vector3::zAxis(-5.0f));
+
+    CORRADE_COMPARE(batch.cull(CameraFrustum), 5);
+    CORRADE_COMPARE_AS(batch.visible(), Containers::arrayView<UnsignedInt>({
+        1, 4, 0, 2, 3
+    }), TestSuite::Compare::Container);
+
+    /* Changing the key changes the order */
+    batch.sortKeys()[3] = 0;
+    CORRADE_COMPARE(batch.cull(CameraFrustum), 5);
+    CORRADE_COMPARE_AS(batch.visible(), Containers::arrayView<UnsignedInt>({
+        3, 1, 4, 0, 2
+    }), TestSuite::Compare::Container);
+}
+
+void DrawableBatchTest::draw() {
+    Scene3D scene;
+    Object3D first{&scene};
+    first.translate(Vector3::zAxis(-5.0f));
+    Object3D second{&scene};
+    second.translate(Vector3::xAxis(5.0f));
+    Object3D third{&first};
+    third.translate(Vector3::yAxis(0.5f));
+
+    std::vector<std::pair<Drawable*, Matrix4>> result;
+    Drawable a{first, &result};
+    Drawable b{second, &result};
+    Drawable c{third, &result};
+
+    /* Camera moved back by one unit */
+    Object3D cameraObject{&scene};
+    cameraObject.translate(Vector3::zAxis(1.0f));
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::orthographicProjection({2.0f, 2.0f}, 1.0f, 10.0f));
+
+    DrawableBatch3D batch;
+    batch.add(a, {}, 2);
+    batch.add(b, {}, 0);
+    batch.add(c, {}, 1);
+    batch.updateTransformations();
+    CORRADE_COMPARE(batch.draw(camera), 2);
+
+    /* The second object is culled, the rest is drawn relative to the camera
+       in the key order */
+    CORRADE_COMPARE(result.size(), 2);
+    CORRADE_COMPARE(result[0].first, &c);
+    CORRADE_COMPARE(result[0].second, Matrix4::translation({0.0f, 0.5f, -6.0f}));
+    CORRADE_COMPARE(result[1].first, &a);
+    CORRADE_COMPARE(result[1].second, Matrix4::translation({0.0f, 0.0f, -6.0f}));
+}
+
+void DrawableBatchTest::benchmarkCull() {
+    auto&& data = ThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Object3D object;
+    Drawable a{object};
+
+    DrawableBatch3D batch;
+    populateLine(batch, a, 200000);
+
+    std::size_t visible{};
+    CORRADE_BENCHMARK(1)
+        visible = batch.cull(CameraFrustum, data.threadCount);
+
+    CORRADE_COMPARE(visible, 50000);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::DrawableBatchTest)
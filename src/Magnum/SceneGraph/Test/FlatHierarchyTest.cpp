@@ -0,0 +1,337 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/FlatHierarchy.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test { namespace {
+
+struct FlatHierarchyTest: TestSuite::Tester {
+    explicit FlatHierarchyTest();
+
+    void construct();
+    void add();
+    void addInvalidParent();
+    void setTransformationInvalid();
+
+    void setClean();
+    void setClean2D();
+    void setCleanPartial();
+    void setCleanLarge();
+
+    void drawableTransformations();
+    void drawableTransformationsInvalid();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} ThreadsData[]{
+    {"", 1},
+    {"all threads", 0},
+    {"4 threads", 4}
+};
+
+FlatHierarchyTest::FlatHierarchyTest() {
+    addTests({&FlatHierarchyTest::construct,
+              &FlatHierarchyTest::add,
+              &FlatHierarchyTest::addInvalidParent,
+              &FlatHierarchyTest::setTransformationInvalid});
+
+    addInstancedTests({&FlatHierarchyTest::setClean,
+                       &FlatHierarchyTest::setClean2D,
+                       &FlatHierarchyTest::setCleanPartial,
+                       &FlatHierarchyTest::setCleanLarge},
+        Containers::arraySize(ThreadsData));
+
+    addTests({&FlatHierarchyTest::drawableTransformations,
+              &FlatHierarchyTest::drawableTransformationsInvalid});
+}
+
+void FlatHierarchyTest::construct() {
+    FlatHierarchy3D hierarchy;
+    CORRADE_COMPARE(hierarchy.size(), 0);
+    CORRADE_VERIFY(!hierarchy.isDirty());
+    CORRADE_VERIFY(hierarchy.parents().empty());
+    CORRADE_VERIFY(hierarchy.transformations().empty());
+    CORRADE_VERIFY(hierarchy.absoluteTransformations().empty());
+
+    /* Cleaning an empty hierarchy does nothing */
+    hierarchy.setClean();
+    CORRADE_VERIFY(!hierarchy.isDirty());
+}
+
+void FlatHierarchyTest::add() {
+    FlatHierarchy3D hierarchy;
+    CORRADE_COMPARE(hierarchy.add(-1), 0);
+    CORRADE_COMPARE(hierarchy.add(0, Matrix4::translation(Vector3::xAxis(3.0f))), 1);
+    CORRADE_COMPARE(hierarchy.add(-1, Matrix4::scaling(Vector3{2.0f})), 2);
+    CORRADE_COMPARE(hierarchy.add(1), 3);
+    CORRADE_COMPARE(hierarchy.size(), 4);
+    CORRADE_VERIFY(hierarchy.isDirty());
+
+    CORRADE_COMPARE_AS(hierarchy.parents(),
+        Containers::arrayView<Int>({-1, 0, -1, 1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(hierarchy.transformations(),
+        Containers::arrayView<Matrix4>({
+            {},
+            Matrix4::translation(Vector3::xAxis(3.0f)),
+            Matrix4::scaling(Vector3{2.0f}),
+            {}
+        }), TestSuite::Compare::Container);
+}
+
+void FlatHierarchyTest::addInvalidParent() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    FlatHierarchy3D hierarchy;
+    hierarchy.add(-1);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    hierarchy.add(1);
+    hierarchy.add(-2);
+    CORRADE_COMPARE(hierarchy.size(), 1);
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::FlatHierarchy::add(): parent index 1 out of range for 1 nodes\n"
+        "SceneGraph::FlatHierarchy::add(): parent index -2 out of range for 1 nodes\n");
+}
+
+void FlatHierarchyTest::setTransformationInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    FlatHierarchy3D hierarchy;
+    hierarchy.add(-1);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    hierarchy.setTransformation(1, {});
+    CORRADE_COMPARE(out.str(), "SceneGraph::FlatHierarchy::setTransformation(): index 1 out of range for 1 nodes\n");
+}
+
+void FlatHierarchyTest::setClean() {
+    auto&& data = ThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    FlatHierarchy3D hierarchy;
+    hierarchy.add(-1, Matrix4::rotationZ(Deg(30.0f)));
+    hierarchy.add(0, Matrix4::scaling(Vector3{0.5f}));
+    hierarchy.add(0, Matrix4::translation(Vector3::xAxis(5.0f)));
+    hierarchy.add(-1, Matrix4::translation(Vector3::yAxis(1.0f)));
+    hierarchy.add(2, Matrix4::rotationX(Deg(90.0f)));
+
+    hierarchy.setClean(data.threadCount);
+    CORRADE_VERIFY(!hierarchy.isDirty());
+    CORRADE_COMPARE_AS(hierarchy.absoluteTransformations(),
+        Containers::arrayView<Matrix4>({
+            Matrix4::rotationZ(Deg(30.0f)),
+            Matrix4::rotationZ(Deg(30.0f))*Matrix4::scaling(Vector3{0.5f}),
+            Matrix4::rotationZ(Deg(30.0f))*Matrix4::translation(Vector3::xAxis(5.0f)),
+            Matrix4::translation(Vector3::yAxis(1.0f)),
+            Matrix4::rotationZ(Deg(30.0f))*Matrix4::translation(Vector3::xAxis(5.0f))*Matrix4::rotationX(Deg(90.0f))
+        }), TestSuite::Compare::Container);
+}
+
+void FlatHierarchyTest::setClean2D() {
+    auto&& data = ThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    FlatHierarchy2D hierarchy;
+    hierarchy.add(-1, Matrix3::rotation(Deg(30.0f)));
+    hierarchy.add(0, Matrix3::translation(Vector2::xAxis(5.0f)));
+
+    hierarchy.setClean(data.threadCount);
+    CORRADE_COMPARE_AS(hierarchy.absoluteTransformations(),
+        Containers::arrayView<Matrix3>({
+            Matrix3::rotation(Deg(30.0f)),
+            Matrix3::rotation(Deg(30.0f))*Matrix3::translation(Vector2::xAxis(5.0f))
+        }), TestSuite::Compare::Container);
+}
+
+void FlatHierarchyTest::setCleanPartial() {
+    auto&& data = ThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    FlatHierarchy3D hierarchy;
+    hierarchy.add(-1, Matrix4::translation(Vector3::xAxis(1.0f)));
+    hierarchy.add(0, Matrix4::translation(Vector3::xAxis(2.0f)));
+    hierarchy.add(0, Matrix4::translation(Vector3::xAxis(4.0f)));
+    hierarchy.add(1, Matrix4::translation(Vector3::xAxis(8.0f)));
+    hierarchy.add(2, Matrix4::translation(Vector3::xAxis(16.0f)));
+    hierarchy.setClean(data.threadCount);
+
+    /* Change of a node in the middle propagates only to its children */
+    hierarchy.setTransformation(1, Matrix4::translation(Vector3::yAxis(2.0f)));
+    CORRADE_VERIFY(hierarchy.isDirty());
+    hierarchy.setClean(data.threadCount);
+    CORRADE_VERIFY(!hierarchy.isDirty());
+    CORRADE_COMPARE_AS(hierarchy.absoluteTransformations(),
+        Containers::arrayView<Matrix4>({
+            Matrix4::translation({1.0f, 0.0f, 0.0f}),
+            Matrix4::translation({1.0f, 2.0f, 0.0f}),
+            Matrix4::translation({5.0f, 0.0f, 0.0f}),
+            Matrix4::translation({9.0f, 2.0f, 0.0f}),
+            Matrix4::translation({21.0f, 0.0f, 0.0f})
+        }), TestSuite::Compare::Container);
+
+    /* Change of the root together with adding a new node propagates
+       everywhere */
+    hierarchy.setTransformation(0, Matrix4::translation(Vector3::zAxis(1.0f)));
+    hierarchy.add(3, Matrix4::translation(Vector3::zAxis(32.0f)));
+    hierarchy.setClean(data.threadCount);
+    CORRADE_COMPARE_AS(hierarchy.absoluteTransformations(),
+        Containers::arrayView<Matrix4>({
+            Matrix4::translation({0.0f, 0.0f, 1.0f}),
+            Matrix4::translation({0.0f, 2.0f, 1.0f}),
+            Matrix4::translation({4.0f, 0.0f, 1.0f}),
+            Matrix4::translation({8.0f, 2.0f, 1.0f}),
+            Matrix4::translation({20.0f, 0.0f, 1.0f}),
+            Matrix4::translation({8.0f, 2.0f, 33.0f})
+        }), TestSuite::Compare::Container);
+}
+
+void FlatHierarchyTest::setCleanLarge() {
+    auto&& data = ThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Large enough for the levels to be split among threads. Each node
+       translates by one unit, so the absolute translation is the depth. */
+    FlatHierarchy3D hierarchy;
+    hierarchy.reserve(100000);
+    hierarchy.add(-1);
+    Containers::Array<Float> depths{Containers::ValueInit, 100000};
+    for(std::size_t i = 1; i != depths.size(); ++i) {
+        const Int parent = (i - 1)/8;
+        hierarchy.add(parent, Matrix4::translation(Vector3::xAxis(1.0f)));
+        depths[i] = depths[parent] + 1.0f;
+    }
+
+    hierarchy.setClean(data.threadCount);
+    for(std::size_t i = 0; i != depths.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(hierarchy.absoluteTransformations()[i].translation().x(), depths[i]);
+    }
+
+    /* Modify a subtree, the rest should stay the same */
+    hierarchy.setTransformation(3, Matrix4::translation(Vector3::xAxis(101.0f)));
+    hierarchy.setClean(data.threadCount);
+    CORRADE_COMPARE(hierarchy.absoluteTransformations()[2].translation().x(), 1.0f);
+    CORRADE_COMPARE(hierarchy.absoluteTransformations()[3].translation().x(), 101.0f);
+    CORRADE_COMPARE(hierarchy.absoluteTransformations()[4].translation().x(), 1.0f);
+    /* Child and grandchild of node 3 */
+    CORRADE_COMPARE(hierarchy.absoluteTransformations()[3*8 + 1].translation().x(), 102.0f);
+    CORRADE_COMPARE(hierarchy.absoluteTransformations()[(3*8 + 1)*8 + 1].translation().x(), 103.0f);
+    /* Child of node 4 */
+    CORRADE_COMPARE(hierarchy.absoluteTransformations()[4*8 + 1].translation().x(), 2.0f);
+}
+
+class Drawable: public SceneGraph::Drawable3D {
+    public:
+        explicit Drawable(AbstractObject3D& object, std::vector<Matrix4>& result): SceneGraph::Drawable3D{object}, _result(result) {}
+
+    private:
+        void draw(const Matrix4& transformationMatrix, Camera3D&) override {
+            _result.push_back(transformationMatrix);
+        }
+
+        std::vector<Matrix4>& _result;
+};
+
+void FlatHierarchyTest::drawableTransformations() {
+    FlatHierarchy3D hierarchy;
+    hierarchy.add(-1, Matrix4::translation(Vector3::yAxis(3.0f)));
+    hierarchy.add(0, Matrix4::scaling(Vector3{5.0f}));
+    hierarchy.add(0, Matrix4::translation(Vector3::zAxis(-1.5f)));
+
+    /* The placeholder object isn't used for anything */
+    Object3D placeholder;
+    std::vector<Matrix4> transformations;
+    Drawable a{placeholder, transformations};
+    Drawable b{placeholder, transformations};
+
+    /* Camera in node 2 */
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+
+    /* The function should clean the hierarchy first */
+    CORRADE_VERIFY(hierarchy.isDirty());
+    std::vector<std::pair<std::reference_wrapper<Drawable3D>, Matrix4>> drawableTransformations = hierarchy.drawableTransformations({
+        {b, 1},
+        {a, 0}
+    }, Matrix4::translation({0.0f, -3.0f, 1.5f}));
+    CORRADE_VERIFY(!hierarchy.isDirty());
+
+    CORRADE_COMPARE(drawableTransformations.size(), 2);
+    CORRADE_COMPARE(&drawableTransformations[0].first.get(), &b);
+    CORRADE_COMPARE(&drawableTransformations[1].first.get(), &a);
+
+    camera.draw(drawableTransformations);
+    CORRADE_COMPARE_AS(transformations, (std::vector<Matrix4>{
+        Matrix4::translation(Vector3::zAxis(1.5f))*Matrix4::scaling(Vector3{5.0f}),
+        Matrix4::translation(Vector3::zAxis(1.5f))
+    }), TestSuite::Compare::Container);
+}
+
+void FlatHierarchyTest::drawableTransformationsInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    FlatHierarchy3D hierarchy;
+    hierarchy.add(-1);
+
+    Object3D placeholder;
+    std::vector<Matrix4> transformations;
+    Drawable a{placeholder, transformations};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    hierarchy.drawableTransformations({{a, 1}}, {});
+    CORRADE_COMPARE(out.str(), "SceneGraph::FlatHierarchy::drawableTransformations(): index 1 out of range for 1 nodes\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FlatHierarchyTest)
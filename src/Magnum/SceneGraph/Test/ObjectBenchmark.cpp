@@ -0,0 +1,219 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <functional>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/FlatHierarchy.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test { namespace {
+
+struct ObjectBenchmark: TestSuite::Tester {
+    explicit ObjectBenchmark();
+
+    void absoluteTransformation();
+    void transformations();
+    void transformationsRelative();
+    void setClean();
+    void flatHierarchySetClean();
+    void flatHierarchySetCleanThreaded();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+const struct {
+    const char* name;
+    std::size_t count;
+} Data[]{
+    {"10k objects", 10000},
+    {"100k objects", 100000},
+    {"1M objects", 1000000}
+};
+
+class CachingFeature: public AbstractFeature3D {
+    public:
+        explicit CachingFeature(AbstractObject3D& object): AbstractFeature3D{object} {
+            setCachedTransformations(CachedTransformation::Absolute);
+        }
+
+        Matrix4 cleanedAbsoluteTransformation;
+
+    private:
+        void clean(const Matrix4& absoluteTransformation) override {
+            cleanedAbsoluteTransformation = absoluteTransformation;
+        }
+};
+
+ObjectBenchmark::ObjectBenchmark() {
+    addInstancedBenchmarks({&ObjectBenchmark::absoluteTransformation,
+                            &ObjectBenchmark::transformations,
+                            &ObjectBenchmark::transformationsRelative,
+                            &ObjectBenchmark::setClean,
+                            &ObjectBenchmark::flatHierarchySetClean,
+                            &ObjectBenchmark::flatHierarchySetCleanThreaded}, 5,
+        Containers::arraySize(Data));
+}
+
+/* A tree with each object having four children and the leaves (three quarters
+   of all objects) being the ones for which the transformations are
+   calculated, similarly to how drawables are usually attached. The scene owns
+   all objects, so they get deleted together with it. */
+Containers::Array<std::reference_wrapper<Object3D>> populate(Scene3D& scene, const std::size_t count, const bool caching = false) {
+    Containers::Array<Object3D*> objects{Containers::NoInit, count};
+    objects[0] = &scene;
+    for(std::size_t i = 1; i != count; ++i) {
+        objects[i] = new Object3D{objects[(i - 1)/4]};
+        objects[i]->translate(Vector3::xAxis(1.0f))
+            .rotateY(Deg(Float(i % 360)));
+        if(caching) new CachingFeature{*objects[i]};
+    }
+
+    Containers::Array<std::reference_wrapper<Object3D>> leaves;
+    for(std::size_t i = (count - 1)/4 + 1; i != count; ++i)
+        arrayAppend(leaves, std::ref(*objects[i]));
+    return leaves;
+}
+
+void ObjectBenchmark::absoluteTransformation() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Scene3D scene;
+    Containers::Array<std::reference_wrapper<Object3D>> leaves = populate(scene, data.count);
+    Containers::Array<Matrix4> out{Containers::NoInit, leaves.size()};
+
+    /* Baseline -- walking up to the root separately for each object */
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != leaves.size(); ++i)
+            out[i] = leaves[i].get().absoluteTransformationMatrix();
+    }
+
+    CORRADE_COMPARE(out[out.size() - 1], leaves[leaves.size() - 1].get().absoluteTransformationMatrix());
+}
+
+void ObjectBenchmark::transformations() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Scene3D scene;
+    Containers::Array<std::reference_wrapper<Object3D>> leaves = populate(scene, data.count);
+    std::vector<std::reference_wrapper<Object3D>> objects(leaves.begin(), leaves.end());
+    std::vector<Matrix4> out;
+
+    CORRADE_BENCHMARK(1) {
+        out = scene.transformations(objects);
+    }
+
+    CORRADE_COMPARE(out.size(), leaves.size());
+    CORRADE_COMPARE(out.back(), leaves[leaves.size() - 1].get().absoluteTransformationMatrix());
+}
+
+void ObjectBenchmark::transformationsRelative() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Scene3D scene;
+    Containers::Array<std::reference_wrapper<Object3D>> leaves = populate(scene, data.count);
+    std::vector<std::reference_wrapper<Object3D>> objects(leaves.begin(), leaves.end());
+    std::vector<Matrix4> out;
+
+    /* Relative to a leaf object, which needs to go through its inverse */
+    Object3D& camera = leaves[0];
+    CORRADE_BENCHMARK(1) {
+        out = camera.transformations(objects);
+    }
+
+    CORRADE_COMPARE(out.size(), leaves.size());
+    CORRADE_COMPARE(out.front(), Matrix4{});
+}
+
+void ObjectBenchmark::setClean() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Scene3D scene;
+    Containers::Array<std::reference_wrapper<Object3D>> leaves = populate(scene, data.count, true);
+    std::vector<std::reference_wrapper<Object3D>> objects(leaves.begin(), leaves.end());
+
+    CORRADE_BENCHMARK(1) {
+        for(Object3D& object: objects) object.setDirty();
+        Object3D::setClean(objects);
+    }
+
+    CORRADE_VERIFY(!leaves[leaves.size() - 1].get().isDirty());
+}
+
+/* Same tree shape as populate(), the leaves are the last three quarters of
+   the nodes */
+void populate(FlatHierarchy3D& hierarchy, const std::size_t count) {
+    hierarchy.reserve(count);
+    hierarchy.add(-1);
+    for(std::size_t i = 1; i != count; ++i)
+        hierarchy.add((i - 1)/4, Matrix4::translation(Vector3::xAxis(1.0f))*
+                                 Matrix4::rotationY(Deg(Float(i % 360))));
+    hierarchy.setClean();
+}
+
+void ObjectBenchmark::flatHierarchySetClean() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    FlatHierarchy3D hierarchy;
+    populate(hierarchy, data.count);
+
+    /* Marking the leaves as dirty, equivalent to setClean() above */
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = (data.count - 1)/4 + 1; i != data.count; ++i)
+            hierarchy.setTransformation(i, hierarchy.transformations()[i]);
+        hierarchy.setClean();
+    }
+
+    CORRADE_VERIFY(!hierarchy.isDirty());
+}
+
+void ObjectBenchmark::flatHierarchySetCleanThreaded() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    FlatHierarchy3D hierarchy;
+    populate(hierarchy, data.count);
+
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = (data.count - 1)/4 + 1; i != data.count; ++i)
+            hierarchy.setTransformation(i, hierarchy.transformations()[i]);
+        hierarchy.setClean(0);
+    }
+
+    CORRADE_VERIFY(!hierarchy.isDirty());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::ObjectBenchmark)
@@ -49,6 +49,7 @@ struct ObjectTest: TestSuite::Tester {
     void transformationsRelative();
     void transformationsOrphan();
     void transformationsDuplicate();
+    void transformationsManyObjects();
     void setClean();
     void setCleanListHierarchy();
     void setCleanListBulk();
@@ -88,6 +89,7 @@ ObjectTest::ObjectTest() {
               &ObjectTest::transformationsRelative,
               &ObjectTest::transformationsOrphan,
               &ObjectTest::transformationsDuplicate,
+              &ObjectTest::transformationsManyObjects,
               &ObjectTest::setClean,
               &ObjectTest::setCleanListHierarchy,
               &ObjectTest::setCleanListBulk,
@@ -289,8 +291,6 @@ void ObjectTest::transformations() {
 }
 
 void ObjectTest::transformationsRelative() {
-    CORRADE_SKIP("Transformations not relative to scene are not implemented yet.");
-
     Scene3D s;
     Object3D first(&s);
     first.rotateZ(Deg(30.0f));
@@ -315,6 +315,24 @@ void ObjectTest::transformationsRelative() {
     CORRADE_COMPARE(orphan1.transformations({orphan2}), std::vector<Matrix4>{
         Matrix4::scaling(Vector3::xScale(3.0f)).inverted()*Matrix4::translation(Vector3::zAxis(5.0f))
     });
+
+    /* Transformation relative to a child, parent and self, with the final
+       transformation applied */
+    Matrix4 initial = Matrix4::rotationX(Deg(90.0f)).inverted();
+    CORRADE_COMPARE(first.transformations({second, s, first}, initial), (std::vector<Matrix4>{
+        initial*Matrix4::scaling(Vector3(0.5f)),
+        initial*Matrix4::rotationZ(Deg(30.0f)).inverted(),
+        initial
+    }));
+
+    /* Common ancestor of the objects is below this object, transformation
+       of this object should be inverted only once */
+    Object3D fourth(&third);
+    fourth.translate(Vector3::yAxis(2.0f));
+    CORRADE_COMPARE(second.transformations({fourth, third}), (std::vector<Matrix4>{
+        Matrix4::scaling(Vector3(0.5f)).inverted()*Matrix4::translation(Vector3::xAxis(5.0f))*Matrix4::translation(Vector3::yAxis(2.0f)),
+        Matrix4::scaling(Vector3(0.5f)).inverted()*Matrix4::translation(Vector3::xAxis(5.0f))
+    }));
 }
 
 void ObjectTest::transformationsOrphan() {
@@ -349,6 +367,31 @@ void ObjectTest::transformationsDuplicate() {
     }));
 }
 
+void ObjectTest::transformationsManyObjects() {
+    /* More objects than what fits into 16 bits, as siblings and in a chain
+       (which isn't too long to not blow up the stack on destruction) */
+    Scene3D s;
+    std::vector<std::reference_wrapper<Object3D>> objects;
+    for(std::size_t i = 0; i != 70000; ++i) {
+        Object3D* object = new Object3D{&s};
+        object->translate(Vector3::yAxis(Float(i)));
+        objects.push_back(*object);
+    }
+    Object3D* parent = &s;
+    for(std::size_t i = 0; i != 1000; ++i) {
+        parent = new Object3D{parent};
+        parent->translate(Vector3::xAxis(1.0f));
+        objects.push_back(*parent);
+    }
+
+    std::vector<Matrix4> transformations = s.transformations(objects);
+    CORRADE_COMPARE(transformations.size(), 71000);
+    CORRADE_COMPARE(transformations[0], Matrix4{});
+    CORRADE_COMPARE(transformations[69999], Matrix4::translation(Vector3::yAxis(69999.0f)));
+    CORRADE_COMPARE(transformations[70000], Matrix4::translation(Vector3::xAxis(1.0f)));
+    CORRADE_COMPARE(transformations[70999], Matrix4::translation(Vector3::xAxis(1000.0f)));
+}
+
 void ObjectTest::setClean() {
     Scene3D scene;
 
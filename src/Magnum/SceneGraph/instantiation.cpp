@@ -27,9 +27,11 @@
 #include "Magnum/SceneGraph/Animable.hpp"
 #include "Magnum/SceneGraph/Camera.hpp"
 #include "Magnum/SceneGraph/Drawable.hpp"
+#include "Magnum/SceneGraph/DrawableBatch.hpp"
 #include "Magnum/SceneGraph/DualComplexTransformation.h"
 #include "Magnum/SceneGraph/DualQuaternionTransformation.h"
 #include "Magnum/SceneGraph/FeatureGroup.hpp"
+#include "Magnum/SceneGraph/FlatHierarchy.hpp"
 #include "Magnum/SceneGraph/MatrixTransformation2D.hpp"
 #include "Magnum/SceneGraph/MatrixTransformation3D.hpp"
 #include "Magnum/SceneGraph/Object.hpp"
@@ -71,6 +73,10 @@ template class MAGNUM_SCENEGRAPH_EXPORT_HPP Camera<3, Float>;
 
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Drawable<2, Float>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Drawable<3, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP BasicDrawableBatch3D<Float>;
+
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP FlatHierarchy<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP FlatHierarchy<3, Float>;
 
 /* These have rotation(const Complex&) and rotation(const Quaternion&) defined
    in a hpp to avoid dragging in Complex / Quaternion for every user */
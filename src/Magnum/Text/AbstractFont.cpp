@@ -35,6 +35,7 @@
 #include "Magnum/FileCallback.h"
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Text/AbstractGlyphCache.h"
+#include "Magnum/Text/LayoutCache.h"
 
 #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
 #include "Magnum/Text/configure.h"
@@ -43,7 +44,7 @@
 namespace Magnum { namespace Text {
 
 std::string AbstractFont::pluginInterface() {
-    return "cz.mosra.magnum.Text.AbstractFont/0.3";
+    return "cz.mosra.magnum.Text.AbstractFont/0.3.1";
 }
 
 #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
@@ -72,6 +73,8 @@ AbstractFont::AbstractFont() = default;
 
 AbstractFont::AbstractFont(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractPlugin{manager, plugin} {}
 
+AbstractFont::~AbstractFont() = default;
+
 void AbstractFont::setFileCallback(Containers::Optional<Containers::ArrayView<const char>>(*callback)(const std::string&, InputFileCallbackPolicy, void*), void* const userData) {
     CORRADE_ASSERT(!isOpened(), "Text::AbstractFont::setFileCallback(): can't be set while a font is opened", );
     CORRADE_ASSERT(features() & (FontFeature::FileCallback|FontFeature::OpenData), "Text::AbstractFont::setFileCallback(): font plugin supports neither loading from data nor via callbacks, callbacks can't be used", );
@@ -193,6 +196,8 @@ auto AbstractFont::doOpenFile(const std::string& filename, const Float size) ->
 }
 
 void AbstractFont::close() {
+    if(_layoutCache) _layoutCache->clear();
+
     if(isOpened()) {
         doClose();
         _size = 0.0f;
@@ -239,6 +244,10 @@ void AbstractFont::fillGlyphCache(AbstractGlyphCache& cache, const std::string&
     CORRADE_ASSERT(!(features() & FontFeature::PreparedGlyphCache),
         "Text::AbstractFont::fillGlyphCache(): feature not supported", );
 
+    /* Glyphs that weren't in the cache before would have invalid texture
+       coordinates in the cached layouts */
+    if(_layoutCache) _layoutCache->clear();
+
     doFillGlyphCache(cache, Utility::Unicode::utf32(characters));
 }
 
@@ -262,7 +271,19 @@ Containers::Pointer<AbstractGlyphCache> AbstractFont::doCreateGlyphCache() {
 Containers::Pointer<AbstractLayouter> AbstractFont::layout(const AbstractGlyphCache& cache, const Float size, const std::string& text) {
     CORRADE_ASSERT(isOpened(), "Text::AbstractFont::layout(): no font opened", nullptr);
 
-    return doLayout(cache, size, text);
+    if(!_layoutCache) return doLayout(cache, size, text);
+
+    Containers::Pointer<AbstractLayouter> layouter = _layoutCache->find(cache, size, text);
+    if(layouter) return layouter;
+
+    layouter = doLayout(cache, size, text);
+    if(!layouter) return layouter;
+    return _layoutCache->insert(cache, size, text, *layouter);
+}
+
+void AbstractFont::setLayoutCacheCapacity(const UnsignedInt capacity) {
+    if(capacity) _layoutCache = Containers::pointer<LayoutCache>(capacity);
+    else _layoutCache = nullptr;
 }
 
 Debug& operator<<(Debug& debug, const FontFeature value) {
@@ -32,6 +32,7 @@
 #include <string>
 #include <vector>
 #include <tuple>
+#include <Corrade/Containers/Pointer.h>
 #include <Corrade/PluginManager/AbstractPlugin.h>
 
 #include "Magnum/Magnum.h"
@@ -185,7 +186,7 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
          * @brief Plugin interface
          *
          * @code{.cpp}
-         * "cz.mosra.magnum.Text.AbstractFont/0.3"
+         * "cz.mosra.magnum.Text.AbstractFont/0.3.1"
          * @endcode
          */
         static std::string pluginInterface();
@@ -213,6 +214,8 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
         /** @brief Plugin manager constructor */
         explicit AbstractFont(PluginManager::AbstractManager& manager, const std::string& plugin);
 
+        ~AbstractFont();
+
         /** @brief Features supported by this font */
         FontFeatures features() const { return doFeatures(); }
 
@@ -436,10 +439,43 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
          * Note that the layouters support rendering of single-line text only.
          * See @ref Renderer class for more advanced text layouting. Expects
          * that a font is opened.
-         * @see @ref fillGlyphCache(), @ref createGlyphCache()
+         * @see @ref fillGlyphCache(), @ref createGlyphCache(),
+         *      @ref setLayoutCacheCapacity()
          */
         Containers::Pointer<AbstractLayouter> layout(const AbstractGlyphCache& cache, Float size, const std::string& text);
 
+        /**
+         * @brief Layout cache
+         * @m_since_latest
+         *
+         * Returns @cpp nullptr @ce if the layout cache is not enabled.
+         * @see @ref setLayoutCacheCapacity()
+         */
+        LayoutCache* layoutCache() { return _layoutCache.get(); }
+        const LayoutCache* layoutCache() const { return _layoutCache.get(); } /**< @overload */
+
+        /**
+         * @brief Enable the layout cache
+         * @m_since_latest
+         *
+         * If @p capacity is non-zero, @ref layout() caches glyph runs of up
+         * to @p capacity most recently used texts in a @ref LayoutCache and
+         * returns the cached glyphs for repeated calls with the same glyph
+         * cache, size and text instead of calling into the font
+         * implementation again. Useful if the same texts are laid out
+         * repeatedly, such as static UI labels for which the renderer is
+         * rebuilt. If @p capacity is @cpp 0 @ce, the cache is disabled. In
+         * both cases, any previous cache is discarded, including its
+         * statistics. By default the cache is disabled.
+         *
+         * The cache is cleared when the font is closed and on each
+         * @ref fillGlyphCache() call, as the cached texture coordinates of
+         * glyphs that weren't in the glyph cache before would be invalid.
+         * If you modify the glyph cache directly, call
+         * @ref LayoutCache::clear() on @ref layoutCache().
+         */
+        void setLayoutCacheCapacity(UnsignedInt capacity);
+
     protected:
         /**
          * @brief Font metrics
@@ -557,6 +593,8 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
         } _fileCallbackTemplate{nullptr, nullptr};
 
         Float _size{}, _ascent{}, _descent{}, _lineHeight{};
+
+        Containers::Pointer<LayoutCache> _layoutCache;
 };
 
 /**
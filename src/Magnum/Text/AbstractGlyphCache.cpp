@@ -32,7 +32,7 @@
 
 namespace Magnum { namespace Text {
 
-AbstractGlyphCache::AbstractGlyphCache(const Vector2i& size, const Vector2i& padding): _size{size}, _padding{padding} {
+AbstractGlyphCache::AbstractGlyphCache(const Vector2i& size, const Vector2i& padding): _size{size}, _padding{padding}, _atlas{Containers::InPlaceInit, size, padding} {
     /* Default "Not Found" glyph. Can't do just `.insert({0, {}})` because
        that's ambiguous in C++17, due to a new insert(node_type&&) overload. */
     glyphs.insert({0, std::pair<Vector2i, Range2Di>{}});
@@ -41,12 +41,14 @@ AbstractGlyphCache::AbstractGlyphCache(const Vector2i& size, const Vector2i& pad
 AbstractGlyphCache::~AbstractGlyphCache() = default;
 
 std::vector<Range2Di> AbstractGlyphCache::reserve(const std::vector<Vector2i>& sizes) {
-    CORRADE_ASSERT((glyphs.size() == 1 && glyphs.at(0) == std::pair<Vector2i, Range2Di>()),
-        "Text::AbstractGlyphCache::reserve(): reserving space in non-empty cache is not yet implemented", {});
     glyphs.reserve(glyphs.size() + sizes.size());
-    return TextureTools::atlas(_size, sizes, _padding);
+    return _atlas->add(sizes);
 }
 
+Range2Di AbstractGlyphCache::dirtyRange() const { return _atlas->dirtyRange(); }
+
+void AbstractGlyphCache::resetDirtyRange() { _atlas->resetDirtyRange(); }
+
 void AbstractGlyphCache::insert(const UnsignedInt glyph, const Vector2i& position, const Range2Di& rectangle) {
     const std::pair<Vector2i, Range2Di> glyphData = {position-_padding, rectangle.padded(_padding)};
 
@@ -32,12 +32,17 @@
 
 #include <vector>
 #include <unordered_map>
+#include <Corrade/Containers/Pointer.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Math/Range.h"
 #include "Magnum/Text/visibility.h"
 
-namespace Magnum { namespace Text {
+namespace Magnum {
+
+namespace TextureTools { class AtlasPacker; }
+
+namespace Text {
 
 /**
 @brief Features supported by a particular glyph cache implementation
@@ -134,19 +139,47 @@ class MAGNUM_TEXT_EXPORT AbstractGlyphCache {
         /**
          * @brief Layout glyphs with given sizes to the cache
          *
-         * Returns non-overlapping regions in cache texture to store glyphs.
-         * The reserved space is reused on next call to @ref reserve() if no
-         * glyph was stored there, use @ref insert() to store actual glyph on
-         * given position and @ref setImage() to upload glyph image.
-         *
-         * Glyph @p sizes are expected to be without padding.
+         * Returns non-overlapping regions in cache texture to store glyphs,
+         * use @ref insert() to store actual glyph on given position and
+         * @ref setImage() to upload glyph image. The cache keeps track of the
+         * free space using a @ref TextureTools::AtlasPacker, so it's possible
+         * to call this function repeatedly to add more glyphs later. Regions
+         * returned from previous calls are never reused or moved, which means
+         * only the image of the newly added glyphs needs to be uploaded,
+         * ideally just the range returned by @ref dirtyRange(). The
+         * @ref GlyphCache and @ref DistanceFieldGlyphCache implementations
+         * do that automatically if the image passed to @ref setImage()
+         * covers the whole dirty range.
          *
-         * @attention Cache size must be large enough to contain all rendered
-         *      glyphs.
+         * Glyph @p sizes are expected to be without padding. Regions of
+         * glyphs added directly through @ref insert() are not known to this
+         * function and may get overlapped. If the glyphs don't fit into the
+         * remaining space, prints a message to @ref Error and returns an
+         * empty vector.
          * @see @ref padding()
          */
         std::vector<Range2Di> reserve(const std::vector<Vector2i>& sizes);
 
+        /**
+         * @brief Range of the cache texture modified by @ref reserve()
+         * @m_since_latest
+         *
+         * Bounding range of all glyph regions including padding returned by
+         * @ref reserve() since construction or since the last call to
+         * @ref resetDirtyRange().
+         */
+        Range2Di dirtyRange() const;
+
+        /**
+         * @brief Reset the dirty range
+         * @m_since_latest
+         *
+         * Call after uploading the glyph images covering @ref dirtyRange().
+         * The @ref GlyphCache and @ref DistanceFieldGlyphCache implementations
+         * call it from @ref setImage() if they uploaded the dirty range.
+         */
+        void resetDirtyRange();
+
         /**
          * @brief Insert glyph to cache
          * @param glyph         Glyph ID
@@ -200,6 +233,7 @@ class MAGNUM_TEXT_EXPORT AbstractGlyphCache {
 
         Vector2i _size, _padding;
         std::unordered_map<UnsignedInt, std::pair<Vector2i, Range2Di>> glyphs;
+        Containers::Pointer<TextureTools::AtlasPacker> _atlas;
 };
 
 }}
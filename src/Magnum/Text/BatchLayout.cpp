@@ -0,0 +1,390 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BatchLayout.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/Implementation/layout.h"
+
+namespace Magnum { namespace Text {
+
+namespace Implementation {
+
+Range2D layoutText(AbstractFont& font, const AbstractGlyphCache& cache, const Float size, const std::string& text, const Alignment alignment, std::vector<BatchLayout::Vertex>& vertices) {
+    /* Reserve memory as when the text would be ASCII-only. In reality the
+       actual vertex count will be smaller, but allocating more at once is
+       better than reallocating many times later. */
+    const std::size_t firstVertex = vertices.size();
+    vertices.reserve(firstVertex + text.size()*4);
+
+    /* Total rendered bounds, intial line position, line increment, last+1
+       vertex on previous line */
+    Range2D rectangle;
+    Vector2 linePosition;
+    const Vector2 lineAdvance = Vector2::yAxis(font.lineHeight()*size/font.size());
+    std::size_t lastLineLastVertex = firstVertex;
+
+    /* Temp buffer so we don't allocate for each new line */
+    /**
+     * @todo C++1z: use std::string_view to avoid the one allocation and all
+     *      the copying altogether
+     */
+    std::string line;
+    line.reserve(text.size());
+
+    /* Render each line separately and align it horizontally */
+    std::size_t pos, prevPos = 0;
+    do {
+        /* Empty line, nothing to do (the rest is done below in while expression) */
+        if((pos = text.find('\n', prevPos)) == prevPos) continue;
+
+        /* Copy the line into the temp buffer */
+        line.assign(text, prevPos, pos-prevPos);
+
+        /* Layout the line */
+        Containers::Pointer<AbstractLayouter> layouter = font.layout(cache, size, line);
+
+        /* Verify that we don't reallocate anything. The only problem might
+           arise when the layouter decides to compose one character from more
+           than one glyph (i.e. accents). Will remove the assert when this
+           issue arises. */
+        CORRADE_INTERNAL_ASSERT(vertices.size() + layouter->glyphCount()*4 <= vertices.capacity());
+
+        /* Bounds of rendered line */
+        Range2D lineRectangle;
+
+        /* Render all glyphs */
+        Vector2 cursorPosition(linePosition);
+        for(UnsignedInt i = 0; i != layouter->glyphCount(); ++i) {
+            Range2D quadPosition, textureCoordinates;
+            std::tie(quadPosition, textureCoordinates) = layouter->renderGlyph(i, cursorPosition, lineRectangle);
+
+            /* 0---2
+               |   |
+               |   |
+               |   |
+               1---3 */
+
+            vertices.insert(vertices.end(), {
+                {quadPosition.topLeft(), textureCoordinates.topLeft()},
+                {quadPosition.bottomLeft(), textureCoordinates.bottomLeft()},
+                {quadPosition.topRight(), textureCoordinates.topRight()},
+                {quadPosition.bottomRight(), textureCoordinates.bottomRight()}
+            });
+        }
+
+        /** @todo What about top-down text? */
+
+        /* Horizontally align the rendered line */
+        Float alignmentOffsetX = 0.0f;
+        if((UnsignedByte(alignment) & AlignmentHorizontal) == AlignmentCenter)
+            alignmentOffsetX = -lineRectangle.centerX();
+        else if((UnsignedByte(alignment) & AlignmentHorizontal) == AlignmentRight)
+            alignmentOffsetX = -lineRectangle.right();
+
+        /* Integer alignment */
+        if(UnsignedByte(alignment) & AlignmentIntegral)
+            alignmentOffsetX = Math::round(alignmentOffsetX);
+
+        /* Align positions and bounds on current line */
+        lineRectangle = lineRectangle.translated(Vector2::xAxis(alignmentOffsetX));
+        for(auto it = vertices.begin()+lastLineLastVertex; it != vertices.end(); ++it)
+            it->position.x() += alignmentOffsetX;
+
+        /* Add final line bounds to total bounds, similarly to AbstractFont::renderGlyph() */
+        if(!rectangle.size().isZero()) {
+            rectangle.bottomLeft() = Math::min(rectangle.bottomLeft(), lineRectangle.bottomLeft());
+            rectangle.topRight() = Math::max(rectangle.topRight(), lineRectangle.topRight());
+        } else rectangle = lineRectangle;
+
+    /* Move to next line */
+    } while(prevPos = pos+1,
+            linePosition -= lineAdvance,
+            lastLineLastVertex = vertices.size(),
+            pos != std::string::npos);
+
+    /* Vertically align the rendered text */
+    Float alignmentOffsetY = 0.0f;
+    if((UnsignedByte(alignment) & AlignmentVertical) == AlignmentMiddle)
+        alignmentOffsetY = -rectangle.centerY();
+    else if((UnsignedByte(alignment) & AlignmentVertical) == AlignmentTop)
+        alignmentOffsetY = -rectangle.top();
+
+    /* Integer alignment */
+    if(UnsignedByte(alignment) & AlignmentIntegral)
+        alignmentOffsetY = Math::round(alignmentOffsetY);
+
+    /* Align positions and bounds */
+    rectangle = rectangle.translated(Vector2::yAxis(alignmentOffsetY));
+    for(auto it = vertices.begin()+firstVertex; it != vertices.end(); ++it)
+        it->position.y() += alignmentOffsetY;
+
+    return rectangle;
+}
+
+}
+
+namespace {
+
+struct Item {
+    UnsignedInt glyphOffset, glyphCapacity, glyphCount;
+    Alignment alignment;
+    bool used;
+    Vector2 position;
+    /* Without the position applied */
+    Range2D rectangle;
+};
+
+}
+
+struct BatchLayout::State {
+    explicit State(AbstractFont& font, const AbstractGlyphCache& cache, Float size): font(font), cache(cache), size{size} {}
+
+    AbstractFont& font;
+    const AbstractGlyphCache& cache;
+    Float size;
+
+    std::vector<Vertex> vertices;
+    std::vector<Item> items;
+    std::vector<UnsignedInt> freeIds;
+    /* Offset and size of free glyph ranges, sorted by offset */
+    std::vector<std::pair<UnsignedInt, UnsignedInt>> freeGlyphs;
+    /* Temp buffer so we don't allocate on each change */
+    std::vector<Vertex> scratch;
+
+    UnsignedInt textCount{}, glyphCount{};
+    /* Empty if begin >= end */
+    UnsignedInt dirtyBegin{~UnsignedInt{}}, dirtyEnd{};
+};
+
+BatchLayout::BatchLayout(AbstractFont& font, const AbstractGlyphCache& cache, const Float size): _state{Containers::InPlaceInit, font, cache, size} {}
+
+BatchLayout::BatchLayout(BatchLayout&&) noexcept = default;
+
+BatchLayout::~BatchLayout() = default;
+
+BatchLayout& BatchLayout::operator=(BatchLayout&&) noexcept = default;
+
+Float BatchLayout::size() const { return _state->size; }
+
+UnsignedInt BatchLayout::textCount() const { return _state->textCount; }
+
+UnsignedInt BatchLayout::glyphCount() const { return _state->glyphCount; }
+
+UnsignedInt BatchLayout::glyphCapacity() const {
+    return _state->vertices.size()/4;
+}
+
+Containers::ArrayView<const BatchLayout::Vertex> BatchLayout::vertices() const {
+    return {_state->vertices.data(), _state->vertices.size()};
+}
+
+UnsignedInt BatchLayout::add(const std::string& text, const Vector2& position, const Alignment alignment) {
+    State& state = *_state;
+
+    /* Reuse an ID of a removed text, if there's any */
+    UnsignedInt id;
+    if(!state.freeIds.empty()) {
+        id = state.freeIds.back();
+        state.freeIds.pop_back();
+    } else {
+        id = state.items.size();
+        state.items.emplace_back();
+    }
+
+    state.items[id] = Item{0, 0, 0, alignment, true, position, {}};
+    ++state.textCount;
+    layoutInternal(id, text);
+    return id;
+}
+
+BatchLayout& BatchLayout::setText(const UnsignedInt id, const std::string& text) {
+    CORRADE_ASSERT(id < _state->items.size() && _state->items[id].used,
+        "Text::BatchLayout::setText(): invalid ID" << id, *this);
+    layoutInternal(id, text);
+    return *this;
+}
+
+BatchLayout& BatchLayout::setPosition(const UnsignedInt id, const Vector2& position) {
+    CORRADE_ASSERT(id < _state->items.size() && _state->items[id].used,
+        "Text::BatchLayout::setPosition(): invalid ID" << id, *this);
+
+    /* Translate the existing glyphs, no need to lay out again */
+    Item& item = _state->items[id];
+    const Vector2 delta = position - item.position;
+    for(std::size_t i = item.glyphOffset*4, end = (item.glyphOffset + item.glyphCount)*4; i != end; ++i)
+        _state->vertices[i].position += delta;
+    item.position = position;
+
+    markDirty(item.glyphOffset, item.glyphOffset + item.glyphCount);
+    return *this;
+}
+
+BatchLayout& BatchLayout::remove(const UnsignedInt id) {
+    CORRADE_ASSERT(id < _state->items.size() && _state->items[id].used,
+        "Text::BatchLayout::remove(): invalid ID" << id, *this);
+
+    Item& item = _state->items[id];
+    freeGlyphs(item.glyphOffset, item.glyphCapacity);
+    _state->glyphCount -= item.glyphCount;
+    --_state->textCount;
+    item = Item{0, 0, 0, Alignment::LineLeft, false, {}, {}};
+    _state->freeIds.push_back(id);
+    return *this;
+}
+
+Vector2 BatchLayout::position(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _state->items.size() && _state->items[id].used,
+        "Text::BatchLayout::position(): invalid ID" << id, {});
+    return _state->items[id].position;
+}
+
+Range2D BatchLayout::rectangle(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _state->items.size() && _state->items[id].used,
+        "Text::BatchLayout::rectangle(): invalid ID" << id, {});
+    const Item& item = _state->items[id];
+    return item.rectangle.translated(item.position);
+}
+
+UnsignedInt BatchLayout::glyphOffset(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _state->items.size() && _state->items[id].used,
+        "Text::BatchLayout::glyphOffset(): invalid ID" << id, {});
+    return _state->items[id].glyphOffset;
+}
+
+UnsignedInt BatchLayout::glyphCount(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _state->items.size() && _state->items[id].used,
+        "Text::BatchLayout::glyphCount(): invalid ID" << id, {});
+    return _state->items[id].glyphCount;
+}
+
+std::pair<UnsignedInt, UnsignedInt> BatchLayout::dirtyGlyphs() const {
+    const UnsignedInt end = Math::min(_state->dirtyEnd, glyphCapacity());
+    if(_state->dirtyBegin >= end) return {};
+    return {_state->dirtyBegin, end};
+}
+
+void BatchLayout::resetDirtyGlyphs() {
+    _state->dirtyBegin = ~UnsignedInt{};
+    _state->dirtyEnd = 0;
+}
+
+void BatchLayout::layoutInternal(const UnsignedInt id, const std::string& text) {
+    State& state = *_state;
+
+    state.scratch.clear();
+    const Range2D rectangle = Implementation::layoutText(state.font, state.cache, state.size, text, state.items[id].alignment, state.scratch);
+    const UnsignedInt glyphCount = state.scratch.size()/4;
+
+    /* If the text doesn't fit into its current range, move it elsewhere and
+       double the capacity so it doesn't need to move again on the next
+       change. The newly allocated range is either already degenerate or
+       marked as dirty, so only the glyphs that are written need to be marked
+       as dirty below. */
+    Item& item = state.items[id];
+    UnsignedInt previousGlyphCount = item.glyphCount;
+    if(glyphCount > item.glyphCapacity) {
+        const UnsignedInt capacity = Math::max(glyphCount, item.glyphCapacity*2);
+        freeGlyphs(item.glyphOffset, item.glyphCapacity);
+        item.glyphOffset = allocateGlyphs(capacity);
+        item.glyphCapacity = capacity;
+        previousGlyphCount = 0;
+    }
+
+    /* Copy the glyphs, make the rest of the previously used glyphs
+       degenerate */
+    Vertex* const out = state.vertices.data() + item.glyphOffset*4;
+    for(std::size_t i = 0; i != state.scratch.size(); ++i)
+        out[i] = {state.scratch[i].position + item.position, state.scratch[i].textureCoordinates};
+    for(std::size_t i = glyphCount*4; i < previousGlyphCount*4; ++i)
+        out[i] = {};
+    markDirty(item.glyphOffset, item.glyphOffset + Math::max(glyphCount, previousGlyphCount));
+
+    state.glyphCount = state.glyphCount - item.glyphCount + glyphCount;
+    item.glyphCount = glyphCount;
+    item.rectangle = rectangle;
+}
+
+UnsignedInt BatchLayout::allocateGlyphs(const UnsignedInt count) {
+    State& state = *_state;
+
+    /* Take the first free range that's large enough */
+    for(auto it = state.freeGlyphs.begin(); it != state.freeGlyphs.end(); ++it) {
+        if(it->second < count) continue;
+
+        const UnsignedInt offset = it->first;
+        it->first += count;
+        it->second -= count;
+        if(!it->second) state.freeGlyphs.erase(it);
+        return offset;
+    }
+
+    /* Otherwise append to the end. The appended glyphs are degenerate, but
+       the range could have been trimmed away before and still contain stale
+       data on the GPU, so mark it dirty. */
+    const UnsignedInt offset = glyphCapacity();
+    state.vertices.resize(state.vertices.size() + count*4);
+    markDirty(offset, offset + count);
+    return offset;
+}
+
+void BatchLayout::freeGlyphs(const UnsignedInt offset, const UnsignedInt count) {
+    if(!count) return;
+
+    State& state = *_state;
+
+    /* Make the glyphs degenerate */
+    std::fill(state.vertices.begin() + offset*4, state.vertices.begin() + (offset + count)*4, Vertex{});
+    markDirty(offset, offset + count);
+
+    /* Insert the range to the sorted free list, merging it with neighbors */
+    auto it = state.freeGlyphs.insert(std::lower_bound(state.freeGlyphs.begin(), state.freeGlyphs.end(), std::make_pair(offset, count)), std::make_pair(offset, count));
+    if(it + 1 != state.freeGlyphs.end() && it->first + it->second == (it + 1)->first) {
+        it->second += (it + 1)->second;
+        state.freeGlyphs.erase(it + 1);
+    }
+    if(it != state.freeGlyphs.begin() && (it - 1)->first + (it - 1)->second == it->first) {
+        (it - 1)->second += it->second;
+        it = state.freeGlyphs.erase(it) - 1;
+    }
+
+    /* If the free range is at the end, trim it away */
+    if(it->first + it->second == glyphCapacity()) {
+        state.vertices.resize(it->first*4);
+        state.freeGlyphs.erase(it);
+    }
+}
+
+void BatchLayout::markDirty(const UnsignedInt begin, const UnsignedInt end) {
+    if(begin >= end) return;
+    _state->dirtyBegin = Math::min(_state->dirtyBegin, begin);
+    _state->dirtyEnd = Math::max(_state->dirtyEnd, end);
+}
+
+}}
@@ -0,0 +1,258 @@
+#ifndef Magnum_Text_BatchLayout_h
+#define Magnum_Text_BatchLayout_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Text::BatchLayout
+ * @m_since_latest
+ */
+
+#include <string>
+#include <utility>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Text/Alignment.h"
+#include "Magnum/Text/visibility.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Layout of many texts in a single vertex array
+@m_since_latest
+
+Lays out many strings into a single shared vertex array, with each text
+occupying a contiguous range of glyphs. When a text changes, only that text is
+laid out again and only its glyph range is marked as changed, so a GPU-side
+copy can be updated incrementally and everything drawn with a single draw
+call. The class doesn't depend on any GPU API, see @ref BatchRenderer for a
+renderer that uploads the data to OpenGL buffers.
+
+@section Text-BatchLayout-usage Usage
+
+Texts are added with @ref add(), which returns an ID that can be used to
+change the text contents or position later with @ref setText() and
+@ref setPosition(), or to remove it with @ref remove(). IDs of removed texts
+get reused by subsequent @ref add() calls.
+
+@snippet MagnumText.cpp BatchLayout-usage
+
+@section Text-BatchLayout-data Data layout
+
+Each glyph is a quad made of four @ref Vertex items, ordered in the same way as
+in @ref Renderer. The texts are placed one after another in @ref vertices().
+If a text gets longer than the glyph range it originally occupied, it's moved
+to a free range large enough or to the end of the array, with its capacity
+doubled to avoid moving again on the next change. The unused glyphs in a text
+range as well as glyph ranges of moved and removed texts are filled with
+degenerate quads that have all vertices at the origin. These don't produce
+any fragments when drawn, which means the whole array can be drawn at once
+regardless of holes. Free ranges are reused for subsequently added or moved
+texts, and free ranges at the end of the array are trimmed away.
+
+The glyphs changed since the last call to @ref resetDirtyGlyphs() are
+available through @ref dirtyGlyphs().
+*/
+class MAGNUM_TEXT_EXPORT BatchLayout {
+    public:
+        /**
+         * @brief Vertex
+         *
+         * Layout matches the attributes of @ref Shaders::AbstractVector.
+         */
+        struct Vertex {
+            /** @brief Position */
+            Vector2 position;
+
+            /** @brief Texture coordinates */
+            Vector2 textureCoordinates;
+        };
+
+        /**
+         * @brief Constructor
+         * @param font          Font
+         * @param cache         Glyph cache
+         * @param size          Font size
+         *
+         * The @p font and @p cache are expected to stay in scope for the
+         * whole lifetime of the instance.
+         */
+        explicit BatchLayout(AbstractFont& font, const AbstractGlyphCache& cache, Float size);
+        BatchLayout(AbstractFont&, AbstractGlyphCache&&, Float) = delete; /**< @overload */
+
+        /** @brief Copying is not allowed */
+        BatchLayout(const BatchLayout&) = delete;
+
+        /** @brief Move constructor */
+        BatchLayout(BatchLayout&&) noexcept;
+
+        ~BatchLayout();
+
+        /** @brief Copying is not allowed */
+        BatchLayout& operator=(const BatchLayout&) = delete;
+
+        /** @brief Move assignment */
+        BatchLayout& operator=(BatchLayout&&) noexcept;
+
+        /** @brief Font size */
+        Float size() const;
+
+        /**
+         * @brief Count of texts
+         *
+         * Doesn't include removed texts.
+         */
+        UnsignedInt textCount() const;
+
+        /**
+         * @brief Count of glyphs in all texts
+         *
+         * Doesn't include unused glyphs, see @ref glyphCapacity() for the
+         * total count of glyphs in @ref vertices().
+         */
+        UnsignedInt glyphCount() const;
+
+        /**
+         * @brief Capacity for glyphs
+         *
+         * Count of glyphs in @ref vertices(), including degenerate quads for
+         * unused glyphs. This is the glyph count that needs to be drawn.
+         */
+        UnsignedInt glyphCapacity() const;
+
+        /**
+         * @brief Vertices
+         *
+         * Contains four vertices for each glyph, size is four times
+         * @ref glyphCapacity(). The view is invalidated by any call that
+         * changes the layout.
+         */
+        Containers::ArrayView<const Vertex> vertices() const;
+
+        /**
+         * @brief Add a text
+         * @param text          Text to lay out
+         * @param position      Position of the text origin
+         * @param alignment     Text alignment
+         * @return ID of the text
+         *
+         * The text is laid out relative to @p position the same way as with
+         * @ref Renderer::render(). Marks the glyph range of the text as dirty.
+         */
+        UnsignedInt add(const std::string& text, const Vector2& position = {}, Alignment alignment = Alignment::LineLeft);
+
+        /**
+         * @brief Set text contents
+         * @return Reference to self (for method chaining)
+         *
+         * Lays out the text again and marks its glyph range as dirty. Other
+         * texts are left untouched. Expects that @p id is a valid text ID.
+         */
+        BatchLayout& setText(UnsignedInt id, const std::string& text);
+
+        /**
+         * @brief Set text position
+         * @return Reference to self (for method chaining)
+         *
+         * Translates already laid out glyphs without laying out the text
+         * again and marks its glyph range as dirty. Expects that @p id is a
+         * valid text ID.
+         */
+        BatchLayout& setPosition(UnsignedInt id, const Vector2& position);
+
+        /**
+         * @brief Remove a text
+         * @return Reference to self (for method chaining)
+         *
+         * Fills the glyph range of the text with degenerate quads and marks
+         * it as dirty. The ID gets reused by subsequent @ref add() calls.
+         * Expects that @p id is a valid text ID.
+         */
+        BatchLayout& remove(UnsignedInt id);
+
+        /**
+         * @brief Text position
+         *
+         * Expects that @p id is a valid text ID.
+         */
+        Vector2 position(UnsignedInt id) const;
+
+        /**
+         * @brief Rectangle spanning the text
+         *
+         * Includes the text position. Expects that @p id is a valid text ID.
+         */
+        Range2D rectangle(UnsignedInt id) const;
+
+        /**
+         * @brief Offset of the text in glyphs
+         *
+         * Multiply by @cpp 4 @ce to get an offset into @ref vertices() or by
+         * @cpp 6 @ce to get an offset into an index buffer, for example to
+         * draw just this text. Expects that @p id is a valid text ID.
+         */
+        UnsignedInt glyphOffset(UnsignedInt id) const;
+
+        /**
+         * @brief Count of glyphs in the text
+         *
+         * Expects that @p id is a valid text ID.
+         */
+        UnsignedInt glyphCount(UnsignedInt id) const;
+
+        /**
+         * @brief Glyph range changed since the last reset
+         *
+         * Returns the first and one-after-last glyph that changed since the
+         * last call to @ref resetDirtyGlyphs(). If nothing changed, both
+         * values are the same. The range is clamped to @ref glyphCapacity().
+         */
+        std::pair<UnsignedInt, UnsignedInt> dirtyGlyphs() const;
+
+        /**
+         * @brief Reset the dirty glyph range
+         *
+         * Call after the changed glyphs were processed, for example uploaded
+         * to a GPU buffer.
+         */
+        void resetDirtyGlyphs();
+
+    private:
+        struct State;
+
+        MAGNUM_TEXT_LOCAL void layoutInternal(UnsignedInt id, const std::string& text);
+        MAGNUM_TEXT_LOCAL UnsignedInt allocateGlyphs(UnsignedInt count);
+        MAGNUM_TEXT_LOCAL void freeGlyphs(UnsignedInt offset, UnsignedInt count);
+        MAGNUM_TEXT_LOCAL void markDirty(UnsignedInt begin, UnsignedInt end);
+
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
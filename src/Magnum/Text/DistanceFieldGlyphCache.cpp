@@ -32,6 +32,7 @@
 #include "Magnum/GL/PixelFormat.h"
 #endif
 #include "Magnum/GL/TextureFormat.h"
+#include "Magnum/Text/Implementation/glyphCache.h"
 #include "Magnum/TextureTools/DistanceField.h"
 
 namespace Magnum { namespace Text {
@@ -59,7 +60,14 @@ DistanceFieldGlyphCache::DistanceFieldGlyphCache(const Vector2i& originalSize, c
     #endif
 }
 
-void DistanceFieldGlyphCache::doSetImage(const Vector2i& offset, const ImageView2D& image) {
+void DistanceFieldGlyphCache::doSetImage(const Vector2i& fullOffset, const ImageView2D& fullImage) {
+    /* Process only the part with glyphs added since the last upload, if the
+       image contains all of them. The dirty range includes the padding, so
+       the distance field radius is covered as well. */
+    Vector2i offset = fullOffset;
+    ImageView2D image = fullImage;
+    const bool dirty = Implementation::cropToDirtyRange(*this, offset, image);
+
     GL::Texture2D input;
     input.setWrapping(GL::SamplerWrapping::ClampToEdge)
         .setMinificationFilter(GL::SamplerFilter::Linear)
@@ -92,6 +100,8 @@ void DistanceFieldGlyphCache::doSetImage(const Vector2i& offset, const ImageView
 
     /* Create distance field from input texture */
     _distanceField(input, texture(), Range2Di::fromSize(offset*_scale, image.size()*_scale), image.size());
+
+    if(dirty) resetDirtyRange();
 }
 
 void DistanceFieldGlyphCache::setDistanceFieldImage(const Vector2i& offset, const ImageView2D& image) {
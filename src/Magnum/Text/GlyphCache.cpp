@@ -26,14 +26,47 @@
 #include "GlyphCache.h"
 
 #include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/TextureFormat.h"
+#include "Magnum/Text/Implementation/glyphCache.h"
 #include "Magnum/TextureTools/Atlas.h"
 
 namespace Magnum { namespace Text {
 
+namespace Implementation {
+
+bool cropToDirtyRange(const AbstractGlyphCache& cache, Vector2i& offset, ImageView2D& image) {
+    Range2Di dirty = cache.dirtyRange();
+    const Range2Di range = Range2Di::fromSize(offset, image.size());
+    if(!dirty.size().product() || !range.contains(dirty)) return false;
+
+    /* Cropping the columns needs a non-default row length, which isn't
+       available on ES2 without EXT_unpack_subimage, crop just the rows
+       there */
+    #ifdef MAGNUM_TARGET_GLES2
+    #ifndef MAGNUM_TARGET_WEBGL
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::unpack_subimage>())
+    #endif
+    {
+        dirty.min().x() = range.min().x();
+        dirty.max().x() = range.max().x();
+    }
+    #endif
+
+    PixelStorage storage = image.storage();
+    if(dirty.size().x() != image.size().x() && !storage.rowLength())
+        storage.setRowLength(image.size().x());
+    storage.setSkip(storage.skip() + Vector3i{dirty.min() - offset, 0});
+    image = ImageView2D{storage, image.format(), image.formatExtra(), image.pixelSize(), dirty.size(), image.data()};
+    offset = dirty.min();
+    return true;
+}
+
+}
+
 GlyphCache::GlyphCache(const GL::TextureFormat internalFormat, const Vector2i& size, const Vector2i& padding): GlyphCache{internalFormat, size, size, padding} {}
 
 GlyphCache::GlyphCache(const GL::TextureFormat internalFormat, const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): AbstractGlyphCache{originalSize, padding} {
@@ -70,8 +103,16 @@ GlyphCacheFeatures GlyphCache::doFeatures() const {
 }
 
 void GlyphCache::doSetImage(const Vector2i& offset, const ImageView2D& image) {
+    /* Upload only the part with glyphs added since the last upload, if the
+       image contains all of them */
+    Vector2i croppedOffset = offset;
+    ImageView2D cropped = image;
+    const bool dirty = Implementation::cropToDirtyRange(*this, croppedOffset, cropped);
+
     /** @todo some internalformat/format checking also here (if querying internal format is not slow) */
-    _texture.setSubImage(0, offset, image);
+    _texture.setSubImage(0, croppedOffset, cropped);
+
+    if(dirty) resetDirtyRange();
 }
 
 #ifndef MAGNUM_TARGET_GLES
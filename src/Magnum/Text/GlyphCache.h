@@ -51,6 +51,19 @@ Create GlyphCache object with sufficient size and then call
 
 See @ref Renderer for information about text rendering.
 
+@section Text-GlyphCache-incremental Incremental filling
+
+If the image passed to @ref setImage() covers the whole
+@ref AbstractGlyphCache::dirtyRange() "dirtyRange()", only the dirty part of
+it is uploaded to the texture and the dirty range is reset afterwards. Adding
+a few glyphs to an already filled cache using @ref reserve() and then passing
+the whole cache image to @ref setImage() thus uploads just the new glyphs. On
+@ref MAGNUM_TARGET_GLES2 "OpenGL ES 2.0" without
+@gl_extension{EXT,unpack_subimage} and on WebGL 1.0 the upload is restricted
+only to rows covering the dirty range. The same applies to
+@ref DistanceFieldGlyphCache, which processes only the dirty part of the
+image.
+
 This class supports the @ref GlyphCacheFeature::ImageDownload (and thus calling
 @ref image()) only on desktop OpenGL, due to using @ref GL::Texture::image(),
 which is not available on @ref MAGNUM_TARGET_GLES "OpenGL ES" platforms.
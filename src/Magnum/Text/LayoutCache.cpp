@@ -0,0 +1,234 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "LayoutCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <unordered_map>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Math/Range.h"
+#include "Magnum/Text/AbstractFont.h"
+
+namespace Magnum { namespace Text {
+
+namespace {
+
+struct Glyph {
+    Range2D quadPosition, textureCoordinates;
+    Vector2 advance;
+};
+
+struct Entry {
+    const AbstractGlyphCache* cache;
+    Float size;
+    std::string text;
+    std::size_t glyphOffset;
+    UnsignedInt glyphCount;
+};
+
+/* Points to the text stored in the entry (or to the queried string during
+   lookup) so the string doesn't need to be stored twice */
+struct Key {
+    const AbstractGlyphCache* cache;
+    Float size;
+    const std::string* text;
+};
+
+struct KeyHash {
+    std::size_t operator()(const Key& key) const {
+        UnsignedInt size;
+        std::memcpy(&size, &key.size, sizeof(Float));
+        std::size_t hash = std::hash<std::string>{}(*key.text);
+        hash ^= std::hash<const void*>{}(key.cache) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<UnsignedInt>{}(size) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash;
+    }
+};
+
+struct KeyEqual {
+    bool operator()(const Key& a, const Key& b) const {
+        return a.cache == b.cache && a.size == b.size && *a.text == *b.text;
+    }
+};
+
+class CachedLayouter: public AbstractLayouter {
+    public:
+        explicit CachedLayouter(Containers::Array<Glyph>&& glyphs): AbstractLayouter{UnsignedInt(glyphs.size())}, _glyphs{std::move(glyphs)} {}
+
+    private:
+        std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(const UnsignedInt i) override {
+            return std::make_tuple(_glyphs[i].quadPosition, _glyphs[i].textureCoordinates, _glyphs[i].advance);
+        }
+
+        Containers::Array<Glyph> _glyphs;
+};
+
+}
+
+struct LayoutCache::State {
+    explicit State(UnsignedInt capacity): capacity{capacity} {}
+
+    UnsignedInt capacity;
+
+    /* Most recently used first */
+    std::list<Entry> entries;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash, KeyEqual> lookup;
+
+    /* Glyphs of all entries, glyphs of evicted entries stay in place until
+       the array gets compacted */
+    std::vector<Glyph> glyphs;
+    std::size_t usedGlyphCount{};
+
+    UnsignedLong hitCount{}, missCount{}, evictionCount{};
+
+    void remove(std::list<Entry>::iterator it);
+};
+
+void LayoutCache::State::remove(const std::list<Entry>::iterator it) {
+    lookup.erase(Key{it->cache, it->size, &it->text});
+    usedGlyphCount -= it->glyphCount;
+    entries.erase(it);
+}
+
+LayoutCache::LayoutCache(const UnsignedInt capacity): _state{Containers::InPlaceInit, capacity} {}
+
+LayoutCache::LayoutCache(LayoutCache&&) noexcept = default;
+
+LayoutCache::~LayoutCache() = default;
+
+LayoutCache& LayoutCache::operator=(LayoutCache&&) noexcept = default;
+
+UnsignedInt LayoutCache::capacity() const { return _state->capacity; }
+
+UnsignedInt LayoutCache::size() const { return _state->entries.size(); }
+
+std::size_t LayoutCache::glyphCount() const { return _state->usedGlyphCount; }
+
+UnsignedLong LayoutCache::hitCount() const { return _state->hitCount; }
+
+UnsignedLong LayoutCache::missCount() const { return _state->missCount; }
+
+UnsignedLong LayoutCache::evictionCount() const { return _state->evictionCount; }
+
+Float LayoutCache::hitRate() const {
+    const UnsignedLong lookupCount = _state->hitCount + _state->missCount;
+    return lookupCount ? Float(Double(_state->hitCount)/Double(lookupCount)) : 0.0f;
+}
+
+void LayoutCache::resetStatistics() {
+    _state->hitCount = _state->missCount = _state->evictionCount = 0;
+}
+
+void LayoutCache::clear() {
+    _state->lookup.clear();
+    _state->entries.clear();
+    _state->glyphs.clear();
+    _state->usedGlyphCount = 0;
+}
+
+Containers::Pointer<AbstractLayouter> LayoutCache::find(const AbstractGlyphCache& cache, const Float size, const std::string& text) {
+    State& state = *_state;
+
+    const auto found = state.lookup.find(Key{&cache, size, &text});
+    if(found == state.lookup.end()) {
+        ++state.missCount;
+        return nullptr;
+    }
+
+    ++state.hitCount;
+
+    /* Mark as most recently used. Splicing doesn't invalidate the iterator
+       or the text pointer in the key. */
+    const std::list<Entry>::iterator it = found->second;
+    state.entries.splice(state.entries.begin(), state.entries, it);
+
+    /* Copy the glyphs out so the layouter stays valid even if the entry gets
+       evicted */
+    Containers::Array<Glyph> glyphs{Containers::NoInit, it->glyphCount};
+    std::copy(state.glyphs.begin() + it->glyphOffset,
+              state.glyphs.begin() + it->glyphOffset + it->glyphCount,
+              glyphs.begin());
+    return Containers::Pointer<AbstractLayouter>{new CachedLayouter{std::move(glyphs)}};
+}
+
+Containers::Pointer<AbstractLayouter> LayoutCache::insert(const AbstractGlyphCache& cache, const Float size, const std::string& text, AbstractLayouter& layouter) {
+    State& state = *_state;
+
+    /* Render the glyphs, each with a zero cursor and an empty rectangle to
+       get back the original quad position and advance */
+    const UnsignedInt glyphCount = layouter.glyphCount();
+    Containers::Array<Glyph> glyphs{Containers::NoInit, glyphCount};
+    for(UnsignedInt i = 0; i != glyphCount; ++i) {
+        Vector2 cursorPosition;
+        Range2D rectangle;
+        Range2D quadPosition, textureCoordinates;
+        std::tie(quadPosition, textureCoordinates) = layouter.renderGlyph(i, cursorPosition, rectangle);
+        glyphs[i] = Glyph{quadPosition, textureCoordinates, cursorPosition};
+    }
+
+    if(state.capacity) {
+        /* Replace an existing entry, otherwise evict the least recently used
+           one if there's no space left */
+        const auto found = state.lookup.find(Key{&cache, size, &text});
+        if(found != state.lookup.end())
+            state.remove(found->second);
+        else if(state.entries.size() == state.capacity) {
+            state.remove(std::prev(state.entries.end()));
+            ++state.evictionCount;
+        }
+
+        /* If the evicted glyphs outnumber the used ones, compact the array.
+           Done before adding the new glyphs so they don't get copied
+           twice. */
+        if(state.glyphs.size() > 2*state.usedGlyphCount) {
+            std::vector<Glyph> compacted;
+            compacted.reserve(state.usedGlyphCount + glyphCount);
+            for(Entry& entry: state.entries) {
+                const std::size_t offset = compacted.size();
+                compacted.insert(compacted.end(),
+                    state.glyphs.begin() + entry.glyphOffset,
+                    state.glyphs.begin() + entry.glyphOffset + entry.glyphCount);
+                entry.glyphOffset = offset;
+            }
+            state.glyphs = std::move(compacted);
+        }
+
+        state.entries.push_front(Entry{&cache, size, text, state.glyphs.size(), glyphCount});
+        const Entry& entry = state.entries.front();
+        state.lookup.emplace(Key{entry.cache, entry.size, &entry.text}, state.entries.begin());
+        state.glyphs.insert(state.glyphs.end(), glyphs.begin(), glyphs.end());
+        state.usedGlyphCount += glyphCount;
+    }
+
+    return Containers::Pointer<AbstractLayouter>{new CachedLayouter{std::move(glyphs)}};
+}
+
+}}
@@ -0,0 +1,175 @@
+#ifndef Magnum_Text_LayoutCache_h
+#define Magnum_Text_LayoutCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Text::LayoutCache
+ * @m_since_latest
+ */
+
+#include <string>
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Text/Text.h"
+#include "Magnum/Text/visibility.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Text layout cache
+@m_since_latest
+
+Least-recently-used cache of glyph runs produced by @ref AbstractFont::layout().
+Usually it's not used directly but enabled on a font through
+@ref AbstractFont::setLayoutCacheCapacity(), after which repeated layouting
+of the same text with the same glyph cache and size returns a layouter
+replaying the cached glyphs instead of calling into the font plugin again:
+
+@snippet MagnumText.cpp LayoutCache-usage
+
+@section Text-LayoutCache-storage Storage
+
+For each glyph, the cache stores its quad position, texture coordinates and
+advance, all glyphs of all cached texts in a single contiguous array. When a
+text is evicted, its glyphs are left in place and the array is compacted
+once the unused glyphs outnumber the used ones. The cache is keyed on the
+glyph cache instance, text size and the text itself, the font is implicit
+as each font has its own cache.
+
+@section Text-LayoutCache-statistics Statistics
+
+The @ref hitCount(), @ref missCount() and @ref evictionCount() can be used
+to size the cache appropriately --- a high eviction count together with a
+low @ref hitRate() means the cache is too small for the working set. The
+statistics are kept across @ref clear() and can be reset using
+@ref resetStatistics().
+*/
+class MAGNUM_TEXT_EXPORT LayoutCache {
+    public:
+        /**
+         * @brief Constructor
+         * @param capacity  Max count of cached texts
+         *
+         * If @p capacity is @cpp 0 @ce, nothing is cached.
+         */
+        explicit LayoutCache(UnsignedInt capacity);
+
+        /** @brief Copying is not allowed */
+        LayoutCache(const LayoutCache&) = delete;
+
+        /** @brief Move constructor */
+        LayoutCache(LayoutCache&&) noexcept;
+
+        ~LayoutCache();
+
+        /** @brief Copying is not allowed */
+        LayoutCache& operator=(const LayoutCache&) = delete;
+
+        /** @brief Move assignment */
+        LayoutCache& operator=(LayoutCache&&) noexcept;
+
+        /** @brief Max count of cached texts */
+        UnsignedInt capacity() const;
+
+        /** @brief Count of cached texts */
+        UnsignedInt size() const;
+
+        /** @brief Count of glyphs in all cached texts */
+        std::size_t glyphCount() const;
+
+        /**
+         * @brief Count of cache hits
+         *
+         * Incremented on each @ref find() that returned a cached layout.
+         */
+        UnsignedLong hitCount() const;
+
+        /**
+         * @brief Count of cache misses
+         *
+         * Incremented on each @ref find() that didn't find the text.
+         */
+        UnsignedLong missCount() const;
+
+        /**
+         * @brief Count of evictions
+         *
+         * Incremented each time the least recently used text is removed to
+         * make room for a new one.
+         */
+        UnsignedLong evictionCount() const;
+
+        /**
+         * @brief Hit rate
+         *
+         * Ratio of @ref hitCount() to the sum of @ref hitCount() and
+         * @ref missCount(), or @cpp 0.0f @ce if there were no lookups yet.
+         */
+        Float hitRate() const;
+
+        /** @brief Reset hit, miss and eviction counters */
+        void resetStatistics();
+
+        /**
+         * @brief Clear the cache
+         *
+         * Removes all cached texts, doesn't reset the statistics. Called
+         * from @ref AbstractFont::close() and
+         * @ref AbstractFont::fillGlyphCache(), as the cached layouts are not
+         * valid anymore after.
+         */
+        void clear();
+
+        /**
+         * @brief Find a cached layout
+         *
+         * If there's a layout for given @p cache, @p size and @p text, marks
+         * it as most recently used and returns a layouter replaying it.
+         * Otherwise returns @cpp nullptr @ce. Updates @ref hitCount() or
+         * @ref missCount().
+         */
+        Containers::Pointer<AbstractLayouter> find(const AbstractGlyphCache& cache, Float size, const std::string& text);
+
+        /**
+         * @brief Insert a layout
+         *
+         * Renders all glyphs of @p layouter, stores them as the most recently
+         * used entry for given @p cache, @p size and @p text, evicting the
+         * least recently used entry if @ref capacity() is reached, and returns
+         * a layouter replaying them. If an entry for the same key already
+         * exists, it's replaced.
+         */
+        Containers::Pointer<AbstractLayouter> insert(const AbstractGlyphCache& cache, Float size, const std::string& text, AbstractLayouter& layouter);
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
@@ -36,6 +36,7 @@
 #include "Magnum/Shaders/AbstractVector.h"
 #include "Magnum/Text/AbstractFont.h"
 #include "Magnum/Text/GlyphCache.h"
+#include "Magnum/Text/Implementation/layout.h"
 
 namespace Magnum { namespace Text {
 
@@ -61,118 +62,11 @@ template<class T> void createIndices(void* output, const UnsignedInt glyphCount)
     }
 }
 
-struct Vertex {
-    Vector2 position, textureCoordinates;
-};
+typedef BatchLayout::Vertex Vertex;
 
 std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& font, const GlyphCache& cache, const Float size, const std::string& text, const Alignment alignment) {
-    /* Output data, reserve memory as when the text would be ASCII-only. In
-       reality the actual vertex count will be smaller, but allocating more at
-       once is better than reallocating many times later. */
     std::vector<Vertex> vertices;
-    vertices.reserve(text.size()*4);
-
-    /* Total rendered bounds, intial line position, line increment, last+1
-       vertex on previous line */
-    Range2D rectangle;
-    Vector2 linePosition;
-    const Vector2 lineAdvance = Vector2::yAxis(font.lineHeight()*size/font.size());
-    std::size_t lastLineLastVertex = 0;
-
-    /* Temp buffer so we don't allocate for each new line */
-    /**
-     * @todo C++1z: use std::string_view to avoid the one allocation and all
-     *      the copying altogether
-     */
-    std::string line;
-    line.reserve(text.size());
-
-    /* Render each line separately and align it horizontally */
-    std::size_t pos, prevPos = 0;
-    do {
-        /* Empty line, nothing to do (the rest is done below in while expression) */
-        if((pos = text.find('\n', prevPos)) == prevPos) continue;
-
-        /* Copy the line into the temp buffer */
-        line.assign(text, prevPos, pos-prevPos);
-
-        /* Layout the line */
-        Containers::Pointer<AbstractLayouter> layouter = font.layout(cache, size, line);
-
-        /* Verify that we don't reallocate anything. The only problem might
-           arise when the layouter decides to compose one character from more
-           than one glyph (i.e. accents). Will remove the assert when this
-           issue arises. */
-        CORRADE_INTERNAL_ASSERT(vertices.size() + layouter->glyphCount()*4 <= vertices.capacity());
-
-        /* Bounds of rendered line */
-        Range2D lineRectangle;
-
-        /* Render all glyphs */
-        Vector2 cursorPosition(linePosition);
-        for(UnsignedInt i = 0; i != layouter->glyphCount(); ++i) {
-            Range2D quadPosition, textureCoordinates;
-            std::tie(quadPosition, textureCoordinates) = layouter->renderGlyph(i, cursorPosition, lineRectangle);
-
-            /* 0---2
-               |   |
-               |   |
-               |   |
-               1---3 */
-
-            vertices.insert(vertices.end(), {
-                {quadPosition.topLeft(), textureCoordinates.topLeft()},
-                {quadPosition.bottomLeft(), textureCoordinates.bottomLeft()},
-                {quadPosition.topRight(), textureCoordinates.topRight()},
-                {quadPosition.bottomRight(), textureCoordinates.bottomRight()}
-            });
-        }
-
-        /** @todo What about top-down text? */
-
-        /* Horizontally align the rendered line */
-        Float alignmentOffsetX = 0.0f;
-        if((UnsignedByte(alignment) & Implementation::AlignmentHorizontal) == Implementation::AlignmentCenter)
-            alignmentOffsetX = -lineRectangle.centerX();
-        else if((UnsignedByte(alignment) & Implementation::AlignmentHorizontal) == Implementation::AlignmentRight)
-            alignmentOffsetX = -lineRectangle.right();
-
-        /* Integer alignment */
-        if(UnsignedByte(alignment) & Implementation::AlignmentIntegral)
-            alignmentOffsetX = Math::round(alignmentOffsetX);
-
-        /* Align positions and bounds on current line */
-        lineRectangle = lineRectangle.translated(Vector2::xAxis(alignmentOffsetX));
-        for(auto it = vertices.begin()+lastLineLastVertex; it != vertices.end(); ++it)
-            it->position.x() += alignmentOffsetX;
-
-        /* Add final line bounds to total bounds, similarly to AbstractFont::renderGlyph() */
-        if(!rectangle.size().isZero()) {
-            rectangle.bottomLeft() = Math::min(rectangle.bottomLeft(), lineRectangle.bottomLeft());
-            rectangle.topRight() = Math::max(rectangle.topRight(), lineRectangle.topRight());
-        } else rectangle = lineRectangle;
-
-    /* Move to next line */
-    } while(prevPos = pos+1,
-            linePosition -= lineAdvance,
-            lastLineLastVertex = vertices.size(),
-            pos != std::string::npos);
-
-    /* Vertically align the rendered text */
-    Float alignmentOffsetY = 0.0f;
-    if((UnsignedByte(alignment) & Implementation::AlignmentVertical) == Implementation::AlignmentMiddle)
-        alignmentOffsetY = -rectangle.centerY();
-    else if((UnsignedByte(alignment) & Implementation::AlignmentVertical) == Implementation::AlignmentTop)
-        alignmentOffsetY = -rectangle.top();
-
-    /* Integer alignment */
-    if(UnsignedByte(alignment) & Implementation::AlignmentIntegral)
-        alignmentOffsetY = Math::round(alignmentOffsetY);
-
-    /* Align positions and bounds */
-    rectangle = rectangle.translated(Vector2::yAxis(alignmentOffsetY));
-    for(auto& v: vertices) v.position.y() += alignmentOffsetY;
-
+    const Range2D rectangle = Implementation::layoutText(font, cache, size, text, alignment, vertices);
     return std::make_tuple(std::move(vertices), rectangle);
 }
 
@@ -381,9 +275,50 @@ void AbstractRenderer::render(const std::string& text) {
     _mesh.setCount(indexCount);
 }
 
+template<UnsignedInt dimensions> BatchRenderer<dimensions>::BatchRenderer(BatchLayout& layout, const GL::BufferUsage usage): _layout(layout), _usage{usage}, _capacity{}, _vertexBuffer{GL::Buffer::TargetHint::Array}, _indexBuffer{GL::Buffer::TargetHint::ElementArray} {
+    _mesh.setPrimitive(MeshPrimitive::Triangles)
+        .setCount(0)
+        .addVertexBuffer(_vertexBuffer, 0,
+            typename Shaders::AbstractVector<dimensions>::Position(Shaders::AbstractVector<dimensions>::Position::Components::Two),
+            typename Shaders::AbstractVector<dimensions>::TextureCoordinates());
+}
+
+template<UnsignedInt dimensions> BatchRenderer<dimensions>& BatchRenderer<dimensions>::update() {
+    const UnsignedInt glyphCapacity = _layout.glyphCapacity();
+
+    /* If the layout doesn't fit, grow the buffers to at least double the
+       size so they don't need to be reallocated with each added text, and
+       upload everything */
+    if(glyphCapacity > _capacity) {
+        _capacity = Math::max(glyphCapacity, _capacity*2);
+
+        _vertexBuffer.setData({nullptr, _capacity*4*sizeof(Vertex)}, _usage);
+        _vertexBuffer.setSubData(0, _layout.vertices());
+
+        Containers::Array<char> indexData;
+        MeshIndexType indexType;
+        std::tie(indexData, indexType) = renderIndicesInternal(_capacity);
+        _indexBuffer.setData(indexData, GL::BufferUsage::StaticDraw);
+        _mesh.setIndexBuffer(_indexBuffer, 0, indexType, 0, _capacity*4);
+
+    /* Otherwise upload just what changed */
+    } else {
+        const std::pair<UnsignedInt, UnsignedInt> dirty = _layout.dirtyGlyphs();
+        if(dirty.first != dirty.second)
+            _vertexBuffer.setSubData(dirty.first*4*sizeof(Vertex),
+                _layout.vertices().slice(dirty.first*4, dirty.second*4));
+    }
+
+    _layout.resetDirtyGlyphs();
+    _mesh.setCount(glyphCapacity*6);
+    return *this;
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_TEXT_EXPORT Renderer<2>;
 template class MAGNUM_TEXT_EXPORT Renderer<3>;
+template class MAGNUM_TEXT_EXPORT BatchRenderer<2>;
+template class MAGNUM_TEXT_EXPORT BatchRenderer<3>;
 #endif
 
 }}
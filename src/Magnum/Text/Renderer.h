@@ -26,7 +26,7 @@
 */
 
 /** @file Text/Renderer.h
- * @brief Class @ref Magnum::Text::AbstractRenderer, @ref Magnum::Text::Renderer, typedef @ref Magnum::Text::Renderer2D, @ref Magnum::Text::Renderer3D
+ * @brief Class @ref Magnum::Text::AbstractRenderer, @ref Magnum::Text::Renderer, @ref Magnum::Text::BatchRenderer, typedef @ref Magnum::Text::Renderer2D, @ref Magnum::Text::Renderer3D, @ref Magnum::Text::BatchRenderer2D, @ref Magnum::Text::BatchRenderer3D
  */
 
 #include "Magnum/configure.h"
@@ -243,6 +243,99 @@ typedef Renderer<2> Renderer2D;
 /** @brief Three-dimensional text renderer */
 typedef Renderer<3> Renderer3D;
 
+/**
+@brief Batch text renderer
+@m_since_latest
+
+Uploads all texts from a @ref BatchLayout into a single vertex and index
+buffer, so they can be drawn with a single draw call. Compared to having a
+@ref Renderer for each text, the buffers are not mapped, only the glyphs that
+changed since the last @ref update() are uploaded and there's just one
+@ref GL::Mesh. Because the layout is done by @ref BatchLayout, which doesn't
+depend on OpenGL, it can be tested and prepared without a GL context.
+
+@section Text-BatchRenderer-usage Usage
+
+Add the texts to a @ref BatchLayout, call @ref update() after the layout
+changes and draw the @ref mesh() using any @ref Shaders::AbstractVector
+subclass:
+
+@snippet MagnumText.cpp BatchRenderer-usage
+
+The mesh draws all glyphs in @ref BatchLayout::glyphCapacity(), including the
+degenerate quads of unused glyph ranges. To draw just a single text, set the
+mesh index offset to six times @ref BatchLayout::glyphOffset() and the count
+to six times @ref BatchLayout::glyphCount().
+
+The buffers are grown to at least twice their current capacity if the layout
+doesn't fit anymore, in which case all vertex data are uploaded again
+together with a new index buffer. Otherwise only the range returned by
+@ref BatchLayout::dirtyGlyphs() is uploaded.
+@see @ref BatchRenderer2D, @ref BatchRenderer3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_TEXT_EXPORT BatchRenderer {
+    public:
+        /**
+         * @brief Constructor
+         * @param layout        Text layout
+         * @param usage         Vertex buffer usage
+         *
+         * The @p layout is expected to stay in scope for the whole lifetime
+         * of the instance. Initially zero capacity is reserved and nothing
+         * is uploaded, call @ref update() to upload the layout.
+         */
+        explicit BatchRenderer(BatchLayout& layout, GL::BufferUsage usage = GL::BufferUsage::DynamicDraw);
+        BatchRenderer(BatchLayout&&, GL::BufferUsage = GL::BufferUsage::DynamicDraw) = delete; /**< @overload */
+
+        /** @brief Text layout */
+        BatchLayout& layout() { return _layout; }
+
+        /**
+         * @brief Capacity for glyphs
+         *
+         * Count of glyphs the buffers can hold.
+         */
+        UnsignedInt capacity() const { return _capacity; }
+
+        /** @brief Vertex buffer */
+        GL::Buffer& vertexBuffer() { return _vertexBuffer; }
+
+        /** @brief Index buffer */
+        GL::Buffer& indexBuffer() { return _indexBuffer; }
+
+        /** @brief Mesh */
+        GL::Mesh& mesh() { return _mesh; }
+
+        /**
+         * @brief Update the buffers from the layout
+         * @return Reference to self (for method chaining)
+         *
+         * Uploads the glyphs returned by @ref BatchLayout::dirtyGlyphs(),
+         * reallocating the buffers if they aren't large enough, updates the
+         * mesh index count and calls @ref BatchLayout::resetDirtyGlyphs().
+         */
+        BatchRenderer<dimensions>& update();
+
+    private:
+        BatchLayout& _layout;
+        GL::BufferUsage _usage;
+        UnsignedInt _capacity;
+        GL::Buffer _vertexBuffer, _indexBuffer;
+        GL::Mesh _mesh;
+};
+
+/**
+@brief Two-dimensional batch text renderer
+@m_since_latest
+*/
+typedef BatchRenderer<2> BatchRenderer2D;
+
+/**
+@brief Three-dimensional batch text renderer
+@m_since_latest
+*/
+typedef BatchRenderer<3> BatchRenderer3D;
+
 }}
 #else
 #error this header is available only in the OpenGL build
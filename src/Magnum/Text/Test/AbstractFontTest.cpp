@@ -34,6 +34,7 @@
 #include "Magnum/Math/Vector2.h"
 #include "Magnum/Text/AbstractFont.h"
 #include "Magnum/Text/AbstractGlyphCache.h"
+#include "Magnum/Text/LayoutCache.h"
 
 #include "configure.h"
 
@@ -81,6 +82,8 @@ struct AbstractFontTest: TestSuite::Tester {
 
     void layout();
     void layoutNoFont();
+    void layoutCached();
+    void layoutCacheInvalidation();
 
     void fillGlyphCache();
     void fillGlyphCacheNotSupported();
@@ -136,6 +139,8 @@ AbstractFontTest::AbstractFontTest() {
 
               &AbstractFontTest::layout,
               &AbstractFontTest::layoutNoFont,
+              &AbstractFontTest::layoutCached,
+              &AbstractFontTest::layoutCacheInvalidation,
 
               &AbstractFontTest::fillGlyphCache,
               &AbstractFontTest::fillGlyphCacheNotSupported,
@@ -990,6 +995,103 @@ void AbstractFontTest::layoutNoFont() {
     CORRADE_COMPARE(out.str(), "Text::AbstractFont::layout(): no font opened\n");
 }
 
+void AbstractFontTest::layoutCached() {
+    struct Layouter: AbstractLayouter {
+        explicit Layouter(UnsignedInt count): AbstractLayouter{count} {}
+        std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(UnsignedInt i) override {
+            return std::make_tuple(Range2D{{}, Vector2{Float(i)}}, Range2D{}, Vector2::xAxis(2.0f));
+        }
+    };
+
+    struct MyFont: AbstractFont {
+        FontFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doGlyphId(char32_t) override { return {}; }
+        Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+        Containers::Pointer<AbstractLayouter> doLayout(const AbstractGlyphCache&, Float, const std::string& str) override {
+            ++layoutCount;
+            return Containers::pointer<Layouter>(UnsignedInt(str.size()));
+        }
+
+        Int layoutCount = 0;
+    } font;
+
+    /* Disabled by default */
+    CORRADE_VERIFY(!font.layoutCache());
+
+    font.setLayoutCacheCapacity(4);
+    CORRADE_VERIFY(font.layoutCache());
+    CORRADE_COMPARE(font.layoutCache()->capacity(), 4);
+
+    DummyGlyphCache cache{{100, 200}};
+    Containers::Pointer<AbstractLayouter> a = font.layout(cache, 0.25f, "hello");
+    Containers::Pointer<AbstractLayouter> b = font.layout(cache, 0.25f, "hello");
+    CORRADE_COMPARE(font.layoutCount, 1);
+    CORRADE_COMPARE(font.layoutCache()->size(), 1);
+    CORRADE_COMPARE(font.layoutCache()->hitCount(), 1);
+    CORRADE_COMPARE(font.layoutCache()->missCount(), 1);
+
+    /* The cached layout produces the same glyphs */
+    CORRADE_COMPARE(b->glyphCount(), 5);
+    Vector2 cursorPosition;
+    Range2D rectangle;
+    CORRADE_COMPARE(b->renderGlyph(3, cursorPosition, rectangle).first, (Range2D{{}, Vector2{3.0f}}));
+    CORRADE_COMPARE(cursorPosition, (Vector2{2.0f, 0.0f}));
+
+    /* Different size is a different layout */
+    font.layout(cache, 0.5f, "hello");
+    CORRADE_COMPARE(font.layoutCount, 2);
+    CORRADE_COMPARE(font.layoutCache()->size(), 2);
+
+    /* Disabling discards the cache */
+    font.setLayoutCacheCapacity(0);
+    CORRADE_VERIFY(!font.layoutCache());
+    font.layout(cache, 0.25f, "hello");
+    CORRADE_COMPARE(font.layoutCount, 3);
+}
+
+void AbstractFontTest::layoutCacheInvalidation() {
+    struct Layouter: AbstractLayouter {
+        explicit Layouter(UnsignedInt count): AbstractLayouter{count} {}
+        std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(UnsignedInt) override { return {}; }
+    };
+
+    struct MyFont: AbstractFont {
+        FontFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return opened; }
+        void doClose() override { opened = false; }
+
+        UnsignedInt doGlyphId(char32_t) override { return {}; }
+        Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+        Containers::Pointer<AbstractLayouter> doLayout(const AbstractGlyphCache&, Float, const std::string& str) override {
+            return Containers::pointer<Layouter>(UnsignedInt(str.size()));
+        }
+        void doFillGlyphCache(AbstractGlyphCache&, const std::u32string&) override {}
+
+        bool opened = true;
+    } font;
+
+    font.setLayoutCacheCapacity(4);
+    DummyGlyphCache cache{{100, 200}};
+    font.layout(cache, 0.25f, "hello");
+    CORRADE_COMPARE(font.layoutCache()->size(), 1);
+
+    /* Filling the glyph cache clears the layouts but keeps the statistics */
+    font.fillGlyphCache(cache, "hello");
+    CORRADE_COMPARE(font.layoutCache()->size(), 0);
+    CORRADE_COMPARE(font.layoutCache()->missCount(), 1);
+
+    font.layout(cache, 0.25f, "hello");
+    CORRADE_COMPARE(font.layoutCache()->size(), 1);
+    CORRADE_COMPARE(font.layoutCache()->missCount(), 2);
+
+    /* Closing clears the layouts as well */
+    font.close();
+    CORRADE_COMPARE(font.layoutCache()->size(), 0);
+}
+
 void AbstractFontTest::fillGlyphCache() {
     struct MyFont: AbstractFont {
         FontFeatures doFeatures() const override { return {}; }
@@ -41,6 +41,7 @@ struct AbstractGlyphCacheTest: TestSuite::Tester {
     void initialize();
     void access();
     void reserve();
+    void reserveIncremental();
 
     void setImage();
     void setImageOutOfBounds();
@@ -54,6 +55,7 @@ AbstractGlyphCacheTest::AbstractGlyphCacheTest() {
     addTests({&AbstractGlyphCacheTest::initialize,
               &AbstractGlyphCacheTest::access,
               &AbstractGlyphCacheTest::reserve,
+              &AbstractGlyphCacheTest::reserveIncremental,
 
               &AbstractGlyphCacheTest::setImage,
               &AbstractGlyphCacheTest::setImageOutOfBounds,
@@ -114,6 +116,24 @@ void AbstractGlyphCacheTest::reserve() {
     CORRADE_VERIFY(!cache.reserve({{5, 3}}).empty());
 }
 
+void AbstractGlyphCacheTest::reserveIncremental() {
+    DummyGlyphCache cache{{64, 64}, {1, 1}};
+
+    std::vector<Range2Di> first = cache.reserve({{30, 14}});
+    CORRADE_COMPARE(first, (std::vector<Range2Di>{
+        Range2Di::fromSize({1, 1}, {30, 14})}));
+    cache.insert(1, {}, first[0]);
+    CORRADE_COMPARE(cache.dirtyRange(), (Range2Di{{0, 0}, {32, 16}}));
+    cache.resetDirtyRange();
+
+    /* Reserving more in a non-empty cache places the new glyphs next to the
+       existing ones and marks only them as dirty */
+    std::vector<Range2Di> second = cache.reserve({{14, 14}});
+    CORRADE_COMPARE(second, (std::vector<Range2Di>{
+        Range2Di::fromSize({33, 1}, {14, 14})}));
+    CORRADE_COMPARE(cache.dirtyRange(), (Range2Di{{32, 0}, {48, 16}}));
+}
+
 void AbstractGlyphCacheTest::setImage() {
     struct MyGlyphCache: AbstractGlyphCache {
         using AbstractGlyphCache::AbstractGlyphCache;
@@ -0,0 +1,361 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Range.h"
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/AbstractGlyphCache.h"
+#include "Magnum/Text/BatchLayout.h"
+
+namespace Magnum { namespace Text { namespace Test { namespace {
+
+struct BatchLayoutTest: TestSuite::Tester {
+    explicit BatchLayoutTest();
+
+    void construct();
+    void constructCopy();
+    void constructMove();
+
+    void add();
+    void addAligned();
+    void setTextShorter();
+    void setTextLonger();
+    void setPosition();
+    void remove();
+    void removeTrimMerged();
+
+    void invalidId();
+};
+
+BatchLayoutTest::BatchLayoutTest() {
+    addTests({&BatchLayoutTest::construct,
+              &BatchLayoutTest::constructCopy,
+              &BatchLayoutTest::constructMove,
+
+              &BatchLayoutTest::add,
+              &BatchLayoutTest::addAligned,
+              &BatchLayoutTest::setTextShorter,
+              &BatchLayoutTest::setTextLonger,
+              &BatchLayoutTest::setPosition,
+              &BatchLayoutTest::remove,
+              &BatchLayoutTest::removeTrimMerged,
+
+              &BatchLayoutTest::invalidId});
+}
+
+/* Each glyph is a size x size quad, advancing by twice the size. Texture
+   coordinates are a unit square shifted by the glyph index. */
+class TestLayouter: public Text::AbstractLayouter {
+    public:
+        explicit TestLayouter(Float size, std::size_t glyphCount): AbstractLayouter(glyphCount), _size(size) {}
+
+    private:
+        std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(UnsignedInt i) override {
+            return std::make_tuple(
+                Range2D({}, Vector2{_size}),
+                Range2D::fromSize({Float(i), 0.0f}, Vector2{1.0f}),
+                Vector2::xAxis(2.0f*_size)
+            );
+        }
+
+        Float _size;
+};
+
+class TestFont: public Text::AbstractFont {
+    FontFeatures doFeatures() const override { return FontFeature::OpenData; }
+
+    bool doIsOpened() const override { return true; }
+    void doClose() override {}
+
+    UnsignedInt doGlyphId(char32_t) override { return 0; }
+    Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+
+    Containers::Pointer<AbstractLayouter> doLayout(const AbstractGlyphCache&, const Float size, const std::string& text) override {
+        return Containers::Pointer<AbstractLayouter>(new TestLayouter(size, text.size()));
+    }
+};
+
+/* The glyph cache isn't accessed by the test font */
+char glyphCacheData;
+const AbstractGlyphCache& nullGlyphCache = *reinterpret_cast<const AbstractGlyphCache*>(&glyphCacheData);
+
+typedef std::pair<UnsignedInt, UnsignedInt> Range;
+
+void BatchLayoutTest::construct() {
+    TestFont font;
+    BatchLayout layout{font, nullGlyphCache, 1.0f};
+
+    CORRADE_COMPARE(layout.size(), 1.0f);
+    CORRADE_COMPARE(layout.textCount(), 0);
+    CORRADE_COMPARE(layout.glyphCount(), 0);
+    CORRADE_COMPARE(layout.glyphCapacity(), 0);
+    CORRADE_VERIFY(layout.vertices().empty());
+    CORRADE_COMPARE(layout.dirtyGlyphs(), Range{});
+}
+
+void BatchLayoutTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<BatchLayout, const BatchLayout&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<BatchLayout, const BatchLayout&>{}));
+}
+
+void BatchLayoutTest::constructMove() {
+    TestFont font;
+    BatchLayout a{font, nullGlyphCache, 1.0f};
+    a.add("abc");
+
+    BatchLayout b{std::move(a)};
+    CORRADE_COMPARE(b.textCount(), 1);
+    CORRADE_COMPARE(b.glyphCapacity(), 3);
+
+    BatchLayout c{font, nullGlyphCache, 2.0f};
+    c = std::move(b);
+    CORRADE_COMPARE(c.size(), 1.0f);
+    CORRADE_COMPARE(c.textCount(), 1);
+    CORRADE_COMPARE(c.glyphCapacity(), 3);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<BatchLayout>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<BatchLayout>::value);
+}
+
+void BatchLayoutTest::add() {
+    TestFont font;
+    BatchLayout layout{font, nullGlyphCache, 1.0f};
+
+    CORRADE_COMPARE(layout.add("abc"), 0);
+    CORRADE_COMPARE(layout.add("de", {10.0f, 20.0f}), 1);
+    CORRADE_COMPARE(layout.textCount(), 2);
+    CORRADE_COMPARE(layout.glyphCount(), 5);
+    CORRADE_COMPARE(layout.glyphCapacity(), 5);
+    CORRADE_COMPARE(layout.vertices().size(), 20);
+    CORRADE_COMPARE(layout.dirtyGlyphs(), (Range{0, 5}));
+
+    CORRADE_COMPARE(layout.glyphOffset(0), 0);
+    CORRADE_COMPARE(layout.glyphCount(0), 3);
+    CORRADE_COMPARE(layout.position(0), Vector2{});
+    CORRADE_COMPARE(layout.rectangle(0), (Range2D{{0.0f, 0.0f}, {5.0f, 1.0f}}));
+
+    CORRADE_COMPARE(layout.glyphOffset(1), 3);
+    CORRADE_COMPARE(layout.glyphCount(1), 2);
+    CORRADE_COMPARE(layout.position(1), (Vector2{10.0f, 20.0f}));
+    CORRADE_COMPARE(layout.rectangle(1), (Range2D{{10.0f, 20.0f}, {13.0f, 21.0f}}));
+
+    /* Top left of the first glyph and bottom right of the last glyph of the
+       second text, with the position applied */
+    CORRADE_COMPARE(layout.vertices()[12].position, (Vector2{10.0f, 21.0f}));
+    CORRADE_COMPARE(layout.vertices()[12].textureCoordinates, (Vector2{0.0f, 1.0f}));
+    CORRADE_COMPARE(layout.vertices()[19].position, (Vector2{13.0f, 20.0f}));
+    CORRADE_COMPARE(layout.vertices()[19].textureCoordinates, (Vector2{2.0f, 0.0f}));
+
+    layout.resetDirtyGlyphs();
+    CORRADE_COMPARE(layout.dirtyGlyphs(), Range{});
+}
+
+void BatchLayoutTest::addAligned() {
+    TestFont font;
+    BatchLayout layout{font, nullGlyphCache, 1.0f};
+
+    /* The alignment is applied first, then the position */
+    UnsignedInt id = layout.add("ab", {10.0f, 20.0f}, Alignment::LineRight);
+    CORRADE_COMPARE(layout.rectangle(id), (Range2D{{7.0f, 20.0f}, {10.0f, 21.0f}}));
+    CORRADE_COMPARE(layout.vertices()[0].position, (Vector2{7.0f, 21.0f}));
+
+    /* The alignment is remembered for subsequent changes */
+    layout.setText(id, "abc");
+    CORRADE_COMPARE(layout.rectangle(id), (Range2D{{5.0f, 20.0f}, {10.0f, 21.0f}}));
+}
+
+void BatchLayoutTest::setTextShorter() {
+    TestFont font;
+    BatchLayout layout{font, nullGlyphCache, 1.0f};
+    layout.add("abc");
+    layout.add("de");
+    layout.resetDirtyGlyphs();
+
+    /* The text stays in place, the now unused glyphs are made degenerate */
+    layout.setText(0, "a");
+    CORRADE_COMPARE(layout.glyphOffset(0), 0);
+    CORRADE_COMPARE(layout.glyphCount(0), 1);
+    CORRADE_COMPARE(layout.rectangle(0), (Range2D{{0.0f, 0.0f}, {1.0f, 1.0f}}));
+    CORRADE_COMPARE(layout.glyphCount(), 3);
+    CORRADE_COMPARE(layout.glyphCapacity(), 5);
+    CORRADE_COMPARE(layout.dirtyGlyphs(), (Range{0, 3}));
+    for(std::size_t i = 4; i != 12; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(layout.vertices()[i].position, Vector2{});
+        CORRADE_COMPARE(layout.vertices()[i].textureCoordinates, Vector2{});
+    }
+
+    /* Growing back to the original size doesn't move the text either */
+    layout.resetDirtyGlyphs();
+    layout.setText(0, "abc");
+    CORRADE_COMPARE(layout.glyphOffset(0), 0);
+    CORRADE_COMPARE(layout.glyphCapacity(), 5);
+    CORRADE_COMPARE(layout.dirtyGlyphs(), (Range{0, 3}));
+}
+
+void BatchLayoutTest::setTextLonger() {
+    TestFont font;
+    BatchLayout layout{font, nullGlyphCache, 1.0f};
+    layout.add("abc");
+    layout.add("de");
+    layout.resetDirtyGlyphs();
+
+    /* The text gets moved to the end with twice the capacity, the original
+       range is made degenerate */
+    layout.setText(0, "abcd");
+    CORRADE_COMPARE(layout.glyphOffset(0), 5);
+    CORRADE_COMPARE(layout.glyphCount(0), 4);
+    CORRADE_COMPARE(layout.glyphCount(), 6);
+    CORRADE_COMPARE(layout.glyphCapacity(), 11);
+    CORRADE_COMPARE(layout.dirtyGlyphs(), (Range{0, 11}));
+    CORRADE_COMPARE(layout.vertices()[0].position, Vector2{});
+    CORRADE_COMPARE(layout.vertices()[20].position, (Vector2{0.0f, 1.0f}));
+
+    /* The freed range gets reused by a new text that fits */
+    layout.resetDirtyGlyphs();
+    UnsignedInt id = layout.add("xy");
+    CORRADE_COMPARE(layout.glyphOffset(id), 0);
+    CORRADE_COMPARE(layout.glyphCapacity(), 11);
+    CORRADE_COMPARE(layout.dirtyGlyphs(), (Range{0, 2}));
+
+    /* The moved text now has space to grow in place */
+    layout.resetDirtyGlyphs();
+    layout.setText(0, "abcdef");
+    CORRADE_COMPARE(layout.glyphOffset(0), 5);
+    CORRADE_COMPARE(layout.glyphCapacity(), 11);
+    CORRADE_COMPARE(layout.dirtyGlyphs(), (Range{5, 11}));
+}
+
+void BatchLayoutTest::setPosition() {
+    TestFont font;
+    BatchLayout layout{font, nullGlyphCache, 1.0f};
+    layout.add("abc");
+    layout.add("de", {10.0f, 20.0f});
+    layout.resetDirtyGlyphs();
+
+    layout.setPosition(1, {0.0f, 5.0f});
+    CORRADE_COMPARE(layout.position(1), (Vector2{0.0f, 5.0f}));
+    CORRADE_COMPARE(layout.rectangle(1), (Range2D{{0.0f, 5.0f}, {3.0f, 6.0f}}));
+    CORRADE_COMPARE(layout.vertices()[12].position, (Vector2{0.0f, 6.0f}));
+    CORRADE_COMPARE(layout.vertices()[19].position, (Vector2{3.0f, 5.0f}));
+    CORRADE_COMPARE(layout.dirtyGlyphs(), (Range{3, 5}));
+
+    /* The position is kept for subsequent changes */
+    layout.setText(1, "d");
+    CORRADE_COMPARE(layout.rectangle(1), (Range2D{{0.0f, 5.0f}, {1.0f, 6.0f}}));
+    CORRADE_COMPARE(layout.vertices()[12].position, (Vector2{0.0f, 6.0f}));
+}
+
+void BatchLayoutTest::remove() {
+    TestFont font;
+    BatchLayout layout{font, nullGlyphCache, 1.0f};
+    layout.add("abc");
+    layout.add("de");
+    layout.add("f");
+    layout.resetDirtyGlyphs();
+
+    /* Removing a text in the middle makes its glyphs degenerate */
+    layout.remove(1);
+    CORRADE_COMPARE(layout.textCount(), 2);
+    CORRADE_COMPARE(layout.glyphCount(), 4);
+    CORRADE_COMPARE(layout.glyphCapacity(), 6);
+    CORRADE_COMPARE(layout.dirtyGlyphs(), (Range{3, 5}));
+    for(std::size_t i = 12; i != 20; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(layout.vertices()[i].position, Vector2{});
+    }
+
+    /* The ID and the glyph range gets reused */
+    CORRADE_COMPARE(layout.add("gh"), 1);
+    CORRADE_COMPARE(layout.glyphOffset(1), 3);
+    CORRADE_COMPARE(layout.textCount(), 3);
+    CORRADE_COMPARE(layout.glyphCapacity(), 6);
+
+    /* Removing the last text trims the capacity */
+    layout.remove(2);
+    CORRADE_COMPARE(layout.textCount(), 2);
+    CORRADE_COMPARE(layout.glyphCount(), 5);
+    CORRADE_COMPARE(layout.glyphCapacity(), 5);
+    CORRADE_COMPARE(layout.vertices().size(), 20);
+}
+
+void BatchLayoutTest::removeTrimMerged() {
+    TestFont font;
+    BatchLayout layout{font, nullGlyphCache, 1.0f};
+    layout.add("abc");
+    layout.add("de");
+    layout.add("f");
+    layout.resetDirtyGlyphs();
+
+    /* The free range of the second text gets merged with the third and both
+       get trimmed away. The dirty range is then outside of the capacity. */
+    layout.remove(1);
+    layout.remove(2);
+    CORRADE_COMPARE(layout.textCount(), 1);
+    CORRADE_COMPARE(layout.glyphCapacity(), 3);
+    CORRADE_COMPARE(layout.dirtyGlyphs(), Range{});
+
+    /* Adding a new text appends it to the end again and marks it dirty */
+    UnsignedInt id = layout.add("xyz");
+    CORRADE_COMPARE(layout.glyphOffset(id), 3);
+    CORRADE_COMPARE(layout.glyphCapacity(), 6);
+    CORRADE_COMPARE(layout.dirtyGlyphs(), (Range{3, 6}));
+}
+
+void BatchLayoutTest::invalidId() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    TestFont font;
+    BatchLayout layout{font, nullGlyphCache, 1.0f};
+    layout.add("abc");
+    layout.remove(0);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    layout.setText(0, "a");
+    layout.setPosition(1, {});
+    layout.remove(0);
+    layout.position(1);
+    layout.rectangle(0);
+    layout.glyphOffset(1);
+    layout.glyphCount(0);
+    CORRADE_COMPARE(out.str(),
+        "Text::BatchLayout::setText(): invalid ID 0\n"
+        "Text::BatchLayout::setPosition(): invalid ID 1\n"
+        "Text::BatchLayout::remove(): invalid ID 0\n"
+        "Text::BatchLayout::position(): invalid ID 1\n"
+        "Text::BatchLayout::rectangle(): invalid ID 0\n"
+        "Text::BatchLayout::glyphOffset(): invalid ID 1\n"
+        "Text::BatchLayout::glyphCount(): invalid ID 0\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::BatchLayoutTest)
@@ -24,7 +24,12 @@
 */
 
 #include <tuple>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
 
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
 #include "Magnum/GL/OpenGLTester.h"
 #include "Magnum/Text/GlyphCache.h"
 
@@ -34,10 +39,12 @@ struct GlyphCacheGLTest: GL::OpenGLTester {
     explicit GlyphCacheGLTest();
 
     void initialize();
+    void setImageDirtyRange();
 };
 
 GlyphCacheGLTest::GlyphCacheGLTest() {
-    addTests({&GlyphCacheGLTest::initialize});
+    addTests({&GlyphCacheGLTest::initialize,
+              &GlyphCacheGLTest::setImageDirtyRange});
 }
 
 void GlyphCacheGLTest::initialize() {
@@ -49,6 +56,34 @@ void GlyphCacheGLTest::initialize() {
     #endif
 }
 
+void GlyphCacheGLTest::setImageDirtyRange() {
+    GlyphCache cache{{16, 8}};
+
+    /* Nothing reserved yet, so the whole image gets uploaded */
+    Containers::Array<char> ones{Containers::DirectInit, 16*8, '\x01'};
+    cache.setImage({}, ImageView2D{PixelFormat::R8Unorm, {16, 8}, ones});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* After reserving, only the dirty range gets uploaded and reset */
+    cache.reserve({{4, 4}});
+    const Range2Di dirty = cache.dirtyRange();
+    CORRADE_COMPARE(dirty.size(), (Vector2i{4, 4}));
+    Containers::Array<char> twos{Containers::DirectInit, 16*8, '\x02'};
+    cache.setImage({}, ImageView2D{PixelFormat::R8Unorm, {16, 8}, twos});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(cache.dirtyRange(), Range2Di{});
+
+    #ifndef MAGNUM_TARGET_GLES
+    Image2D image = cache.image();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    const Containers::StridedArrayView2D<const UnsignedByte> pixels = image.pixels<UnsignedByte>();
+    for(Int y = 0; y != 8; ++y) for(Int x = 0; x != 16; ++x) {
+        CORRADE_ITERATION(Vector2i(x, y));
+        CORRADE_COMPARE(pixels[y][x], UnsignedByte(dirty.contains({x, y}) ? 2 : 1));
+    }
+    #endif
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Text::Test::GlyphCacheGLTest)
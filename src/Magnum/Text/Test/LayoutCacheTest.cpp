@@ -0,0 +1,321 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Range.h"
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/AbstractGlyphCache.h"
+#include "Magnum/Text/LayoutCache.h"
+
+namespace Magnum { namespace Text { namespace Test { namespace {
+
+struct LayoutCacheTest: TestSuite::Tester {
+    explicit LayoutCacheTest();
+
+    void construct();
+    void constructCopy();
+    void constructMove();
+
+    void findEmpty();
+    void insertFind();
+    void differentKey();
+    void replace();
+    void evictLeastRecentlyUsed();
+    void compact();
+    void zeroCapacity();
+    void clear();
+    void statistics();
+};
+
+LayoutCacheTest::LayoutCacheTest() {
+    addTests({&LayoutCacheTest::construct,
+              &LayoutCacheTest::constructCopy,
+              &LayoutCacheTest::constructMove,
+
+              &LayoutCacheTest::findEmpty,
+              &LayoutCacheTest::insertFind,
+              &LayoutCacheTest::differentKey,
+              &LayoutCacheTest::replace,
+              &LayoutCacheTest::evictLeastRecentlyUsed,
+              &LayoutCacheTest::compact,
+              &LayoutCacheTest::zeroCapacity,
+              &LayoutCacheTest::clear,
+              &LayoutCacheTest::statistics});
+}
+
+/* Glyph quads, texture coordinates and advances depend on the characters
+   and the size so each text produces a different layout */
+class TestLayouter: public AbstractLayouter {
+    public:
+        explicit TestLayouter(Float size, const std::string& text): AbstractLayouter(text.size()), _size{size}, _text{text} {}
+
+    private:
+        std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(UnsignedInt i) override {
+            const Float c = _text[i] - 'a';
+            return std::make_tuple(
+                Range2D{{0.0f, -_size}, {c + 1.0f, _size}},
+                Range2D::fromSize({c, 0.0f}, {1.0f, 0.5f}),
+                Vector2{c*_size + 0.5f, 0.0f}
+            );
+        }
+
+        Float _size;
+        std::string _text;
+};
+
+struct DummyGlyphCache: AbstractGlyphCache {
+    using AbstractGlyphCache::AbstractGlyphCache;
+
+    GlyphCacheFeatures doFeatures() const override { return {}; }
+    void doSetImage(const Vector2i&, const ImageView2D&) override {}
+};
+
+/* Flattens everything the layouter produces for easy comparison */
+std::vector<Vector2> render(AbstractLayouter& layouter) {
+    std::vector<Vector2> out;
+    Vector2 cursorPosition;
+    Range2D rectangle;
+    for(UnsignedInt i = 0; i != layouter.glyphCount(); ++i) {
+        Range2D quadPosition, textureCoordinates;
+        std::tie(quadPosition, textureCoordinates) = layouter.renderGlyph(i, cursorPosition, rectangle);
+        out.insert(out.end(), {quadPosition.min(), quadPosition.max(),
+            textureCoordinates.min(), textureCoordinates.max()});
+    }
+    out.insert(out.end(), {cursorPosition, rectangle.min(), rectangle.max()});
+    return out;
+}
+
+std::vector<Vector2> render(Float size, const std::string& text) {
+    TestLayouter layouter{size, text};
+    return render(layouter);
+}
+
+void LayoutCacheTest::construct() {
+    LayoutCache cache{16};
+    CORRADE_COMPARE(cache.capacity(), 16);
+    CORRADE_COMPARE(cache.size(), 0);
+    CORRADE_COMPARE(cache.glyphCount(), 0);
+    CORRADE_COMPARE(cache.hitCount(), 0);
+    CORRADE_COMPARE(cache.missCount(), 0);
+    CORRADE_COMPARE(cache.evictionCount(), 0);
+    CORRADE_COMPARE(cache.hitRate(), 0.0f);
+}
+
+void LayoutCacheTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<LayoutCache, const LayoutCache&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<LayoutCache, const LayoutCache&>{}));
+}
+
+void LayoutCacheTest::constructMove() {
+    DummyGlyphCache glyphCache{{100, 100}};
+    TestLayouter layouter{1.0f, "abc"};
+
+    LayoutCache a{16};
+    a.insert(glyphCache, 1.0f, "abc", layouter);
+
+    LayoutCache b{std::move(a)};
+    CORRADE_COMPARE(b.capacity(), 16);
+    CORRADE_COMPARE(b.size(), 1);
+
+    LayoutCache c{4};
+    c = std::move(b);
+    CORRADE_COMPARE(c.capacity(), 16);
+    CORRADE_COMPARE(c.size(), 1);
+    CORRADE_VERIFY(c.find(glyphCache, 1.0f, "abc"));
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<LayoutCache>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<LayoutCache>::value);
+}
+
+void LayoutCacheTest::findEmpty() {
+    DummyGlyphCache glyphCache{{100, 100}};
+    LayoutCache cache{16};
+
+    CORRADE_VERIFY(!cache.find(glyphCache, 1.0f, "abc"));
+    CORRADE_COMPARE(cache.hitCount(), 0);
+    CORRADE_COMPARE(cache.missCount(), 1);
+}
+
+void LayoutCacheTest::insertFind() {
+    DummyGlyphCache glyphCache{{100, 100}};
+    LayoutCache cache{16};
+
+    TestLayouter layouter{0.5f, "hello"};
+    Containers::Pointer<AbstractLayouter> inserted = cache.insert(glyphCache, 0.5f, "hello", layouter);
+    CORRADE_COMPARE(cache.size(), 1);
+    CORRADE_COMPARE(cache.glyphCount(), 5);
+    CORRADE_COMPARE(inserted->glyphCount(), 5);
+    CORRADE_COMPARE(render(*inserted), render(0.5f, "hello"));
+
+    Containers::Pointer<AbstractLayouter> found = cache.find(glyphCache, 0.5f, "hello");
+    CORRADE_VERIFY(found);
+    CORRADE_COMPARE(found->glyphCount(), 5);
+    CORRADE_COMPARE(render(*found), render(0.5f, "hello"));
+    CORRADE_COMPARE(cache.hitCount(), 1);
+    CORRADE_COMPARE(cache.missCount(), 0);
+
+    /* The layouter can be rendered again with the same result */
+    CORRADE_COMPARE(render(*found), render(0.5f, "hello"));
+}
+
+void LayoutCacheTest::differentKey() {
+    DummyGlyphCache glyphCache{{100, 100}}, anotherGlyphCache{{100, 100}};
+    LayoutCache cache{16};
+
+    TestLayouter layouter{0.5f, "hello"};
+    cache.insert(glyphCache, 0.5f, "hello", layouter);
+
+    CORRADE_VERIFY(!cache.find(anotherGlyphCache, 0.5f, "hello"));
+    CORRADE_VERIFY(!cache.find(glyphCache, 0.25f, "hello"));
+    CORRADE_VERIFY(!cache.find(glyphCache, 0.5f, "hell"));
+    CORRADE_VERIFY(cache.find(glyphCache, 0.5f, "hello"));
+    CORRADE_COMPARE(cache.hitCount(), 1);
+    CORRADE_COMPARE(cache.missCount(), 3);
+}
+
+void LayoutCacheTest::replace() {
+    DummyGlyphCache glyphCache{{100, 100}};
+    LayoutCache cache{16};
+
+    TestLayouter layouter1{0.5f, "hello"};
+    cache.insert(glyphCache, 0.5f, "hello", layouter1);
+
+    /* A different layout for the same key replaces the original */
+    TestLayouter layouter2{0.5f, "ahoy"};
+    cache.insert(glyphCache, 0.5f, "hello", layouter2);
+    CORRADE_COMPARE(cache.size(), 1);
+    CORRADE_COMPARE(cache.glyphCount(), 4);
+    CORRADE_COMPARE(cache.evictionCount(), 0);
+
+    Containers::Pointer<AbstractLayouter> found = cache.find(glyphCache, 0.5f, "hello");
+    CORRADE_VERIFY(found);
+    CORRADE_COMPARE(render(*found), render(0.5f, "ahoy"));
+}
+
+void LayoutCacheTest::evictLeastRecentlyUsed() {
+    DummyGlyphCache glyphCache{{100, 100}};
+    LayoutCache cache{2};
+
+    TestLayouter a{1.0f, "a"}, b{1.0f, "bb"}, c{1.0f, "ccc"};
+    cache.insert(glyphCache, 1.0f, "a", a);
+    cache.insert(glyphCache, 1.0f, "bb", b);
+
+    /* Using "a" makes "bb" the least recently used one */
+    CORRADE_VERIFY(cache.find(glyphCache, 1.0f, "a"));
+
+    cache.insert(glyphCache, 1.0f, "ccc", c);
+    CORRADE_COMPARE(cache.size(), 2);
+    CORRADE_COMPARE(cache.glyphCount(), 4);
+    CORRADE_COMPARE(cache.evictionCount(), 1);
+    CORRADE_VERIFY(!cache.find(glyphCache, 1.0f, "bb"));
+    CORRADE_VERIFY(cache.find(glyphCache, 1.0f, "a"));
+    CORRADE_VERIFY(cache.find(glyphCache, 1.0f, "ccc"));
+}
+
+void LayoutCacheTest::compact() {
+    DummyGlyphCache glyphCache{{100, 100}};
+    LayoutCache cache{3};
+
+    /* Insert many texts of varying lengths so the glyph storage gets
+       compacted several times, the remaining entries should stay intact */
+    const std::string texts[]{"hello", "a", "abcdefgh", "xy", "zzz", "ab",
+        "longer text", "b", "cd", "efghijk"};
+    for(const std::string& text: texts) {
+        TestLayouter layouter{1.0f, text};
+        cache.insert(glyphCache, 1.0f, text, layouter);
+    }
+
+    CORRADE_COMPARE(cache.size(), 3);
+    CORRADE_COMPARE(cache.glyphCount(), 1 + 2 + 7);
+    CORRADE_COMPARE(cache.evictionCount(), 7);
+    for(const char* text: {"b", "cd", "efghijk"}) {
+        CORRADE_ITERATION(text);
+        Containers::Pointer<AbstractLayouter> found = cache.find(glyphCache, 1.0f, text);
+        CORRADE_VERIFY(found);
+        CORRADE_COMPARE(render(*found), render(1.0f, text));
+    }
+}
+
+void LayoutCacheTest::zeroCapacity() {
+    DummyGlyphCache glyphCache{{100, 100}};
+    LayoutCache cache{0};
+
+    /* The layouter is still returned, just not cached */
+    TestLayouter layouter{1.0f, "abc"};
+    Containers::Pointer<AbstractLayouter> inserted = cache.insert(glyphCache, 1.0f, "abc", layouter);
+    CORRADE_COMPARE(render(*inserted), render(1.0f, "abc"));
+    CORRADE_COMPARE(cache.size(), 0);
+    CORRADE_COMPARE(cache.glyphCount(), 0);
+    CORRADE_VERIFY(!cache.find(glyphCache, 1.0f, "abc"));
+}
+
+void LayoutCacheTest::clear() {
+    DummyGlyphCache glyphCache{{100, 100}};
+    LayoutCache cache{16};
+
+    TestLayouter layouter{1.0f, "abc"};
+    cache.insert(glyphCache, 1.0f, "abc", layouter);
+    CORRADE_VERIFY(cache.find(glyphCache, 1.0f, "abc"));
+
+    /* Statistics are kept */
+    cache.clear();
+    CORRADE_COMPARE(cache.size(), 0);
+    CORRADE_COMPARE(cache.glyphCount(), 0);
+    CORRADE_COMPARE(cache.hitCount(), 1);
+    CORRADE_VERIFY(!cache.find(glyphCache, 1.0f, "abc"));
+}
+
+void LayoutCacheTest::statistics() {
+    DummyGlyphCache glyphCache{{100, 100}};
+    LayoutCache cache{1};
+
+    TestLayouter a{1.0f, "a"}, b{1.0f, "b"};
+    CORRADE_VERIFY(!cache.find(glyphCache, 1.0f, "a"));
+    cache.insert(glyphCache, 1.0f, "a", a);
+    CORRADE_VERIFY(cache.find(glyphCache, 1.0f, "a"));
+    CORRADE_VERIFY(cache.find(glyphCache, 1.0f, "a"));
+    CORRADE_VERIFY(cache.find(glyphCache, 1.0f, "a"));
+    CORRADE_VERIFY(!cache.find(glyphCache, 1.0f, "b"));
+    cache.insert(glyphCache, 1.0f, "b", b);
+
+    CORRADE_COMPARE(cache.hitCount(), 3);
+    CORRADE_COMPARE(cache.missCount(), 2);
+    CORRADE_COMPARE(cache.evictionCount(), 1);
+    CORRADE_COMPARE(cache.hitRate(), 0.6f);
+
+    cache.resetStatistics();
+    CORRADE_COMPARE(cache.hitCount(), 0);
+    CORRADE_COMPARE(cache.missCount(), 0);
+    CORRADE_COMPARE(cache.evictionCount(), 0);
+    CORRADE_COMPARE(cache.hitRate(), 0.0f);
+    CORRADE_COMPARE(cache.size(), 1);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::LayoutCacheTest)
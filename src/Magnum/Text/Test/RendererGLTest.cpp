@@ -30,6 +30,8 @@
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/OpenGLTester.h"
 #include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/BatchLayout.h"
+#include "Magnum/Text/GlyphCache.h"
 #include "Magnum/Text/Renderer.h"
 
 namespace Magnum { namespace Text { namespace Test { namespace {
@@ -41,6 +43,7 @@ struct RendererGLTest: GL::OpenGLTester {
     void renderMesh();
     void renderMeshIndexType();
     void mutableText();
+    void batch();
 
     void multiline();
 };
@@ -50,6 +53,7 @@ RendererGLTest::RendererGLTest() {
               &RendererGLTest::renderMesh,
               &RendererGLTest::renderMeshIndexType,
               &RendererGLTest::mutableText,
+              &RendererGLTest::batch,
 
               &RendererGLTest::multiline});
 }
@@ -324,6 +328,64 @@ void RendererGLTest::mutableText() {
     #endif
 }
 
+void RendererGLTest::batch() {
+    TestFont font;
+    BatchLayout layout{font, nullGlyphCache, 0.25f};
+    const UnsignedInt id = layout.add("abc");
+    layout.add("de", {10.0f, 0.0f});
+
+    Text::BatchRenderer2D renderer{layout};
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(renderer.capacity(), 0);
+    CORRADE_COMPARE(renderer.mesh().count(), 0);
+
+    /* Initial upload */
+    renderer.update();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(renderer.capacity(), 5);
+    CORRADE_COMPARE(renderer.mesh().count(), 30);
+    CORRADE_COMPARE(layout.dirtyGlyphs().second, 0);
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Containers::Array<char> indices = renderer.indexBuffer().data();
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedByte>(indices).prefix(12),
+        (Containers::Array<UnsignedByte>{Containers::InPlaceInit, {
+             0,  1,  2,  1,  3,  2,
+             4,  5,  6,  5,  7,  6
+        }}), TestSuite::Compare::Container);
+    Containers::Array<char> vertices = renderer.vertexBuffer().data();
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Float>(vertices),
+        Containers::arrayCast<const Float>(layout.vertices()),
+        TestSuite::Compare::Container);
+    #endif
+
+    /* Changing the text uploads just the changed range, capacity stays */
+    layout.setText(id, "a");
+    renderer.update();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(renderer.capacity(), 5);
+    CORRADE_COMPARE(renderer.mesh().count(), 30);
+    #ifndef MAGNUM_TARGET_GLES
+    Containers::Array<char> verticesChanged = renderer.vertexBuffer().data();
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Float>(verticesChanged),
+        Containers::arrayCast<const Float>(layout.vertices()),
+        TestSuite::Compare::Container);
+    #endif
+
+    /* Adding text that doesn't fit reallocates the buffers */
+    layout.add("fghijk");
+    renderer.update();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(renderer.capacity(), 11);
+    CORRADE_COMPARE(renderer.mesh().count(), 66);
+    #ifndef MAGNUM_TARGET_GLES
+    Containers::Array<char> verticesGrown = renderer.vertexBuffer().data();
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Float>(verticesGrown),
+        Containers::arrayCast<const Float>(layout.vertices()),
+        TestSuite::Compare::Container);
+    #endif
+}
+
 void RendererGLTest::multiline() {
     class Layouter: public Text::AbstractLayouter {
         public:
@@ -39,6 +39,8 @@ class AbstractFont;
 class AbstractFontConverter;
 class AbstractGlyphCache;
 class AbstractLayouter;
+class BatchLayout;
+class LayoutCache;
 
 enum class Alignment: UnsignedByte;
 
@@ -50,6 +52,9 @@ class AbstractRenderer;
 template<UnsignedInt> class Renderer;
 typedef Renderer<2> Renderer2D;
 typedef Renderer<3> Renderer3D;
+template<UnsignedInt> class BatchRenderer;
+typedef BatchRenderer<2> BatchRenderer2D;
+typedef BatchRenderer<3> BatchRenderer3D;
 #endif
 #endif
 
@@ -23,15 +23,21 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/PluginManager/Manager.h>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Arguments.h>
 #include <Corrade/Utility/DebugStl.h>
 #include <Corrade/Utility/Directory.h>
 
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
 #include "Magnum/Math/ConfigurationValue.h"
 #include "Magnum/Text/AbstractFont.h"
 #include "Magnum/Text/AbstractFontConverter.h"
 #include "Magnum/Text/DistanceFieldGlyphCache.h"
+#include "Magnum/TextureTools/DistanceField.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
 
 #ifdef MAGNUM_TARGET_HEADLESS
@@ -84,7 +90,7 @@ See @ref building, @ref cmake and the @ref Text namespace for more information.
 magnum-fontconverter [--magnum-...] [-h|--help] --font FONT
     --converter CONVERTER [--plugin-dir DIR] [--characters CHARACTERS]
     [--font-size N] [--atlas-size "X Y"] [--output-size "X Y"] [--radius N]
-    [--] input output
+    [--cpu] [--threads COUNT] [--] input output
 @endcode
 
 Arguments:
@@ -102,12 +108,24 @@ Arguments:
 -   `--output-size "X Y"` --- output atlas size. If set to zero size, distance
     field computation will not be used. (default: `"256 256"`)
 -   `--radius N` --- distance field computation radius (default: `24`)
+-   `--cpu` --- fill the glyph cache and calculate the distance field on the
+    CPU instead of using the GPU
+-   `--threads COUNT` --- count of threads to use for distance field
+    computation with `--cpu`, @cpp 0 @ce for all available hardware threads
+    (default: `1`)
 -   `--magnum-...` --- engine-specific options (see
     @ref GL-Context-command-line for details)
 
 The resulting font files can be then used as specified in the documentation of
 `converter` plugin.
 
+With `--cpu`, the glyph cache is kept in memory instead of a GL texture and
+the distance field is calculated using
+@ref TextureTools::distanceField(const ImageView2D&, const MutableImageView2D&, UnsignedInt, UnsignedInt),
+producing the same output as @ref Text::DistanceFieldGlyphCache. No GL context
+is created in that case, so the utility can be used also on machines without
+a GPU.
+
 @section magnum-fontconverter-example Example usage
 
 Making raster font from TTF file with default set of characters using
@@ -130,6 +148,48 @@ current directory. You can then load and use them via the
 
 namespace Text {
 
+namespace {
+
+/* Glyph cache stored in CPU memory, optionally converting the image to a
+   distance field on download. Used with --cpu instead of GlyphCache and
+   DistanceFieldGlyphCache which need a GL context. */
+class CpuGlyphCache: public AbstractGlyphCache {
+    public:
+        explicit CpuGlyphCache(const Vector2i& size, const Vector2i& distanceFieldSize = {}, UnsignedInt radius = 0, UnsignedInt threadCount = 1): AbstractGlyphCache{size, Vector2i(radius)}, _image{PixelStorage{}.setAlignment(1), PixelFormat::R8Unorm, size, Containers::Array<char>{Containers::ValueInit, std::size_t(size.product())}}, _distanceFieldSize{distanceFieldSize}, _radius{radius}, _threadCount{threadCount} {}
+
+    private:
+        GlyphCacheFeatures doFeatures() const override {
+            return GlyphCacheFeature::ImageDownload;
+        }
+
+        void doSetImage(const Vector2i& offset, const ImageView2D& image) override {
+            CORRADE_INTERNAL_ASSERT(image.format() == PixelFormat::R8Unorm);
+            const Containers::StridedArrayView2D<UnsignedByte> pixels = _image.pixels<UnsignedByte>();
+            Utility::copy(image.pixels<UnsignedByte>(), pixels.slice(
+                {std::size_t(offset.y()), std::size_t(offset.x())},
+                {std::size_t(offset.y() + image.size().y()), std::size_t(offset.x() + image.size().x())}));
+        }
+
+        Image2D doImage() override {
+            if(_distanceFieldSize.isZero()) {
+                const Containers::ArrayView<const char> imageData = _image.data();
+                Containers::Array<char> data{Containers::NoInit, imageData.size()};
+                Utility::copy(imageData, data);
+                return Image2D{_image.storage(), _image.format(), _image.size(), std::move(data)};
+            }
+
+            Image2D out{PixelStorage{}.setAlignment(1), PixelFormat::R8Unorm, _distanceFieldSize, Containers::Array<char>{Containers::NoInit, std::size_t(_distanceFieldSize.product())}};
+            TextureTools::distanceField(_image, out, _radius, _threadCount);
+            return out;
+        }
+
+        Image2D _image;
+        Vector2i _distanceFieldSize;
+        UnsignedInt _radius, _threadCount;
+};
+
+}
+
 class FontConverter: public Platform::WindowlessApplication {
     public:
         explicit FontConverter(const Arguments& arguments);
@@ -153,11 +213,14 @@ FontConverter::FontConverter(const Arguments& arguments): Platform::WindowlessAp
         .addOption("atlas-size", "2048 2048").setHelp("atlas-size", "glyph atlas size", "\"X Y\"")
         .addOption("output-size", "256 256").setHelp("output-size", "output atlas size. If set to zero size, distance field computation will not be used.", "\"X Y\"")
         .addOption("radius", "24").setHelp("radius", "distance field computation radius", "N")
+        .addBooleanOption("cpu").setHelp("cpu", "fill the glyph cache and calculate the distance field on the CPU")
+        .addOption("threads", "1").setHelp("threads", "count of threads to use with --cpu, 0 for all available", "COUNT")
         .addSkippedPrefix("magnum", "engine-specific options")
         .setGlobalHelp("Converts font to raster one of given atlas size.")
         .parse(arguments.argc, arguments.argv);
 
-    createContext();
+    /* The CPU glyph cache doesn't need any GL context */
+    if(!args.isSet("cpu")) createContext();
 }
 
 int FontConverter::exec() {
@@ -187,11 +250,16 @@ int FontConverter::exec() {
     }
 
     /* Create distance field glyph cache if radius is specified */
-    Containers::Pointer<Text::GlyphCache> cache;
+    Containers::Pointer<Text::AbstractGlyphCache> cache;
     if(!args.value<Vector2i>("output-size").isZero()) {
         Debug() << "Populating distance field glyph cache...";
 
-        cache.reset(new Text::DistanceFieldGlyphCache(
+        if(args.isSet("cpu")) cache.reset(new CpuGlyphCache(
+            args.value<Vector2i>("atlas-size"),
+            args.value<Vector2i>("output-size"),
+            args.value<UnsignedInt>("radius"),
+            args.value<UnsignedInt>("threads")));
+        else cache.reset(new Text::DistanceFieldGlyphCache(
             args.value<Vector2i>("atlas-size"),
             args.value<Vector2i>("output-size"),
             args.value<Int>("radius")));
@@ -200,7 +268,10 @@ int FontConverter::exec() {
     } else {
         Debug() << "Zero-size distance field output specified, populating normal glyph cache...";
 
-        cache.reset(new Text::GlyphCache(args.value<Vector2i>("atlas-size")));
+        if(args.isSet("cpu"))
+            cache.reset(new CpuGlyphCache(args.value<Vector2i>("atlas-size")));
+        else
+            cache.reset(new Text::GlyphCache(args.value<Vector2i>("atlas-size")));
     }
 
     /* Fill the cache */
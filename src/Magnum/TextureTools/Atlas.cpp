@@ -25,38 +25,267 @@
 
 #include "Atlas.h"
 
+#include <algorithm>
+#include <Corrade/Containers/Array.h>
+
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Range.h"
 
 namespace Magnum { namespace TextureTools {
 
-std::vector<Range2Di> atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding) {
-    if(sizes.empty()) return {};
+namespace {
 
-    /* Size of largest texture */
-    Vector2i maxSize;
-    for(const Vector2i& size: sizes)
-        maxSize = Math::max(maxSize, size);
+/* A horizontal segment of the skyline, i.e. the top edge of everything
+   placed below it. Segments are ordered by X and cover the whole width. */
+struct SkylineSegment {
+    Int x, y, width;
+};
 
-    std::vector<Range2Di> atlas;
+class Skyline {
+    public:
+        explicit Skyline(const Vector2i& size): _size{size}, _segments{{0, 0, size.x()}} {}
+
+        /* Returns Y position at which a rectangle of given size would be
+           placed if put at the start of segment `i`, or -1 if it doesn't fit
+           there */
+        Int fit(const std::size_t i, const Vector2i& size) const {
+            const Int x = _segments[i].x;
+            if(x + size.x() > _size.x()) return -1;
+
+            Int y = _segments[i].y;
+            std::size_t j = i;
+            for(Int widthLeft = size.x(); widthLeft > 0; ++j) {
+                y = Math::max(y, _segments[j].y);
+                if(y + size.y() > _size.y()) return -1;
+                widthLeft -= _segments[j].width;
+            }
+
+            return y;
+        }
+
+        /* Finds the segment where given rectangle has the lowest top edge,
+           choosing the leftmost in case of a tie. Returns false if it doesn't
+           fit anywhere. */
+        bool find(const Vector2i& size, std::size_t& bestSegment, Int& bestY) const {
+            Int bestTop = _size.y() + 1;
+            for(std::size_t i = 0; i != _segments.size(); ++i) {
+                const Int y = fit(i, size);
+                if(y != -1 && y + size.y() < bestTop) {
+                    bestTop = y + size.y();
+                    bestSegment = i;
+                    bestY = y;
+                }
+            }
+
+            return bestTop != _size.y() + 1;
+        }
+
+        /* Puts a rectangle at the start of given segment */
+        Vector2i place(const std::size_t i, const Int y, const Vector2i& size) {
+            const Vector2i position{_segments[i].x, y};
+            const Int end = position.x() + size.x();
+            _segments.insert(_segments.begin() + i, SkylineSegment{position.x(), y + size.y(), size.x()});
+
+            /* Shrink or remove the segments that are now covered */
+            std::size_t j = i + 1;
+            while(j < _segments.size() && _segments[j].x < end) {
+                const Int shrink = end - _segments[j].x;
+                if(shrink >= _segments[j].width) {
+                    _segments.erase(_segments.begin() + j);
+                } else {
+                    _segments[j].x += shrink;
+                    _segments[j].width -= shrink;
+                    break;
+                }
+            }
+
+            /* Merge with neighbors of the same height */
+            if(i + 1 < _segments.size() && _segments[i + 1].y == _segments[i].y) {
+                _segments[i].width += _segments[i + 1].width;
+                _segments.erase(_segments.begin() + i + 1);
+            }
+            if(i > 0 && _segments[i - 1].y == _segments[i].y) {
+                _segments[i - 1].width += _segments[i].width;
+                _segments.erase(_segments.begin() + i);
+            }
+
+            return position;
+        }
+
+    private:
+        Vector2i _size;
+        std::vector<SkylineSegment> _segments;
+};
+
+/* Packs the textures into existing layers, adding new ones up to
+   `layerCount`. Returns position of the padded texture in the XY coordinates
+   and layer index in Z, or an empty array if the textures don't fit, in which
+   case the layers are left in an unspecified state. Sizes of rotated
+   textures are flipped in place. */
+Containers::Array<Vector3i> atlasInternal(std::vector<Skyline>& layers, const Vector2i& layerSize, const Int layerCount, std::vector<Vector2i>& sizes, const Vector2i& padding, const AtlasFlags flags) {
+    /* Sort from the tallest. With rotation, the textures are rotated to be
+       landscape first so the skyline stays low, the portrait orientation is
+       tried later during placement. */
+    if(flags & AtlasFlag::AllowRotation) for(Vector2i& size: sizes)
+        if(size.x() < size.y()) size = size.flipped();
+    Containers::Array<std::size_t> order{Containers::NoInit, sizes.size()};
+    for(std::size_t i = 0; i != order.size(); ++i) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&sizes](std::size_t a, std::size_t b) {
+        return sizes[a].y() > sizes[b].y() || (sizes[a].y() == sizes[b].y() && sizes[a].x() > sizes[b].x());
+    });
+
+    Containers::Array<Vector3i> positions{Containers::ValueInit, sizes.size()};
+    for(const std::size_t i: order) {
+        const Vector2i paddedSize = sizes[i] + 2*padding;
+        const Vector2i rotatedPaddedSize = sizes[i].flipped() + 2*padding;
+
+        /* Empty textures don't need any space */
+        if(!paddedSize.product()) continue;
+
+        /* Put the texture into the first layer where it fits, or add a new
+           one if there's none */
+        bool placed = false;
+        for(std::size_t layer = 0; layer <= layers.size() && !placed; ++layer) {
+            if(layer == layers.size()) {
+                if(Int(layers.size()) == layerCount) break;
+                layers.emplace_back(layerSize);
+            }
 
-    /* Columns and rows */
-    const Vector2i paddedSize = maxSize+2*padding;
-    const Vector2i gridSize = atlasSize/paddedSize;
-    if(std::size_t(gridSize.product()) < sizes.size()) {
+            std::size_t segment{};
+            Int y{};
+            bool rotated = false;
+            bool found = layers[layer].find(paddedSize, segment, y);
+
+            /* Try the other orientation, use it if the top edge ends up
+               lower */
+            if(flags & AtlasFlag::AllowRotation && sizes[i].x() != sizes[i].y()) {
+                std::size_t rotatedSegment{};
+                Int rotatedY{};
+                if(layers[layer].find(rotatedPaddedSize, rotatedSegment, rotatedY) && (!found || rotatedY + rotatedPaddedSize.y() < y + paddedSize.y())) {
+                    found = true;
+                    rotated = true;
+                    segment = rotatedSegment;
+                    y = rotatedY;
+                }
+            }
+
+            if(!found) continue;
+
+            if(rotated) sizes[i] = sizes[i].flipped();
+            positions[i] = {layers[layer].place(segment, y, rotated ? rotatedPaddedSize : paddedSize), Int(layer)};
+            placed = true;
+        }
+
+        if(!placed) return {};
+    }
+
+    return positions;
+}
+
+}
+
+std::vector<Range2Di> atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding, const AtlasFlags flags) {
+    if(sizes.empty()) return {};
+
+    std::vector<Range2Di> atlas;
+    std::vector<Vector2i> outputSizes = sizes;
+    std::vector<Skyline> layers;
+    const Containers::Array<Vector3i> positions = atlasInternal(layers, atlasSize, 1, outputSizes, padding, flags);
+    if(positions.empty()) {
         Error() << "TextureTools::atlas(): requested atlas size" << atlasSize
-                << "is too small to fit" << sizes.size() << paddedSize
+                << "is too small to fit" << sizes.size()
                 << "textures. Generated atlas will be empty.";
         return atlas;
     }
 
-    /** @todo actual magic implementation, not this joke */
+    atlas.reserve(sizes.size());
+    for(std::size_t i = 0; i != sizes.size(); ++i)
+        atlas.push_back(Range2Di::fromSize(positions[i].xy() + padding, outputSizes[i]));
+
+    return atlas;
+}
+
+std::vector<Range3Di> atlasArray(const Vector3i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding, const AtlasFlags flags) {
+    if(sizes.empty()) return {};
+
+    std::vector<Range3Di> atlas;
+    std::vector<Vector2i> outputSizes = sizes;
+    std::vector<Skyline> layers;
+    const Containers::Array<Vector3i> positions = atlasInternal(layers, atlasSize.xy(), atlasSize.z(), outputSizes, padding, flags);
+    if(positions.empty()) {
+        Error() << "TextureTools::atlasArray(): requested atlas size" << atlasSize
+                << "is too small to fit" << sizes.size()
+                << "textures. Generated atlas will be empty.";
+        return atlas;
+    }
 
     atlas.reserve(sizes.size());
     for(std::size_t i = 0; i != sizes.size(); ++i)
-        atlas.push_back(Range2Di::fromSize(Vector2i(i%gridSize.x(), i/gridSize.x())*paddedSize+padding, sizes[i]));
+        atlas.push_back(Range3Di::fromSize(positions[i] + Vector3i{padding, 0}, {outputSizes[i], 1}));
 
     return atlas;
 }
 
+struct AtlasPacker::State {
+    explicit State(const Vector2i& size, const Vector2i& padding, AtlasFlags flags): size{size}, padding{padding}, flags{flags} {}
+
+    Vector2i size, padding;
+    AtlasFlags flags;
+    std::vector<Skyline> layers;
+    Range2Di dirtyRange;
+};
+
+AtlasPacker::AtlasPacker(const Vector2i& size, const Vector2i& padding, const AtlasFlags flags): _state{Containers::InPlaceInit, size, padding, flags} {}
+
+AtlasPacker::AtlasPacker(AtlasPacker&&) noexcept = default;
+
+AtlasPacker::~AtlasPacker() = default;
+
+AtlasPacker& AtlasPacker::operator=(AtlasPacker&&) noexcept = default;
+
+Vector2i AtlasPacker::size() const { return _state->size; }
+
+Vector2i AtlasPacker::padding() const { return _state->padding; }
+
+AtlasFlags AtlasPacker::flags() const { return _state->flags; }
+
+std::vector<Range2Di> AtlasPacker::add(const std::vector<Vector2i>& sizes) {
+    if(sizes.empty()) return {};
+
+    /* Pack into a copy of the skyline so the state stays untouched if the
+       textures don't fit. The skyline is usually just a few segments so this
+       is cheap. */
+    std::vector<Skyline> layers = _state->layers;
+    std::vector<Vector2i> outputSizes = sizes;
+    const Containers::Array<Vector3i> positions = atlasInternal(layers, _state->size, 1, outputSizes, _state->padding, _state->flags);
+    std::vector<Range2Di> atlas;
+    if(positions.empty()) {
+        Error() << "TextureTools::AtlasPacker::add(): atlas size" << _state->size
+                << "is too small to fit" << sizes.size() << "more textures";
+        return atlas;
+    }
+
+    _state->layers = std::move(layers);
+    atlas.reserve(sizes.size());
+    for(std::size_t i = 0; i != sizes.size(); ++i) {
+        atlas.push_back(Range2Di::fromSize(positions[i].xy() + _state->padding, outputSizes[i]));
+
+        /* Zero-area textures have no contents to upload, don't let them
+           extend the dirty range */
+        if(outputSizes[i].product())
+            _state->dirtyRange = Math::join(_state->dirtyRange, atlas.back().padded(_state->padding));
+    }
+
+    return atlas;
+}
+
+Range2Di AtlasPacker::dirtyRange() const { return _state->dirtyRange; }
+
+void AtlasPacker::resetDirtyRange() { _state->dirtyRange = {}; }
+
+void AtlasPacker::clear() {
+    _state->layers.clear();
+    _state->dirtyRange = {};
+}
+
 }}
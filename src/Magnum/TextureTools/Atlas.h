@@ -26,31 +26,181 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::TextureTools::atlas()
+ * @brief Class @ref Magnum::TextureTools::AtlasPacker, function @ref Magnum::TextureTools::atlas(), @ref Magnum::TextureTools::atlasArray(), enum @ref Magnum::TextureTools::AtlasFlag, enum set @ref Magnum::TextureTools::AtlasFlags
  */
 
 #include <vector>
+#include <Corrade/Containers/EnumSet.h>
+#include <Corrade/Containers/Pointer.h>
 
 #include "Magnum/Magnum.h"
-#include "Magnum/Math/Vector2.h"
+#include "Magnum/Math/Vector3.h"
 #include "Magnum/TextureTools/visibility.h"
 
 namespace Magnum { namespace TextureTools {
 
+/**
+@brief Atlas packing flag
+@m_since_latest
+
+@see @ref AtlasFlags, @ref atlas(), @ref atlasArray()
+*/
+enum class AtlasFlag: UnsignedByte {
+    /**
+     * Allow rotating the textures by 90° if it results in a tighter packing.
+     * A rotated texture is reported with its size flipped, i.e.
+     * @cpp range.size() == sizes[i].flipped() @ce. For square textures the
+     * rotation is never done.
+     */
+    AllowRotation = 1 << 0
+};
+
+/**
+@brief Atlas packing flags
+@m_since_latest
+
+@see @ref atlas(), @ref atlasArray()
+*/
+typedef Containers::EnumSet<AtlasFlag> AtlasFlags;
+
+CORRADE_ENUMSET_OPERATORS(AtlasFlags)
+
 /**
 @brief Pack textures into texture atlas
 @param atlasSize    Size of resulting atlas
 @param sizes        Sizes of all textures in the atlas
 @param padding      Padding around each texture
+@param flags        Packing flags
 
 Packs many small textures into one larger. If the textures cannot be packed
 into required size, empty vector is returned.
 
 Padding is added twice to each size and the atlas is laid out so the padding
 don't overlap. Returned sizes are the same as original sizes, i.e. without the
-padding.
+padding, except for textures rotated with @ref AtlasFlag::AllowRotation, which
+have the size flipped. The returned ranges are in the same order as @p sizes.
+
+The textures are packed using a skyline algorithm --- they're sorted from the
+tallest, each is then placed at the position along the current skyline where
+its top edge ends up lowest, with ties resolved by choosing the leftmost
+position. The packing takes @f$ \mathcal{O}(n \log n + ns^2) @f$ time in the
+worst case, where @f$ s @f$ is the count of distinct skyline segments --- for
+each texture, every segment is tried as a starting position and the fit check
+walks the segments the texture spans. The count of segments is usually very
+small compared to @f$ n @f$.
+@see @ref atlasArray()
 */
-std::vector<Range2Di> MAGNUM_TEXTURETOOLS_EXPORT atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding = Vector2i());
+std::vector<Range2Di> MAGNUM_TEXTURETOOLS_EXPORT atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding = Vector2i(), AtlasFlags flags = {});
+
+/**
+@brief Pack textures into a texture array atlas
+@param atlasSize    Size of a single layer in the first two dimensions, max
+    count of layers in the third
+@param sizes        Sizes of all textures in the atlas
+@param padding      Padding around each texture
+@param flags        Packing flags
+@m_since_latest
+
+Like @ref atlas(), but if the textures don't fit into a single layer, new
+layers are added, up to @cpp atlasSize.z() @ce. Each texture is put into the
+first layer it fits into. The Z coordinate of each returned range is the layer
+index, with the range being one layer thick. If the textures cannot be packed
+into required count of layers, empty vector is returned. The count of layers
+actually used is the maximal Z coordinate of all returned ranges.
+*/
+std::vector<Range3Di> MAGNUM_TEXTURETOOLS_EXPORT atlasArray(const Vector3i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding = Vector2i(), AtlasFlags flags = {});
+
+/**
+@brief Incremental texture atlas packer
+@m_since_latest
+
+Unlike @ref atlas(), which packs all textures at once, this class keeps track
+of the free space in the atlas across calls to @ref add(), so new textures can
+be added to an already populated atlas without moving the textures placed
+before. Each batch passed to @ref add() is packed the same way as in
+@ref atlas(), using the skyline left by previous batches. Adding a texture
+thus takes time depending on the count of skyline segments as described in
+@ref atlas(), not on the count of textures already in the atlas.
+
+The packer also tracks a bounding range of all textures added since the last
+call to @ref resetDirtyRange(). After copying the new textures into the atlas
+image, only this range needs to be uploaded to the atlas texture instead of the
+whole image.
+
+@see @ref Text::AbstractGlyphCache::reserve()
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT AtlasPacker {
+    public:
+        /**
+         * @brief Constructor
+         * @param size      Atlas size
+         * @param padding   Padding around each texture
+         * @param flags     Packing flags
+         */
+        explicit AtlasPacker(const Vector2i& size, const Vector2i& padding = {}, AtlasFlags flags = {});
+
+        /** @brief Copying is not allowed */
+        AtlasPacker(const AtlasPacker&) = delete;
+
+        /** @brief Move constructor */
+        AtlasPacker(AtlasPacker&&) noexcept;
+
+        ~AtlasPacker();
+
+        /** @brief Copying is not allowed */
+        AtlasPacker& operator=(const AtlasPacker&) = delete;
+
+        /** @brief Move assignment */
+        AtlasPacker& operator=(AtlasPacker&&) noexcept;
+
+        /** @brief Atlas size */
+        Vector2i size() const;
+
+        /** @brief Padding around each texture */
+        Vector2i padding() const;
+
+        /** @brief Packing flags */
+        AtlasFlags flags() const;
+
+        /**
+         * @brief Add textures to the atlas
+         *
+         * Returns ranges for all @p sizes in the same order, with the same
+         * semantics as @ref atlas(). Textures placed in previous calls are
+         * not moved. If the textures don't all fit into the remaining space,
+         * prints a message to @ref Error, returns an empty
+         * vector and the packer state is left unchanged.
+         */
+        std::vector<Range2Di> add(const std::vector<Vector2i>& sizes);
+
+        /**
+         * @brief Range of the atlas modified since last reset
+         *
+         * Bounding range of all textures including their padding added since
+         * construction or since the last call to @ref resetDirtyRange() or
+         * @ref clear(). Textures with a zero area are not included. Zero-size
+         * if nothing was added.
+         */
+        Range2Di dirtyRange() const;
+
+        /**
+         * @brief Reset the dirty range
+         *
+         * @see @ref dirtyRange()
+         */
+        void resetDirtyRange();
+
+        /**
+         * @brief Clear the atlas
+         *
+         * Marks the whole atlas as free again and resets the dirty range.
+         */
+        void clear();
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
 
 }}
 
@@ -25,6 +25,17 @@
 
 #include "DistanceField.h"
 
+#include <cmath>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+
+#ifdef MAGNUM_TARGET_GL
 #include <Corrade/Containers/Reference.h>
 #include <Corrade/Utility/FormatStl.h>
 #include <Corrade/Utility/Resource.h>
@@ -45,11 +56,176 @@ static void importTextureToolResources() {
     CORRADE_RESOURCE_INITIALIZE(MagnumTextureTools_RCS)
 }
 #endif
+#endif
 
 namespace Magnum { namespace TextureTools {
 
 namespace {
 
+/* Column pass of the distance transform. For every pixel in columns
+   [begin, end) extracts whether it's inside into `mask`, then calculates
+   vertical distance to the nearest inside pixel into `inside` and to the
+   nearest outside pixel into `outside`, clamped to `max`. The loops go over
+   whole rows so the innermost loops are over contiguous memory and get
+   vectorized. */
+void distanceFieldColumns(const char* const input, const std::ptrdiff_t inputRowStride, const std::ptrdiff_t inputPixelStride, UnsignedByte* const mask, Int* const inside, Int* const outside, const std::size_t width, const std::size_t height, const std::size_t begin, const std::size_t end, const Int max) {
+    /* Top to bottom. The input can have arbitrary strides, so it's first
+       converted to a contiguous mask row. */
+    for(std::size_t y = 0; y != height; ++y) {
+        const char* const inputRow = input + y*inputRowStride;
+        UnsignedByte* const maskRow = mask + y*width;
+        for(std::size_t x = begin; x != end; ++x)
+            maskRow[x] = UnsignedByte(inputRow[x*inputPixelStride]) > 127;
+
+        Int* const insideRow = inside + y*width;
+        Int* const outsideRow = outside + y*width;
+        if(!y) for(std::size_t x = begin; x != end; ++x) {
+            insideRow[x] = maskRow[x] ? 0 : max;
+            outsideRow[x] = maskRow[x] ? max : 0;
+        } else {
+            const Int* const insidePrevious = insideRow - width;
+            const Int* const outsidePrevious = outsideRow - width;
+            for(std::size_t x = begin; x != end; ++x) {
+                /* Loading both values unconditionally so the loop doesn't
+                   branch */
+                const Int insideAbove = Math::min(insidePrevious[x] + 1, max);
+                const Int outsideAbove = Math::min(outsidePrevious[x] + 1, max);
+                insideRow[x] = maskRow[x] ? 0 : insideAbove;
+                outsideRow[x] = maskRow[x] ? outsideAbove : 0;
+            }
+        }
+    }
+
+    /* Bottom to top */
+    for(std::size_t y = height - 1; y-- > 0; ) {
+        Int* const insideRow = inside + y*width;
+        Int* const outsideRow = outside + y*width;
+        const Int* const insideNext = insideRow + width;
+        const Int* const outsideNext = outsideRow + width;
+        for(std::size_t x = begin; x != end; ++x) {
+            insideRow[x] = Math::min(insideRow[x], insideNext[x] + 1);
+            outsideRow[x] = Math::min(outsideRow[x], outsideNext[x] + 1);
+        }
+    }
+}
+
+/* Row pass of the distance transform, calculating squared Euclidean distance
+   for every pixel in a row from the column distances `g` using the lower
+   envelope of parabolas, as described in A. Meijster, J.B.T.M. Roerdink and
+   W.H. Hesselink: A General Algorithm for Computing Distance Transforms in
+   Linear Time. The `s` and `t` are scratch arrays of `width` items. */
+void distanceFieldRow(const Int* const g, Int* const out, Int* const s, Int* const t, const Int width) {
+    Int q = 0;
+    s[0] = 0;
+    t[0] = 0;
+    for(Int u = 1; u < width; ++u) {
+        while(q >= 0 && (t[q] - s[q])*(t[q] - s[q]) + g[s[q]]*g[s[q]] > (t[q] - u)*(t[q] - u) + g[u]*g[u])
+            --q;
+
+        if(q < 0) {
+            q = 0;
+            s[0] = u;
+        } else {
+            /* Position from which the parabola at u is lower than the one at
+               s[q]. The numerator can be negative, so a floor division has to
+               be done explicitly. */
+            const Int numerator = u*u - s[q]*s[q] + g[u]*g[u] - g[s[q]]*g[s[q]];
+            const Int denominator = 2*(u - s[q]);
+            const Int w = 1 + (numerator >= 0 ?
+                numerator/denominator :
+               -((denominator - 1 - numerator)/denominator));
+            if(w < width) {
+                ++q;
+                s[q] = u;
+                t[q] = w;
+            }
+        }
+    }
+
+    for(Int u = width - 1; u >= 0; --u) {
+        out[u] = (u - s[q])*(u - s[q]) + g[s[q]]*g[s[q]];
+        if(u == t[q]) --q;
+    }
+}
+
+}
+
+void distanceField(const ImageView2D& input, const MutableImageView2D& output, const UnsignedInt radius, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(input.format() == PixelFormat::R8Unorm ||
+                   input.format() == PixelFormat::RG8Unorm ||
+                   input.format() == PixelFormat::RGB8Unorm ||
+                   input.format() == PixelFormat::RGBA8Unorm,
+        "TextureTools::distanceField(): expected input to be R8Unorm, RG8Unorm, RGB8Unorm or RGBA8Unorm but got" << input.format(), );
+    CORRADE_ASSERT(output.format() == PixelFormat::R8Unorm,
+        "TextureTools::distanceField(): expected output to be R8Unorm but got" << output.format(), );
+    CORRADE_ASSERT(input.size().product() && output.size().product(),
+        "TextureTools::distanceField(): expected non-empty input and output but got" << input.size() << "and" << output.size(), );
+
+    const std::size_t width = input.size().x();
+    const std::size_t height = input.size().y();
+    const Int max = radius + 1;
+    const Int maxSquared = max*max;
+
+    /* Output values for all possible squared distances, first for outside
+       and then for inside pixels. Signed distance normalized from
+       [-radius-1, radius+1] to [0, 1], calculated the same way as in the
+       shader. */
+    Containers::Array<UnsignedByte> values{Containers::NoInit, std::size_t(2*(maxSquared + 1))};
+    for(Int i = 0; i <= maxSquared; ++i) {
+        const Float distance = std::sqrt(Float(i))/Float(max);
+        values[i] = Math::pack<UnsignedByte>(-0.5f*distance + 0.5f);
+        values[maxSquared + 1 + i] = Math::pack<UnsignedByte>(0.5f*distance + 0.5f);
+    }
+
+    /* Vertical distances to the nearest inside and outside pixel. The
+       columns are split into chunks of at least 64 so the threads don't write
+       to the same cache lines too often. */
+    Containers::Array<UnsignedByte> mask{Containers::NoInit, width*height};
+    Containers::Array<Int> inside{Containers::NoInit, width*height};
+    Containers::Array<Int> outside{Containers::NoInit, width*height};
+    const Containers::StridedArrayView3D<const char> pixels = input.pixels();
+    const auto inputData = static_cast<const char*>(pixels.data());
+    const std::ptrdiff_t inputRowStride = pixels.stride()[0];
+    const std::ptrdiff_t inputPixelStride = pixels.stride()[1];
+    Magnum::Implementation::parallelFor(width, Magnum::Implementation::parallelChunkCount(width, threadCount, 64), [&](const std::size_t begin, const std::size_t end, UnsignedInt) {
+        distanceFieldColumns(inputData, inputRowStride, inputPixelStride, mask.data(), inside.data(), outside.data(), width, height, begin, end, max);
+    });
+
+    /* Horizontal pass only for input rows that are sampled by the output,
+       sampling the input the same way as the shader does */
+    const Containers::StridedArrayView2D<UnsignedByte> outputPixels = output.pixels<UnsignedByte>();
+    const Vector2i outputSize = output.size();
+    const Vector2 scaling = Vector2{input.size()}/Vector2{outputSize};
+    Magnum::Implementation::parallelFor(outputSize.y(), Magnum::Implementation::parallelChunkCount(outputSize.y(), threadCount, 8), [&](const std::size_t begin, const std::size_t end, UnsignedInt) {
+        /* s, t and the transformed inside and outside row */
+        Containers::Array<Int> scratch{Containers::NoInit, 4*width};
+        Int* const s = scratch.data();
+        Int* const t = s + width;
+        Int* const insideRow = t + width;
+        Int* const outsideRow = insideRow + width;
+
+        for(std::size_t y = begin; y != end; ++y) {
+            const std::size_t inputY = Math::min(std::size_t(Float(y)*scaling.y()), height - 1);
+            distanceFieldRow(inside.data() + inputY*width, insideRow, s, t, Int(width));
+            distanceFieldRow(outside.data() + inputY*width, outsideRow, s, t, Int(width));
+
+            const UnsignedByte* const maskRow = mask.data() + inputY*width;
+            const Containers::StridedArrayView1D<UnsignedByte> outputRow = outputPixels[y];
+            for(std::size_t x = 0; x != std::size_t(outputSize.x()); ++x) {
+                const std::size_t inputX = Math::min(std::size_t(Float(x)*scaling.x()), width - 1);
+                /* Inside pixels look for the nearest outside pixel and vice
+                   versa */
+                outputRow[x] = maskRow[inputX] ?
+                    values[maxSquared + 1 + Math::min(outsideRow[inputX], maxSquared)] :
+                    values[Math::min(insideRow[inputX], maxSquared)];
+            }
+        }
+    });
+}
+
+#ifdef MAGNUM_TARGET_GL
+namespace {
+
 class DistanceFieldShader: public GL::AbstractShaderProgram {
     public:
         typedef GL::Attribute<0, Vector2> Position;
@@ -219,4 +395,6 @@ void DistanceField::operator()(GL::Texture2D& input, GL::Texture2D& output, cons
     _state->shader.draw(_state->mesh);
 }
 
+#endif
+
 }}
@@ -26,23 +26,60 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::TextureTools::DistanceField
+ * @brief Class @ref Magnum::TextureTools::DistanceField, function @ref Magnum::TextureTools::distanceField()
  */
 
-#include "Magnum/configure.h"
+#include "Magnum/Magnum.h"
+#include "Magnum/TextureTools/visibility.h"
 
 #ifdef MAGNUM_TARGET_GL
 #include <Corrade/Containers/Pointer.h>
 
-#include "Magnum/Magnum.h"
 #include "Magnum/GL/GL.h"
 #ifndef MAGNUM_TARGET_GLES
 #include "Magnum/Math/Vector2.h"
 #endif
-#include "Magnum/TextureTools/visibility.h"
+#endif
 
 namespace Magnum { namespace TextureTools {
 
+/**
+@brief Create a signed distance field on the CPU
+@param input        Input image
+@param output       Output image
+@param radius       Max lookup radius in the input image
+@param threadCount  Count of threads to use. Use @cpp 0 @ce for all
+    available hardware threads.
+@m_since_latest
+
+A CPU counterpart to @ref DistanceField, producing the same output without
+needing a GL context. Converts a binary black/white image stored in the first
+channel of @p input to a signed distance field in @p output. The @p input is
+expected to be @ref PixelFormat::R8Unorm, @ref PixelFormat::RG8Unorm,
+@ref PixelFormat::RGB8Unorm or @ref PixelFormat::RGBA8Unorm, a pixel is
+considered inside if its first channel is larger than @cpp 0.5 @ce. The
+@p output is expected to be @ref PixelFormat::R8Unorm and is filled whole,
+usually it's smaller than @p input. See the
+@ref TextureTools-DistanceField-algorithm "DistanceField class documentation"
+for a description of the output values.
+
+Instead of searching the whole @p radius around each pixel, an exact Euclidean
+distance transform of the whole input is calculated in linear time using the
+algorithm from *A. Meijster, J.B.T.M. Roerdink and W.H. Hesselink -- A General
+Algorithm for Computing Distance Transforms in Linear Time*. The vertical pass
+goes over whole image rows and is vectorized by the compiler, the horizontal
+pass is then done only for rows that get sampled by the output. With
+@p threadCount larger than @cpp 1 @ce, the vertical pass is split into ranges
+of columns and the horizontal pass into ranges of output rows, each processed
+on a separate thread. The output is the same regardless of the thread count.
+The function allocates @cpp 9 @ce bytes of temporary memory per input pixel.
+
+Compared to the GPU implementation, pixels outside of the input image are
+never considered in the distance calculation.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT void distanceField(const ImageView2D& input, const MutableImageView2D& output, UnsignedInt radius, UnsignedInt threadCount = 1);
+
+#ifdef MAGNUM_TARGET_GL
 /**
 @brief Create a signed distance field
 
@@ -57,6 +94,9 @@ or drop shadow essentially for free.
 You can also use the @ref magnum-distancefieldconverter "magnum-distancefieldconverter"
 utility to do distance field conversion on command-line. This functionality is
 also used inside the @ref magnum-fontconverter "magnum-fontconverter" utility.
+If a GL context isn't available, use the
+@ref distanceField(const ImageView2D&, const MutableImageView2D&, UnsignedInt, UnsignedInt)
+function instead, which produces the same output on the CPU.
 
 @section TextureTools-DistanceField-algorithm The algorithm
 
@@ -78,8 +118,7 @@ Based on: *Chris Green - Improved Alpha-Tested Magnification for Vector Textures
 and Special Effects, SIGGRAPH 2007,
 http://www.valvesoftware.com/publications/2007/SIGGRAPH2007_AlphaTestedMagnification.pdf*
 
-@attention This is a GPU-only implementation, so it expects an active GL
-    context.
+@attention This is a GPU implementation, so it expects an active GL context.
 
 @note If internal format of @p output texture is not renderable, this function
     prints a message to error output and does nothing. On desktop OpenGL and
@@ -144,10 +183,8 @@ inline CORRADE_DEPRECATED("use the DistanceField class instead") void distanceFi
     DistanceField{UnsignedInt(radius)}(input, output, rectangle, imageSize);
 }
 #endif
+#endif
 
 }}
-#else
-#error this header is available only in the OpenGL build
-#endif
 
 #endif
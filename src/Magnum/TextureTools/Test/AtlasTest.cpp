@@ -23,10 +23,12 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <random>
 #include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/DebugStl.h>
 
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Range.h"
 #include "Magnum/TextureTools/Atlas.h"
 
@@ -39,13 +41,64 @@ struct AtlasTest: TestSuite::Tester {
     void createPadding();
     void createEmpty();
     void createTooSmall();
+    void createRotation();
+    void createNoOverlap();
+
+    void createArray();
+    void createArrayTooSmall();
+
+    void packer();
+    void packerIncremental();
+    void packerZeroSize();
+    void packerTooSmall();
+    void packerClear();
+
+    void benchmark();
+    void benchmarkRotation();
+
+    void benchmarkEfficiencyBegin();
+    std::uint64_t benchmarkEfficiencyEnd();
+    void benchmarkEfficiency();
+    void benchmarkEfficiencyRotation();
+
+    std::uint64_t _efficiency;
 };
 
 AtlasTest::AtlasTest() {
     addTests({&AtlasTest::create,
               &AtlasTest::createPadding,
               &AtlasTest::createEmpty,
-              &AtlasTest::createTooSmall});
+              &AtlasTest::createTooSmall,
+              &AtlasTest::createRotation,
+              &AtlasTest::createNoOverlap,
+
+              &AtlasTest::createArray,
+              &AtlasTest::createArrayTooSmall,
+
+              &AtlasTest::packer,
+              &AtlasTest::packerIncremental,
+              &AtlasTest::packerZeroSize,
+              &AtlasTest::packerTooSmall,
+              &AtlasTest::packerClear});
+
+    addBenchmarks({&AtlasTest::benchmark,
+                   &AtlasTest::benchmarkRotation}, 10);
+
+    addCustomBenchmarks({&AtlasTest::benchmarkEfficiency,
+                         &AtlasTest::benchmarkEfficiencyRotation}, 1,
+        &AtlasTest::benchmarkEfficiencyBegin,
+        &AtlasTest::benchmarkEfficiencyEnd,
+        BenchmarkUnits::PercentageThousandths);
+}
+
+std::vector<Vector2i> randomSizes(std::size_t count) {
+    std::mt19937 rng;
+    std::uniform_int_distribution<Int> distribution{4, 32};
+    std::vector<Vector2i> sizes;
+    sizes.reserve(count);
+    for(std::size_t i = 0; i != count; ++i)
+        sizes.emplace_back(distribution(rng), distribution(rng));
+    return sizes;
 }
 
 void AtlasTest::create() {
@@ -57,9 +110,9 @@ void AtlasTest::create() {
 
     CORRADE_COMPARE(atlas.size(), 3);
     CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
-        Range2Di::fromSize({0, 0}, {12, 18}),
-        Range2Di::fromSize({32, 0}, {32, 15}),
-        Range2Di::fromSize({0, 25}, {23, 25})}));
+        Range2Di::fromSize({23, 0}, {12, 18}),
+        Range2Di::fromSize({23, 18}, {32, 15}),
+        Range2Di::fromSize({0, 0}, {23, 25})}));
 }
 
 void AtlasTest::createPadding() {
@@ -71,9 +124,9 @@ void AtlasTest::createPadding() {
 
     CORRADE_COMPARE(atlas.size(), 3);
     CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
-        Range2Di::fromSize({2, 1}, {8, 16}),
-        Range2Di::fromSize({34, 1}, {28, 13}),
-        Range2Di::fromSize({2, 26}, {19, 23})}));
+        Range2Di::fromSize({25, 1}, {8, 16}),
+        Range2Di::fromSize({25, 19}, {28, 13}),
+        Range2Di::fromSize({2, 1}, {19, 23})}));
 }
 
 void AtlasTest::createEmpty() {
@@ -85,13 +138,239 @@ void AtlasTest::createTooSmall() {
     std::ostringstream o;
     Error redirectError{&o};
 
-    std::vector<Range2Di> atlas = TextureTools::atlas({64, 32}, {
+    std::vector<Range2Di> atlas = TextureTools::atlas({32, 32}, {
         {8, 16},
         {21, 13},
         {19, 29}
     }, {2, 1});
     CORRADE_VERIFY(atlas.empty());
-    CORRADE_COMPARE(o.str(), "TextureTools::atlas(): requested atlas size Vector(64, 32) is too small to fit 3 Vector(25, 31) textures. Generated atlas will be empty.\n");
+    CORRADE_COMPARE(o.str(), "TextureTools::atlas(): requested atlas size Vector(32, 32) is too small to fit 3 textures. Generated atlas will be empty.\n");
+}
+
+void AtlasTest::createRotation() {
+    /* Without rotation the second doesn't fit */
+    {
+        std::ostringstream o;
+        Error redirectError{&o};
+        CORRADE_VERIFY(TextureTools::atlas({64, 16}, {
+            {30, 10},
+            {10, 30}
+        }).empty());
+    }
+
+    std::vector<Range2Di> atlas = TextureTools::atlas({64, 16}, {
+        {30, 10},
+        {10, 30}
+    }, {}, AtlasFlag::AllowRotation);
+
+    /* The second is rotated, having the size flipped */
+    CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
+        Range2Di::fromSize({0, 0}, {30, 10}),
+        Range2Di::fromSize({30, 0}, {30, 10})}));
+}
+
+void AtlasTest::createNoOverlap() {
+    const std::vector<Vector2i> sizes = randomSizes(500);
+    const Vector2i padding{1, 2};
+    std::vector<Range2Di> atlas = TextureTools::atlas({512, 512}, sizes, padding);
+    CORRADE_COMPARE(atlas.size(), sizes.size());
+
+    /* Mark all padded rectangles in a bitmap, none should be marked twice */
+    std::vector<bool> used(512*512);
+    for(std::size_t i = 0; i != atlas.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(atlas[i].size(), sizes[i]);
+
+        const Range2Di padded = atlas[i].padded(padding);
+        CORRADE_VERIFY((padded.min() >= Vector2i{} && padded.max() <= Vector2i{512}).all());
+        for(Int y = padded.bottom(); y != padded.top(); ++y)
+            for(Int x = padded.left(); x != padded.right(); ++x) {
+                CORRADE_VERIFY(!used[y*512 + x]);
+                used[y*512 + x] = true;
+            }
+    }
+}
+
+void AtlasTest::createArray() {
+    std::vector<Range3Di> atlas = TextureTools::atlasArray({64, 64, 3}, {
+        {40, 40},
+        {40, 40},
+        {20, 20},
+        {40, 40}
+    });
+
+    /* The small one fits next to the first big one */
+    CORRADE_COMPARE(atlas, (std::vector<Range3Di>{
+        Range3Di::fromSize({0, 0, 0}, {40, 40, 1}),
+        Range3Di::fromSize({0, 0, 1}, {40, 40, 1}),
+        Range3Di::fromSize({40, 0, 0}, {20, 20, 1}),
+        Range3Di::fromSize({0, 0, 2}, {40, 40, 1})}));
+}
+
+void AtlasTest::createArrayTooSmall() {
+    std::ostringstream o;
+    Error redirectError{&o};
+
+    std::vector<Range3Di> atlas = TextureTools::atlasArray({64, 64, 2}, {
+        {40, 40},
+        {40, 40},
+        {40, 40}
+    });
+    CORRADE_VERIFY(atlas.empty());
+    CORRADE_COMPARE(o.str(), "TextureTools::atlasArray(): requested atlas size Vector(64, 64, 2) is too small to fit 3 textures. Generated atlas will be empty.\n");
+}
+
+void AtlasTest::packer() {
+    AtlasPacker packer{{64, 64}, {2, 1}, AtlasFlag::AllowRotation};
+    CORRADE_COMPARE(packer.size(), (Vector2i{64, 64}));
+    CORRADE_COMPARE(packer.padding(), (Vector2i{2, 1}));
+    CORRADE_COMPARE(packer.flags(), AtlasFlag::AllowRotation);
+    CORRADE_COMPARE(packer.dirtyRange(), Range2Di{});
+
+    /* Same as atlas() for the first batch */
+    std::vector<Range2Di> atlas = packer.add({
+        {8, 16},
+        {28, 13},
+        {19, 23}
+    });
+    CORRADE_COMPARE(atlas, TextureTools::atlas({64, 64}, {
+        {8, 16},
+        {28, 13},
+        {19, 23}
+    }, {2, 1}, AtlasFlag::AllowRotation));
+}
+
+void AtlasTest::packerIncremental() {
+    AtlasPacker packer{{64, 64}};
+
+    std::vector<Range2Di> first = packer.add({{32, 16}, {16, 16}});
+    CORRADE_COMPARE(first, (std::vector<Range2Di>{
+        Range2Di::fromSize({0, 0}, {32, 16}),
+        Range2Di::fromSize({32, 0}, {16, 16})}));
+    CORRADE_COMPARE(packer.dirtyRange(), (Range2Di{{0, 0}, {48, 16}}));
+
+    /* The next batch fills the space next to the first one, without touching
+       the already placed rectangles */
+    packer.resetDirtyRange();
+    CORRADE_COMPARE(packer.dirtyRange(), Range2Di{});
+    std::vector<Range2Di> second = packer.add({{16, 16}});
+    CORRADE_COMPARE(second, (std::vector<Range2Di>{
+        Range2Di::fromSize({48, 0}, {16, 16})}));
+    CORRADE_COMPARE(packer.dirtyRange(), (Range2Di{{48, 0}, {64, 16}}));
+
+    /* And then continues above, the dirty range is accumulated */
+    std::vector<Range2Di> third = packer.add({{64, 8}});
+    CORRADE_COMPARE(third, (std::vector<Range2Di>{
+        Range2Di::fromSize({0, 16}, {64, 8})}));
+    CORRADE_COMPARE(packer.dirtyRange(), (Range2Di{{0, 0}, {64, 24}}));
+}
+
+void AtlasTest::packerZeroSize() {
+    AtlasPacker packer{{64, 64}};
+    CORRADE_VERIFY(!packer.add({{32, 16}}).empty());
+    packer.resetDirtyRange();
+
+    /* Zero-area textures are put at the origin and take no space, but they
+       shouldn't extend the dirty range there */
+    std::vector<Range2Di> atlas = packer.add({{0, 0}, {0, 8}, {16, 16}});
+    CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
+        Range2Di::fromSize({0, 0}, {0, 0}),
+        Range2Di::fromSize({0, 0}, {0, 8}),
+        Range2Di::fromSize({32, 0}, {16, 16})}));
+    CORRADE_COMPARE(packer.dirtyRange(), (Range2Di{{32, 0}, {48, 16}}));
+
+    /* A batch with just zero-area textures doesn't make anything dirty */
+    packer.resetDirtyRange();
+    CORRADE_COMPARE(packer.add({{0, 0}, {8, 0}}).size(), 2);
+    CORRADE_COMPARE(packer.dirtyRange(), Range2Di{});
+}
+
+void AtlasTest::packerTooSmall() {
+    AtlasPacker packer{{64, 64}};
+    CORRADE_VERIFY(!packer.add({{64, 48}}).empty());
+
+    {
+        std::ostringstream o;
+        Error redirectError{&o};
+        CORRADE_VERIFY(packer.add({{8, 8}, {32, 32}}).empty());
+        CORRADE_COMPARE(o.str(), "TextureTools::AtlasPacker::add(): atlas size Vector(64, 64) is too small to fit 2 more textures\n");
+    }
+
+    /* The failed batch didn't take any space */
+    CORRADE_COMPARE(packer.add({{64, 16}}), (std::vector<Range2Di>{
+        Range2Di::fromSize({0, 48}, {64, 16})}));
+}
+
+void AtlasTest::packerClear() {
+    AtlasPacker packer{{64, 64}};
+    CORRADE_VERIFY(!packer.add({{64, 64}}).empty());
+
+    packer.clear();
+    CORRADE_COMPARE(packer.dirtyRange(), Range2Di{});
+    CORRADE_COMPARE(packer.add({{64, 64}}), (std::vector<Range2Di>{
+        Range2Di::fromSize({0, 0}, {64, 64})}));
+}
+
+void AtlasTest::benchmark() {
+    const std::vector<Vector2i> sizes = randomSizes(5000);
+
+    std::vector<Range2Di> atlas;
+    CORRADE_BENCHMARK(1)
+        atlas = TextureTools::atlas({2048, 2048}, sizes);
+
+    CORRADE_COMPARE(atlas.size(), sizes.size());
+}
+
+void AtlasTest::benchmarkRotation() {
+    const std::vector<Vector2i> sizes = randomSizes(5000);
+
+    std::vector<Range2Di> atlas;
+    CORRADE_BENCHMARK(1)
+        atlas = TextureTools::atlas({2048, 2048}, sizes, {}, AtlasFlag::AllowRotation);
+
+    CORRADE_COMPARE(atlas.size(), sizes.size());
+}
+
+void AtlasTest::benchmarkEfficiencyBegin() {
+    _efficiency = 0;
+}
+
+std::uint64_t AtlasTest::benchmarkEfficiencyEnd() {
+    return _efficiency;
+}
+
+/* Reports the ratio of the texture area to the atlas area actually used,
+   i.e. up to the top edge of the topmost texture */
+std::uint64_t efficiency(const std::vector<Vector2i>& sizes, const std::vector<Range2Di>& atlas, Int width) {
+    std::uint64_t area = 0;
+    for(const Vector2i& size: sizes) area += size.product();
+    Int height = 0;
+    for(const Range2Di& range: atlas) height = Math::max(height, range.top());
+    return area*100000/(std::uint64_t(width)*height);
+}
+
+void AtlasTest::benchmarkEfficiency() {
+    const std::vector<Vector2i> sizes = randomSizes(5000);
+
+    std::vector<Range2Di> atlas;
+    CORRADE_BENCHMARK(1) {
+        atlas = TextureTools::atlas({2048, 2048}, sizes);
+        _efficiency = efficiency(sizes, atlas, 2048);
+    }
+
+    CORRADE_COMPARE(atlas.size(), sizes.size());
+}
+
+void AtlasTest::benchmarkEfficiencyRotation() {
+    const std::vector<Vector2i> sizes = randomSizes(5000);
+
+    std::vector<Range2Di> atlas;
+    CORRADE_BENCHMARK(1) {
+        atlas = TextureTools::atlas({2048, 2048}, sizes, {}, AtlasFlag::AllowRotation);
+        _efficiency = efficiency(sizes, atlas, 2048);
+    }
+
+    CORRADE_COMPARE(atlas.size(), sizes.size());
 }
 
 }}}}
@@ -0,0 +1,214 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/TextureTools/DistanceField.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImageData.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace TextureTools { namespace Test { namespace {
+
+struct DistanceFieldTest: TestSuite::Tester {
+    explicit DistanceFieldTest();
+
+    void test();
+    void rgba();
+    void threads();
+    void file();
+
+    void benchmark();
+
+    private:
+        PluginManager::Manager<Trade::AbstractImporter> _manager{"nonexistent"};
+        std::string _testDir;
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} ThreadsData[]{
+    {"all available", 0},
+    {"three", 3},
+    {"more than there's rows", 64}
+};
+
+DistanceFieldTest::DistanceFieldTest() {
+    addTests({&DistanceFieldTest::test,
+              &DistanceFieldTest::rgba});
+
+    addInstancedTests({&DistanceFieldTest::threads},
+        Containers::arraySize(ThreadsData));
+
+    addTests({&DistanceFieldTest::file});
+
+    addBenchmarks({&DistanceFieldTest::benchmark}, 5);
+
+    /* Load the plugin directly from the build tree. Otherwise it's either
+       static and already loaded or not present in the build tree */
+    #ifdef ANYIMAGEIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(ANYIMAGEIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+    #ifdef TGAIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(TGAIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    #ifdef CORRADE_TARGET_APPLE
+    if(Utility::Directory::isSandboxed()
+        #if defined(CORRADE_TARGET_IOS) && defined(CORRADE_TESTSUITE_TARGET_XCTEST)
+        /** @todo Fix this once I persuade CMake to run XCTest tests properly */
+        && std::getenv("SIMULATOR_UDID")
+        #endif
+    ) {
+        _testDir = Utility::Directory::join(Utility::Directory::path(Utility::Directory::executableLocation()), "DistanceFieldGLTestFiles");
+    } else
+    #endif
+    {
+        _testDir = DISTANCEFIELDGLTEST_FILES_DIR;
+    }
+}
+
+constexpr UnsignedByte X = 0xff;
+constexpr UnsignedByte InputData[]{
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, X, X, X, X, 0, 0,
+    0, 0, X, X, X, X, X, 0,
+    0, 0, X, X, X, X, 0, 0,
+    0, 0, 0, X, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0
+};
+
+constexpr UnsignedByte OutputData[]{
+     32,  67,  85,  85,  85,  85,  67,  32,
+     42,  85, 170, 170, 170, 170,  85,  67,
+     42,  85, 170, 213, 213, 188, 170,  85,
+     42,  85, 170, 188, 170, 170,  85,  67,
+     32,  67,  85, 170,  85,  85,  67,  32,
+      7,  32,  67,  85,  67,  42,  32,   7
+};
+
+void DistanceFieldTest::test() {
+    UnsignedByte out[8*6];
+    distanceField(ImageView2D{PixelFormat::R8Unorm, {8, 6}, InputData},
+        MutableImageView2D{PixelFormat::R8Unorm, {8, 6}, out}, 2);
+
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView(OutputData),
+        TestSuite::Compare::Container);
+}
+
+void DistanceFieldTest::rgba() {
+    /* Only the first channel should be taken into account */
+    Color4ub input[8*6];
+    for(std::size_t i = 0; i != Containers::arraySize(input); ++i)
+        input[i] = {InputData[i], 0xff, UnsignedByte(i), 0x33};
+
+    UnsignedByte out[8*6];
+    distanceField(ImageView2D{PixelFormat::RGBA8Unorm, {8, 6}, input},
+        MutableImageView2D{PixelFormat::R8Unorm, {8, 6}, out}, 2);
+
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView(OutputData),
+        TestSuite::Compare::Container);
+}
+
+void DistanceFieldTest::threads() {
+    auto&& data = ThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Some random-ish blobs large enough to get split into multiple chunks */
+    const Vector2i size{317, 211};
+    Containers::Array<UnsignedByte> input{std::size_t(size.product())};
+    for(Int y = 0; y != size.y(); ++y)
+        for(Int x = 0; x != size.x(); ++x)
+            input[y*size.x() + x] = ((x/13)*7 + (y/11)*5) % 3 ? 0xff : 0;
+
+    const Vector2i outputSize{97, 64};
+    const PixelStorage storage = PixelStorage{}.setAlignment(1);
+    Containers::Array<UnsignedByte> expected{std::size_t(outputSize.product())};
+    distanceField(ImageView2D{storage, PixelFormat::R8Unorm, size, input},
+        MutableImageView2D{storage, PixelFormat::R8Unorm, outputSize, expected}, 8);
+
+    Containers::Array<UnsignedByte> out{std::size_t(outputSize.product())};
+    distanceField(ImageView2D{storage, PixelFormat::R8Unorm, size, input},
+        MutableImageView2D{storage, PixelFormat::R8Unorm, outputSize, out}, 8, data.threadCount);
+
+    CORRADE_COMPARE_AS(out, expected, TestSuite::Compare::Container);
+}
+
+void DistanceFieldTest::file() {
+    Containers::Pointer<Trade::AbstractImporter> importer;
+    if(!(importer = _manager.loadAndInstantiate("TgaImporter")))
+        CORRADE_SKIP("TgaImporter plugin not found.");
+
+    CORRADE_VERIFY(importer->openFile(Utility::Directory::join(_testDir, "input.tga")));
+    Containers::Optional<Trade::ImageData2D> inputImage = importer->image2D(0);
+    CORRADE_VERIFY(inputImage);
+    CORRADE_COMPARE(inputImage->format(), PixelFormat::R8Unorm);
+
+    CORRADE_VERIFY(importer->openFile(Utility::Directory::join(_testDir, "output.tga")));
+    Containers::Optional<Trade::ImageData2D> expectedImage = importer->image2D(0);
+    CORRADE_VERIFY(expectedImage);
+    CORRADE_COMPARE(expectedImage->format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(expectedImage->size(), Vector2i{64});
+
+    /* Same parameters as in DistanceFieldGLTest, the output should be exactly
+       the same as the ground truth */
+    Image2D actual{PixelFormat::R8Unorm, Vector2i{64}, Containers::Array<char>{64*64}};
+    distanceField(*inputImage, actual, 32);
+
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedByte>(actual.data()),
+        Containers::arrayCast<const UnsignedByte>(expectedImage->data()),
+        TestSuite::Compare::Container);
+}
+
+void DistanceFieldTest::benchmark() {
+    Containers::Pointer<Trade::AbstractImporter> importer;
+    if(!(importer = _manager.loadAndInstantiate("TgaImporter")))
+        CORRADE_SKIP("TgaImporter plugin not found.");
+
+    CORRADE_VERIFY(importer->openFile(Utility::Directory::join(_testDir, "input.tga")));
+    Containers::Optional<Trade::ImageData2D> inputImage = importer->image2D(0);
+    CORRADE_VERIFY(inputImage);
+
+    Image2D actual{PixelFormat::R8Unorm, Vector2i{64}, Containers::Array<char>{64*64}};
+    CORRADE_BENCHMARK(5)
+        distanceField(*inputImage, actual, 32);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::DistanceFieldTest)
@@ -91,8 +91,8 @@ information.
 
 @code{.sh}
 magnum-distancefieldconverter [--magnum-...] [-h|--help] [--importer IMPORTER]
-    [--converter CONVERTER] [--plugin-dir DIR] --output-size "X Y" --radius N
-    [--] input output
+    [--converter CONVERTER] [--plugin-dir DIR] [--cpu] [--threads COUNT]
+    --output-size "X Y" --radius N [--] input output
 @endcode
 
 Arguments:
@@ -105,13 +105,24 @@ Arguments:
 -   `--converter CONVERTER` --- image converter plugin (default:
     @ref Trade::AnyImageConverter "AnyImageConverter")
 -   `--plugin-dir DIR` --- override base plugin dir
+-   `--cpu` --- calculate the distance field on the CPU instead of using the
+    GPU
+-   `--threads COUNT` --- count of threads to use with `--cpu`, @cpp 0 @ce
+    for all available hardware threads (default: `1`)
 -   `--output-size "X Y"` --- size of output image
 -   `--radius N` --- distance field computation radius
 -   `--magnum-...` --- engine-specific options (see
     @ref GL-Context-command-line for details)
 
 Images with @ref PixelFormat::R8Unorm, @ref PixelFormat::RGB8Unorm or
-@ref PixelFormat::RGBA8Unorm are accepted on input.
+@ref PixelFormat::RGBA8Unorm are accepted on input, with `--cpu` also
+@ref PixelFormat::RG8Unorm.
+
+With `--cpu`, the conversion is done using
+@ref TextureTools::distanceField(const ImageView2D&, const MutableImageView2D&, UnsignedInt, UnsignedInt)
+instead of @ref TextureTools::DistanceField, producing the same output. No GL
+context is created in that case, so the utility can be used also on machines
+without a GPU.
 
 The resulting image can be then used with @ref Shaders::DistanceFieldVector
 shader. See also @ref TextureTools::DistanceField for more information about
@@ -127,6 +138,12 @@ This will open monochrome `logo-src.png` image using any plugin that can open
 PNG files and converts it to 256x256 distance field `logo.png` using any plugin
 that can write PNG files.
 
+@code{.sh}
+magnum-distancefieldconverter --cpu --threads 0 --output-size "256 256" --radius 24 logo-src.png logo.png
+@endcode
+
+Does the same, but on the CPU using all available hardware threads.
+
 @note This executable is available only if Magnum is compiled with
     @ref MAGNUM_TARGET_GL enabled (done by default). See @ref building-features
     for more information.
@@ -150,13 +167,16 @@ DistanceFieldConverter::DistanceFieldConverter(const Arguments& arguments): Plat
         .addOption("importer", "AnyImageImporter").setHelp("importer", "image importer plugin")
         .addOption("converter", "AnyImageConverter").setHelp("converter", "image converter plugin")
         .addOption("plugin-dir").setHelp("plugin-dir", "override base plugin dir", "DIR")
+        .addBooleanOption("cpu").setHelp("cpu", "calculate the distance field on the CPU")
+        .addOption("threads", "1").setHelp("threads", "count of threads to use with --cpu, 0 for all available", "COUNT")
         .addNamedArgument("output-size").setHelp("output-size", "size of output image", "\"X Y\"")
         .addNamedArgument("radius").setHelp("radius", "distance field computation radius", "N")
         .addSkippedPrefix("magnum", "engine-specific options")
         .setGlobalHelp("Converts red channel of an image to distance field representation.")
         .parse(arguments.argc, arguments.argv);
 
-    createContext();
+    /* The CPU implementation doesn't need any GL context */
+    if(!args.isSet("cpu")) createContext();
 }
 
 int DistanceFieldConverter::exec() {
@@ -181,6 +201,32 @@ int DistanceFieldConverter::exec() {
         return 3;
     }
 
+    const Vector2i outputSize = args.value<Vector2i>("output-size");
+    const UnsignedInt radius = args.value<UnsignedInt>("radius");
+
+    /* Do it on the CPU, if requested */
+    if(args.isSet("cpu")) {
+        if(image->format() != PixelFormat::R8Unorm &&
+           image->format() != PixelFormat::RG8Unorm &&
+           image->format() != PixelFormat::RGB8Unorm &&
+           image->format() != PixelFormat::RGBA8Unorm) {
+            Error() << "Unsupported image format" << image->format();
+            return 4;
+        }
+
+        Image2D result{PixelStorage{}.setAlignment(1), PixelFormat::R8Unorm, outputSize, Containers::Array<char>{std::size_t(outputSize.product())}};
+
+        Debug() << "Converting image of size" << image->size() << "to distance field on the CPU...";
+        TextureTools::distanceField(*image, result, radius, args.value<UnsignedInt>("threads"));
+
+        if(!converter->exportToFile(result, args.value("output"))) {
+            Error() << "Cannot save file" << args.value("output");
+            return 5;
+        }
+
+        return 0;
+    }
+
     /* Decide about internal format */
     GL::TextureFormat internalFormat;
     if(image->format() == PixelFormat::R8Unorm)
@@ -204,13 +250,13 @@ int DistanceFieldConverter::exec() {
 
     /* Output texture */
     GL::Texture2D output;
-    output.setStorage(1, GL::TextureFormat::R8, args.value<Vector2i>("output-size"));
+    output.setStorage(1, GL::TextureFormat::R8, outputSize);
 
     CORRADE_INTERNAL_ASSERT(GL::Renderer::error() == GL::Renderer::Error::NoError);
 
     /* Do it */
     Debug() << "Converting image of size" << image->size() << "to distance field...";
-    TextureTools::DistanceField{args.value<UnsignedInt>("radius")}(input, output, {{}, args.value<Vector2i>("output-size")}, image->size());
+    TextureTools::DistanceField{radius}(input, output, {{}, outputSize}, image->size());
 
     /* Save image */
     Image2D result{PixelFormat::R8Unorm};
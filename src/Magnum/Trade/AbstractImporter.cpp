@@ -25,6 +25,7 @@
 
 #include "AbstractImporter.h"
 
+#include <fstream>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/EnumSet.hpp>
 #include <Corrade/Containers/Optional.h>
@@ -33,6 +34,8 @@
 #include <Corrade/Utility/Directory.h>
 
 #include "Magnum/FileCallback.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
 #include "Magnum/Trade/AnimationData.h"
 #include "Magnum/Trade/ArrayAllocator.h"
 #include "Magnum/Trade/CameraData.h"
@@ -40,6 +43,8 @@
 #include "Magnum/Trade/LightData.h"
 #include "Magnum/Trade/MaterialData.h"
 #include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/MeshObjectData2D.h"
+#include "Magnum/Trade/MeshObjectData3D.h"
 #include "Magnum/Trade/ObjectData2D.h"
 #include "Magnum/Trade/ObjectData3D.h"
 #include "Magnum/Trade/SceneData.h"
@@ -56,10 +61,36 @@
 #include "Magnum/Trade/configure.h"
 #endif
 
+#if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+#define _MAGNUM_TRADE_USE_MAPPING
+#endif
+
 namespace Magnum { namespace Trade {
 
+struct AbstractImporter::FileData {
+    /* If the file was loaded through a callback with LoadPermanent, tell
+       the callback it can be closed now */
+    ~FileData() {
+        if(callback) callback(callbackFilename, InputFileCallbackPolicy::Close, callbackUserData);
+    }
+
+    /* Either pointing to a memory-mapped file, to a copy of it or to data
+       returned by a file callback */
+    Containers::ArrayView<const char> in;
+    Containers::Array<char> data;
+    #ifdef _MAGNUM_TRADE_USE_MAPPING
+    Containers::Array<const char, Utility::Directory::MapDeleter> mappedData;
+    #endif
+
+    /* Callback the data were loaded with, remembered in case the callback
+       gets reset before the importer is closed */
+    Containers::Optional<Containers::ArrayView<const char>>(*callback)(const std::string&, InputFileCallbackPolicy, void*){};
+    void* callbackUserData{};
+    std::string callbackFilename;
+};
+
 std::string AbstractImporter::pluginInterface() {
-    return "cz.mosra.magnum.Trade.AbstractImporter/0.3.2";
+    return "cz.mosra.magnum.Trade.AbstractImporter/0.3.4";
 }
 
 #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
@@ -90,6 +121,8 @@ AbstractImporter::AbstractImporter(PluginManager::Manager<AbstractImporter>& man
 
 AbstractImporter::AbstractImporter(PluginManager::AbstractManager& manager, const std::string& plugin): PluginManager::AbstractManagingPlugin<AbstractImporter>{manager, plugin} {}
 
+AbstractImporter::~AbstractImporter() = default;
+
 void AbstractImporter::setFlags(ImporterFlags flags) {
     CORRADE_ASSERT(!isOpened(),
         "Trade::AbstractImporter::setFlags(): can't be set while a file is opened", );
@@ -161,13 +194,16 @@ bool AbstractImporter::openFile(const std::string& filename) {
               file loading to the default implementation (callback used in the
               base doOpenFile() implementation, because this branch is never
               taken in that case) */
-        const Containers::Optional<Containers::ArrayView<const char>> data = _fileCallback(filename, InputFileCallbackPolicy::LoadTemporary, _fileCallbackUserData);
+        /* With zero copy the importer is allowed to reference the data until
+           it's closed, so the file can't be closed right after */
+        const bool zeroCopy = !!(_flags & ImporterFlag::ZeroCopy);
+        const Containers::Optional<Containers::ArrayView<const char>> data = _fileCallback(filename, zeroCopy ? InputFileCallbackPolicy::LoadPermanent : InputFileCallbackPolicy::LoadTemporary, _fileCallbackUserData);
         if(!data) {
             Error() << "Trade::AbstractImporter::openFile(): cannot open file" << filename;
             return isOpened();
         }
         doOpenData(*data);
-        _fileCallback(filename, InputFileCallbackPolicy::Close, _fileCallbackUserData);
+        closeCallbackFile(filename, *data, zeroCopy);
 
     /* Shouldn't get here, the assert is fired already in setFileCallback() */
     } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
@@ -181,13 +217,16 @@ void AbstractImporter::doOpenFile(const std::string& filename) {
     /* If callbacks are set, use them. This is the same implementation as in
        openFile(), see the comment there for details. */
     if(_fileCallback) {
-        const Containers::Optional<Containers::ArrayView<const char>> data = _fileCallback(filename, InputFileCallbackPolicy::LoadTemporary, _fileCallbackUserData);
+        /* With zero copy the importer is allowed to reference the data until
+           it's closed, so the file can't be closed right after */
+        const bool zeroCopy = !!(_flags & ImporterFlag::ZeroCopy);
+        const Containers::Optional<Containers::ArrayView<const char>> data = _fileCallback(filename, zeroCopy ? InputFileCallbackPolicy::LoadPermanent : InputFileCallbackPolicy::LoadTemporary, _fileCallbackUserData);
         if(!data) {
             Error() << "Trade::AbstractImporter::openFile(): cannot open file" << filename;
             return;
         }
         doOpenData(*data);
-        _fileCallback(filename, InputFileCallbackPolicy::Close, _fileCallbackUserData);
+        closeCallbackFile(filename, *data, zeroCopy);
 
     /* Otherwise open the file directly */
     } else {
@@ -196,15 +235,61 @@ void AbstractImporter::doOpenFile(const std::string& filename) {
             return;
         }
 
+        /* With zero copy, the implementation is allowed to reference the
+           data until it's closed, so they need to be kept alive. Memory-map
+           the file instead of reading it if possible, empty files can't be
+           mapped though. */
+        if(_flags & ImporterFlag::ZeroCopy) {
+            Containers::Pointer<FileData> file{new FileData};
+            #ifdef _MAGNUM_TRADE_USE_MAPPING
+            if(std::ifstream{filename, std::ios::binary|std::ios::ate}.tellg() > 0) {
+                file->mappedData = Utility::Directory::mapRead(filename);
+                if(!file->mappedData) {
+                    Error() << "Trade::AbstractImporter::openFile(): cannot map file" << filename;
+                    return;
+                }
+                file->in = file->mappedData;
+            } else
+            #endif
+            {
+                file->data = Utility::Directory::read(filename);
+                file->in = file->data;
+            }
+
+            doOpenData(file->in);
+            if(isOpened()) _fileData = std::move(file);
+            return;
+        }
+
         doOpenData(Utility::Directory::read(filename));
     }
 }
 
+void AbstractImporter::closeCallbackFile(const std::string& filename, const Containers::ArrayView<const char> data, const bool zeroCopy) {
+    /* With zero copy the implementation may reference the data until it's
+       closed, so the Close is deferred to close() or the destructor. If the
+       opening failed, there's nothing referencing the data. */
+    if(zeroCopy && isOpened()) {
+        Containers::Pointer<FileData> file{new FileData};
+        file->in = data;
+        file->callback = _fileCallback;
+        file->callbackUserData = _fileCallbackUserData;
+        file->callbackFilename = filename;
+        _fileData = std::move(file);
+    } else _fileCallback(filename, InputFileCallbackPolicy::Close, _fileCallbackUserData);
+}
+
 void AbstractImporter::close() {
     if(isOpened()) {
         doClose();
         CORRADE_INTERNAL_ASSERT(!isOpened());
     }
+
+    /* Release the file opened with ImporterFlag::ZeroCopy only after the
+       implementation is closed, as it may still reference it. If it was
+       loaded through a file callback, this calls it with
+       InputFileCallbackPolicy::Close. */
+    _fileData.reset();
 }
 
 Int AbstractImporter::defaultScene() {
@@ -239,7 +324,12 @@ std::string AbstractImporter::doSceneName(UnsignedInt) { return {}; }
 Containers::Optional<SceneData> AbstractImporter::scene(const UnsignedInt id) {
     CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::scene(): no file opened", {});
     CORRADE_ASSERT(id < doSceneCount(), "Trade::AbstractImporter::scene(): index" << id << "out of range for" << doSceneCount() << "entries", {});
-    return doScene(id);
+    Containers::Optional<SceneData> scene = doScene(id);
+    CORRADE_ASSERT(!scene || (
+        (!scene->_data.deleter() || scene->_data.deleter() == Implementation::nonOwnedArrayDeleter || scene->_data.deleter() == ArrayAllocator<char>::deleter) &&
+        (!scene->_fields.deleter() || scene->_fields.deleter() == reinterpret_cast<void(*)(SceneFieldData*, std::size_t)>(Implementation::nonOwnedArrayDeleter))),
+        "Trade::AbstractImporter::scene(): implementation is not allowed to use a custom Array deleter", {});
+    return scene;
 }
 
 Containers::Optional<SceneData> AbstractImporter::doScene(UnsignedInt) {
@@ -256,6 +346,129 @@ Containers::Optional<SceneData> AbstractImporter::scene(const std::string& name)
     return scene(id); /* not doScene(), so we get the range checks also */
 }
 
+namespace {
+
+struct FlatSceneFields {
+    Containers::StridedArrayView1D<Int> parents, meshes, meshMaterials, cameras, lights;
+};
+
+void flatSceneObject(const ObjectData2D& object, const FlatSceneFields& fields, const UnsignedInt id) {
+    if(object.instanceType() == ObjectInstanceType2D::Mesh) {
+        fields.meshes[id] = object.instance();
+        fields.meshMaterials[id] = static_cast<const MeshObjectData2D&>(object).material();
+    } else if(object.instanceType() == ObjectInstanceType2D::Camera)
+        fields.cameras[id] = object.instance();
+}
+
+void flatSceneObject(const ObjectData3D& object, const FlatSceneFields& fields, const UnsignedInt id) {
+    if(object.instanceType() == ObjectInstanceType3D::Mesh) {
+        fields.meshes[id] = object.instance();
+        fields.meshMaterials[id] = static_cast<const MeshObjectData3D&>(object).material();
+    } else if(object.instanceType() == ObjectInstanceType3D::Camera)
+        fields.cameras[id] = object.instance();
+    else if(object.instanceType() == ObjectInstanceType3D::Light)
+        fields.lights[id] = object.instance();
+}
+
+template<class MatrixType, class Getter> bool flatSceneHierarchy(Getter get, const std::vector<UnsignedInt>& children, const FlatSceneFields& fields, const Containers::StridedArrayView1D<MatrixType>& transformations) {
+    const std::size_t objectCount = transformations.size();
+    Containers::Array<bool> visited{Containers::ValueInit, objectCount};
+
+    /* Object ID and its parent */
+    std::vector<std::pair<UnsignedInt, Int>> stack;
+    stack.reserve(children.size());
+    for(const UnsignedInt child: children) stack.emplace_back(child, -1);
+
+    while(!stack.empty()) {
+        const UnsignedInt id = stack.back().first;
+        const Int parent = stack.back().second;
+        stack.pop_back();
+
+        if(id >= objectCount) {
+            Error{} << "Trade::AbstractImporter::flatScene(): object" << id << "out of range for" << objectCount << "objects";
+            return false;
+        }
+        if(visited[id]) {
+            Error{} << "Trade::AbstractImporter::flatScene(): object" << id << "is referenced more than once";
+            return false;
+        }
+        visited[id] = true;
+
+        const auto object = get(id);
+        if(!object) return false;
+
+        fields.parents[id] = parent;
+        transformations[id] = object->transformation();
+        flatSceneObject(*object, fields, id);
+        for(const UnsignedInt child: object->children())
+            stack.emplace_back(child, Int(id));
+    }
+
+    return true;
+}
+
+}
+
+Containers::Optional<SceneData> AbstractImporter::flatScene(const UnsignedInt id) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::flatScene(): no file opened", {});
+    CORRADE_ASSERT(id < doSceneCount(), "Trade::AbstractImporter::flatScene(): index" << id << "out of range for" << doSceneCount() << "entries", {});
+
+    /* If the plugin provides the per-object fields already, we're done */
+    Containers::Optional<SceneData> scene = this->scene(id);
+    if(!scene || scene->fieldCount()) return scene;
+
+    /* Otherwise query the objects one by one. Everything goes into a single
+       allocation -- transformations first so they're aligned, followed by
+       the index fields. */
+    const bool is2D = scene->children3D().empty() && !scene->children2D().empty();
+    const UnsignedInt objectCount = is2D ? doObject2DCount() : doObject3DCount();
+    const std::size_t indexFieldCount = is2D ? 4 : 5;
+    const std::size_t transformationSize = objectCount*(is2D ? sizeof(Matrix3) : sizeof(Matrix4));
+    Containers::Array<char> data{Containers::NoInit, transformationSize + indexFieldCount*objectCount*sizeof(Int)};
+
+    const Containers::ArrayView<Int> indices = Containers::arrayCast<Int>(data.suffix(transformationSize));
+    for(Int& i: indices) i = -1;
+    FlatSceneFields fields;
+    fields.parents = indices.slice(0*objectCount, 1*objectCount);
+    fields.meshes = indices.slice(1*objectCount, 2*objectCount);
+    fields.meshMaterials = indices.slice(2*objectCount, 3*objectCount);
+    fields.cameras = indices.slice(3*objectCount, 4*objectCount);
+    if(!is2D) fields.lights = indices.slice(4*objectCount, 5*objectCount);
+
+    Containers::Array<SceneFieldData> fieldData{indexFieldCount + 1};
+    fieldData[0] = SceneFieldData{SceneField::Parent, fields.parents};
+    fieldData[2] = SceneFieldData{SceneField::Mesh, fields.meshes};
+    fieldData[3] = SceneFieldData{SceneField::MeshMaterial, fields.meshMaterials};
+    fieldData[4] = SceneFieldData{SceneField::Camera, fields.cameras};
+    if(!is2D) fieldData[5] = SceneFieldData{SceneField::Light, fields.lights};
+
+    if(is2D) {
+        const Containers::ArrayView<Matrix3> transformations = Containers::arrayCast<Matrix3>(data.prefix(transformationSize));
+        for(Matrix3& i: transformations) i = Matrix3{};
+        fieldData[1] = SceneFieldData{SceneField::Transformation, transformations};
+        if(!flatSceneHierarchy<Matrix3>([this](UnsignedInt object) { return object2D(object); }, scene->children2D(), fields, transformations))
+            return {};
+    } else {
+        const Containers::ArrayView<Matrix4> transformations = Containers::arrayCast<Matrix4>(data.prefix(transformationSize));
+        for(Matrix4& i: transformations) i = Matrix4{};
+        fieldData[1] = SceneFieldData{SceneField::Transformation, transformations};
+        if(!flatSceneHierarchy<Matrix4>([this](UnsignedInt object) { return object3D(object); }, scene->children3D(), fields, transformations))
+            return {};
+    }
+
+    return SceneData{scene->children2D(), scene->children3D(), objectCount, std::move(data), std::move(fieldData), scene->importerState()};
+}
+
+Containers::Optional<SceneData> AbstractImporter::flatScene(const std::string& name) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::flatScene(): no file opened", {});
+    const Int id = doSceneForName(name);
+    if(id == -1) {
+        Error{} << "Trade::AbstractImporter::flatScene(): scene" << name << "not found";
+        return {};
+    }
+    return flatScene(id); /* not doScene(), so we get the range checks also */
+}
+
 UnsignedInt AbstractImporter::animationCount() const {
     CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::animationCount(): no file opened", {});
     return doAnimationCount();
@@ -993,6 +1206,7 @@ Debug& operator<<(Debug& debug, const ImporterFlag value) {
         /* LCOV_EXCL_START */
         #define _c(v) case ImporterFlag::v: return debug << "::" #v;
         _c(Verbose)
+        _c(ZeroCopy)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -1002,7 +1216,8 @@ Debug& operator<<(Debug& debug, const ImporterFlag value) {
 
 Debug& operator<<(Debug& debug, const ImporterFlags value) {
     return Containers::enumSetDebugOutput(debug, value, "Trade::ImporterFlags{}", {
-        ImporterFlag::Verbose});
+        ImporterFlag::Verbose,
+        ImporterFlag::ZeroCopy});
 }
 
 }}
@@ -30,6 +30,7 @@
  */
 
 #include <Corrade/Containers/EnumSet.h>
+#include <Corrade/Containers/Pointer.h>
 #include <Corrade/PluginManager/AbstractManagingPlugin.h>
 
 #include "Magnum/Magnum.h"
@@ -104,7 +105,31 @@ enum class ImporterFlag: UnsignedByte {
      */
     Verbose = 1 << 0,
 
-    /** @todo Y flip for images, "I want to import just once, don't copy" ... */
+    /**
+     * Don't copy the input, reference it directly instead. The caller
+     * guarantees that data passed to @ref AbstractImporter::openData() stay
+     * in scope and unchanged until the importer is closed, another file is
+     * opened or the importer is destroyed. The default
+     * @ref AbstractImporter::openFile() implementation then memory-maps the
+     * file instead of reading it into a newly allocated array, on platforms
+     * that support it, and file callbacks are called with
+     * @ref InputFileCallbackPolicy::LoadPermanent instead of
+     * @ref InputFileCallbackPolicy::LoadTemporary, with the corresponding
+     * @ref InputFileCallbackPolicy::Close deferred until the importer is
+     * closed.
+     *
+     * Importers that support this flag may return data that are a non-owned
+     * view on the original input --- check @ref ImageData::dataFlags(),
+     * @ref MeshData::vertexDataFlags() and others for absence of
+     * @ref DataFlag::Owned. Such data are valid only as long as the input is.
+     * See documentation of particular plugins for what they do with this
+     * flag, importers that don't support it simply ignore it.
+     * @see @ref Trade-AbstractImporter-data-dependency
+     * @m_since_latest
+     */
+    ZeroCopy = 1 << 1,
+
+    /** @todo Y flip for images ... */
 };
 
 /**
@@ -243,8 +268,8 @@ dependency on the importer instance and neither on the dynamic plugin module.
 In other words, you don't need to keep the importer instance (or the plugin
 manager instance) around in order to have the `*Data` instances valid.
 Moreover, all @ref Corrade::Containers::Array instances returned through
-@ref ImageData, @ref AnimationData, @ref MaterialData and @ref MeshData are
-only allowed to have default deleters (or be non-owning instances created from
+@ref ImageData, @ref AnimationData, @ref MaterialData, @ref MeshData and
+@ref SceneData are only allowed to have default deleters (or be non-owning instances created from
 @ref Corrade::Containers::ArrayView) --- this is to avoid potential dangling
 function pointer calls when destructing such instances after the plugin module
 has been unloaded.
@@ -256,6 +281,15 @@ file is kept open. If the file gets closed or the importer instance deleted,
 the state pointers become dangling, and that's fine as long as you don't access
 them.
 
+The other exception is when @ref ImporterFlag::ZeroCopy is set. To avoid
+copying large amounts of data, the importer is then allowed to return
+non-owned views on the input passed to @ref openData() or on the file mapped
+by @ref openFile(). Such instances have @ref DataFlag::Owned not set in
+@ref ImageData::dataFlags() and similar and are valid only until the importer
+is closed --- if you need them for longer, make a copy.
+
+@snippet MagnumTrade.cpp AbstractImporter-zero-copy
+
 @section Trade-AbstractImporter-subclassing Subclassing
 
 The plugin needs to implement the @ref doFeatures(), @ref doIsOpened()
@@ -337,7 +371,7 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          * @brief Plugin interface
          *
          * @code{.cpp}
-         * "cz.mosra.magnum.Trade.AbstractImporter/0.3.2"
+         * "cz.mosra.magnum.Trade.AbstractImporter/0.3.4"
          * @endcode
          */
         static std::string pluginInterface();
@@ -368,6 +402,8 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /** @brief Plugin manager constructor */
         explicit AbstractImporter(PluginManager::AbstractManager& manager, const std::string& plugin);
 
+        ~AbstractImporter();
+
         /** @brief Features supported by this importer */
         ImporterFeatures features() const { return doFeatures(); }
 
@@ -427,7 +463,11 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          * callback is called again with @ref InputFileCallbackPolicy::Close
          * because the semantics of @ref openData() don't require the data to
          * be alive after. In case you need a different behavior, use
-         * @ref openData() directly.
+         * @ref openData() directly. If @ref ImporterFlag::ZeroCopy is set,
+         * the file is loaded with @ref InputFileCallbackPolicy::LoadPermanent
+         * instead and the callback is called with
+         * @ref InputFileCallbackPolicy::Close only once the importer is
+         * closed, another file is opened or the importer is destroyed.
          *
          * In case @p callback is @cpp nullptr @ce, the current callback (if
          * any) is reset. This function expects that the importer supports
@@ -573,8 +613,14 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          * @param id        Scene ID, from range [0, @ref sceneCount()).
          *
          * Returns given scene or @ref Containers::NullOpt if import failed.
-         * Expects that a file is opened.
-         * @see @ref scene(const std::string&)
+         * Expects that a file is opened. Depending on the plugin, the scene
+         * either contains per-object fields such as parents, transformations
+         * and mesh assignments, imported with a constant amount of
+         * allocations, or only the list of root objects, in which case the
+         * per-object data have to be fetched through @ref object2D() /
+         * @ref object3D(). Use @ref flatScene() to always get the per-object
+         * fields.
+         * @see @ref scene(const std::string&), @ref SceneData::fieldCount()
          */
         Containers::Optional<SceneData> scene(UnsignedInt id);
 
@@ -590,6 +636,42 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         Containers::Optional<SceneData> scene(const std::string& name);
 
+        /**
+         * @brief Scene with per-object fields
+         * @param id        Scene ID, from range [0, @ref sceneCount()).
+         * @m_since_latest
+         *
+         * If @ref scene(UnsignedInt) returns a scene with per-object fields,
+         * passes it through unchanged. Otherwise walks the hierarchy from
+         * @ref SceneData::children3D() (or @ref SceneData::children2D() if
+         * there are no 3D children) using @ref object3D() /
+         * @ref object2D() and returns a @ref SceneData with
+         * @ref SceneField::Parent, @ref SceneField::Transformation,
+         * @ref SceneField::Mesh, @ref SceneField::MeshMaterial,
+         * @ref SceneField::Camera and (for 3D) @ref SceneField::Light fields,
+         * all stored in a single allocation. The fields are indexed by the
+         * object IDs and are sized to @ref object3DCount() /
+         * @ref object2DCount(), objects that are not part of the scene have
+         * the parent and all references set to @cpp -1 @ce and an identity
+         * transformation. Returns @ref Containers::NullOpt if importing the
+         * scene or any of its objects failed, or if an object is referenced
+         * more than once. Expects that a file is opened.
+         * @see @ref flatScene(const std::string&)
+         */
+        Containers::Optional<SceneData> flatScene(UnsignedInt id);
+
+        /**
+         * @brief Scene with per-object fields for given name
+         * @m_since_latest
+         *
+         * A convenience API combining @ref sceneForName() and
+         * @ref flatScene(UnsignedInt). If @ref sceneForName() returns
+         * @cpp -1 @ce, prints an error message and returns
+         * @ref Containers::NullOpt, otherwise propagates the result from
+         * @ref flatScene(UnsignedInt). Expects that a file is opened.
+         */
+        Containers::Optional<SceneData> flatScene(const std::string& name);
+
         /**
          * @brief Animation count
          *
@@ -1398,7 +1480,13 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         virtual std::string doSceneName(UnsignedInt id);
 
-        /** @brief Implementation for @ref scene() */
+        /**
+         * @brief Implementation for @ref scene()
+         *
+         * Importers that have the whole object hierarchy available upfront
+         * are encouraged to return the scene with per-object fields, which
+         * makes @ref flatScene() free of any per-object allocations.
+         */
         virtual Containers::Optional<SceneData> doScene(UnsignedInt id);
 
         /**
@@ -1853,8 +1941,16 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /** @brief Implementation for @ref importerState() */
         virtual const void* doImporterState() const;
 
+        MAGNUM_TRADE_LOCAL void closeCallbackFile(const std::string& filename, Containers::ArrayView<const char> data, bool zeroCopy);
+
+        struct FileData;
+
         ImporterFlags _flags;
 
+        /* File opened by the default doOpenFile() implementation with
+           ImporterFlag::ZeroCopy, kept alive until close() */
+        Containers::Pointer<FileData> _fileData;
+
         Containers::Optional<Containers::ArrayView<const char>>(*_fileCallback)(const std::string&, InputFileCallbackPolicy, void*){};
         void* _fileCallbackUserData{};
 
@@ -33,6 +33,7 @@
 
 #include "Magnum/Trade/ArrayAllocator.h"
 #include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
 
 #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
 #include "Magnum/Trade/configure.h"
@@ -41,7 +42,7 @@
 namespace Magnum { namespace Trade {
 
 std::string AbstractSceneConverter::pluginInterface() {
-    return "cz.mosra.magnum.Trade.AbstractSceneConverter/0.1";
+    return "cz.mosra.magnum.Trade.AbstractSceneConverter/0.1.1";
 }
 
 #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
@@ -150,6 +151,65 @@ bool AbstractSceneConverter::doConvertToFile(const std::string& filename, const
     return true;
 }
 
+Containers::Optional<SceneData> AbstractSceneConverter::convert(const SceneData& scene) {
+    CORRADE_ASSERT(features() & SceneConverterFeature::ConvertScene,
+        "Trade::AbstractSceneConverter::convert(): scene conversion not supported", {});
+    CORRADE_ASSERT(scene.fieldCount(),
+        "Trade::AbstractSceneConverter::convert(): the scene has no per-object fields", {});
+
+    Containers::Optional<SceneData> out = doConvert(scene);
+    CORRADE_ASSERT(!out || (
+        (!out->_data.deleter() || out->_data.deleter() == Implementation::nonOwnedArrayDeleter || out->_data.deleter() == ArrayAllocator<char>::deleter) &&
+        (!out->_fields.deleter() || out->_fields.deleter() == reinterpret_cast<void(*)(SceneFieldData*, std::size_t)>(Implementation::nonOwnedArrayDeleter))),
+        "Trade::AbstractSceneConverter::convert(): implementation is not allowed to use a custom Array deleter", {});
+    return out;
+}
+
+Containers::Optional<SceneData> AbstractSceneConverter::doConvert(const SceneData&) {
+    CORRADE_ASSERT_UNREACHABLE("Trade::AbstractSceneConverter::convert(): scene conversion advertised but not implemented", {});
+}
+
+Containers::Array<char> AbstractSceneConverter::convertToData(const SceneData& scene) {
+    CORRADE_ASSERT(features() & SceneConverterFeature::ConvertSceneToData,
+        "Trade::AbstractSceneConverter::convertToData(): scene conversion not supported", {});
+    CORRADE_ASSERT(scene.fieldCount(),
+        "Trade::AbstractSceneConverter::convertToData(): the scene has no per-object fields", {});
+
+    Containers::Array<char> out = doConvertToData(scene);
+    CORRADE_ASSERT(!out || !out.deleter() || out.deleter() == Implementation::nonOwnedArrayDeleter || out.deleter() == ArrayAllocator<char>::deleter,
+        "Trade::AbstractSceneConverter::convertToData(): implementation is not allowed to use a custom Array deleter", {});
+    return out;
+}
+
+Containers::Array<char> AbstractSceneConverter::doConvertToData(const SceneData&) {
+    CORRADE_ASSERT_UNREACHABLE("Trade::AbstractSceneConverter::convertToData(): scene conversion advertised but not implemented", {});
+}
+
+bool AbstractSceneConverter::convertToFile(const std::string& filename, const SceneData& scene) {
+    CORRADE_ASSERT(features() >= SceneConverterFeature::ConvertSceneToFile,
+        "Trade::AbstractSceneConverter::convertToFile(): scene conversion not supported", {});
+    CORRADE_ASSERT(scene.fieldCount(),
+        "Trade::AbstractSceneConverter::convertToFile(): the scene has no per-object fields", {});
+
+    return doConvertToFile(filename, scene);
+}
+
+bool AbstractSceneConverter::doConvertToFile(const std::string& filename, const SceneData& scene) {
+    CORRADE_ASSERT(features() >= SceneConverterFeature::ConvertSceneToData, "Trade::AbstractSceneConverter::convertToFile(): scene conversion advertised but not implemented", false);
+
+    const auto data = doConvertToData(scene);
+    /* No deleter checks as it doesn't matter here */
+    if(!data) return false;
+
+    /* Open file */
+    if(!Utility::Directory::write(filename, data)) {
+        Error() << "Trade::AbstractSceneConverter::convertToFile(): cannot write to file" << filename;
+        return false;
+    }
+
+    return true;
+}
+
 Debug& operator<<(Debug& debug, const SceneConverterFeature value) {
     debug << "Trade::SceneConverterFeature" << Debug::nospace;
 
@@ -160,6 +220,9 @@ Debug& operator<<(Debug& debug, const SceneConverterFeature value) {
         _c(ConvertMeshInPlace)
         _c(ConvertMeshToData)
         _c(ConvertMeshToFile)
+        _c(ConvertScene)
+        _c(ConvertSceneToData)
+        _c(ConvertSceneToFile)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -173,7 +236,11 @@ Debug& operator<<(Debug& debug, const SceneConverterFeatures value) {
         SceneConverterFeature::ConvertMeshInPlace,
         SceneConverterFeature::ConvertMeshToData,
         /* Implied by ConvertMeshToData, has to be after */
-        SceneConverterFeature::ConvertMeshToFile});
+        SceneConverterFeature::ConvertMeshToFile,
+        SceneConverterFeature::ConvertScene,
+        SceneConverterFeature::ConvertSceneToData,
+        /* Implied by ConvertSceneToData, has to be after */
+        SceneConverterFeature::ConvertSceneToFile});
 }
 
 Debug& operator<<(Debug& debug, const SceneConverterFlag value) {
@@ -68,7 +68,29 @@ enum class SceneConverterFeature: UnsignedByte {
      * @ref AbstractSceneConverter::convertToData(const MeshData&). Implies
      * @ref SceneConverterFeature::ConvertMeshToFile.
      */
-    ConvertMeshToData = ConvertMeshToFile|(1 << 3)
+    ConvertMeshToData = ConvertMeshToFile|(1 << 3),
+
+    /**
+     * Convert a scene with
+     * @ref AbstractSceneConverter::convert(const SceneData&).
+     * @m_since_latest
+     */
+    ConvertScene = 1 << 4,
+
+    /**
+     * Converting a scene to a file with
+     * @ref AbstractSceneConverter::convertToFile(const std::string&, const SceneData&).
+     * @m_since_latest
+     */
+    ConvertSceneToFile = 1 << 5,
+
+    /**
+     * Converting a scene to raw data with
+     * @ref AbstractSceneConverter::convertToData(const SceneData&). Implies
+     * @ref SceneConverterFeature::ConvertSceneToFile.
+     * @m_since_latest
+     */
+    ConvertSceneToData = ConvertSceneToFile|(1 << 6)
 };
 
 /**
@@ -163,6 +185,13 @@ checked by the implementation:
     @ref SceneConverterFeature::ConvertMeshToData is supported.
 -   The function @ref doConvertToFile(const std::string&, const MeshData&) is
     called only if @ref SceneConverterFeature::ConvertMeshToFile is supported.
+-   The function @ref doConvert(const SceneData&) is called only if
+    @ref SceneConverterFeature::ConvertScene is supported.
+-   The function @ref doConvertToData(const SceneData&) is called only if
+    @ref SceneConverterFeature::ConvertSceneToData is supported.
+-   The function @ref doConvertToFile(const std::string&, const SceneData&) is
+    called only if @ref SceneConverterFeature::ConvertSceneToFile is
+    supported.
 
 @m_class{m-block m-warning}
 
@@ -181,7 +210,7 @@ class MAGNUM_TRADE_EXPORT AbstractSceneConverter: public PluginManager::Abstract
          * @brief Plugin interface
          *
          * @code{.cpp}
-         * "cz.mosra.magnum.Trade.AbstractSceneConverter/0.1"
+         * "cz.mosra.magnum.Trade.AbstractSceneConverter/0.1.1"
          * @endcode
          */
         static std::string pluginInterface();
@@ -274,6 +303,45 @@ class MAGNUM_TRADE_EXPORT AbstractSceneConverter: public PluginManager::Abstract
          */
         bool convertToFile(const std::string& filename, const MeshData& mesh);
 
+        /**
+         * @brief Convert a scene
+         * @m_since_latest
+         *
+         * Depending on the plugin, can perform for example flattening of the
+         * hierarchy or removal of unused objects. Available only if
+         * @ref SceneConverterFeature::ConvertScene is supported. The scene is
+         * expected to have per-object fields, see @ref SceneData::fieldCount()
+         * and @ref AbstractImporter::flatScene().
+         * @see @ref features()
+         */
+        Containers::Optional<SceneData> convert(const SceneData& scene);
+
+        /**
+         * @brief Convert a scene to a raw data
+         * @m_since_latest
+         *
+         * Depending on the plugin, can convert the scene to a file format
+         * that can be saved to disk. Available only if
+         * @ref SceneConverterFeature::ConvertSceneToData is supported. The
+         * scene is expected to have per-object fields. On failure the
+         * function prints an error message and returns @cpp nullptr @ce.
+         * @see @ref features(), @ref convertToFile(const std::string&, const SceneData&)
+         */
+        Containers::Array<char> convertToData(const SceneData& scene);
+
+        /**
+         * @brief Convert a scene to a file
+         * @m_since_latest
+         *
+         * Available only if @ref SceneConverterFeature::ConvertSceneToFile or
+         * @ref SceneConverterFeature::ConvertSceneToData is supported. The
+         * scene is expected to have per-object fields. Returns @cpp true @ce
+         * on success, prints an error message and returns @cpp false @ce
+         * otherwise.
+         * @see @ref features(), @ref convertToData(const SceneData&)
+         */
+        bool convertToFile(const std::string& filename, const SceneData& scene);
+
     private:
         /**
          * @brief Implementation of @ref features()
@@ -315,6 +383,28 @@ class MAGNUM_TRADE_EXPORT AbstractSceneConverter: public PluginManager::Abstract
          */
         virtual bool doConvertToFile(const std::string& filename, const MeshData& mesh);
 
+        /**
+         * @brief Implementation of @ref convert(const SceneData&)
+         * @m_since_latest
+         */
+        virtual Containers::Optional<SceneData> doConvert(const SceneData& scene);
+
+        /**
+         * @brief Implementation of @ref convertToData(const SceneData&)
+         * @m_since_latest
+         */
+        virtual Containers::Array<char> doConvertToData(const SceneData& scene);
+
+        /**
+         * @brief Implementation of @ref convertToFile(const std::string&, const SceneData&)
+         * @m_since_latest
+         *
+         * If @ref SceneConverterFeature::ConvertSceneToData is supported,
+         * default implementation calls @ref doConvertToData(const SceneData&)
+         * and saves the result to given file.
+         */
+        virtual bool doConvertToFile(const std::string& filename, const SceneData& scene);
+
         SceneConverterFlags _flags;
 };
 
@@ -0,0 +1,255 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ImportBatch.h"
+
+#include <atomic>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace Trade {
+
+struct ImportBatch::Request {
+    enum class Type: UnsignedByte {
+        Image1D, Image2D, Image3D, Mesh, Material
+    } type;
+    UnsignedInt id, level;
+    void* out;
+};
+
+ImportBatch::ImportBatch(PluginManager::Manager<AbstractImporter>& manager, const std::string& plugin, UnsignedInt threadCount) {
+    /* The error output redirection in open() needs to be thread-local,
+       otherwise the threads would be fighting over it. Without
+       CORRADE_BUILD_MULTITHREADED this is always 1. */
+    threadCount = Implementation::parallelThreadCount(threadCount);
+
+    _importers = Containers::Array<Containers::Pointer<AbstractImporter>>{threadCount};
+    for(Containers::Pointer<AbstractImporter>& importer: _importers) {
+        /* The plugin manager prints a message on failure */
+        importer = manager.loadAndInstantiate(plugin);
+        if(!importer) {
+            _importers = nullptr;
+            return;
+        }
+    }
+}
+
+ImportBatch::ImportBatch(ImportBatch&&) noexcept = default;
+
+ImportBatch::~ImportBatch() = default;
+
+ImportBatch& ImportBatch::operator=(ImportBatch&&) noexcept = default;
+
+ImportBatch& ImportBatch::setFlags(const ImporterFlags flags) {
+    CORRADE_ASSERT(!_opened,
+        "Trade::ImportBatch::setFlags(): can't be set while a file is opened", *this);
+    _flags = flags;
+    return *this;
+}
+
+AbstractImporter& ImportBatch::importer() {
+    /* There's no instance to return a reference to on failure and
+       dereferencing the empty array would crash even with graceful asserts */
+    CORRADE_ASSERT(!_importers.empty(),
+        "Trade::ImportBatch::importer(): no importer instances", *static_cast<AbstractImporter*>(nullptr));
+    return *_importers[0];
+}
+
+bool ImportBatch::open(bool(*const open)(AbstractImporter&, const void*), const void* const input) {
+    close();
+    if(_importers.empty()) {
+        Error{} << "Trade::ImportBatch: no importer instances";
+        return false;
+    }
+
+    /* Open all instances in parallel, as opening can be expensive for some
+       formats. Each thread writes only to its own element. */
+    Containers::Array<bool> opened{Containers::ValueInit, _importers.size()};
+    Implementation::parallelFor(_importers.size(), _importers.size(), [&](std::size_t, std::size_t, const UnsignedInt i) {
+        AbstractImporter& importer = *_importers[i];
+        importer.setFlags(_flags|ImporterFlag::ZeroCopy);
+
+        /* The first instance is opened on the calling thread and reports
+           errors, the others would only repeat the same */
+        if(i) {
+            Error redirectError{nullptr};
+            opened[i] = open(importer, input);
+        } else opened[i] = open(importer, input);
+    });
+
+    for(const bool i: opened) {
+        if(i) continue;
+
+        for(Containers::Pointer<AbstractImporter>& importer: _importers)
+            importer->close();
+        return false;
+    }
+
+    _opened = true;
+    return true;
+}
+
+bool ImportBatch::openData(const Containers::ArrayView<const char> data) {
+    return open([](AbstractImporter& importer, const void* input) {
+        return importer.openData(*static_cast<const Containers::ArrayView<const char>*>(input));
+    }, &data);
+}
+
+bool ImportBatch::openFile(const std::string& filename) {
+    return open([](AbstractImporter& importer, const void* input) {
+        return importer.openFile(*static_cast<const std::string*>(input));
+    }, &filename);
+}
+
+void ImportBatch::close() {
+    for(Containers::Pointer<AbstractImporter>& importer: _importers)
+        importer->close();
+    arrayResize(_requests, 0);
+    _opened = false;
+}
+
+ImportBatch& ImportBatch::addImage1D(const UnsignedInt id, Containers::Optional<ImageData1D>& out, const UnsignedInt level) {
+    CORRADE_ASSERT(_opened,
+        "Trade::ImportBatch::addImage1D(): no file opened", *this);
+    CORRADE_ASSERT(id < _importers[0]->image1DCount(),
+        "Trade::ImportBatch::addImage1D(): index" << id << "out of range for" << _importers[0]->image1DCount() << "entries", *this);
+    CORRADE_ASSERT(level < _importers[0]->image1DLevelCount(id),
+        "Trade::ImportBatch::addImage1D(): level" << level << "out of range for" << _importers[0]->image1DLevelCount(id) << "entries", *this);
+    arrayAppend(_requests, Request{Request::Type::Image1D, id, level, &out});
+    return *this;
+}
+
+ImportBatch& ImportBatch::addImage2D(const UnsignedInt id, Containers::Optional<ImageData2D>& out, const UnsignedInt level) {
+    CORRADE_ASSERT(_opened,
+        "Trade::ImportBatch::addImage2D(): no file opened", *this);
+    CORRADE_ASSERT(id < _importers[0]->image2DCount(),
+        "Trade::ImportBatch::addImage2D(): index" << id << "out of range for" << _importers[0]->image2DCount() << "entries", *this);
+    CORRADE_ASSERT(level < _importers[0]->image2DLevelCount(id),
+        "Trade::ImportBatch::addImage2D(): level" << level << "out of range for" << _importers[0]->image2DLevelCount(id) << "entries", *this);
+    arrayAppend(_requests, Request{Request::Type::Image2D, id, level, &out});
+    return *this;
+}
+
+ImportBatch& ImportBatch::addImage3D(const UnsignedInt id, Containers::Optional<ImageData3D>& out, const UnsignedInt level) {
+    CORRADE_ASSERT(_opened,
+        "Trade::ImportBatch::addImage3D(): no file opened", *this);
+    CORRADE_ASSERT(id < _importers[0]->image3DCount(),
+        "Trade::ImportBatch::addImage3D(): index" << id << "out of range for" << _importers[0]->image3DCount() << "entries", *this);
+    CORRADE_ASSERT(level < _importers[0]->image3DLevelCount(id),
+        "Trade::ImportBatch::addImage3D(): level" << level << "out of range for" << _importers[0]->image3DLevelCount(id) << "entries", *this);
+    arrayAppend(_requests, Request{Request::Type::Image3D, id, level, &out});
+    return *this;
+}
+
+ImportBatch& ImportBatch::addMesh(const UnsignedInt id, Containers::Optional<MeshData>& out, const UnsignedInt level) {
+    CORRADE_ASSERT(_opened,
+        "Trade::ImportBatch::addMesh(): no file opened", *this);
+    CORRADE_ASSERT(id < _importers[0]->meshCount(),
+        "Trade::ImportBatch::addMesh(): index" << id << "out of range for" << _importers[0]->meshCount() << "entries", *this);
+    CORRADE_ASSERT(level < _importers[0]->meshLevelCount(id),
+        "Trade::ImportBatch::addMesh(): level" << level << "out of range for" << _importers[0]->meshLevelCount(id) << "entries", *this);
+    arrayAppend(_requests, Request{Request::Type::Mesh, id, level, &out});
+    return *this;
+}
+
+ImportBatch& ImportBatch::addMaterial(const UnsignedInt id, Containers::Optional<MaterialData>& out) {
+    CORRADE_ASSERT(_opened,
+        "Trade::ImportBatch::addMaterial(): no file opened", *this);
+    CORRADE_ASSERT(id < _importers[0]->materialCount(),
+        "Trade::ImportBatch::addMaterial(): index" << id << "out of range for" << _importers[0]->materialCount() << "entries", *this);
+    arrayAppend(_requests, Request{Request::Type::Material, id, 0, &out});
+    return *this;
+}
+
+ImportBatch& ImportBatch::setCompletionCallback(const CompletionCallback callback, void* const userData) {
+    _completionCallback = callback;
+    _completionCallbackUserData = userData;
+    return *this;
+}
+
+namespace {
+
+template<class T> bool importInto(void* const out, Containers::Optional<T>&& data) {
+    Containers::Optional<T>& slot = *static_cast<Containers::Optional<T>*>(out);
+    slot = std::move(data);
+    return !!slot;
+}
+
+}
+
+bool ImportBatch::execute() {
+    CORRADE_ASSERT(_opened,
+        "Trade::ImportBatch::execute(): no file opened", {});
+
+    /* Images or meshes can have wildly different sizes, so instead of
+       splitting the requests into fixed ranges each thread picks the next
+       unprocessed one */
+    const UnsignedInt threadCount = Implementation::parallelChunkCount(_requests.size(), _importers.size());
+    std::atomic<std::size_t> next{0};
+    std::atomic<std::size_t> failedCount{0};
+    Implementation::parallelFor(threadCount, threadCount, [&](std::size_t, std::size_t, const UnsignedInt thread) {
+        AbstractImporter& importer = *_importers[thread];
+        for(std::size_t i; (i = next++) < _requests.size(); ) {
+            const Request& request = _requests[i];
+            bool success{};
+            switch(request.type) {
+                case Request::Type::Image1D:
+                    success = importInto(request.out, importer.image1D(request.id, request.level));
+                    break;
+                case Request::Type::Image2D:
+                    success = importInto(request.out, importer.image2D(request.id, request.level));
+                    break;
+                case Request::Type::Image3D:
+                    success = importInto(request.out, importer.image3D(request.id, request.level));
+                    break;
+                case Request::Type::Mesh:
+                    success = importInto(request.out, importer.mesh(request.id, request.level));
+                    break;
+                case Request::Type::Material:
+                    /* With MAGNUM_BUILD_DEPRECATED this returns a subclass,
+                       so the type has to be explicit */
+                    success = importInto<MaterialData>(request.out, importer.material(request.id));
+                    break;
+            }
+
+            if(!success) ++failedCount;
+            if(_completionCallback)
+                _completionCallback(i, success, _completionCallbackUserData);
+        }
+    });
+
+    arrayResize(_requests, 0);
+    return !failedCount;
+}
+
+}}
@@ -0,0 +1,300 @@
+#ifndef Magnum_Trade_ImportBatch_h
+#define Magnum_Trade_ImportBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::ImportBatch
+ * @m_since_latest
+ */
+
+#include <string>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Batch import on multiple threads
+@m_since_latest
+
+An @ref AbstractImporter instance is not thread-safe and all its data access
+functions are synchronous, so importing many images or meshes from a single
+file means decoding them one after another. This class instead instantiates
+a given importer plugin once for each worker thread, opens all instances with
+the same input and then distributes a list of import requests among them.
+
+@section Trade-ImportBatch-usage Usage
+
+Create the batch with a plugin manager and a plugin name, open the input using
+@ref openData() or @ref openFile() and then add requests using
+@ref addImage1D(), @ref addImage2D(), @ref addImage3D(), @ref addMesh() or
+@ref addMaterial(). Each request gets a reference to a slot that the result
+will be written to, allocated upfront by the caller. Calling @ref execute()
+then imports all requests in parallel. It's a blocking call --- the calling
+thread takes part in the import as well and the function returns only once
+all requests are finished:
+
+@snippet MagnumTrade.cpp ImportBatch-usage
+
+Optionally, a completion callback can be set with @ref setCompletionCallback()
+to process the results as soon as each of them is ready --- for example to
+put them into an upload queue. Note that the callback is called from the
+worker threads and thus has to be thread-safe.
+
+The imported data in the slots are independent on the batch, with the
+exception described below. Requests are cleared after @ref execute() so the
+batch can be reused for another set of requests on the same input without
+having to open it again.
+
+@section Trade-ImportBatch-zero-copy Memory use
+
+To avoid each worker having its own copy of the input, all instances are
+opened with @ref ImporterFlag::ZeroCopy. Data passed to @ref openData() are
+thus expected to stay in scope until the batch is closed and files opened with
+@ref openFile() get memory-mapped where the plugin and platform support it.
+As a consequence, plugins supporting this flag may return data that are
+non-owned views on the input --- see the flag documentation for details.
+
+@section Trade-ImportBatch-threads Thread count
+
+If Corrade isn't built with @ref CORRADE_BUILD_MULTITHREADED, the error and
+debug output redirection isn't thread-local and thus the import is always
+done on the calling thread only, with a single importer instance. The same
+happens on @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" without pthreads
+enabled or if a thread count of @cpp 1 @ce is requested.
+*/
+class MAGNUM_TRADE_EXPORT ImportBatch {
+    public:
+        /**
+         * @brief Completion callback
+         *
+         * Called with request index as returned by @ref requestCount() before
+         * given request was added, a @cpp true @ce value if the import
+         * succeeded and the user data pointer passed to
+         * @ref setCompletionCallback().
+         */
+        typedef void(*CompletionCallback)(std::size_t, bool, void*);
+
+        /**
+         * @brief Constructor
+         * @param manager       Plugin manager to instantiate the importers
+         *      from
+         * @param plugin        Plugin name
+         * @param threadCount   Worker thread count. If @cpp 0 @ce, the
+         *      hardware thread count is used.
+         *
+         * Instantiates one importer for each thread. If the plugin can't be
+         * instantiated, prints a message to @relativeref{Magnum,Error} and
+         * @ref threadCount() is @cpp 0 @ce.
+         */
+        explicit ImportBatch(PluginManager::Manager<AbstractImporter>& manager, const std::string& plugin, UnsignedInt threadCount = 0);
+
+        /** @brief Copying is not allowed */
+        ImportBatch(const ImportBatch&) = delete;
+
+        /** @brief Move constructor */
+        ImportBatch(ImportBatch&&) noexcept;
+
+        ~ImportBatch();
+
+        /** @brief Copying is not allowed */
+        ImportBatch& operator=(const ImportBatch&) = delete;
+
+        /** @brief Move assignment */
+        ImportBatch& operator=(ImportBatch&&) noexcept;
+
+        /**
+         * @brief Worker thread count
+         *
+         * Equal to the count of importer instances.
+         */
+        UnsignedInt threadCount() const { return _importers.size(); }
+
+        /**
+         * @brief Importer flags
+         *
+         * Doesn't include @ref ImporterFlag::ZeroCopy, which is implicitly
+         * enabled for all instances.
+         */
+        ImporterFlags flags() const { return _flags; }
+
+        /**
+         * @brief Set importer flags
+         *
+         * Passed to all importer instances, together with
+         * @ref ImporterFlag::ZeroCopy. Expects that the input is not opened.
+         */
+        ImportBatch& setFlags(ImporterFlags flags);
+
+        /**
+         * @brief Importer instance
+         *
+         * Can be used for querying the input contents, for example to get
+         * image or mesh count, or setting up plugin-specific configuration
+         * before opening. Changes to the configuration are not propagated to
+         * other instances, use @ref importers() for that. Expects that
+         * @ref threadCount() is not zero.
+         */
+        AbstractImporter& importer();
+
+        /**
+         * @brief All importer instances
+         *
+         * One for each worker thread.
+         */
+        Containers::ArrayView<const Containers::Pointer<AbstractImporter>> importers() const { return _importers; }
+
+        /** @brief Whether the input is opened */
+        bool isOpened() const { return _opened; }
+
+        /**
+         * @brief Open raw data
+         *
+         * Opens the data with all importer instances in parallel. The data are
+         * referenced directly and are expected to stay in scope until the
+         * batch is closed. If any of the instances fails to open the data,
+         * closes all of them and returns @cpp false @ce. Only the first
+         * instance prints error messages, as all would be the same.
+         * @see @ref Trade-ImportBatch-zero-copy
+         */
+        bool openData(Containers::ArrayView<const char> data);
+
+        /**
+         * @brief Open a file
+         *
+         * Similar to @ref openData(), but opens given file.
+         */
+        bool openFile(const std::string& filename);
+
+        /**
+         * @brief Close the input
+         *
+         * Closes all importer instances and discards all requests. On
+         * destruction, the input is closed automatically.
+         */
+        void close();
+
+        /**
+         * @brief Add a 1D image import request
+         * @return Reference to self (for method chaining)
+         *
+         * The @p out slot is expected to stay in scope until @ref execute()
+         * is called. Expects that the input is opened and @p id and @p level
+         * are in range.
+         */
+        ImportBatch& addImage1D(UnsignedInt id, Containers::Optional<ImageData1D>& out, UnsignedInt level = 0);
+
+        /**
+         * @brief Add a 2D image import request
+         * @return Reference to self (for method chaining)
+         *
+         * The @p out slot is expected to stay in scope until @ref execute()
+         * is called. Expects that the input is opened and @p id and @p level
+         * are in range.
+         */
+        ImportBatch& addImage2D(UnsignedInt id, Containers::Optional<ImageData2D>& out, UnsignedInt level = 0);
+
+        /**
+         * @brief Add a 3D image import request
+         * @return Reference to self (for method chaining)
+         *
+         * The @p out slot is expected to stay in scope until @ref execute()
+         * is called. Expects that the input is opened and @p id and @p level
+         * are in range.
+         */
+        ImportBatch& addImage3D(UnsignedInt id, Containers::Optional<ImageData3D>& out, UnsignedInt level = 0);
+
+        /**
+         * @brief Add a mesh import request
+         * @return Reference to self (for method chaining)
+         *
+         * The @p out slot is expected to stay in scope until @ref execute()
+         * is called. Expects that the input is opened and @p id and @p level
+         * are in range.
+         */
+        ImportBatch& addMesh(UnsignedInt id, Containers::Optional<MeshData>& out, UnsignedInt level = 0);
+
+        /**
+         * @brief Add a material import request
+         * @return Reference to self (for method chaining)
+         *
+         * The @p out slot is expected to stay in scope until @ref execute()
+         * is called. Expects that the input is opened and @p id is in range.
+         */
+        ImportBatch& addMaterial(UnsignedInt id, Containers::Optional<MaterialData>& out);
+
+        /** @brief Count of requests added since last @ref execute() */
+        std::size_t requestCount() const { return _requests.size(); }
+
+        /**
+         * @brief Set completion callback
+         * @return Reference to self (for method chaining)
+         *
+         * The callback is called from the worker threads right after each
+         * request is finished and the result written into its slot.
+         * Pass @cpp nullptr @ce to reset it.
+         */
+        ImportBatch& setCompletionCallback(CompletionCallback callback, void* userData = nullptr);
+
+        /**
+         * @brief Execute all requests
+         *
+         * Distributes the requests among worker threads and blocks until all
+         * of them are finished, with the calling thread processing requests
+         * as well. There's no asynchronous variant, if the calling thread
+         * needs to stay responsive, call this function from a dedicated
+         * thread and use @ref setCompletionCallback() to get notified about
+         * finished requests. Each thread picks the next unprocessed
+         * request once it's done with the previous one, so requests of
+         * varying complexity are balanced. Results are written into slots
+         * passed to the @ref addImage1D() "add*()" functions, failed imports
+         * leave the slot as @relativeref{Corrade,Containers::NullOpt}.
+         * Returns @cpp true @ce if all requests succeeded, @cpp false @ce
+         * otherwise. The request list is cleared afterwards. Expects that the
+         * input is opened.
+         */
+        bool execute();
+
+    private:
+        struct Request;
+
+        MAGNUM_TRADE_LOCAL bool open(bool(*open)(AbstractImporter&, const void*), const void* input);
+
+        Containers::Array<Containers::Pointer<AbstractImporter>> _importers;
+        ImporterFlags _flags;
+        bool _opened{};
+        Containers::Array<Request> _requests;
+        CompletionCallback _completionCallback{};
+        void* _completionCallbackUserData{};
+};
+
+}}
+
+#endif
@@ -25,9 +25,149 @@
 
 #include "SceneData.h"
 
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Complex.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Trade/Implementation/arrayUtilities.h"
+
 namespace Magnum { namespace Trade {
 
-SceneData::SceneData(std::vector<UnsignedInt> children2D, std::vector<UnsignedInt> children3D, const void* const importerState): _children2D{std::move(children2D)}, _children3D{std::move(children3D)}, _importerState{importerState} {}
+Debug& operator<<(Debug& debug, const SceneField value) {
+    debug << "Trade::SceneField" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case SceneField::value: return debug << "::" #value;
+        _c(Parent)
+        _c(Transformation)
+        _c(Translation)
+        _c(Rotation)
+        _c(Scaling)
+        _c(Mesh)
+        _c(MeshMaterial)
+        _c(Light)
+        _c(Camera)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const SceneFieldType value) {
+    debug << "Trade::SceneFieldType" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case SceneFieldType::value: return debug << "::" #value;
+        _c(Int)
+        _c(Vector2)
+        _c(Vector3)
+        _c(Complex)
+        _c(Quaternion)
+        _c(Matrix3)
+        _c(Matrix4)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+UnsignedInt sceneFieldTypeSize(const SceneFieldType type) {
+    switch(type) {
+        case SceneFieldType::Int: return sizeof(Int);
+        case SceneFieldType::Vector2: return sizeof(Vector2);
+        case SceneFieldType::Vector3: return sizeof(Vector3);
+        case SceneFieldType::Complex: return sizeof(Complex);
+        case SceneFieldType::Quaternion: return sizeof(Quaternion);
+        case SceneFieldType::Matrix3: return sizeof(Matrix3);
+        case SceneFieldType::Matrix4: return sizeof(Matrix4);
+    }
+
+    CORRADE_ASSERT_UNREACHABLE("Trade::sceneFieldTypeSize(): invalid type" << type, {});
+}
+
+SceneFieldData::SceneFieldData(const SceneField name, const SceneFieldType type, const Containers::StridedArrayView1D<const void>& data) noexcept: SceneFieldData{nullptr, name, type, data} {
+    /* Yes, this calls into a constexpr function defined in the header --
+       because I feel that makes more sense than duplicating the full assert
+       logic */
+    CORRADE_ASSERT(data.empty() || std::ptrdiff_t(sceneFieldTypeSize(type)) <= data.stride(),
+        "Trade::SceneFieldData: expected stride to be positive and enough to fit" << type << Debug::nospace << ", got" << data.stride(), );
+}
+
+namespace {
+
+/* 0 if the type doesn't imply any dimension count, 2 or 3 otherwise */
+UnsignedInt sceneFieldTypeDimensions(const SceneFieldType type) {
+    switch(type) {
+        case SceneFieldType::Vector2:
+        case SceneFieldType::Complex:
+        case SceneFieldType::Matrix3:
+            return 2;
+        case SceneFieldType::Vector3:
+        case SceneFieldType::Quaternion:
+        case SceneFieldType::Matrix4:
+            return 3;
+        case SceneFieldType::Int:
+            return 0;
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+}
+
+SceneData::SceneData(std::vector<UnsignedInt> children2D, std::vector<UnsignedInt> children3D, const UnsignedInt objectCount, Containers::Array<char>&& data, Containers::Array<SceneFieldData>&& fields, const void* const importerState) noexcept: _objectCount{objectCount}, _is2D{}, _children2D{std::move(children2D)}, _children3D{std::move(children3D)}, _importerState{importerState}, _fields{std::move(fields)}, _data{std::move(data)} {
+    UnsignedInt dimensions = 0;
+    for(std::size_t i = 0; i != _fields.size(); ++i) {
+        const SceneFieldData& field = _fields[i];
+        CORRADE_ASSERT(field._type != SceneFieldType{},
+            "Trade::SceneData: field" << i << "doesn't specify anything", );
+        CORRADE_ASSERT(field._size == _objectCount,
+            "Trade::SceneData: field" << i << "has" << field._size << "items but" << _objectCount << "expected", );
+        for(std::size_t j = 0; j != i; ++j) CORRADE_ASSERT(_fields[j]._name != field._name,
+            "Trade::SceneData: duplicate field" << field._name, );
+
+        /* Check that the view fits into the provided data array */
+        #ifndef CORRADE_NO_ASSERT
+        const void* const begin = static_cast<const char*>(field._data);
+        const void* const end = static_cast<const char*>(field._data) + (_objectCount - 1)*field._stride + sceneFieldTypeSize(field._type);
+        CORRADE_ASSERT(!_objectCount || (begin >= _data.begin() && end <= _data.end()),
+            "Trade::SceneData: field" << i << "[" << Debug::nospace << begin << Debug::nospace << ":" << Debug::nospace << end << Debug::nospace << "] is not contained in passed data array [" << Debug::nospace << static_cast<const void*>(_data.begin()) << Debug::nospace << ":" << Debug::nospace << static_cast<const void*>(_data.end()) << Debug::nospace << "]", );
+        #endif
+
+        const UnsignedInt fieldDimensions = sceneFieldTypeDimensions(field._type);
+        if(!fieldDimensions) continue;
+        CORRADE_ASSERT(!dimensions || dimensions == fieldDimensions,
+            "Trade::SceneData: field" << field._name << "of type" << field._type << "doesn't match the dimension count of previous fields", );
+        dimensions = fieldDimensions;
+    }
+
+    _is2D = dimensions == 2;
+}
+
+SceneData::SceneData(const UnsignedInt objectCount, Containers::Array<char>&& data, Containers::Array<SceneFieldData>&& fields, const void* const importerState) noexcept: SceneData{{}, {}, objectCount, std::move(data), std::move(fields), importerState} {
+    std::vector<UnsignedInt>& children = _is2D ? _children2D : _children3D;
+
+    const UnsignedInt parentId = fieldFor(SceneField::Parent);
+    if(parentId == ~UnsignedInt{}) {
+        children.reserve(_objectCount);
+        for(UnsignedInt i = 0; i != _objectCount; ++i) children.push_back(i);
+        return;
+    }
+
+    const Containers::StridedArrayView1D<const Int> parents = Containers::arrayCast<const Int>(_fields[parentId].data());
+    for(UnsignedInt i = 0; i != _objectCount; ++i)
+        if(parents[i] == -1) children.push_back(i);
+}
+
+SceneData::SceneData(const UnsignedInt objectCount, Containers::Array<char>&& data, const std::initializer_list<SceneFieldData> fields, const void* const importerState): SceneData{objectCount, std::move(data), Implementation::initializerListToArrayWithDefaultDeleter(fields), importerState} {}
+
+SceneData::SceneData(std::vector<UnsignedInt> children2D, std::vector<UnsignedInt> children3D, const void* const importerState): _objectCount{}, _is2D{}, _children2D{std::move(children2D)}, _children3D{std::move(children3D)}, _importerState{importerState} {}
 
 SceneData::SceneData(SceneData&&)
     #if !defined(__GNUC__) || __GNUC__*100 + __GNUC_MINOR__ != 409
@@ -41,4 +181,218 @@ SceneData& SceneData::operator=(SceneData&&)
     #endif
     = default;
 
+SceneField SceneData::fieldName(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _fields.size(),
+        "Trade::SceneData::fieldName(): index" << id << "out of range for" << _fields.size() << "fields", {});
+    return _fields[id]._name;
+}
+
+SceneFieldType SceneData::fieldType(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _fields.size(),
+        "Trade::SceneData::fieldType(): index" << id << "out of range for" << _fields.size() << "fields", {});
+    return _fields[id]._type;
+}
+
+UnsignedInt SceneData::fieldFor(const SceneField name) const {
+    for(UnsignedInt i = 0; i != _fields.size(); ++i)
+        if(_fields[i]._name == name) return i;
+    return ~UnsignedInt{};
+}
+
+bool SceneData::hasField(const SceneField name) const {
+    return fieldFor(name) != ~UnsignedInt{};
+}
+
+UnsignedInt SceneData::fieldId(const SceneField name) const {
+    const UnsignedInt id = fieldFor(name);
+    CORRADE_ASSERT(id != ~UnsignedInt{},
+        "Trade::SceneData::fieldId(): field" << name << "not found", {});
+    return id;
+}
+
+SceneFieldType SceneData::fieldType(const SceneField name) const {
+    const UnsignedInt id = fieldFor(name);
+    CORRADE_ASSERT(id != ~UnsignedInt{},
+        "Trade::SceneData::fieldType(): field" << name << "not found", {});
+    return _fields[id]._type;
+}
+
+Containers::StridedArrayView2D<const char> SceneData::field(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _fields.size(),
+        "Trade::SceneData::field(): index" << id << "out of range for" << _fields.size() << "fields", nullptr);
+    const SceneFieldData& field = _fields[id];
+    /* Build a 2D view using information about field type size */
+    return Containers::arrayCast<2, const char>(field.data(), sceneFieldTypeSize(field._type));
+}
+
+Containers::StridedArrayView2D<const char> SceneData::field(const SceneField name) const {
+    const UnsignedInt id = fieldFor(name);
+    CORRADE_ASSERT(id != ~UnsignedInt{},
+        "Trade::SceneData::field(): field" << name << "not found", nullptr);
+    return field(id);
+}
+
+void SceneData::indexFieldInto(const SceneField name, const Containers::StridedArrayView1D<Int>& destination, const char* const prefix) const {
+    CORRADE_ASSERT(destination.size() == _objectCount,
+        prefix << "expected a view with" << _objectCount << "elements but got" << destination.size(), );
+    #ifdef CORRADE_NO_ASSERT
+    static_cast<void>(prefix);
+    #endif
+
+    const UnsignedInt fieldId = fieldFor(name);
+    if(fieldId == ~UnsignedInt{}) {
+        for(Int& i: destination) i = -1;
+        return;
+    }
+
+    /* The type is always Int, checked in SceneFieldData already */
+    Utility::copy(Containers::arrayCast<const Int>(_fields[fieldId].data()), destination);
+}
+
+void SceneData::parentsInto(const Containers::StridedArrayView1D<Int> destination) const {
+    indexFieldInto(SceneField::Parent, destination, "Trade::SceneData::parentsInto():");
+}
+
+Containers::Array<Int> SceneData::parentsAsArray() const {
+    Containers::Array<Int> out{Containers::NoInit, _objectCount};
+    parentsInto(out);
+    return out;
+}
+
+void SceneData::transformations2DInto(const Containers::StridedArrayView1D<Matrix3> destination) const {
+    CORRADE_ASSERT(destination.size() == _objectCount,
+        "Trade::SceneData::transformations2DInto(): expected a view with" << _objectCount << "elements but got" << destination.size(), );
+
+    const UnsignedInt transformationId = fieldFor(SceneField::Transformation);
+    const UnsignedInt translationId = fieldFor(SceneField::Translation);
+    const UnsignedInt rotationId = fieldFor(SceneField::Rotation);
+    const UnsignedInt scalingId = fieldFor(SceneField::Scaling);
+    CORRADE_ASSERT(_is2D || (transformationId == ~UnsignedInt{} && translationId == ~UnsignedInt{} && rotationId == ~UnsignedInt{} && scalingId == ~UnsignedInt{}),
+        "Trade::SceneData::transformations2DInto(): the scene has 3D transformations", );
+
+    /* If there's a matrix, copy it directly */
+    if(transformationId != ~UnsignedInt{}) {
+        Utility::copy(Containers::arrayCast<const Matrix3>(_fields[transformationId].data()), destination);
+        return;
+    }
+
+    /* Otherwise combine the TRS components, treating the missing ones as an
+       identity. That includes the case of no TRS component at all. */
+    Containers::StridedArrayView1D<const Vector2> translations;
+    Containers::StridedArrayView1D<const Complex> rotations;
+    Containers::StridedArrayView1D<const Vector2> scalings;
+    if(translationId != ~UnsignedInt{})
+        translations = Containers::arrayCast<const Vector2>(_fields[translationId].data());
+    if(rotationId != ~UnsignedInt{})
+        rotations = Containers::arrayCast<const Complex>(_fields[rotationId].data());
+    if(scalingId != ~UnsignedInt{})
+        scalings = Containers::arrayCast<const Vector2>(_fields[scalingId].data());
+    for(std::size_t i = 0; i != destination.size(); ++i)
+        destination[i] =
+            Matrix3::from(
+                rotations.empty() ? Matrix2x2{Math::IdentityInit} : rotations[i].toMatrix(),
+                translations.empty() ? Vector2{} : translations[i])*
+            Matrix3::scaling(scalings.empty() ? Vector2{1.0f} : scalings[i]);
+}
+
+Containers::Array<Matrix3> SceneData::transformations2DAsArray() const {
+    Containers::Array<Matrix3> out{Containers::NoInit, _objectCount};
+    transformations2DInto(out);
+    return out;
+}
+
+void SceneData::transformations3DInto(const Containers::StridedArrayView1D<Matrix4> destination) const {
+    CORRADE_ASSERT(destination.size() == _objectCount,
+        "Trade::SceneData::transformations3DInto(): expected a view with" << _objectCount << "elements but got" << destination.size(), );
+    CORRADE_ASSERT(!_is2D,
+        "Trade::SceneData::transformations3DInto(): the scene has 2D transformations", );
+
+    /* If there's a matrix, copy it directly */
+    const UnsignedInt transformationId = fieldFor(SceneField::Transformation);
+    if(transformationId != ~UnsignedInt{}) {
+        Utility::copy(Containers::arrayCast<const Matrix4>(_fields[transformationId].data()), destination);
+        return;
+    }
+
+    /* Otherwise combine the TRS components, treating the missing ones as an
+       identity. That includes the case of no TRS component at all. */
+    const UnsignedInt translationId = fieldFor(SceneField::Translation);
+    const UnsignedInt rotationId = fieldFor(SceneField::Rotation);
+    const UnsignedInt scalingId = fieldFor(SceneField::Scaling);
+    Containers::StridedArrayView1D<const Vector3> translations;
+    Containers::StridedArrayView1D<const Quaternion> rotations;
+    Containers::StridedArrayView1D<const Vector3> scalings;
+    if(translationId != ~UnsignedInt{})
+        translations = Containers::arrayCast<const Vector3>(_fields[translationId].data());
+    if(rotationId != ~UnsignedInt{})
+        rotations = Containers::arrayCast<const Quaternion>(_fields[rotationId].data());
+    if(scalingId != ~UnsignedInt{})
+        scalings = Containers::arrayCast<const Vector3>(_fields[scalingId].data());
+    for(std::size_t i = 0; i != destination.size(); ++i)
+        destination[i] =
+            Matrix4::from(
+                rotations.empty() ? Matrix3x3{Math::IdentityInit} : rotations[i].toMatrix(),
+                translations.empty() ? Vector3{} : translations[i])*
+            Matrix4::scaling(scalings.empty() ? Vector3{1.0f} : scalings[i]);
+}
+
+Containers::Array<Matrix4> SceneData::transformations3DAsArray() const {
+    Containers::Array<Matrix4> out{Containers::NoInit, _objectCount};
+    transformations3DInto(out);
+    return out;
+}
+
+void SceneData::meshesInto(const Containers::StridedArrayView1D<Int> destination) const {
+    indexFieldInto(SceneField::Mesh, destination, "Trade::SceneData::meshesInto():");
+}
+
+Containers::Array<Int> SceneData::meshesAsArray() const {
+    Containers::Array<Int> out{Containers::NoInit, _objectCount};
+    meshesInto(out);
+    return out;
+}
+
+void SceneData::meshMaterialsInto(const Containers::StridedArrayView1D<Int> destination) const {
+    indexFieldInto(SceneField::MeshMaterial, destination, "Trade::SceneData::meshMaterialsInto():");
+}
+
+Containers::Array<Int> SceneData::meshMaterialsAsArray() const {
+    Containers::Array<Int> out{Containers::NoInit, _objectCount};
+    meshMaterialsInto(out);
+    return out;
+}
+
+void SceneData::lightsInto(const Containers::StridedArrayView1D<Int> destination) const {
+    indexFieldInto(SceneField::Light, destination, "Trade::SceneData::lightsInto():");
+}
+
+Containers::Array<Int> SceneData::lightsAsArray() const {
+    Containers::Array<Int> out{Containers::NoInit, _objectCount};
+    lightsInto(out);
+    return out;
+}
+
+void SceneData::camerasInto(const Containers::StridedArrayView1D<Int> destination) const {
+    indexFieldInto(SceneField::Camera, destination, "Trade::SceneData::camerasInto():");
+}
+
+Containers::Array<Int> SceneData::camerasAsArray() const {
+    Containers::Array<Int> out{Containers::NoInit, _objectCount};
+    camerasInto(out);
+    return out;
+}
+
+Containers::Array<char> SceneData::releaseData() {
+    _objectCount = 0;
+    _is2D = false;
+    _fields = nullptr;
+    return std::move(_data);
+}
+
+Containers::Array<SceneFieldData> SceneData::releaseFieldData() {
+    _objectCount = 0;
+    _is2D = false;
+    return std::move(_fields);
+}
+
 }}
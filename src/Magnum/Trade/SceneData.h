@@ -26,29 +26,309 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::Trade::SceneData
+ * @brief Class @ref Magnum::Trade::SceneData, @ref Magnum::Trade::SceneFieldData, enum @ref Magnum::Trade::SceneField, @ref Magnum::Trade::SceneFieldType, function @ref Magnum::Trade::sceneFieldTypeSize()
  */
 
 #include <string>
 #include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
 
-#include "Magnum/Types.h"
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/Trade.h"
 #include "Magnum/Trade/visibility.h"
 
 namespace Magnum { namespace Trade {
 
+/**
+@brief Scene field name
+@m_since_latest
+
+Each field is a per-object array, indexed by object ID. Fields that reference
+other data (meshes, materials, lights, cameras) use @cpp -1 @ce for objects
+that don't reference anything.
+@see @ref SceneData, @ref SceneFieldData, @ref SceneFieldType
+*/
+enum class SceneField: UnsignedByte {
+    /* Zero used for an invalid value */
+
+    /**
+     * Parent object index. Type is usually @ref SceneFieldType::Int,
+     * @cpp -1 @ce denotes a root object.
+     * @see @ref SceneData::parentsAsArray()
+     */
+    Parent = 1,
+
+    /**
+     * Transformation relative to the parent. Type is usually
+     * @ref SceneFieldType::Matrix3 for 2D and
+     * @ref SceneFieldType::Matrix4 for 3D.
+     * @see @ref SceneData::transformations2DAsArray(),
+     *      @ref SceneData::transformations3DAsArray()
+     */
+    Transformation,
+
+    /**
+     * Translation relative to the parent. Type is usually
+     * @ref SceneFieldType::Vector2 for 2D and
+     * @ref SceneFieldType::Vector3 for 3D. Used only if
+     * @ref SceneField::Transformation isn't present.
+     */
+    Translation,
+
+    /**
+     * Rotation relative to the parent. Type is usually
+     * @ref SceneFieldType::Complex for 2D and
+     * @ref SceneFieldType::Quaternion for 3D. Used only if
+     * @ref SceneField::Transformation isn't present.
+     */
+    Rotation,
+
+    /**
+     * Scaling relative to the parent. Type is usually
+     * @ref SceneFieldType::Vector2 for 2D and
+     * @ref SceneFieldType::Vector3 for 3D. Used only if
+     * @ref SceneField::Transformation isn't present.
+     */
+    Scaling,
+
+    /**
+     * Mesh ID, as passed to @ref AbstractImporter::mesh(). Type is usually
+     * @ref SceneFieldType::Int.
+     * @see @ref SceneData::meshesAsArray()
+     */
+    Mesh,
+
+    /**
+     * Material ID of the mesh, as passed to
+     * @ref AbstractImporter::material(). Type is usually
+     * @ref SceneFieldType::Int.
+     * @see @ref SceneData::meshMaterialsAsArray()
+     */
+    MeshMaterial,
+
+    /**
+     * Light ID, as passed to @ref AbstractImporter::light(). Type is usually
+     * @ref SceneFieldType::Int.
+     * @see @ref SceneData::lightsAsArray()
+     */
+    Light,
+
+    /**
+     * Camera ID, as passed to @ref AbstractImporter::camera(). Type is
+     * usually @ref SceneFieldType::Int.
+     * @see @ref SceneData::camerasAsArray()
+     */
+    Camera
+};
+
+/**
+@debugoperatorenum{SceneField}
+@m_since_latest
+*/
+MAGNUM_TRADE_EXPORT Debug& operator<<(Debug& debug, SceneField value);
+
+/**
+@brief Scene field type
+@m_since_latest
+
+@see @ref SceneData, @ref SceneFieldData, @ref sceneFieldTypeSize()
+*/
+enum class SceneFieldType: UnsignedByte {
+    /* Zero used for an invalid value */
+
+    Int = 1,        /**< @relativeref{Magnum,Int} */
+    Vector2,        /**< @relativeref{Magnum,Vector2} */
+    Vector3,        /**< @relativeref{Magnum,Vector3} */
+    Complex,        /**< @relativeref{Magnum,Complex} */
+    Quaternion,     /**< @relativeref{Magnum,Quaternion} */
+    Matrix3,        /**< @relativeref{Magnum,Matrix3} */
+    Matrix4         /**< @relativeref{Magnum,Matrix4} */
+};
+
+/**
+@debugoperatorenum{SceneFieldType}
+@m_since_latest
+*/
+MAGNUM_TRADE_EXPORT Debug& operator<<(Debug& debug, SceneFieldType value);
+
+/**
+@brief Size of given scene field type
+@m_since_latest
+*/
+MAGNUM_TRADE_EXPORT UnsignedInt sceneFieldTypeSize(SceneFieldType type);
+
+/**
+@brief Scene field data
+@m_since_latest
+
+Convenience type for populating @ref SceneData, see its documentation for an
+introduction.
+*/
+class MAGNUM_TRADE_EXPORT SceneFieldData {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Leaves contents at unspecified values. Provided as a convenience for
+         * initialization of the field array for @ref SceneData, expected to
+         * be replaced with concrete values later.
+         */
+        constexpr explicit SceneFieldData() noexcept: _name{}, _type{}, _size{}, _stride{}, _data{} {}
+
+        /**
+         * @brief Type-erased constructor
+         * @param name      Field name
+         * @param type      Field type
+         * @param data      Field data
+         *
+         * Expects that @p data stride is large enough to fit @p type and
+         * that @p type corresponds to @p name.
+         */
+        explicit SceneFieldData(SceneField name, SceneFieldType type, const Containers::StridedArrayView1D<const void>& data) noexcept;
+
+        /**
+         * @brief Constructor
+         * @param name      Field name
+         * @param data      Field data
+         *
+         * Detects @ref SceneFieldType based on @p T and calls
+         * @ref SceneFieldData(SceneField, SceneFieldType, const Containers::StridedArrayView1D<const void>&).
+         * The detected type is of the same name as @p T.
+         */
+        template<class T> constexpr explicit SceneFieldData(SceneField name, const Containers::StridedArrayView1D<T>& data) noexcept;
+
+        /** @overload */
+        template<class T> constexpr explicit SceneFieldData(SceneField name, const Containers::ArrayView<T>& data) noexcept: SceneFieldData{name, Containers::stridedArrayView(data)} {}
+
+        /** @brief Field name */
+        constexpr SceneField name() const { return _name; }
+
+        /** @brief Field type */
+        constexpr SceneFieldType type() const { return _type; }
+
+        /** @brief Type-erased field data */
+        Containers::StridedArrayView1D<const void> data() const {
+            return Containers::StridedArrayView1D<const void>{
+                /* We're *sure* the view is correct, so faking the view size */
+                {_data, ~std::size_t{}}, _size, _stride};
+        }
+
+    private:
+        friend SceneData;
+
+        /* nullptr first, to avoid accidental matches as much as possible */
+        constexpr explicit SceneFieldData(std::nullptr_t, SceneField name, SceneFieldType type, const Containers::StridedArrayView1D<const void>& data) noexcept;
+
+        SceneField _name;
+        SceneFieldType _type;
+        /* 2 bytes free */
+
+        /* Object count in SceneData is 32-bit, so this doesn't need to be
+           64-bit either */
+        UnsignedInt _size;
+        Int _stride;
+
+        /* Data pointer last. Its size varies between 32 and 64 bit and having
+           it last reduces the amount of pain when serializing. */
+        const void* _data;
+};
+
 /**
 @brief Scene data
 
-@see @ref AbstractImporter::scene()
+Contains the object hierarchy of a scene together with per-object
+transformations and references to meshes, materials, lights and cameras.
+Populated instances of this class are returned from
+@ref AbstractImporter::scene() and @ref AbstractImporter::flatScene().
+
+@section Trade-SceneData-usage Basic usage
+
+The scene is stored in a columnar form --- each @ref SceneField is an array
+indexed by object ID, with all fields being typed strided views into a single
+owned buffer, similarly to how @ref MeshData stores vertex attributes. The
+simplest usage is through the convenience functions @ref parentsAsArray(),
+@ref transformations3DAsArray(), @ref meshesAsArray() and others, which
+return the data converted to a canonical type independently of how it's
+stored:
+
+@snippet MagnumTrade.cpp SceneData-usage
+
+Alternatively, @ref field(SceneField) const gives a typed view directly into
+the stored data, without any copy. The list of root objects is provided by
+@ref children2D() and @ref children3D().
+
+@section Trade-SceneData-populating Populating an instance
+
+A scene with @p objectCount objects is created from a single data buffer and
+a list of @ref SceneFieldData describing the fields in it. The whole scene can
+be thus created with a constant amount of allocations, independently of the
+object count:
+
+@snippet MagnumTrade.cpp SceneData-populating
+
+@section Trade-SceneData-legacy Scenes without per-object data
+
+Instances created with the @ref SceneData(std::vector<UnsignedInt>, std::vector<UnsignedInt>, const void*)
+constructor contain only the list of root objects. Per-object data then have
+to be queried through @ref AbstractImporter::object2D() and
+@ref AbstractImporter::object3D(), or converted to the columnar form through
+@ref AbstractImporter::flatScene().
+
+@see @ref AbstractImporter::scene(), @ref AbstractImporter::flatScene(),
+    @ref AbstractSceneConverter::convert(const SceneData&)
 */
 class MAGNUM_TRADE_EXPORT SceneData {
     public:
         /**
-         * @brief Constructor
+         * @brief Construct a scene with per-object data
+         * @param objectCount       Object count
+         * @param data              Field data
+         * @param fields            Description of all scene field data
+         * @param importerState     Importer-specific state
+         * @m_since_latest
+         *
+         * All @p fields are expected to have @p objectCount items and be
+         * contained in @p data, each field name is expected to be present
+         * at most once and all fields are expected to be either 2D or 3D.
+         * Root objects, i.e. objects with @ref SceneField::Parent set to
+         * @cpp -1 @ce, are put into @ref children2D() if the fields are 2D
+         * and into @ref children3D() otherwise. If there's no
+         * @ref SceneField::Parent, all objects are roots.
+         */
+        explicit SceneData(UnsignedInt objectCount, Containers::Array<char>&& data, Containers::Array<SceneFieldData>&& fields, const void* importerState = nullptr) noexcept;
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        explicit SceneData(UnsignedInt objectCount, Containers::Array<char>&& data, std::initializer_list<SceneFieldData> fields, const void* importerState = nullptr);
+
+        /**
+         * @brief Construct a scene with per-object data and explicit root objects
+         * @param children2D        Two-dimensional root objects
+         * @param children3D        Three-dimensional root objects
+         * @param objectCount       Object count
+         * @param data              Field data
+         * @param fields            Description of all scene field data
+         * @param importerState     Importer-specific state
+         * @m_since_latest
+         *
+         * Useful when the per-object arrays cover also objects that aren't
+         * part of the scene, such as when the fields are indexed by global
+         * object IDs of a file containing multiple scenes. Expectations on
+         * @p fields are the same as in
+         * @ref SceneData(UnsignedInt, Containers::Array<char>&&, Containers::Array<SceneFieldData>&&, const void*).
+         */
+        explicit SceneData(std::vector<UnsignedInt> children2D, std::vector<UnsignedInt> children3D, UnsignedInt objectCount, Containers::Array<char>&& data, Containers::Array<SceneFieldData>&& fields, const void* importerState = nullptr) noexcept;
+
+        /**
+         * @brief Construct a scene without per-object data
          * @param children2D        Two-dimensional child objects
          * @param children3D        Three-dimensional child objects
          * @param importerState     Importer-specific state
+         *
+         * The @ref objectCount() and @ref fieldCount() are both zero.
          */
         explicit SceneData(std::vector<UnsignedInt> children2D, std::vector<UnsignedInt> children3D, const void* importerState = nullptr);
 
@@ -78,12 +358,319 @@ class MAGNUM_TRADE_EXPORT SceneData {
             #endif
             ;
 
-        /** @brief Two-dimensional child objects */
+        /** @brief Two-dimensional root objects */
         const std::vector<UnsignedInt>& children2D() const { return _children2D; }
 
-        /** @brief Three-dimensional child objects */
+        /** @brief Three-dimensional root objects */
         const std::vector<UnsignedInt>& children3D() const { return _children3D; }
 
+        /**
+         * @brief Object count
+         * @m_since_latest
+         *
+         * Size of each field array. Zero for scenes without per-object data.
+         */
+        UnsignedInt objectCount() const { return _objectCount; }
+
+        /**
+         * @brief Whether the per-object fields are two-dimensional
+         * @m_since_latest
+         *
+         * Returns @cpp true @ce if any of @ref SceneField::Transformation,
+         * @ref SceneField::Translation, @ref SceneField::Rotation or
+         * @ref SceneField::Scaling is present and is two-dimensional,
+         * @cpp false @ce otherwise.
+         */
+        bool is2D() const { return _is2D; }
+
+        /**
+         * @brief Raw field data
+         * @m_since_latest
+         *
+         * @see @ref releaseData()
+         */
+        Containers::ArrayView<const char> data() const & { return _data; }
+
+        /** @brief Taking a view to a r-value instance is not allowed */
+        Containers::ArrayView<const char> data() const && = delete;
+
+        /**
+         * @brief Raw field metadata
+         * @m_since_latest
+         *
+         * Returns the raw data that are used as a base for all `field*()`
+         * accessors. In most cases you don't want to access those directly,
+         * but rather use the @ref field(), @ref fieldName(),
+         * @ref fieldType() etc. accessors.
+         * @see @ref releaseFieldData()
+         */
+        Containers::ArrayView<const SceneFieldData> fieldData() const & { return _fields; }
+
+        /** @brief Taking a view to a r-value instance is not allowed */
+        Containers::ArrayView<const SceneFieldData> fieldData() const && = delete;
+
+        /**
+         * @brief Field count
+         * @m_since_latest
+         *
+         * Count of all fields. Zero for scenes without per-object data.
+         */
+        UnsignedInt fieldCount() const { return _fields.size(); }
+
+        /**
+         * @brief Field name
+         * @m_since_latest
+         *
+         * The @p id is expected to be smaller than @ref fieldCount().
+         */
+        SceneField fieldName(UnsignedInt id) const;
+
+        /**
+         * @brief Field type
+         * @m_since_latest
+         *
+         * The @p id is expected to be smaller than @ref fieldCount().
+         */
+        SceneFieldType fieldType(UnsignedInt id) const;
+
+        /**
+         * @brief Whether the scene has given field
+         * @m_since_latest
+         */
+        bool hasField(SceneField name) const;
+
+        /**
+         * @brief Absolute ID of a named field
+         * @m_since_latest
+         *
+         * Expects that @p name is present in the scene.
+         * @see @ref hasField()
+         */
+        UnsignedInt fieldId(SceneField name) const;
+
+        /**
+         * @brief Type of a named field
+         * @m_since_latest
+         *
+         * Expects that @p name is present in the scene.
+         * @see @ref hasField()
+         */
+        SceneFieldType fieldType(SceneField name) const;
+
+        /**
+         * @brief Data for given field
+         * @m_since_latest
+         *
+         * The @p id is expected to be smaller than @ref fieldCount(). The
+         * second dimension represents the actual data type (its size is equal
+         * to @ref sceneFieldTypeSize()) and is guaranteed to be contiguous.
+         * Use the templated overload below to get the field in a concrete
+         * type.
+         */
+        Containers::StridedArrayView2D<const char> field(UnsignedInt id) const;
+
+        /**
+         * @brief Data for given field in a concrete type
+         * @m_since_latest
+         *
+         * The @p id is expected to be smaller than @ref fieldCount() and
+         * @p T is expected to correspond to @ref fieldType(UnsignedInt) const.
+         */
+        template<class T> Containers::StridedArrayView1D<const T> field(UnsignedInt id) const;
+
+        /**
+         * @brief Data for given named field
+         * @m_since_latest
+         *
+         * Expects that @p name is present in the scene.
+         * @see @ref hasField()
+         */
+        Containers::StridedArrayView2D<const char> field(SceneField name) const;
+
+        /**
+         * @brief Data for given named field in a concrete type
+         * @m_since_latest
+         *
+         * Expects that @p name is present in the scene and @p T corresponds
+         * to @ref fieldType(SceneField) const.
+         */
+        template<class T> Containers::StridedArrayView1D<const T> field(SceneField name) const;
+
+        /**
+         * @brief Parents as 32-bit integers
+         * @m_since_latest
+         *
+         * Convenience alternative to @ref field(SceneField) const with
+         * @ref SceneField::Parent. If the field isn't present, all objects
+         * are treated as roots and the output is filled with @cpp -1 @ce.
+         * @see @ref parentsInto()
+         */
+        Containers::Array<Int> parentsAsArray() const;
+
+        /**
+         * @brief Parents as 32-bit integers into a pre-allocated view
+         * @m_since_latest
+         *
+         * Like @ref parentsAsArray(), but puts the result into
+         * @p destination instead of allocating a new array. Expects that
+         * @p destination is sized to contain exactly all data.
+         */
+        void parentsInto(Containers::StridedArrayView1D<Int> destination) const;
+
+        /**
+         * @brief 2D transformations as 3x3 float matrices
+         * @m_since_latest
+         *
+         * If @ref SceneField::Transformation is present, returns its contents,
+         * otherwise combines @ref SceneField::Translation,
+         * @ref SceneField::Rotation and @ref SceneField::Scaling, with the
+         * missing ones being treated as identity. If none of these is present,
+         * the output is filled with identity matrices. Expects that the scene
+         * doesn't contain three-dimensional transformation fields.
+         * @see @ref is2D(), @ref transformations2DInto()
+         */
+        Containers::Array<Matrix3> transformations2DAsArray() const;
+
+        /**
+         * @brief 2D transformations as 3x3 float matrices into a pre-allocated view
+         * @m_since_latest
+         *
+         * Like @ref transformations2DAsArray(), but puts the result into
+         * @p destination instead of allocating a new array. Expects that
+         * @p destination is sized to contain exactly all data.
+         */
+        void transformations2DInto(Containers::StridedArrayView1D<Matrix3> destination) const;
+
+        /**
+         * @brief 3D transformations as 4x4 float matrices
+         * @m_since_latest
+         *
+         * If @ref SceneField::Transformation is present, returns its contents,
+         * otherwise combines @ref SceneField::Translation,
+         * @ref SceneField::Rotation and @ref SceneField::Scaling, with the
+         * missing ones being treated as identity. If none of these is present,
+         * the output is filled with identity matrices. Expects that the scene
+         * doesn't contain two-dimensional transformation fields.
+         * @see @ref is2D(), @ref transformations3DInto()
+         */
+        Containers::Array<Matrix4> transformations3DAsArray() const;
+
+        /**
+         * @brief 3D transformations as 4x4 float matrices into a pre-allocated view
+         * @m_since_latest
+         *
+         * Like @ref transformations3DAsArray(), but puts the result into
+         * @p destination instead of allocating a new array. Expects that
+         * @p destination is sized to contain exactly all data.
+         */
+        void transformations3DInto(Containers::StridedArrayView1D<Matrix4> destination) const;
+
+        /**
+         * @brief Mesh IDs as 32-bit integers
+         * @m_since_latest
+         *
+         * Convenience alternative to @ref field(SceneField) const with
+         * @ref SceneField::Mesh. If the field isn't present, the output is
+         * filled with @cpp -1 @ce.
+         * @see @ref meshesInto()
+         */
+        Containers::Array<Int> meshesAsArray() const;
+
+        /**
+         * @brief Mesh IDs as 32-bit integers into a pre-allocated view
+         * @m_since_latest
+         *
+         * Like @ref meshesAsArray(), but puts the result into @p destination
+         * instead of allocating a new array. Expects that @p destination is
+         * sized to contain exactly all data.
+         */
+        void meshesInto(Containers::StridedArrayView1D<Int> destination) const;
+
+        /**
+         * @brief Mesh material IDs as 32-bit integers
+         * @m_since_latest
+         *
+         * Convenience alternative to @ref field(SceneField) const with
+         * @ref SceneField::MeshMaterial. If the field isn't present, the
+         * output is filled with @cpp -1 @ce.
+         * @see @ref meshMaterialsInto()
+         */
+        Containers::Array<Int> meshMaterialsAsArray() const;
+
+        /**
+         * @brief Mesh material IDs as 32-bit integers into a pre-allocated view
+         * @m_since_latest
+         *
+         * Like @ref meshMaterialsAsArray(), but puts the result into
+         * @p destination instead of allocating a new array. Expects that
+         * @p destination is sized to contain exactly all data.
+         */
+        void meshMaterialsInto(Containers::StridedArrayView1D<Int> destination) const;
+
+        /**
+         * @brief Light IDs as 32-bit integers
+         * @m_since_latest
+         *
+         * Convenience alternative to @ref field(SceneField) const with
+         * @ref SceneField::Light. If the field isn't present, the output is
+         * filled with @cpp -1 @ce.
+         * @see @ref lightsInto()
+         */
+        Containers::Array<Int> lightsAsArray() const;
+
+        /**
+         * @brief Light IDs as 32-bit integers into a pre-allocated view
+         * @m_since_latest
+         *
+         * Like @ref lightsAsArray(), but puts the result into @p destination
+         * instead of allocating a new array. Expects that @p destination is
+         * sized to contain exactly all data.
+         */
+        void lightsInto(Containers::StridedArrayView1D<Int> destination) const;
+
+        /**
+         * @brief Camera IDs as 32-bit integers
+         * @m_since_latest
+         *
+         * Convenience alternative to @ref field(SceneField) const with
+         * @ref SceneField::Camera. If the field isn't present, the output is
+         * filled with @cpp -1 @ce.
+         * @see @ref camerasInto()
+         */
+        Containers::Array<Int> camerasAsArray() const;
+
+        /**
+         * @brief Camera IDs as 32-bit integers into a pre-allocated view
+         * @m_since_latest
+         *
+         * Like @ref camerasAsArray(), but puts the result into
+         * @p destination instead of allocating a new array. Expects that
+         * @p destination is sized to contain exactly all data.
+         */
+        void camerasInto(Containers::StridedArrayView1D<Int> destination) const;
+
+        /**
+         * @brief Release field data storage
+         * @m_since_latest
+         *
+         * Releases the ownership of the field data array and resets the
+         * internal field-related state to default. The scene then behaves
+         * like if it had no per-object data.
+         * @see @ref data()
+         */
+        Containers::Array<char> releaseData();
+
+        /**
+         * @brief Release field metadata storage
+         * @m_since_latest
+         *
+         * Releases the ownership of the field metadata array and resets the
+         * internal field-related state to default. The scene then behaves
+         * like if it had no per-object data.
+         * @see @ref fieldData()
+         */
+        Containers::Array<SceneFieldData> releaseFieldData();
+
         /**
          * @brief Importer-specific state
          *
@@ -92,11 +679,96 @@ class MAGNUM_TRADE_EXPORT SceneData {
         const void* importerState() const { return _importerState; }
 
     private:
+        /* For custom deleter checks. Not done in the constructors here because
+           the restriction is pointless when used outside of plugin
+           implementations. */
+        friend AbstractImporter;
+        friend AbstractSceneConverter;
+
+        /* Like fieldId(), but returns ~UnsignedInt{} if not found */
+        UnsignedInt fieldFor(SceneField name) const;
+
+        MAGNUM_TRADE_LOCAL void indexFieldInto(SceneField name, const Containers::StridedArrayView1D<Int>& destination, const char* prefix) const;
+
+        UnsignedInt _objectCount;
+        bool _is2D;
         std::vector<UnsignedInt> _children2D,
             _children3D;
         const void* _importerState;
+        Containers::Array<SceneFieldData> _fields;
+        Containers::Array<char> _data;
 };
 
+namespace Implementation {
+    /* Implicit mapping from a type to enum (1:1) */
+    template<class T> constexpr SceneFieldType sceneFieldTypeFor() {
+        /* C++ why there isn't an obvious way to do such a thing?! */
+        static_assert(sizeof(T) == 0, "unsupported field type");
+        return {};
+    }
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    #define _c(type) \
+        template<> constexpr SceneFieldType sceneFieldTypeFor<type>() { return SceneFieldType::type; }
+    _c(Int)
+    _c(Vector2)
+    _c(Vector3)
+    _c(Complex)
+    _c(Quaternion)
+    _c(Matrix3)
+    _c(Matrix4)
+    #undef _c
+    #endif
+
+    constexpr bool isSceneFieldTypeCompatibleWithField(SceneField name, SceneFieldType type) {
+        return
+            /* Implicit types for index fields */
+            ((name == SceneField::Parent ||
+              name == SceneField::Mesh ||
+              name == SceneField::MeshMaterial ||
+              name == SceneField::Light ||
+              name == SceneField::Camera) &&
+                type == SceneFieldType::Int) ||
+            (name == SceneField::Transformation &&
+                (type == SceneFieldType::Matrix3 ||
+                 type == SceneFieldType::Matrix4)) ||
+            ((name == SceneField::Translation ||
+              name == SceneField::Scaling) &&
+                (type == SceneFieldType::Vector2 ||
+                 type == SceneFieldType::Vector3)) ||
+            (name == SceneField::Rotation &&
+                (type == SceneFieldType::Complex ||
+                 type == SceneFieldType::Quaternion));
+    }
+}
+
+constexpr SceneFieldData::SceneFieldData(std::nullptr_t, const SceneField name, const SceneFieldType type, const Containers::StridedArrayView1D<const void>& data) noexcept:
+    _name{(CORRADE_CONSTEXPR_ASSERT(Implementation::isSceneFieldTypeCompatibleWithField(name, type),
+        "Trade::SceneFieldData:" << type << "is not a valid type for" << name), name)},
+    _type{type}, _size{UnsignedInt(data.size())},
+    _stride{(CORRADE_CONSTEXPR_ASSERT(data.stride() >= 0 && data.stride() <= 0x7fffffff,
+        "Trade::SceneFieldData: expected stride to be positive and fit into 32 bits, got" << data.stride()),
+        Int(data.stride()))},
+    _data{data.data()} {}
+
+template<class T> constexpr SceneFieldData::SceneFieldData(SceneField name, const Containers::StridedArrayView1D<T>& data) noexcept: SceneFieldData{nullptr, name, Implementation::sceneFieldTypeFor<typename std::remove_const<T>::type>(), data} {}
+
+template<class T> Containers::StridedArrayView1D<const T> SceneData::field(const UnsignedInt id) const {
+    Containers::StridedArrayView2D<const char> data = field(id);
+    #ifdef CORRADE_GRACEFUL_ASSERT /* Sigh. Brittle. Better idea? */
+    if(!data.stride()[1]) return {};
+    #endif
+    CORRADE_ASSERT(Implementation::sceneFieldTypeFor<T>() == _fields[id]._type,
+        "Trade::SceneData::field(): improper type requested for" << _fields[id]._name << "of type" << _fields[id]._type, nullptr);
+    return Containers::arrayCast<1, const T>(data);
+}
+
+template<class T> Containers::StridedArrayView1D<const T> SceneData::field(const SceneField name) const {
+    const UnsignedInt id = fieldFor(name);
+    CORRADE_ASSERT(id != ~UnsignedInt{},
+        "Trade::SceneData::field(): field" << name << "not found", nullptr);
+    return field<T>(id);
+}
+
 }}
 
 #endif
@@ -70,6 +70,7 @@ struct AbstractImporterTest: TestSuite::Tester {
     void openData();
     void openFileAsData();
     void openFileAsDataNotFound();
+    void openFileAsDataZeroCopy();
 
     void openFileNotImplemented();
     void openDataNotSupported();
@@ -89,6 +90,9 @@ struct AbstractImporterTest: TestSuite::Tester {
     void setFileCallbackOpenFileThroughBaseImplementationFailed();
     void setFileCallbackOpenFileAsData();
     void setFileCallbackOpenFileAsDataFailed();
+    void setFileCallbackOpenFileAsDataZeroCopy();
+    void setFileCallbackOpenFileAsDataZeroCopyDestructor();
+    void setFileCallbackOpenFileAsDataZeroCopyFailed();
 
     void thingCountNotImplemented();
     void thingCountNoFile();
@@ -106,6 +110,16 @@ struct AbstractImporterTest: TestSuite::Tester {
     void sceneNameOutOfRange();
     void sceneNotImplemented();
     void sceneOutOfRange();
+    void sceneCustomDataDeleter();
+    void sceneCustomFieldDataDeleter();
+
+    void flatScene();
+    void flatSceneFallback3D();
+    void flatSceneFallback2D();
+    void flatSceneFallbackObjectFailed();
+    void flatSceneFallbackObjectOutOfRange();
+    void flatSceneFallbackObjectReferencedTwice();
+    void flatSceneOutOfRange();
 
     void animation();
     void animationNameNotImplemented();
@@ -275,6 +289,7 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::openData,
               &AbstractImporterTest::openFileAsData,
               &AbstractImporterTest::openFileAsDataNotFound,
+              &AbstractImporterTest::openFileAsDataZeroCopy,
 
               &AbstractImporterTest::openFileNotImplemented,
               &AbstractImporterTest::openDataNotSupported,
@@ -294,6 +309,9 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::setFileCallbackOpenFileThroughBaseImplementationFailed,
               &AbstractImporterTest::setFileCallbackOpenFileAsData,
               &AbstractImporterTest::setFileCallbackOpenFileAsDataFailed,
+              &AbstractImporterTest::setFileCallbackOpenFileAsDataZeroCopy,
+              &AbstractImporterTest::setFileCallbackOpenFileAsDataZeroCopyDestructor,
+              &AbstractImporterTest::setFileCallbackOpenFileAsDataZeroCopyFailed,
 
               &AbstractImporterTest::thingCountNotImplemented,
               &AbstractImporterTest::thingCountNoFile,
@@ -314,6 +332,16 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::sceneNameOutOfRange,
               &AbstractImporterTest::sceneNotImplemented,
               &AbstractImporterTest::sceneOutOfRange,
+              &AbstractImporterTest::sceneCustomDataDeleter,
+              &AbstractImporterTest::sceneCustomFieldDataDeleter,
+
+              &AbstractImporterTest::flatScene,
+              &AbstractImporterTest::flatSceneFallback3D,
+              &AbstractImporterTest::flatSceneFallback2D,
+              &AbstractImporterTest::flatSceneFallbackObjectFailed,
+              &AbstractImporterTest::flatSceneFallbackObjectOutOfRange,
+              &AbstractImporterTest::flatSceneFallbackObjectReferencedTwice,
+              &AbstractImporterTest::flatSceneOutOfRange,
 
               &AbstractImporterTest::animation,
               &AbstractImporterTest::animationNameNotImplemented,
@@ -585,6 +613,32 @@ void AbstractImporterTest::openFileAsData() {
     CORRADE_VERIFY(!importer.isOpened());
 }
 
+void AbstractImporterTest::openFileAsDataZeroCopy() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+        bool doIsOpened() const override { return !_in.empty(); }
+        void doClose() override { _in = nullptr; }
+
+        void doOpenData(Containers::ArrayView<const char> data) override {
+            _in = data;
+        }
+
+        /* Accessing the data after doOpenData() returned */
+        UnsignedInt doImage1DCount() const override { return _in[0] == '\xa5'; }
+
+        Containers::ArrayView<const char> _in;
+    } importer;
+
+    /* The file should be kept alive until the importer is closed (and ASan
+       should not complain about anything) */
+    importer.setFlags(ImporterFlag::ZeroCopy);
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(TRADE_TEST_DIR, "file.bin")));
+    CORRADE_COMPARE(importer.image1DCount(), 1);
+
+    importer.close();
+    CORRADE_VERIFY(!importer.isOpened());
+}
+
 void AbstractImporterTest::openFileAsDataNotFound() {
     struct Importer: AbstractImporter {
         ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
@@ -993,6 +1047,140 @@ void AbstractImporterTest::setFileCallbackOpenFileAsData() {
     CORRADE_VERIFY(!state.calledNotSureWhy);
 }
 
+void AbstractImporterTest::setFileCallbackOpenFileAsDataZeroCopy() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+        bool doIsOpened() const override { return _opened; }
+        void doClose() override { _opened = false; }
+
+        void doOpenData(Containers::ArrayView<const char> data) override {
+            _opened = (data.size() == 1 && data[0] == '\xb0');
+        }
+
+        bool _opened = false;
+    } importer;
+
+    struct State {
+        const char data = '\xb0';
+        AbstractImporter* importer;
+        Int loaded = 0;
+        Int closed = 0;
+        bool closedWhileOpened = false;
+        bool calledNotSureWhy = false;
+    } state;
+
+    /* With zero copy the data should be requested as permanent and the file
+       closed only once the importer is closed */
+    importer.setFlags(ImporterFlag::ZeroCopy);
+    importer.setFileCallback([](const std::string& filename, InputFileCallbackPolicy policy, State& state) -> Containers::Optional<Containers::ArrayView<const char>> {
+        if(filename == "file.dat" && policy == InputFileCallbackPolicy::LoadPermanent) {
+            ++state.loaded;
+            return Containers::arrayView(&state.data, 1);
+        }
+
+        if(filename == "file.dat" && policy == InputFileCallbackPolicy::Close) {
+            /* The implementation has to be closed first */
+            if(state.importer->isOpened()) state.closedWhileOpened = true;
+            ++state.closed;
+            return {};
+        }
+
+        state.calledNotSureWhy = true;
+        return {};
+    }, state);
+    state.importer = &importer;
+
+    CORRADE_VERIFY(importer.openFile("file.dat"));
+    CORRADE_COMPARE(state.loaded, 1);
+    CORRADE_COMPARE(state.closed, 0);
+
+    importer.close();
+    CORRADE_COMPARE(state.loaded, 1);
+    CORRADE_COMPARE(state.closed, 1);
+
+    /* Closing again doesn't call the callback again */
+    importer.close();
+    CORRADE_COMPARE(state.closed, 1);
+
+    /* Opening another file closes the previous one */
+    CORRADE_VERIFY(importer.openFile("file.dat"));
+    CORRADE_COMPARE(state.closed, 1);
+    CORRADE_VERIFY(importer.openFile("file.dat"));
+    CORRADE_COMPARE(state.loaded, 3);
+    CORRADE_COMPARE(state.closed, 2);
+    importer.close();
+    CORRADE_COMPARE(state.closed, 3);
+    CORRADE_VERIFY(!state.closedWhileOpened);
+    CORRADE_VERIFY(!state.calledNotSureWhy);
+}
+
+void AbstractImporterTest::setFileCallbackOpenFileAsDataZeroCopyDestructor() {
+    struct Importer: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+        bool doIsOpened() const override { return _opened; }
+        void doClose() override { _opened = false; }
+
+        void doOpenData(Containers::ArrayView<const char> data) override {
+            _opened = (data.size() == 1 && data[0] == '\xb0');
+        }
+
+        bool _opened = false;
+    };
+
+    struct State {
+        const char data = '\xb0';
+        Int closed = 0;
+    } state;
+
+    {
+        Importer importer;
+        importer.setFlags(ImporterFlag::ZeroCopy);
+        importer.setFileCallback([](const std::string&, InputFileCallbackPolicy policy, State& state) -> Containers::Optional<Containers::ArrayView<const char>> {
+            if(policy == InputFileCallbackPolicy::Close) {
+                ++state.closed;
+                return {};
+            }
+            return Containers::arrayView(&state.data, 1);
+        }, state);
+
+        CORRADE_VERIFY(importer.openFile("file.dat"));
+        CORRADE_COMPARE(state.closed, 0);
+    }
+
+    /* Destroying an importer with the file still opened closes it */
+    CORRADE_COMPARE(state.closed, 1);
+}
+
+void AbstractImporterTest::setFileCallbackOpenFileAsDataZeroCopyFailed() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+        void doOpenData(Containers::ArrayView<const char>) override {}
+    } importer;
+
+    struct State {
+        const char data = '\xb0';
+        Int closed = 0;
+    } state;
+
+    importer.setFlags(ImporterFlag::ZeroCopy);
+    importer.setFileCallback([](const std::string&, InputFileCallbackPolicy policy, State& state) -> Containers::Optional<Containers::ArrayView<const char>> {
+        if(policy == InputFileCallbackPolicy::Close) {
+            ++state.closed;
+            return {};
+        }
+        return Containers::arrayView(&state.data, 1);
+    }, state);
+
+    /* If the implementation fails to open the data, nothing references them
+       and the file is closed right away */
+    CORRADE_VERIFY(!importer.openFile("file.dat"));
+    CORRADE_COMPARE(state.closed, 1);
+    importer.close();
+    CORRADE_COMPARE(state.closed, 1);
+}
+
 void AbstractImporterTest::setFileCallbackOpenFileAsDataFailed() {
     struct: AbstractImporter {
         ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
@@ -1284,6 +1472,8 @@ void AbstractImporterTest::thingNoFile() {
     importer.defaultScene();
     importer.scene(42);
     importer.scene("foo");
+    importer.flatScene(42);
+    importer.flatScene("foo");
     importer.animation(42);
     importer.animation("foo");
     importer.light(42);
@@ -1316,6 +1506,8 @@ void AbstractImporterTest::thingNoFile() {
         "Trade::AbstractImporter::defaultScene(): no file opened\n"
         "Trade::AbstractImporter::scene(): no file opened\n"
         "Trade::AbstractImporter::scene(): no file opened\n"
+        "Trade::AbstractImporter::flatScene(): no file opened\n"
+        "Trade::AbstractImporter::flatScene(): no file opened\n"
         "Trade::AbstractImporter::animation(): no file opened\n"
         "Trade::AbstractImporter::animation(): no file opened\n"
         "Trade::AbstractImporter::light(): no file opened\n"
@@ -1477,6 +1669,309 @@ void AbstractImporterTest::sceneOutOfRange() {
     CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::scene(): index 8 out of range for 8 entries\n");
 }
 
+void AbstractImporterTest::sceneCustomDataDeleter() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doSceneCount() const override { return 1; }
+        Int doSceneForName(const std::string&) override { return 0; }
+        Containers::Optional<SceneData> doScene(UnsignedInt) override {
+            return SceneData{0, Containers::Array<char>{nullptr, 0, [](char*, std::size_t) {}}, {}};
+        }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    importer.scene(0);
+    importer.scene("");
+    CORRADE_COMPARE(out.str(),
+        "Trade::AbstractImporter::scene(): implementation is not allowed to use a custom Array deleter\n"
+        "Trade::AbstractImporter::scene(): implementation is not allowed to use a custom Array deleter\n");
+}
+
+void AbstractImporterTest::sceneCustomFieldDataDeleter() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doSceneCount() const override { return 1; }
+        Int doSceneForName(const std::string&) override { return 0; }
+        Containers::Optional<SceneData> doScene(UnsignedInt) override {
+            return SceneData{0, nullptr, Containers::Array<SceneFieldData>{nullptr, 0, [](SceneFieldData*, std::size_t) {}}};
+        }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    importer.scene(0);
+    importer.scene("");
+    CORRADE_COMPARE(out.str(),
+        "Trade::AbstractImporter::scene(): implementation is not allowed to use a custom Array deleter\n"
+        "Trade::AbstractImporter::scene(): implementation is not allowed to use a custom Array deleter\n");
+}
+
+void AbstractImporterTest::flatScene() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doSceneCount() const override { return 1; }
+        Int doSceneForName(const std::string& name) override {
+            if(name == "first") return 0;
+            return -1;
+        }
+        Containers::Optional<SceneData> doScene(UnsignedInt) override {
+            Containers::Array<char> data{3*sizeof(Int)};
+            Containers::ArrayView<Int> parents = Containers::arrayCast<Int>(data);
+            parents[0] = -1;
+            parents[1] = 0;
+            parents[2] = -1;
+            return SceneData{3, std::move(data), {
+                SceneFieldData{SceneField::Parent, parents}
+            }, &state};
+        }
+
+        /* Should not be called at all */
+        UnsignedInt doObject3DCount() const override {
+            CORRADE_VERIFY(false);
+            return 0;
+        }
+    } importer;
+
+    {
+        auto data = importer.flatScene(0);
+        CORRADE_VERIFY(data);
+        CORRADE_COMPARE(data->objectCount(), 3);
+        CORRADE_COMPARE(data->fieldCount(), 1);
+        CORRADE_COMPARE(data->children3D(), (std::vector<UnsignedInt>{0, 2}));
+        CORRADE_COMPARE(data->importerState(), &state);
+    } {
+        auto data = importer.flatScene("first");
+        CORRADE_VERIFY(data);
+        CORRADE_COMPARE(data->objectCount(), 3);
+        CORRADE_COMPARE(data->importerState(), &state);
+    }
+}
+
+void AbstractImporterTest::flatSceneFallback3D() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doSceneCount() const override { return 1; }
+        Containers::Optional<SceneData> doScene(UnsignedInt) override {
+            return SceneData{{}, {3, 0}, &state};
+        }
+
+        /* Object 1 is not part of the scene */
+        UnsignedInt doObject3DCount() const override { return 5; }
+        Containers::Pointer<ObjectData3D> doObject3D(UnsignedInt id) override {
+            if(id == 0)
+                return Containers::pointer(new MeshObjectData3D{{4}, Matrix4::translation(Vector3::xAxis(2.0f)), 7, 3});
+            if(id == 2)
+                return Containers::pointer(new ObjectData3D{{}, Vector3::yAxis(5.0f), Quaternion{}, Vector3{2.0f}, ObjectInstanceType3D::Light, 1});
+            if(id == 3)
+                return Containers::pointer(new ObjectData3D{{}, Matrix4::scaling(Vector3{3.0f}), ObjectInstanceType3D::Camera, 6});
+            if(id == 4)
+                return Containers::pointer(new ObjectData3D{{2}, Matrix4{}});
+            CORRADE_VERIFY(false);
+            return nullptr;
+        }
+    } importer;
+
+    auto data = importer.flatScene(0);
+    CORRADE_VERIFY(data);
+    CORRADE_VERIFY(!data->is2D());
+    CORRADE_COMPARE(data->objectCount(), 5);
+    CORRADE_COMPARE(data->fieldCount(), 6);
+    CORRADE_COMPARE(data->children2D(), std::vector<UnsignedInt>{});
+    CORRADE_COMPARE(data->children3D(), (std::vector<UnsignedInt>{3, 0}));
+    CORRADE_COMPARE(data->importerState(), &state);
+
+    Containers::Array<Int> parents = data->parentsAsArray();
+    CORRADE_COMPARE(parents[0], -1);
+    CORRADE_COMPARE(parents[1], -1);
+    CORRADE_COMPARE(parents[2], 4);
+    CORRADE_COMPARE(parents[3], -1);
+    CORRADE_COMPARE(parents[4], 0);
+
+    Containers::Array<Matrix4> transformations = data->transformations3DAsArray();
+    CORRADE_COMPARE(transformations[0], Matrix4::translation(Vector3::xAxis(2.0f)));
+    CORRADE_COMPARE(transformations[1], Matrix4{});
+    CORRADE_COMPARE(transformations[2], Matrix4::translation(Vector3::yAxis(5.0f))*Matrix4::scaling(Vector3{2.0f}));
+    CORRADE_COMPARE(transformations[3], Matrix4::scaling(Vector3{3.0f}));
+    CORRADE_COMPARE(transformations[4], Matrix4{});
+
+    Containers::Array<Int> meshes = data->meshesAsArray();
+    Containers::Array<Int> meshMaterials = data->meshMaterialsAsArray();
+    Containers::Array<Int> lights = data->lightsAsArray();
+    Containers::Array<Int> cameras = data->camerasAsArray();
+    CORRADE_COMPARE(meshes[0], 7);
+    CORRADE_COMPARE(meshMaterials[0], 3);
+    CORRADE_COMPARE(meshes[2], -1);
+    CORRADE_COMPARE(lights[2], 1);
+    CORRADE_COMPARE(lights[3], -1);
+    CORRADE_COMPARE(cameras[3], 6);
+    CORRADE_COMPARE(cameras[4], -1);
+    CORRADE_COMPARE(meshes[1], -1);
+    CORRADE_COMPARE(meshMaterials[1], -1);
+    CORRADE_COMPARE(lights[1], -1);
+    CORRADE_COMPARE(cameras[1], -1);
+}
+
+void AbstractImporterTest::flatSceneFallback2D() {
+    using namespace Math::Literals;
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doSceneCount() const override { return 1; }
+        Containers::Optional<SceneData> doScene(UnsignedInt) override {
+            return SceneData{{1}, {}};
+        }
+
+        UnsignedInt doObject2DCount() const override { return 2; }
+        Containers::Pointer<ObjectData2D> doObject2D(UnsignedInt id) override {
+            if(id == 0)
+                return Containers::pointer(new ObjectData2D{{}, Matrix3::rotation(90.0_degf), ObjectInstanceType2D::Camera, 2});
+            if(id == 1)
+                return Containers::pointer(new MeshObjectData2D{{0}, Matrix3::translation(Vector2::xAxis(2.0f)), 5, -1});
+            CORRADE_VERIFY(false);
+            return nullptr;
+        }
+    } importer;
+
+    auto data = importer.flatScene(0);
+    CORRADE_VERIFY(data);
+    CORRADE_VERIFY(data->is2D());
+    CORRADE_COMPARE(data->objectCount(), 2);
+    CORRADE_COMPARE(data->fieldCount(), 5);
+    CORRADE_VERIFY(!data->hasField(SceneField::Light));
+    CORRADE_COMPARE(data->children2D(), std::vector<UnsignedInt>{1});
+
+    Containers::Array<Int> parents = data->parentsAsArray();
+    CORRADE_COMPARE(parents[0], 1);
+    CORRADE_COMPARE(parents[1], -1);
+
+    Containers::Array<Matrix3> transformations = data->transformations2DAsArray();
+    CORRADE_COMPARE(transformations[0], Matrix3::rotation(90.0_degf));
+    CORRADE_COMPARE(transformations[1], Matrix3::translation(Vector2::xAxis(2.0f)));
+
+    Containers::Array<Int> meshes = data->meshesAsArray();
+    Containers::Array<Int> cameras = data->camerasAsArray();
+    CORRADE_COMPARE(meshes[0], -1);
+    CORRADE_COMPARE(meshes[1], 5);
+    CORRADE_COMPARE(data->meshMaterialsAsArray()[1], -1);
+    CORRADE_COMPARE(cameras[0], 2);
+    CORRADE_COMPARE(cameras[1], -1);
+}
+
+void AbstractImporterTest::flatSceneFallbackObjectFailed() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doSceneCount() const override { return 1; }
+        Containers::Optional<SceneData> doScene(UnsignedInt) override {
+            return SceneData{{}, {0}};
+        }
+
+        UnsignedInt doObject3DCount() const override { return 2; }
+        Containers::Pointer<ObjectData3D> doObject3D(UnsignedInt id) override {
+            if(id == 0)
+                return Containers::pointer(new ObjectData3D{{1}, Matrix4{}});
+            return nullptr;
+        }
+    } importer;
+
+    CORRADE_VERIFY(!importer.flatScene(0));
+}
+
+void AbstractImporterTest::flatSceneFallbackObjectOutOfRange() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doSceneCount() const override { return 1; }
+        Containers::Optional<SceneData> doScene(UnsignedInt) override {
+            return SceneData{{}, {0}};
+        }
+
+        UnsignedInt doObject3DCount() const override { return 2; }
+        Containers::Pointer<ObjectData3D> doObject3D(UnsignedInt) override {
+            return Containers::pointer(new ObjectData3D{{2}, Matrix4{}});
+        }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer.flatScene(0));
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::flatScene(): object 2 out of range for 2 objects\n");
+}
+
+void AbstractImporterTest::flatSceneFallbackObjectReferencedTwice() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doSceneCount() const override { return 1; }
+        Containers::Optional<SceneData> doScene(UnsignedInt) override {
+            return SceneData{{}, {0}};
+        }
+
+        /* A cycle */
+        UnsignedInt doObject3DCount() const override { return 2; }
+        Containers::Pointer<ObjectData3D> doObject3D(UnsignedInt id) override {
+            return Containers::pointer(new ObjectData3D{{id ? 0u : 1u}, Matrix4{}});
+        }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer.flatScene(0));
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::flatScene(): object 0 is referenced more than once\n");
+}
+
+void AbstractImporterTest::flatSceneOutOfRange() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doSceneCount() const override { return 8; }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    importer.flatScene(8);
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::flatScene(): index 8 out of range for 8 entries\n");
+}
+
 void AbstractImporterTest::animation() {
     struct: AbstractImporter {
         ImporterFeatures doFeatures() const override { return {}; }
@@ -4168,15 +4663,15 @@ void AbstractImporterTest::debugFeatures() {
 void AbstractImporterTest::debugFlag() {
     std::ostringstream out;
 
-    Debug{&out} << ImporterFlag::Verbose << ImporterFlag(0xf0);
-    CORRADE_COMPARE(out.str(), "Trade::ImporterFlag::Verbose Trade::ImporterFlag(0xf0)\n");
+    Debug{&out} << ImporterFlag::ZeroCopy << ImporterFlag(0xf0);
+    CORRADE_COMPARE(out.str(), "Trade::ImporterFlag::ZeroCopy Trade::ImporterFlag(0xf0)\n");
 }
 
 void AbstractImporterTest::debugFlags() {
     std::ostringstream out;
 
-    Debug{&out} << (ImporterFlag::Verbose|ImporterFlag(0xf0)) << ImporterFlags{};
-    CORRADE_COMPARE(out.str(), "Trade::ImporterFlag::Verbose|Trade::ImporterFlag(0xf0) Trade::ImporterFlags{}\n");
+    Debug{&out} << (ImporterFlag::Verbose|ImporterFlag::ZeroCopy|ImporterFlag(0xf0)) << ImporterFlags{};
+    CORRADE_COMPARE(out.str(), "Trade::ImporterFlag::Verbose|Trade::ImporterFlag::ZeroCopy|Trade::ImporterFlag(0xf0) Trade::ImporterFlags{}\n");
 }
 
 }}}}
@@ -35,6 +35,7 @@
 #include "Magnum/Trade/ArrayAllocator.h"
 #include "Magnum/Trade/AbstractSceneConverter.h"
 #include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
 
 #include "configure.h"
 
@@ -70,12 +71,34 @@ struct AbstractSceneConverterTest: TestSuite::Tester {
     void convertMeshToFileThroughDataNotWritable();
     void convertMeshToFileNotImplemented();
 
+    void convertScene();
+    void convertSceneNotImplemented();
+    void convertSceneNoFields();
+    void convertSceneCustomDataDeleter();
+
+    void convertSceneToData();
+    void convertSceneToDataNotImplemented();
+    void convertSceneToDataCustomDeleter();
+
+    void convertSceneToFile();
+    void convertSceneToFileThroughData();
+    void convertSceneToFileNotImplemented();
+
     void debugFeature();
     void debugFeatures();
     void debugFlag();
     void debugFlags();
 };
 
+SceneData rootScene(const UnsignedInt objectCount) {
+    Containers::Array<char> data{objectCount*sizeof(Int)};
+    Containers::ArrayView<Int> parents = Containers::arrayCast<Int>(data);
+    for(Int& i: parents) i = -1;
+    return SceneData{objectCount, std::move(data), {
+        SceneFieldData{SceneField::Parent, parents}
+    }};
+}
+
 AbstractSceneConverterTest::AbstractSceneConverterTest() {
     addTests({&AbstractSceneConverterTest::featuresNone,
 
@@ -104,6 +127,19 @@ AbstractSceneConverterTest::AbstractSceneConverterTest() {
               &AbstractSceneConverterTest::convertMeshToFileThroughDataNotWritable,
               &AbstractSceneConverterTest::convertMeshToFileNotImplemented,
 
+              &AbstractSceneConverterTest::convertScene,
+              &AbstractSceneConverterTest::convertSceneNotImplemented,
+              &AbstractSceneConverterTest::convertSceneNoFields,
+              &AbstractSceneConverterTest::convertSceneCustomDataDeleter,
+
+              &AbstractSceneConverterTest::convertSceneToData,
+              &AbstractSceneConverterTest::convertSceneToDataNotImplemented,
+              &AbstractSceneConverterTest::convertSceneToDataCustomDeleter,
+
+              &AbstractSceneConverterTest::convertSceneToFile,
+              &AbstractSceneConverterTest::convertSceneToFileThroughData,
+              &AbstractSceneConverterTest::convertSceneToFileNotImplemented,
+
               &AbstractSceneConverterTest::debugFeature,
               &AbstractSceneConverterTest::debugFeatures,
               &AbstractSceneConverterTest::debugFlag,
@@ -175,6 +211,7 @@ void AbstractSceneConverterTest::thingNotSupported() {
     } converter;
 
     MeshData mesh{MeshPrimitive::Triangles, 3};
+    SceneData scene = rootScene(3);
 
     std::ostringstream out;
     Error redirectError{&out};
@@ -182,11 +219,17 @@ void AbstractSceneConverterTest::thingNotSupported() {
     converter.convertInPlace(mesh);
     converter.convertToData(mesh);
     converter.convertToFile(Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "mesh.out"), mesh);
+    converter.convert(scene);
+    converter.convertToData(scene);
+    converter.convertToFile(Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "scene.out"), scene);
     CORRADE_COMPARE(out.str(),
         "Trade::AbstractSceneConverter::convert(): mesh conversion not supported\n"
         "Trade::AbstractSceneConverter::convertInPlace(): mesh conversion not supported\n"
         "Trade::AbstractSceneConverter::convertToData(): mesh conversion not supported\n"
-        "Trade::AbstractSceneConverter::convertToFile(): mesh conversion not supported\n");
+        "Trade::AbstractSceneConverter::convertToFile(): mesh conversion not supported\n"
+        "Trade::AbstractSceneConverter::convert(): scene conversion not supported\n"
+        "Trade::AbstractSceneConverter::convertToData(): scene conversion not supported\n"
+        "Trade::AbstractSceneConverter::convertToFile(): scene conversion not supported\n");
 }
 
 void AbstractSceneConverterTest::convertMesh() {
@@ -491,6 +534,180 @@ void AbstractSceneConverterTest::convertMeshToFileNotImplemented() {
     CORRADE_COMPARE(out.str(), "Trade::AbstractSceneConverter::convertToFile(): mesh conversion advertised but not implemented\n");
 }
 
+void AbstractSceneConverterTest::convertScene() {
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override { return SceneConverterFeature::ConvertScene; }
+
+        Containers::Optional<SceneData> doConvert(const SceneData& scene) override {
+            return rootScene(scene.objectCount()*2);
+        }
+    } converter;
+
+    Containers::Optional<SceneData> out = converter.convert(rootScene(3));
+    CORRADE_VERIFY(out);
+    CORRADE_COMPARE(out->objectCount(), 6);
+    CORRADE_COMPARE(out->children3D().size(), 6);
+}
+
+void AbstractSceneConverterTest::convertSceneNotImplemented() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override { return SceneConverterFeature::ConvertScene; }
+    } converter;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    converter.convert(rootScene(3));
+    CORRADE_COMPARE(out.str(), "Trade::AbstractSceneConverter::convert(): scene conversion advertised but not implemented\n");
+}
+
+void AbstractSceneConverterTest::convertSceneNoFields() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override {
+            return SceneConverterFeature::ConvertScene|SceneConverterFeature::ConvertSceneToData;
+        }
+    } converter;
+
+    SceneData scene{{}, {0, 1}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    converter.convert(scene);
+    converter.convertToData(scene);
+    converter.convertToFile(Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "scene.out"), scene);
+    CORRADE_COMPARE(out.str(),
+        "Trade::AbstractSceneConverter::convert(): the scene has no per-object fields\n"
+        "Trade::AbstractSceneConverter::convertToData(): the scene has no per-object fields\n"
+        "Trade::AbstractSceneConverter::convertToFile(): the scene has no per-object fields\n");
+}
+
+void AbstractSceneConverterTest::convertSceneCustomDataDeleter() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override { return SceneConverterFeature::ConvertScene; }
+
+        Containers::Optional<SceneData> doConvert(const SceneData&) override {
+            return SceneData{0, Containers::Array<char>{data, 1, [](char*, std::size_t) {}}, {}};
+        }
+
+        char data[1];
+    } converter;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    converter.convert(rootScene(3));
+    CORRADE_COMPARE(out.str(),
+        "Trade::AbstractSceneConverter::convert(): implementation is not allowed to use a custom Array deleter\n");
+}
+
+void AbstractSceneConverterTest::convertSceneToData() {
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override { return SceneConverterFeature::ConvertSceneToData; }
+
+        Containers::Array<char> doConvertToData(const SceneData& scene) override {
+            return Containers::Array<char>{nullptr, scene.objectCount()};
+        }
+    } converter;
+
+    Containers::Array<char> data = converter.convertToData(rootScene(6));
+    CORRADE_COMPARE(data.size(), 6);
+}
+
+void AbstractSceneConverterTest::convertSceneToDataNotImplemented() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override { return SceneConverterFeature::ConvertSceneToData; }
+    } converter;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    converter.convertToData(rootScene(6));
+    CORRADE_COMPARE(out.str(), "Trade::AbstractSceneConverter::convertToData(): scene conversion advertised but not implemented\n");
+}
+
+void AbstractSceneConverterTest::convertSceneToDataCustomDeleter() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override { return SceneConverterFeature::ConvertSceneToData; }
+
+        Containers::Array<char> doConvertToData(const SceneData&) override {
+            return Containers::Array<char>{data, 1, [](char*, std::size_t) {}};
+        }
+
+        char data[1];
+    } converter;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    converter.convertToData(rootScene(6));
+    CORRADE_COMPARE(out.str(), "Trade::AbstractSceneConverter::convertToData(): implementation is not allowed to use a custom Array deleter\n");
+}
+
+void AbstractSceneConverterTest::convertSceneToFile() {
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override { return SceneConverterFeature::ConvertSceneToFile; }
+
+        bool doConvertToFile(const std::string& filename, const SceneData& scene) override {
+            return Utility::Directory::write(filename, Containers::arrayView({char(scene.objectCount())}));
+        }
+    } converter;
+
+    /* Remove previous file */
+    Utility::Directory::rm(Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "scene.out"));
+
+    CORRADE_VERIFY(converter.convertToFile(Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "scene.out"), rootScene(0x3f)));
+    CORRADE_COMPARE_AS(Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "scene.out"),
+        "\x3f", TestSuite::Compare::FileToString);
+}
+
+void AbstractSceneConverterTest::convertSceneToFileThroughData() {
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override { return SceneConverterFeature::ConvertSceneToData; }
+
+        Containers::Array<char> doConvertToData(const SceneData& scene) override {
+            return Containers::array({char(scene.objectCount())});
+        }
+    } converter;
+
+    /* Remove previous file */
+    Utility::Directory::rm(Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "scene.out"));
+
+    CORRADE_VERIFY(converter.convertToFile(Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "scene.out"), rootScene(0x3f)));
+    CORRADE_COMPARE_AS(Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "scene.out"),
+        "\x3f", TestSuite::Compare::FileToString);
+}
+
+void AbstractSceneConverterTest::convertSceneToFileNotImplemented() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override { return SceneConverterFeature::ConvertSceneToFile; }
+    } converter;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    converter.convertToFile(Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "scene.out"), rootScene(6));
+    CORRADE_COMPARE(out.str(), "Trade::AbstractSceneConverter::convertToFile(): scene conversion advertised but not implemented\n");
+}
+
 void AbstractSceneConverterTest::debugFeature() {
     std::ostringstream out;
 
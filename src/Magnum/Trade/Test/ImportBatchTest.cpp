@@ -0,0 +1,667 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImportBatch.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+
+static void importStaticPlugin() {
+    CORRADE_PLUGIN_IMPORT(ImportBatchTestImporter)
+}
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct ImportBatchTest: TestSuite::Tester {
+    explicit ImportBatchTest();
+
+    void construct();
+    void constructPluginNotFound();
+
+    void image1D();
+    void image2D();
+    void image3D();
+    void mesh();
+    void material();
+    void mixed();
+
+    void completionCallback();
+    void openFailed();
+    void importFailed();
+    void reuse();
+
+    void setFlags();
+    void setFlagsOpened();
+    void importerNoInstances();
+    void openNoInstances();
+
+    void addImage1DNotOpened();
+    void addImage1DOutOfRange();
+    void addImage2DNotOpened();
+    void addImage2DOutOfRange();
+    void addImage3DNotOpened();
+    void addImage3DOutOfRange();
+    void addMeshNotOpened();
+    void addMeshOutOfRange();
+    void addMaterialNotOpened();
+    void addMaterialOutOfRange();
+    void executeNotOpened();
+
+    PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+};
+
+constexpr struct {
+    const char* name;
+    UnsignedInt threadCount;
+} ThreadData[] {
+    {"single thread", 1},
+    {"four threads", 4}
+};
+
+constexpr const char Data[]{'B'};
+
+ImportBatchTest::ImportBatchTest() {
+    addInstancedTests({&ImportBatchTest::construct},
+        Containers::arraySize(ThreadData));
+
+    addTests({&ImportBatchTest::constructPluginNotFound});
+
+    addInstancedTests({&ImportBatchTest::image1D,
+                       &ImportBatchTest::image2D,
+                       &ImportBatchTest::image3D,
+                       &ImportBatchTest::mesh,
+                       &ImportBatchTest::material,
+                       &ImportBatchTest::mixed,
+
+                       &ImportBatchTest::completionCallback,
+                       &ImportBatchTest::openFailed,
+                       &ImportBatchTest::importFailed,
+                       &ImportBatchTest::reuse},
+        Containers::arraySize(ThreadData));
+
+    addTests({&ImportBatchTest::setFlags,
+              &ImportBatchTest::setFlagsOpened,
+              &ImportBatchTest::importerNoInstances,
+              &ImportBatchTest::openNoInstances,
+
+              &ImportBatchTest::addImage1DNotOpened,
+              &ImportBatchTest::addImage1DOutOfRange,
+              &ImportBatchTest::addImage2DNotOpened,
+              &ImportBatchTest::addImage2DOutOfRange,
+              &ImportBatchTest::addImage3DNotOpened,
+              &ImportBatchTest::addImage3DOutOfRange,
+              &ImportBatchTest::addMeshNotOpened,
+              &ImportBatchTest::addMeshOutOfRange,
+              &ImportBatchTest::addMaterialNotOpened,
+              &ImportBatchTest::addMaterialOutOfRange,
+              &ImportBatchTest::executeNotOpened});
+
+    importStaticPlugin();
+}
+
+void ImportBatchTest::construct() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", data.threadCount};
+    #if defined(CORRADE_BUILD_MULTITHREADED) && (!defined(CORRADE_TARGET_EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__))
+    CORRADE_COMPARE(batch.threadCount(), data.threadCount);
+    #else
+    CORRADE_COMPARE(batch.threadCount(), 1);
+    #endif
+    CORRADE_COMPARE(batch.importers().size(), batch.threadCount());
+    CORRADE_COMPARE(&batch.importer(), batch.importers()[0].get());
+    CORRADE_COMPARE(batch.flags(), ImporterFlags{});
+    CORRADE_VERIFY(!batch.isOpened());
+    CORRADE_COMPARE(batch.requestCount(), 0);
+
+    CORRADE_VERIFY(batch.openData(Data));
+    CORRADE_VERIFY(batch.isOpened());
+    for(const Containers::Pointer<AbstractImporter>& importer: batch.importers()) {
+        CORRADE_VERIFY(importer->isOpened());
+        CORRADE_COMPARE(importer->flags(), ImporterFlag::ZeroCopy);
+    }
+
+    batch.close();
+    CORRADE_VERIFY(!batch.isOpened());
+    for(const Containers::Pointer<AbstractImporter>& importer: batch.importers())
+        CORRADE_VERIFY(!importer->isOpened());
+}
+
+void ImportBatchTest::constructPluginNotFound() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    ImportBatch batch{_manager, "NonexistentImporter", 1};
+    CORRADE_COMPARE(batch.threadCount(), 0);
+    CORRADE_VERIFY(batch.importers().empty());
+    CORRADE_VERIFY(!out.str().empty());
+}
+
+void ImportBatchTest::image1D() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", data.threadCount};
+    CORRADE_VERIFY(batch.openData(Data));
+
+    Containers::Optional<ImageData1D> a, b, c;
+    batch.addImage1D(0, a)
+         .addImage1D(1, b, 1)
+         .addImage1D(1, c);
+    CORRADE_COMPARE(batch.requestCount(), 3);
+    CORRADE_VERIFY(batch.execute());
+    CORRADE_COMPARE(batch.requestCount(), 0);
+
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(a->size(), 1);
+    CORRADE_COMPARE(Int(a->data()[0]), 0*16 + 0);
+    CORRADE_VERIFY(b);
+    CORRADE_COMPARE(Int(b->data()[0]), 1*16 + 1);
+    CORRADE_VERIFY(c);
+    CORRADE_COMPARE(Int(c->data()[0]), 1*16 + 0);
+}
+
+void ImportBatchTest::image2D() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", data.threadCount};
+    CORRADE_VERIFY(batch.openData(Data));
+
+    Containers::Optional<ImageData2D> a, b;
+    batch.addImage2D(1, a)
+         .addImage2D(0, b);
+    CORRADE_COMPARE(batch.requestCount(), 2);
+    CORRADE_VERIFY(batch.execute());
+    CORRADE_COMPARE(batch.requestCount(), 0);
+
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(a->size(), Vector2i{1});
+    CORRADE_COMPARE(Int(a->data()[0]), 1*16 + 0);
+    CORRADE_VERIFY(b);
+    CORRADE_COMPARE(Int(b->data()[0]), 0*16 + 0);
+}
+
+void ImportBatchTest::image3D() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", data.threadCount};
+    CORRADE_VERIFY(batch.openData(Data));
+
+    Containers::Optional<ImageData3D> a, b, c;
+    batch.addImage3D(0, a, 2)
+         .addImage3D(0, b)
+         .addImage3D(0, c, 1);
+    CORRADE_COMPARE(batch.requestCount(), 3);
+    CORRADE_VERIFY(batch.execute());
+    CORRADE_COMPARE(batch.requestCount(), 0);
+
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(a->size(), Vector3i{1});
+    CORRADE_COMPARE(Int(a->data()[0]), 0*16 + 2);
+    CORRADE_VERIFY(b);
+    CORRADE_COMPARE(Int(b->data()[0]), 0*16 + 0);
+    CORRADE_VERIFY(c);
+    CORRADE_COMPARE(Int(c->data()[0]), 0*16 + 1);
+}
+
+void ImportBatchTest::mesh() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", data.threadCount};
+    CORRADE_VERIFY(batch.openData(Data));
+
+    Containers::Optional<MeshData> a, b, c;
+    batch.addMesh(1, a, 2)
+         .addMesh(0, b)
+         .addMesh(1, c);
+    CORRADE_COMPARE(batch.requestCount(), 3);
+    CORRADE_VERIFY(batch.execute());
+    CORRADE_COMPARE(batch.requestCount(), 0);
+
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(a->primitive(), MeshPrimitive::Points);
+    CORRADE_COMPARE(a->vertexCount(), 1*16 + 2);
+    CORRADE_VERIFY(b);
+    CORRADE_COMPARE(b->vertexCount(), 0*16 + 0);
+    CORRADE_VERIFY(c);
+    CORRADE_COMPARE(c->vertexCount(), 1*16 + 0);
+}
+
+void ImportBatchTest::material() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", data.threadCount};
+    CORRADE_VERIFY(batch.openData(Data));
+
+    Containers::Optional<MaterialData> a, b;
+    batch.addMaterial(1, a)
+         .addMaterial(0, b);
+    CORRADE_COMPARE(batch.requestCount(), 2);
+    CORRADE_VERIFY(batch.execute());
+    CORRADE_COMPARE(batch.requestCount(), 0);
+
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(a->types(), MaterialType::Phong);
+    CORRADE_COMPARE(a->attribute<Float>(MaterialAttribute::Shininess), 1.0f);
+    CORRADE_VERIFY(b);
+    CORRADE_COMPARE(b->attribute<Float>(MaterialAttribute::Shininess), 0.0f);
+}
+
+void ImportBatchTest::mixed() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", data.threadCount};
+    CORRADE_VERIFY(batch.openData(Data));
+
+    /* Many requests of all types interleaved, so each thread gets to process
+       several of them */
+    Containers::Array<Containers::Optional<ImageData1D>> images1D{8};
+    Containers::Array<Containers::Optional<ImageData2D>> images2D{8};
+    Containers::Array<Containers::Optional<ImageData3D>> images3D{8};
+    Containers::Array<Containers::Optional<MeshData>> meshes{8};
+    Containers::Array<Containers::Optional<MaterialData>> materials{8};
+    for(UnsignedInt i = 0; i != 8; ++i) {
+        batch.addImage1D(1, images1D[i], i % 2)
+             .addImage2D(i % 2, images2D[i])
+             .addImage3D(0, images3D[i], i % 3)
+             .addMesh(1, meshes[i], i % 3)
+             .addMaterial(i % 2, materials[i]);
+    }
+    CORRADE_COMPARE(batch.requestCount(), 40);
+    CORRADE_VERIFY(batch.execute());
+    CORRADE_COMPARE(batch.requestCount(), 0);
+
+    for(UnsignedInt i = 0; i != 8; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(images1D[i]);
+        CORRADE_COMPARE(Int(images1D[i]->data()[0]), Int(1*16 + i % 2));
+        CORRADE_VERIFY(images2D[i]);
+        CORRADE_COMPARE(Int(images2D[i]->data()[0]), Int((i % 2)*16));
+        CORRADE_VERIFY(images3D[i]);
+        CORRADE_COMPARE(Int(images3D[i]->data()[0]), Int(i % 3));
+        CORRADE_VERIFY(meshes[i]);
+        CORRADE_COMPARE(meshes[i]->vertexCount(), 1*16 + i % 3);
+        CORRADE_VERIFY(materials[i]);
+        CORRADE_COMPARE(materials[i]->attribute<Float>(MaterialAttribute::Shininess), Float(i % 2));
+    }
+}
+
+void ImportBatchTest::completionCallback() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", data.threadCount};
+    CORRADE_VERIFY(batch.openData(Data));
+
+    /* The last request fails */
+    Containers::Array<Containers::Optional<ImageData2D>> images{8};
+    for(std::size_t i = 0; i != images.size(); ++i)
+        batch.addImage2D(i == images.size() - 1 ? 2 : 0, images[i]);
+
+    struct State {
+        /* Each request has its own element, so these don't need to be
+           atomic */
+        Containers::Array<Containers::Optional<ImageData2D>>* images;
+        Containers::Array<int> finished;
+        std::atomic<std::size_t> count;
+    } state{&images, Containers::Array<int>{Containers::ValueInit, 8}, {0}};
+    batch.setCompletionCallback([](std::size_t request, bool success, void* userData) {
+        State& state = *static_cast<State*>(userData);
+        /* The slot should be already filled when the callback is called */
+        state.finished[request] = success && (*state.images)[request] ? 1 : -1;
+        ++state.count;
+    }, &state);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!batch.execute());
+    CORRADE_COMPARE(state.count.load(), 8);
+    for(std::size_t i = 0; i != state.finished.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(state.finished[i], i == 7 ? -1 : 1);
+    }
+}
+
+void ImportBatchTest::openFailed() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", data.threadCount};
+
+    /* The error should be printed just once, not for every thread */
+    std::ostringstream out;
+    Error redirectError{&out};
+    const char invalid[]{'X'};
+    CORRADE_VERIFY(!batch.openData(invalid));
+    CORRADE_VERIFY(!batch.isOpened());
+    for(const Containers::Pointer<AbstractImporter>& importer: batch.importers())
+        CORRADE_VERIFY(!importer->isOpened());
+    CORRADE_COMPARE(out.str(), "ImportBatchTestImporter::openData(): invalid data\n");
+}
+
+void ImportBatchTest::importFailed() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", data.threadCount};
+    CORRADE_VERIFY(batch.openData(Data));
+
+    Containers::Optional<ImageData2D> a, b;
+    Containers::Optional<MeshData> c;
+    batch.addImage2D(0, a)
+         .addImage2D(2, b)
+         .addMesh(0, c);
+
+    /* The failure doesn't affect the other requests */
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!batch.execute());
+    CORRADE_COMPARE(batch.requestCount(), 0);
+    CORRADE_VERIFY(a);
+    CORRADE_VERIFY(!b);
+    CORRADE_VERIFY(c);
+    CORRADE_COMPARE(out.str(), "ImportBatchTestImporter::image2D(): failing on purpose\n");
+}
+
+void ImportBatchTest::reuse() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", data.threadCount};
+    CORRADE_VERIFY(batch.openData(Data));
+
+    Containers::Optional<ImageData2D> a;
+    CORRADE_VERIFY(batch.addImage2D(1, a).execute());
+    CORRADE_VERIFY(a);
+
+    /* Another set of requests on the same input */
+    Containers::Optional<MeshData> b;
+    CORRADE_VERIFY(batch.addMesh(1, b, 1).execute());
+    CORRADE_VERIFY(b);
+    CORRADE_COMPARE(b->vertexCount(), 1*16 + 1);
+
+    /* Closing discards pending requests */
+    Containers::Optional<MeshData> c;
+    batch.addMesh(0, c);
+    batch.close();
+    CORRADE_COMPARE(batch.requestCount(), 0);
+
+    /* And the batch can be opened again */
+    CORRADE_VERIFY(batch.openData(Data));
+    CORRADE_VERIFY(batch.addMesh(0, c).execute());
+    CORRADE_VERIFY(c);
+}
+
+void ImportBatchTest::setFlags() {
+    ImportBatch batch{_manager, "ImportBatchTestImporter", 2};
+    batch.setFlags(ImporterFlag::Verbose);
+    CORRADE_COMPARE(batch.flags(), ImporterFlag::Verbose);
+
+    /* The flags get propagated to all instances on open, together with
+       ZeroCopy */
+    CORRADE_VERIFY(batch.openData(Data));
+    for(const Containers::Pointer<AbstractImporter>& importer: batch.importers())
+        CORRADE_COMPARE(importer->flags(), ImporterFlag::Verbose|ImporterFlag::ZeroCopy);
+}
+
+void ImportBatchTest::setFlagsOpened() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", 1};
+    CORRADE_VERIFY(batch.openData(Data));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    batch.setFlags(ImporterFlag::Verbose);
+    CORRADE_COMPARE(batch.flags(), ImporterFlags{});
+    CORRADE_COMPARE(out.str(), "Trade::ImportBatch::setFlags(): can't be set while a file is opened\n");
+}
+
+void ImportBatchTest::importerNoInstances() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    ImportBatch batch{_manager, "NonexistentImporter", 1};
+    CORRADE_COMPARE(batch.threadCount(), 0);
+
+    out.str({});
+    batch.importer();
+    CORRADE_COMPARE(out.str(), "Trade::ImportBatch::importer(): no importer instances\n");
+}
+
+void ImportBatchTest::openNoInstances() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    ImportBatch batch{_manager, "NonexistentImporter", 1};
+    CORRADE_COMPARE(batch.threadCount(), 0);
+
+    out.str({});
+    CORRADE_VERIFY(!batch.openData(Data));
+    CORRADE_VERIFY(!batch.isOpened());
+    CORRADE_COMPARE(out.str(), "Trade::ImportBatch: no importer instances\n");
+}
+
+void ImportBatchTest::addImage1DNotOpened() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", 1};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Containers::Optional<ImageData1D> image;
+    batch.addImage1D(0, image);
+    CORRADE_COMPARE(batch.requestCount(), 0);
+    CORRADE_COMPARE(out.str(), "Trade::ImportBatch::addImage1D(): no file opened\n");
+}
+
+void ImportBatchTest::addImage1DOutOfRange() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", 1};
+    CORRADE_VERIFY(batch.openData(Data));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Containers::Optional<ImageData1D> image;
+    batch.addImage1D(2, image)
+         .addImage1D(1, image, 2);
+    CORRADE_COMPARE(batch.requestCount(), 0);
+    CORRADE_COMPARE(out.str(),
+        "Trade::ImportBatch::addImage1D(): index 2 out of range for 2 entries\n"
+        "Trade::ImportBatch::addImage1D(): level 2 out of range for 2 entries\n");
+}
+
+void ImportBatchTest::addImage2DNotOpened() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", 1};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Containers::Optional<ImageData2D> image;
+    batch.addImage2D(0, image);
+    CORRADE_COMPARE(batch.requestCount(), 0);
+    CORRADE_COMPARE(out.str(), "Trade::ImportBatch::addImage2D(): no file opened\n");
+}
+
+void ImportBatchTest::addImage2DOutOfRange() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", 1};
+    CORRADE_VERIFY(batch.openData(Data));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Containers::Optional<ImageData2D> image;
+    batch.addImage2D(3, image)
+         .addImage2D(0, image, 1);
+    CORRADE_COMPARE(batch.requestCount(), 0);
+    CORRADE_COMPARE(out.str(),
+        "Trade::ImportBatch::addImage2D(): index 3 out of range for 3 entries\n"
+        "Trade::ImportBatch::addImage2D(): level 1 out of range for 1 entries\n");
+}
+
+void ImportBatchTest::addImage3DNotOpened() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", 1};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Containers::Optional<ImageData3D> image;
+    batch.addImage3D(0, image);
+    CORRADE_COMPARE(batch.requestCount(), 0);
+    CORRADE_COMPARE(out.str(), "Trade::ImportBatch::addImage3D(): no file opened\n");
+}
+
+void ImportBatchTest::addImage3DOutOfRange() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", 1};
+    CORRADE_VERIFY(batch.openData(Data));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Containers::Optional<ImageData3D> image;
+    batch.addImage3D(1, image)
+         .addImage3D(0, image, 3);
+    CORRADE_COMPARE(batch.requestCount(), 0);
+    CORRADE_COMPARE(out.str(),
+        "Trade::ImportBatch::addImage3D(): index 1 out of range for 1 entries\n"
+        "Trade::ImportBatch::addImage3D(): level 3 out of range for 3 entries\n");
+}
+
+void ImportBatchTest::addMeshNotOpened() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", 1};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Containers::Optional<MeshData> mesh;
+    batch.addMesh(0, mesh);
+    CORRADE_COMPARE(batch.requestCount(), 0);
+    CORRADE_COMPARE(out.str(), "Trade::ImportBatch::addMesh(): no file opened\n");
+}
+
+void ImportBatchTest::addMeshOutOfRange() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", 1};
+    CORRADE_VERIFY(batch.openData(Data));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Containers::Optional<MeshData> mesh;
+    batch.addMesh(2, mesh)
+         .addMesh(1, mesh, 3);
+    CORRADE_COMPARE(batch.requestCount(), 0);
+    CORRADE_COMPARE(out.str(),
+        "Trade::ImportBatch::addMesh(): index 2 out of range for 2 entries\n"
+        "Trade::ImportBatch::addMesh(): level 3 out of range for 3 entries\n");
+}
+
+void ImportBatchTest::addMaterialNotOpened() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", 1};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Containers::Optional<MaterialData> material;
+    batch.addMaterial(0, material);
+    CORRADE_COMPARE(batch.requestCount(), 0);
+    CORRADE_COMPARE(out.str(), "Trade::ImportBatch::addMaterial(): no file opened\n");
+}
+
+void ImportBatchTest::addMaterialOutOfRange() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", 1};
+    CORRADE_VERIFY(batch.openData(Data));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Containers::Optional<MaterialData> material;
+    batch.addMaterial(2, material);
+    CORRADE_COMPARE(batch.requestCount(), 0);
+    CORRADE_COMPARE(out.str(), "Trade::ImportBatch::addMaterial(): index 2 out of range for 2 entries\n");
+}
+
+void ImportBatchTest::executeNotOpened() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    ImportBatch batch{_manager, "ImportBatchTestImporter", 1};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!batch.execute());
+    CORRADE_COMPARE(out.str(), "Trade::ImportBatch::execute(): no file opened\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::ImportBatchTest)
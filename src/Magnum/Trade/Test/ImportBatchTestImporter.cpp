@@ -0,0 +1,103 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/PluginManager/AbstractManager.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+/* Importer for ImportBatchTest, with contents of each image and mesh derived
+   from its ID and level so the results can be verified. Data starting with
+   anything else than `B` fail to open. */
+struct ImportBatchTestImporter: AbstractImporter {
+    explicit ImportBatchTestImporter(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractImporter{manager, plugin} {}
+
+    ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+    bool doIsOpened() const override { return _opened; }
+    void doClose() override { _opened = false; }
+
+    void doOpenData(const Containers::ArrayView<const char> data) override {
+        if(data.empty() || data[0] != 'B') {
+            Error{} << "ImportBatchTestImporter::openData(): invalid data";
+            return;
+        }
+        _opened = true;
+    }
+
+    UnsignedInt doImage1DCount() const override { return 2; }
+    UnsignedInt doImage1DLevelCount(UnsignedInt id) override { return id == 1 ? 2 : 1; }
+    Containers::Optional<ImageData1D> doImage1D(UnsignedInt id, UnsignedInt level) override {
+        return image<1>(id, level);
+    }
+
+    /* The last 2D image fails to import */
+    UnsignedInt doImage2DCount() const override { return 3; }
+    Containers::Optional<ImageData2D> doImage2D(UnsignedInt id, UnsignedInt level) override {
+        if(id == 2) {
+            Error{} << "ImportBatchTestImporter::image2D(): failing on purpose";
+            return {};
+        }
+        return image<2>(id, level);
+    }
+
+    UnsignedInt doImage3DCount() const override { return 1; }
+    UnsignedInt doImage3DLevelCount(UnsignedInt) override { return 3; }
+    Containers::Optional<ImageData3D> doImage3D(UnsignedInt id, UnsignedInt level) override {
+        return image<3>(id, level);
+    }
+
+    UnsignedInt doMeshCount() const override { return 2; }
+    UnsignedInt doMeshLevelCount(UnsignedInt id) override { return id == 1 ? 3 : 1; }
+    Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt level) override {
+        return MeshData{MeshPrimitive::Points, id*16 + level};
+    }
+
+    UnsignedInt doMaterialCount() const override { return 2; }
+    Containers::Optional<MaterialData> doMaterial(UnsignedInt id) override {
+        return MaterialData{MaterialType::Phong, {
+            {MaterialAttribute::Shininess, Float(id)}
+        }};
+    }
+
+    /* A single RGBA8 pixel with the first byte being id*16 + level */
+    template<UnsignedInt dimensions> static ImageData<dimensions> image(UnsignedInt id, UnsignedInt level) {
+        Containers::Array<char> data{Containers::ValueInit, 4};
+        data[0] = id*16 + level;
+        return ImageData<dimensions>{PixelFormat::RGBA8Unorm, Math::Vector<dimensions, Int>{1}, std::move(data)};
+    }
+
+    bool _opened{};
+};
+
+}}}}
+
+CORRADE_PLUGIN_REGISTER(ImportBatchTestImporter, Magnum::Trade::Test::ImportBatchTestImporter,
+    "cz.mosra.magnum.Trade.AbstractImporter/0.3.4")
@@ -23,9 +23,16 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstddef>
+#include <sstream>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
 
-#include "Magnum/Magnum.h"
+#include "Magnum/Math/Complex.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Quaternion.h"
 #include "Magnum/Trade/SceneData.h"
 
 namespace Magnum { namespace Trade { namespace Test { namespace {
@@ -33,15 +40,197 @@ namespace Magnum { namespace Trade { namespace Test { namespace {
 struct SceneDataTest: TestSuite::Tester {
     explicit SceneDataTest();
 
+    void fieldTypeSize();
+    void fieldTypeSizeInvalid();
+    void debugFieldName();
+    void debugFieldType();
+
+    void constructField();
+    void constructFieldTypeErased();
+    void constructFieldWrongType();
+    void constructFieldWrongStride();
+
     void construct();
+    void constructFields();
+    void constructFields2D();
+    void constructFieldsNoParents();
+    void constructFieldsExplicitChildren();
+    void constructFieldsNotContained();
+    void constructFieldsWrongObjectCount();
+    void constructFieldsDuplicate();
+    void constructFieldsDimensionMismatch();
+    void constructFieldsNoType();
     void constructCopy();
     void constructMove();
+
+    void fieldAccess();
+    void fieldAccessWrongType();
+    void fieldAccessNotFound();
+    void fieldAccessOutOfRange();
+
+    void parentsAsArray();
+    void indexFieldsAsArray();
+    void indexFieldsAsArrayNotPresent();
+    void indexFieldsIntoWrongSize();
+
+    void transformations3DAsArray();
+    void transformations3DAsArrayTRS();
+    void transformations3DAsArrayNotPresent();
+    void transformations2DAsArray();
+    void transformations2DAsArrayTRS();
+    void transformationsAsArrayWrongDimensions();
+    void transformationsIntoWrongSize();
+
+    void releaseData();
+    void releaseFieldData();
 };
 
 SceneDataTest::SceneDataTest() {
-    addTests({&SceneDataTest::construct,
+    addTests({&SceneDataTest::fieldTypeSize,
+              &SceneDataTest::fieldTypeSizeInvalid,
+              &SceneDataTest::debugFieldName,
+              &SceneDataTest::debugFieldType,
+
+              &SceneDataTest::constructField,
+              &SceneDataTest::constructFieldTypeErased,
+              &SceneDataTest::constructFieldWrongType,
+              &SceneDataTest::constructFieldWrongStride,
+
+              &SceneDataTest::construct,
+              &SceneDataTest::constructFields,
+              &SceneDataTest::constructFields2D,
+              &SceneDataTest::constructFieldsNoParents,
+              &SceneDataTest::constructFieldsExplicitChildren,
+              &SceneDataTest::constructFieldsNotContained,
+              &SceneDataTest::constructFieldsWrongObjectCount,
+              &SceneDataTest::constructFieldsDuplicate,
+              &SceneDataTest::constructFieldsDimensionMismatch,
+              &SceneDataTest::constructFieldsNoType,
               &SceneDataTest::constructCopy,
-              &SceneDataTest::constructMove});
+              &SceneDataTest::constructMove,
+
+              &SceneDataTest::fieldAccess,
+              &SceneDataTest::fieldAccessWrongType,
+              &SceneDataTest::fieldAccessNotFound,
+              &SceneDataTest::fieldAccessOutOfRange,
+
+              &SceneDataTest::parentsAsArray,
+              &SceneDataTest::indexFieldsAsArray,
+              &SceneDataTest::indexFieldsAsArrayNotPresent,
+              &SceneDataTest::indexFieldsIntoWrongSize,
+
+              &SceneDataTest::transformations3DAsArray,
+              &SceneDataTest::transformations3DAsArrayTRS,
+              &SceneDataTest::transformations3DAsArrayNotPresent,
+              &SceneDataTest::transformations2DAsArray,
+              &SceneDataTest::transformations2DAsArrayTRS,
+              &SceneDataTest::transformationsAsArrayWrongDimensions,
+              &SceneDataTest::transformationsIntoWrongSize,
+
+              &SceneDataTest::releaseData,
+              &SceneDataTest::releaseFieldData});
+}
+
+using namespace Math::Literals;
+
+void SceneDataTest::fieldTypeSize() {
+    CORRADE_COMPARE(sceneFieldTypeSize(SceneFieldType::Int), 4);
+    CORRADE_COMPARE(sceneFieldTypeSize(SceneFieldType::Vector2), 8);
+    CORRADE_COMPARE(sceneFieldTypeSize(SceneFieldType::Vector3), 12);
+    CORRADE_COMPARE(sceneFieldTypeSize(SceneFieldType::Complex), 8);
+    CORRADE_COMPARE(sceneFieldTypeSize(SceneFieldType::Quaternion), 16);
+    CORRADE_COMPARE(sceneFieldTypeSize(SceneFieldType::Matrix3), 36);
+    CORRADE_COMPARE(sceneFieldTypeSize(SceneFieldType::Matrix4), 64);
+}
+
+void SceneDataTest::fieldTypeSizeInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    sceneFieldTypeSize(SceneFieldType{});
+    sceneFieldTypeSize(SceneFieldType(0xdf));
+
+    CORRADE_COMPARE(out.str(),
+        "Trade::sceneFieldTypeSize(): invalid type Trade::SceneFieldType(0x0)\n"
+        "Trade::sceneFieldTypeSize(): invalid type Trade::SceneFieldType(0xdf)\n");
+}
+
+void SceneDataTest::debugFieldName() {
+    std::ostringstream out;
+    Debug{&out} << SceneField::MeshMaterial << SceneField(0xdf);
+    CORRADE_COMPARE(out.str(), "Trade::SceneField::MeshMaterial Trade::SceneField(0xdf)\n");
+}
+
+void SceneDataTest::debugFieldType() {
+    std::ostringstream out;
+    Debug{&out} << SceneFieldType::Quaternion << SceneFieldType(0xdf);
+    CORRADE_COMPARE(out.str(), "Trade::SceneFieldType::Quaternion Trade::SceneFieldType(0xdf)\n");
+}
+
+void SceneDataTest::constructField() {
+    const Matrix4 transformations[3];
+    SceneFieldData data{SceneField::Transformation, Containers::arrayView(transformations)};
+    CORRADE_COMPARE(data.name(), SceneField::Transformation);
+    CORRADE_COMPARE(data.type(), SceneFieldType::Matrix4);
+    CORRADE_VERIFY(data.data().data() == transformations);
+    CORRADE_COMPARE(data.data().size(), 3);
+    CORRADE_COMPARE(data.data().stride(), sizeof(Matrix4));
+
+    /* Strided view of a member */
+    struct Object {
+        Int parent;
+        Vector3 translation;
+    } objects[4];
+    SceneFieldData strided{SceneField::Translation, Containers::stridedArrayView(objects).slice(&Object::translation)};
+    CORRADE_COMPARE(strided.name(), SceneField::Translation);
+    CORRADE_COMPARE(strided.type(), SceneFieldType::Vector3);
+    CORRADE_VERIFY(strided.data().data() == &objects[0].translation);
+    CORRADE_COMPARE(strided.data().size(), 4);
+    CORRADE_COMPARE(strided.data().stride(), sizeof(Object));
+}
+
+void SceneDataTest::constructFieldTypeErased() {
+    const Quaternion rotations[3];
+    SceneFieldData data{SceneField::Rotation, SceneFieldType::Quaternion, Containers::arrayView(rotations)};
+    CORRADE_COMPARE(data.name(), SceneField::Rotation);
+    CORRADE_COMPARE(data.type(), SceneFieldType::Quaternion);
+    CORRADE_VERIFY(data.data().data() == rotations);
+    CORRADE_COMPARE(data.data().size(), 3);
+    CORRADE_COMPARE(data.data().stride(), sizeof(Quaternion));
+}
+
+void SceneDataTest::constructFieldWrongType() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const Vector3 translations[3];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    SceneFieldData{SceneField::Rotation, Containers::arrayView(translations)};
+    SceneFieldData{SceneField::Mesh, SceneFieldType::Vector2, nullptr};
+    CORRADE_COMPARE(out.str(),
+        "Trade::SceneFieldData: Trade::SceneFieldType::Vector3 is not a valid type for Trade::SceneField::Rotation\n"
+        "Trade::SceneFieldData: Trade::SceneFieldType::Vector2 is not a valid type for Trade::SceneField::Mesh\n");
+}
+
+void SceneDataTest::constructFieldWrongStride() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const char data[3*sizeof(Matrix3)]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    SceneFieldData{SceneField::Transformation, SceneFieldType::Matrix4, Containers::StridedArrayView1D<const void>{data, 3, sizeof(Matrix3)}};
+    CORRADE_COMPARE(out.str(),
+        "Trade::SceneFieldData: expected stride to be positive and enough to fit Trade::SceneFieldType::Matrix4, got 36\n");
 }
 
 void SceneDataTest::construct() {
@@ -50,9 +239,195 @@ void SceneDataTest::construct() {
 
     CORRADE_COMPARE(data.children2D(), (std::vector<UnsignedInt>{0, 1, 4}));
     CORRADE_COMPARE(data.children3D(), (std::vector<UnsignedInt>{2, 5}));
+    CORRADE_COMPARE(data.objectCount(), 0);
+    CORRADE_COMPARE(data.fieldCount(), 0);
+    CORRADE_VERIFY(!data.is2D());
+    CORRADE_VERIFY(!data.data());
     CORRADE_COMPARE(data.importerState(), &a);
 }
 
+struct Object3D {
+    Int parent;
+    Int mesh;
+    Matrix4 transformation;
+};
+
+/* Hierarchy:
+
+    0
+    |-- 2
+    |   `-- 3
+    4
+    `-- 1 */
+SceneData scene3D(const void* importerState = nullptr) {
+    Containers::Array<char> data{4*sizeof(Object3D) + sizeof(Object3D)};
+    /* Leave some space at the beginning to verify offsets are taken into
+       account */
+    Containers::ArrayView<Object3D> objects = Containers::arrayCast<Object3D>(data.suffix(sizeof(Object3D)));
+    objects[0] = {-1, 5, Matrix4::translation(Vector3::xAxis(3.0f))};
+    objects[1] = {4, -1, Matrix4::rotationZ(90.0_degf)};
+    objects[2] = {0, 7, Matrix4::scaling(Vector3{2.0f})};
+    objects[3] = {2, 5, Matrix4{}};
+    /* Object 4 is abused for the extra space above */
+    return SceneData{4, std::move(data), {
+        SceneFieldData{SceneField::Parent, Containers::stridedArrayView(objects.prefix(4)).slice(&Object3D::parent)},
+        SceneFieldData{SceneField::Transformation, Containers::stridedArrayView(objects.prefix(4)).slice(&Object3D::transformation)},
+        SceneFieldData{SceneField::Mesh, Containers::stridedArrayView(objects.prefix(4)).slice(&Object3D::mesh)}
+    }, importerState};
+}
+
+void SceneDataTest::constructFields() {
+    const int a{};
+    SceneData data = scene3D(&a);
+
+    CORRADE_COMPARE(data.objectCount(), 4);
+    CORRADE_COMPARE(data.fieldCount(), 3);
+    CORRADE_VERIFY(!data.is2D());
+    CORRADE_COMPARE(data.data().size(), 5*sizeof(Object3D));
+    CORRADE_COMPARE(data.fieldData().size(), 3);
+    CORRADE_COMPARE(data.importerState(), &a);
+
+    /* The root objects get filled from the parent field */
+    CORRADE_COMPARE(data.children2D(), std::vector<UnsignedInt>{});
+    CORRADE_COMPARE(data.children3D(), (std::vector<UnsignedInt>{0}));
+
+    CORRADE_COMPARE(data.fieldName(0), SceneField::Parent);
+    CORRADE_COMPARE(data.fieldName(1), SceneField::Transformation);
+    CORRADE_COMPARE(data.fieldType(1), SceneFieldType::Matrix4);
+    CORRADE_COMPARE(data.fieldName(2), SceneField::Mesh);
+    CORRADE_COMPARE(data.fieldType(2), SceneFieldType::Int);
+    CORRADE_VERIFY(data.hasField(SceneField::Mesh));
+    CORRADE_VERIFY(!data.hasField(SceneField::Camera));
+    CORRADE_COMPARE(data.fieldId(SceneField::Mesh), 2);
+    CORRADE_COMPARE(data.fieldType(SceneField::Transformation), SceneFieldType::Matrix4);
+}
+
+void SceneDataTest::constructFields2D() {
+    Containers::Array<char> data{3*(sizeof(Int) + sizeof(Vector2))};
+    Containers::ArrayView<Int> parents = Containers::arrayCast<Int>(data.prefix(3*sizeof(Int)));
+    Containers::ArrayView<Vector2> translations = Containers::arrayCast<Vector2>(data.suffix(3*sizeof(Int)));
+    parents[0] = 2;
+    parents[1] = -1;
+    parents[2] = -1;
+
+    SceneData scene{3, std::move(data), {
+        SceneFieldData{SceneField::Parent, parents},
+        SceneFieldData{SceneField::Translation, translations}
+    }};
+    CORRADE_VERIFY(scene.is2D());
+    CORRADE_COMPARE(scene.children2D(), (std::vector<UnsignedInt>{1, 2}));
+    CORRADE_COMPARE(scene.children3D(), std::vector<UnsignedInt>{});
+}
+
+void SceneDataTest::constructFieldsNoParents() {
+    Containers::Array<char> data{3*sizeof(Int)};
+    Containers::ArrayView<Int> cameras = Containers::arrayCast<Int>(data);
+
+    SceneData scene{3, std::move(data), {
+        SceneFieldData{SceneField::Camera, cameras}
+    }};
+    CORRADE_VERIFY(!scene.is2D());
+    CORRADE_COMPARE(scene.children3D(), (std::vector<UnsignedInt>{0, 1, 2}));
+}
+
+void SceneDataTest::constructFieldsExplicitChildren() {
+    Containers::Array<char> data{3*sizeof(Int)};
+    Containers::ArrayView<Int> parents = Containers::arrayCast<Int>(data);
+    parents[0] = -1;
+    parents[1] = -1;
+    parents[2] = -1;
+
+    /* Object 1 is not part of the scene */
+    Containers::Array<SceneFieldData> fields{1};
+    fields[0] = SceneFieldData{SceneField::Parent, parents};
+    SceneData scene{{}, {2, 0}, 3, std::move(data), std::move(fields)};
+    CORRADE_COMPARE(scene.objectCount(), 3);
+    CORRADE_COMPARE(scene.children3D(), (std::vector<UnsignedInt>{2, 0}));
+}
+
+void SceneDataTest::constructFieldsNotContained() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Containers::Array<char> data{reinterpret_cast<char*>(0xbadda9), 3*sizeof(Int), [](char*, std::size_t){}};
+    Containers::ArrayView<Int> meshes{reinterpret_cast<Int*>(0xbadda9 + 4), 3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    SceneData{3, std::move(data), {SceneFieldData{SceneField::Mesh, meshes}}};
+    CORRADE_COMPARE(out.str(),
+        "Trade::SceneData: field 0 [0xbaddad:0xbaddb9] is not contained in passed data array [0xbadda9:0xbaddb5]\n");
+}
+
+void SceneDataTest::constructFieldsWrongObjectCount() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Containers::Array<char> data{5*sizeof(Int)};
+    Containers::ArrayView<Int> view = Containers::arrayCast<Int>(data);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    SceneData{3, std::move(data), {
+        SceneFieldData{SceneField::Parent, view.prefix(3)},
+        SceneFieldData{SceneField::Mesh, view.prefix(2)}
+    }};
+    CORRADE_COMPARE(out.str(),
+        "Trade::SceneData: field 1 has 2 items but 3 expected\n");
+}
+
+void SceneDataTest::constructFieldsDuplicate() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Containers::Array<char> data{3*sizeof(Int)};
+    Containers::ArrayView<Int> view = Containers::arrayCast<Int>(data);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    SceneData{3, std::move(data), {
+        SceneFieldData{SceneField::Mesh, view},
+        SceneFieldData{SceneField::Camera, view},
+        SceneFieldData{SceneField::Mesh, view}
+    }};
+    CORRADE_COMPARE(out.str(),
+        "Trade::SceneData: duplicate field Trade::SceneField::Mesh\n");
+}
+
+void SceneDataTest::constructFieldsDimensionMismatch() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Containers::Array<char> data{3*sizeof(Quaternion)};
+    Containers::ArrayView<Vector2> translations = Containers::arrayCast<Vector2>(data.prefix(3*sizeof(Vector2)));
+    Containers::ArrayView<Quaternion> rotations = Containers::arrayCast<Quaternion>(data);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    SceneData{3, std::move(data), {
+        SceneFieldData{SceneField::Translation, translations},
+        SceneFieldData{SceneField::Rotation, rotations}
+    }};
+    CORRADE_COMPARE(out.str(),
+        "Trade::SceneData: field Trade::SceneField::Rotation of type Trade::SceneFieldType::Quaternion doesn't match the dimension count of previous fields\n");
+}
+
+void SceneDataTest::constructFieldsNoType() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    SceneData{0, nullptr, {SceneFieldData{}}};
+    CORRADE_COMPARE(out.str(),
+        "Trade::SceneData: field 0 doesn't specify anything\n");
+}
+
 void SceneDataTest::constructCopy() {
     CORRADE_VERIFY(!(std::is_constructible<SceneData, const SceneData&>{}));
     CORRADE_VERIFY(!(std::is_assignable<SceneData, const SceneData&>{}));
@@ -76,10 +451,348 @@ void SceneDataTest::constructMove() {
     CORRADE_COMPARE(d.children3D(), (std::vector<UnsignedInt>{2, 5}));
     CORRADE_COMPARE(d.importerState(), &a);
 
+    /* Moving a scene with fields */
+    SceneData e = scene3D(&c);
+    const void* fieldData = e.data().data();
+    d = std::move(e);
+    CORRADE_COMPARE(d.objectCount(), 4);
+    CORRADE_COMPARE(d.fieldCount(), 3);
+    CORRADE_COMPARE(static_cast<const void*>(d.data().data()), fieldData);
+    CORRADE_COMPARE(d.children3D(), (std::vector<UnsignedInt>{0}));
+    CORRADE_COMPARE(d.importerState(), &c);
+
     CORRADE_VERIFY(std::is_nothrow_move_constructible<SceneData>::value);
     CORRADE_VERIFY(std::is_nothrow_move_assignable<SceneData>::value);
 }
 
+void SceneDataTest::fieldAccess() {
+    SceneData data = scene3D();
+
+    Containers::StridedArrayView2D<const char> raw = data.field(1);
+    CORRADE_COMPARE(raw.size()[0], 4);
+    CORRADE_COMPARE(raw.size()[1], sizeof(Matrix4));
+    CORRADE_COMPARE(raw.stride()[0], sizeof(Object3D));
+    CORRADE_COMPARE(raw.data(), static_cast<const void*>(data.data().data() + sizeof(Object3D) + offsetof(Object3D, transformation)));
+    CORRADE_COMPARE(data.field(SceneField::Mesh).data(), static_cast<const void*>(data.data().data() + sizeof(Object3D) + offsetof(Object3D, mesh)));
+
+    CORRADE_COMPARE_AS(data.field<Int>(0),
+        Containers::arrayView<Int>({-1, 4, 0, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(data.field<Int>(SceneField::Mesh),
+        Containers::arrayView<Int>({5, -1, 7, 5}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(data.field<Matrix4>(SceneField::Transformation)[2], Matrix4::scaling(Vector3{2.0f}));
+}
+
+void SceneDataTest::fieldAccessWrongType() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    SceneData data = scene3D();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    data.field<Matrix3>(1);
+    data.field<Vector3>(SceneField::Mesh);
+    CORRADE_COMPARE(out.str(),
+        "Trade::SceneData::field(): improper type requested for Trade::SceneField::Transformation of type Trade::SceneFieldType::Matrix4\n"
+        "Trade::SceneData::field(): improper type requested for Trade::SceneField::Mesh of type Trade::SceneFieldType::Int\n");
+}
+
+void SceneDataTest::fieldAccessNotFound() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    SceneData data = scene3D();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    data.fieldId(SceneField::Light);
+    data.fieldType(SceneField::Light);
+    data.field(SceneField::Light);
+    data.field<Int>(SceneField::Light);
+    CORRADE_COMPARE(out.str(),
+        "Trade::SceneData::fieldId(): field Trade::SceneField::Light not found\n"
+        "Trade::SceneData::fieldType(): field Trade::SceneField::Light not found\n"
+        "Trade::SceneData::field(): field Trade::SceneField::Light not found\n"
+        "Trade::SceneData::field(): field Trade::SceneField::Light not found\n");
+}
+
+void SceneDataTest::fieldAccessOutOfRange() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    SceneData data = scene3D();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    data.fieldName(3);
+    data.fieldType(3);
+    data.field(3);
+    data.field<Int>(3);
+    CORRADE_COMPARE(out.str(),
+        "Trade::SceneData::fieldName(): index 3 out of range for 3 fields\n"
+        "Trade::SceneData::fieldType(): index 3 out of range for 3 fields\n"
+        "Trade::SceneData::field(): index 3 out of range for 3 fields\n"
+        "Trade::SceneData::field(): index 3 out of range for 3 fields\n");
+}
+
+void SceneDataTest::parentsAsArray() {
+    SceneData data = scene3D();
+    CORRADE_COMPARE_AS(data.parentsAsArray(),
+        Containers::arrayView<Int>({-1, 4, 0, 2}),
+        TestSuite::Compare::Container);
+}
+
+void SceneDataTest::indexFieldsAsArray() {
+    /* Interleaved, two objects with four fields each */
+    Containers::Array<char> data{2*4*sizeof(Int)};
+    Containers::StridedArrayView2D<Int> fields{Containers::arrayCast<Int>(data), {2, 4}};
+    for(std::size_t i = 0; i != 2; ++i)
+        for(std::size_t j = 0; j != 4; ++j)
+            fields[i][j] = 10*(j + 1) + i;
+
+    SceneData scene{2, std::move(data), {
+        SceneFieldData{SceneField::Mesh, fields.transposed<0, 1>()[0]},
+        SceneFieldData{SceneField::MeshMaterial, fields.transposed<0, 1>()[1]},
+        SceneFieldData{SceneField::Light, fields.transposed<0, 1>()[2]},
+        SceneFieldData{SceneField::Camera, fields.transposed<0, 1>()[3]}
+    }};
+
+    CORRADE_COMPARE_AS(scene.meshesAsArray(),
+        Containers::arrayView<Int>({10, 11}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.meshMaterialsAsArray(),
+        Containers::arrayView<Int>({20, 21}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.lightsAsArray(),
+        Containers::arrayView<Int>({30, 31}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.camerasAsArray(),
+        Containers::arrayView<Int>({40, 41}),
+        TestSuite::Compare::Container);
+}
+
+void SceneDataTest::indexFieldsAsArrayNotPresent() {
+    Containers::Array<char> data{3*sizeof(Vector3)};
+    Containers::ArrayView<Vector3> translations = Containers::arrayCast<Vector3>(data);
+
+    SceneData scene{3, std::move(data), {
+        SceneFieldData{SceneField::Translation, translations}
+    }};
+
+    CORRADE_COMPARE_AS(scene.parentsAsArray(),
+        Containers::arrayView<Int>({-1, -1, -1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.meshesAsArray(),
+        Containers::arrayView<Int>({-1, -1, -1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.meshMaterialsAsArray(),
+        Containers::arrayView<Int>({-1, -1, -1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.lightsAsArray(),
+        Containers::arrayView<Int>({-1, -1, -1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.camerasAsArray(),
+        Containers::arrayView<Int>({-1, -1, -1}),
+        TestSuite::Compare::Container);
+}
+
+void SceneDataTest::indexFieldsIntoWrongSize() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    SceneData data = scene3D();
+    Int destination[3];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    data.parentsInto(destination);
+    data.meshesInto(destination);
+    data.meshMaterialsInto(destination);
+    data.lightsInto(destination);
+    data.camerasInto(destination);
+    CORRADE_COMPARE(out.str(),
+        "Trade::SceneData::parentsInto(): expected a view with 4 elements but got 3\n"
+        "Trade::SceneData::meshesInto(): expected a view with 4 elements but got 3\n"
+        "Trade::SceneData::meshMaterialsInto(): expected a view with 4 elements but got 3\n"
+        "Trade::SceneData::lightsInto(): expected a view with 4 elements but got 3\n"
+        "Trade::SceneData::camerasInto(): expected a view with 4 elements but got 3\n");
+}
+
+void SceneDataTest::transformations3DAsArray() {
+    SceneData data = scene3D();
+    CORRADE_COMPARE_AS(data.transformations3DAsArray(), Containers::arrayView<Matrix4>({
+        Matrix4::translation(Vector3::xAxis(3.0f)),
+        Matrix4::rotationZ(90.0_degf),
+        Matrix4::scaling(Vector3{2.0f}),
+        Matrix4{}
+    }), TestSuite::Compare::Container);
+}
+
+void SceneDataTest::transformations3DAsArrayTRS() {
+    Containers::Array<char> data{2*(2*sizeof(Vector3) + sizeof(Quaternion))};
+    Containers::ArrayView<Quaternion> rotations = Containers::arrayCast<Quaternion>(data.prefix(2*sizeof(Quaternion)));
+    Containers::ArrayView<Vector3> translations = Containers::arrayCast<Vector3>(data.slice(2*sizeof(Quaternion), 2*sizeof(Quaternion) + 2*sizeof(Vector3)));
+    Containers::ArrayView<Vector3> scalings = Containers::arrayCast<Vector3>(data.suffix(2*sizeof(Quaternion) + 2*sizeof(Vector3)));
+    translations[0] = {1.0f, 2.0f, 3.0f};
+    translations[1] = {};
+    rotations[0] = Quaternion::rotation(35.0_degf, Vector3::yAxis());
+    rotations[1] = Quaternion::rotation(-90.0_degf, Vector3::xAxis());
+    scalings[0] = Vector3{1.0f};
+    scalings[1] = {1.5f, 2.0f, 0.5f};
+
+    SceneData scene{2, std::move(data), {
+        SceneFieldData{SceneField::Scaling, scalings},
+        SceneFieldData{SceneField::Rotation, rotations},
+        SceneFieldData{SceneField::Translation, translations}
+    }};
+    CORRADE_COMPARE_AS(scene.transformations3DAsArray(), Containers::arrayView<Matrix4>({
+        Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::rotationY(35.0_degf),
+        Matrix4::rotationX(-90.0_degf)*Matrix4::scaling({1.5f, 2.0f, 0.5f})
+    }), TestSuite::Compare::Container);
+
+    /* Only some of the components */
+    Containers::Array<char> translationData{2*sizeof(Vector3)};
+    Containers::ArrayView<Vector3> translationsOnly = Containers::arrayCast<Vector3>(translationData);
+    translationsOnly[0] = {1.0f, 2.0f, 3.0f};
+    translationsOnly[1] = {4.0f, 5.0f, 6.0f};
+    SceneData translationScene{2, std::move(translationData), {
+        SceneFieldData{SceneField::Translation, translationsOnly}
+    }};
+    CORRADE_COMPARE_AS(translationScene.transformations3DAsArray(), Containers::arrayView<Matrix4>({
+        Matrix4::translation({1.0f, 2.0f, 3.0f}),
+        Matrix4::translation({4.0f, 5.0f, 6.0f})
+    }), TestSuite::Compare::Container);
+}
+
+void SceneDataTest::transformations3DAsArrayNotPresent() {
+    Containers::Array<char> data{2*sizeof(Int)};
+    Containers::ArrayView<Int> parents = Containers::arrayCast<Int>(data);
+    parents[0] = -1;
+    parents[1] = 0;
+
+    SceneData scene{2, std::move(data), {
+        SceneFieldData{SceneField::Parent, parents}
+    }};
+    CORRADE_COMPARE_AS(scene.transformations3DAsArray(), Containers::arrayView<Matrix4>({
+        Matrix4{}, Matrix4{}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.transformations2DAsArray(), Containers::arrayView<Matrix3>({
+        Matrix3{}, Matrix3{}
+    }), TestSuite::Compare::Container);
+}
+
+void SceneDataTest::transformations2DAsArray() {
+    Containers::Array<char> data{2*sizeof(Matrix3)};
+    Containers::ArrayView<Matrix3> transformations = Containers::arrayCast<Matrix3>(data);
+    transformations[0] = Matrix3::translation({1.0f, 2.0f});
+    transformations[1] = Matrix3::rotation(35.0_degf);
+
+    SceneData scene{2, std::move(data), {
+        SceneFieldData{SceneField::Transformation, transformations}
+    }};
+    CORRADE_VERIFY(scene.is2D());
+    CORRADE_COMPARE_AS(scene.transformations2DAsArray(), Containers::arrayView<Matrix3>({
+        Matrix3::translation({1.0f, 2.0f}),
+        Matrix3::rotation(35.0_degf)
+    }), TestSuite::Compare::Container);
+}
+
+void SceneDataTest::transformations2DAsArrayTRS() {
+    Containers::Array<char> data{2*(2*sizeof(Vector2) + sizeof(Complex))};
+    Containers::ArrayView<Vector2> translations = Containers::arrayCast<Vector2>(data.prefix(2*sizeof(Vector2)));
+    Containers::ArrayView<Complex> rotations = Containers::arrayCast<Complex>(data.slice(2*sizeof(Vector2), 2*sizeof(Vector2) + 2*sizeof(Complex)));
+    Containers::ArrayView<Vector2> scalings = Containers::arrayCast<Vector2>(data.suffix(2*sizeof(Vector2) + 2*sizeof(Complex)));
+    translations[0] = {1.0f, 2.0f};
+    translations[1] = {};
+    rotations[0] = Complex::rotation(35.0_degf);
+    rotations[1] = Complex{};
+    scalings[0] = Vector2{1.0f};
+    scalings[1] = {1.5f, 2.0f};
+
+    SceneData scene{2, std::move(data), {
+        SceneFieldData{SceneField::Translation, translations},
+        SceneFieldData{SceneField::Rotation, rotations},
+        SceneFieldData{SceneField::Scaling, scalings}
+    }};
+    CORRADE_VERIFY(scene.is2D());
+    CORRADE_COMPARE_AS(scene.transformations2DAsArray(), Containers::arrayView<Matrix3>({
+        Matrix3::translation({1.0f, 2.0f})*Matrix3::rotation(35.0_degf),
+        Matrix3::scaling({1.5f, 2.0f})
+    }), TestSuite::Compare::Container);
+}
+
+void SceneDataTest::transformationsAsArrayWrongDimensions() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    SceneData data3D = scene3D();
+
+    Containers::Array<char> data{2*sizeof(Vector2)};
+    Containers::ArrayView<Vector2> translations = Containers::arrayCast<Vector2>(data);
+    SceneData data2D{2, std::move(data), {
+        SceneFieldData{SceneField::Translation, translations}
+    }};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    data3D.transformations2DAsArray();
+    data2D.transformations3DAsArray();
+    CORRADE_COMPARE(out.str(),
+        "Trade::SceneData::transformations2DInto(): the scene has 3D transformations\n"
+        "Trade::SceneData::transformations3DInto(): the scene has 2D transformations\n");
+}
+
+void SceneDataTest::transformationsIntoWrongSize() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    SceneData data = scene3D();
+    Matrix3 destination2D[3];
+    Matrix4 destination3D[3];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    data.transformations2DInto(destination2D);
+    data.transformations3DInto(destination3D);
+    CORRADE_COMPARE(out.str(),
+        "Trade::SceneData::transformations2DInto(): expected a view with 4 elements but got 3\n"
+        "Trade::SceneData::transformations3DInto(): expected a view with 4 elements but got 3\n");
+}
+
+void SceneDataTest::releaseData() {
+    SceneData data = scene3D();
+    const void* pointer = data.data().data();
+
+    Containers::Array<char> released = data.releaseData();
+    CORRADE_COMPARE(static_cast<const void*>(released.data()), pointer);
+    CORRADE_COMPARE(released.size(), 5*sizeof(Object3D));
+    CORRADE_COMPARE(data.objectCount(), 0);
+    CORRADE_COMPARE(data.fieldCount(), 0);
+    CORRADE_VERIFY(!data.data());
+    /* The root list stays */
+    CORRADE_COMPARE(data.children3D(), (std::vector<UnsignedInt>{0}));
+}
+
+void SceneDataTest::releaseFieldData() {
+    SceneData data = scene3D();
+    const void* pointer = data.fieldData().data();
+
+    Containers::Array<SceneFieldData> released = data.releaseFieldData();
+    CORRADE_COMPARE(static_cast<const void*>(released.data()), pointer);
+    CORRADE_COMPARE(released.size(), 3);
+    CORRADE_COMPARE(data.objectCount(), 0);
+    CORRADE_COMPARE(data.fieldCount(), 0);
+    CORRADE_COMPARE(data.data().size(), 5*sizeof(Object3D));
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::SceneDataTest)
@@ -78,6 +78,8 @@ typedef ImageData<1> ImageData1D;
 typedef ImageData<2> ImageData2D;
 typedef ImageData<3> ImageData3D;
 
+class ImportBatch;
+
 class LightData;
 
 enum class MeshAttribute: UnsignedShort;
@@ -98,6 +100,9 @@ class PbrMetallicRoughnessMaterialData;
 class PbrSpecularGlossinessMaterialData;
 class PhongMaterialData;
 class TextureData;
+enum class SceneField: UnsignedByte;
+enum class SceneFieldType: UnsignedByte;
+class SceneFieldData;
 class SceneData;
 #endif
 
@@ -46,7 +46,8 @@ constexpr VkPrimitiveTopology PrimitiveTopologyMapping[]{
     VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN,
     VkPrimitiveTopology(~UnsignedInt{}), /* Instances */
     VkPrimitiveTopology(~UnsignedInt{}), /* Faces */
-    VkPrimitiveTopology(~UnsignedInt{})  /* Edges */
+    VkPrimitiveTopology(~UnsignedInt{}), /* Edges */
+    VkPrimitiveTopology(~UnsignedInt{})  /* Meshlets */
 };
 
 constexpr VkIndexType IndexTypeMapping[]{
@@ -92,4 +92,4 @@ Containers::Array<char> AnyImporter::doData() { return _in->data(); }
 }}
 
 CORRADE_PLUGIN_REGISTER(AnyAudioImporter, Magnum::Audio::AnyImporter,
-    "cz.mosra.magnum.Audio.AbstractImporter/0.1")
+    "cz.mosra.magnum.Audio.AbstractImporter/0.1.1")
@@ -86,4 +86,4 @@ bool AnySceneConverter::doConvertToFile(const std::string& filename, const MeshD
 }}
 
 CORRADE_PLUGIN_REGISTER(AnySceneConverter, Magnum::Trade::AnySceneConverter,
-    "cz.mosra.magnum.Trade.AbstractSceneConverter/0.1")
+    "cz.mosra.magnum.Trade.AbstractSceneConverter/0.1.1")
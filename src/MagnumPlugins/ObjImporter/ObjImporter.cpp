@@ -25,59 +25,262 @@
 
 #include "ObjImporter.h"
 
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
-#include <limits>
-#include <sstream>
 #include <unordered_map>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Configuration.h>
 #include <Corrade/Utility/DebugStl.h>
-#include <Corrade/Utility/String.h>
+#include <Corrade/Utility/Directory.h>
 
 #include "Magnum/Mesh.h"
 #include "Magnum/MeshTools/CompressIndices.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/MeshTools/Reference.h"
 #include "Magnum/Math/Color.h"
 #include "Magnum/Trade/MeshData.h"
+#include "Magnum/Implementation/parallelFor.h"
+
+#ifdef CORRADE_BUILD_MULTITHREADED
+#include <atomic>
+#endif
+
+#if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+#define _MAGNUM_OBJIMPORTER_USE_MAPPING
+#endif
 
 namespace Magnum { namespace Trade {
 
 struct ObjImporter::File {
+    enum class LineType: UnsignedByte {
+        Position, TextureCoordinate, Normal, Point, Line, Face, Unknown
+    };
+
+    /* A line with known data, found when opening the file. For known
+       keywords the range is the line contents after the keyword, for
+       unknown keywords it's the keyword itself, for error reporting. */
+    struct Line {
+        std::size_t begin;
+        UnsignedInt size;
+        LineType type;
+    };
+
+    struct Mesh {
+        /* Range in `lines` */
+        std::size_t lineBegin, lineEnd;
+        UnsignedInt positionIndexOffset,
+            textureCoordinateIndexOffset,
+            normalIndexOffset;
+        /* Counts of data and primitive lines to allocate the outputs
+           upfront */
+        UnsignedInt positionCount,
+            textureCoordinateCount,
+            normalCount,
+            primitiveCount;
+    };
+
     std::unordered_map<std::string, UnsignedInt> meshesForName;
     std::vector<std::string> meshNames;
-    std::vector<std::tuple<std::streampos, std::streampos, UnsignedInt, UnsignedInt, UnsignedInt>> meshes;
-    Containers::Pointer<std::istream> in;
+    std::vector<Mesh> meshes;
+    Containers::Array<Line> lines;
+
+    /* Meshes parsed concurrently when opening the file, if enabled. Empty
+       otherwise, null items are meshes that failed to import. */
+    Containers::Array<Containers::Optional<MeshData>> meshCache;
+
+    /* The whole file contents, either pointing to a memory-mapped file or to
+       a copy of the data passed to openData() */
+    Containers::ArrayView<const char> in;
+    Containers::Array<char> data;
+    #ifdef _MAGNUM_OBJIMPORTER_USE_MAPPING
+    Containers::Array<const char, Utility::Directory::MapDeleter> mappedData;
+    #endif
 };
 
 namespace {
 
-void ignoreLine(std::istream& in) {
-    in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+/* Everything below operates directly on the file contents, without copying
+   any lines or tokens out */
+
+inline bool isWhitespace(const char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
 }
 
-template<std::size_t size> Math::Vector<size, Float> extractFloatData(const std::string& str, Float* extra = nullptr) {
-    std::vector<std::string> data = Utility::String::splitWithoutEmptyParts(str, ' ');
-    if(data.size() < size || data.size() > size + (extra ? 1 : 0)) {
-        Error() << "Trade::ObjImporter::mesh(): invalid float array size";
-        throw 0;
+inline const char* skipWhitespace(const char* it, const char* const end) {
+    while(it != end && isWhitespace(*it)) ++it;
+    return it;
+}
+
+inline const char* findWhitespace(const char* it, const char* const end) {
+    while(it != end && !isWhitespace(*it)) ++it;
+    return it;
+}
+
+/* Returns pointer to the newline character or `end` if there's none */
+inline const char* findLineEnd(const char* const it, const char* const end) {
+    const void* const found = std::memchr(it, '\n', end - it);
+    return found ? static_cast<const char*>(found) : end;
+}
+
+template<std::size_t size> inline bool tokenEquals(const Containers::ArrayView<const char> token, const char(&string)[size]) {
+    return token.size() == size - 1 && std::memcmp(token.data(), string, size - 1) == 0;
+}
+
+/* Splits whitespace-separated tokens in the [it, end) range. Returns total
+   count of tokens, but saves only first `tokens.size()` of them. */
+std::size_t splitTokens(const char* it, const char* const end, const Containers::ArrayView<Containers::ArrayView<const char>> tokens) {
+    std::size_t count = 0;
+    for(it = skipWhitespace(it, end); it != end; it = skipWhitespace(it, end)) {
+        const char* const tokenEnd = findWhitespace(it, end);
+        if(count < tokens.size()) tokens[count] = {it, std::size_t(tokenEnd - it)};
+        ++count;
+        it = tokenEnd;
+    }
+    return count;
+}
+
+/* Powers of ten that are exactly representable in a double */
+constexpr Double ExactPowersOf10[]{
+    1.0e0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5, 1.0e6, 1.0e7, 1.0e8, 1.0e9,
+    1.0e10, 1.0e11, 1.0e12, 1.0e13, 1.0e14, 1.0e15, 1.0e16, 1.0e17, 1.0e18,
+    1.0e19, 1.0e20, 1.0e21, 1.0e22
+};
+
+/* Parses a float from the token. Handles the common decimal notation
+   directly, accumulating at most 19 significant digits into an integer and
+   then scaling it by a power of ten in double precision. The result is
+   correctly rounded for typical inputs, but as the value may get rounded
+   more than once, it can differ from std::strtof() in the last bit for
+   mantissas over 15 digits or large exponents. Rare cases such as `inf` or
+   `nan` go through std::strtof(). Same as with std::stof() that was used
+   before, trailing characters after a valid number (such as `1.0f`) are
+   ignored and only tokens that don't start with a number are rejected. */
+bool parseFloat(const Containers::ArrayView<const char> token, Float& out) {
+    const char* it = token.begin();
+    const char* const end = token.end();
+
+    bool negative = false;
+    if(it != end && (*it == '-' || *it == '+')) {
+        negative = *it == '-';
+        ++it;
+    }
+
+    UnsignedLong mantissa = 0;
+    Int exponent = 0;
+    Int significantDigits = 0;
+    bool anyDigits = false;
+    for(; it != end && *it >= '0' && *it <= '9'; ++it) {
+        anyDigits = true;
+        if(significantDigits < 19) {
+            mantissa = mantissa*10 + (*it - '0');
+            if(mantissa) ++significantDigits;
+        } else ++exponent;
+    }
+    if(it != end && *it == '.') {
+        for(++it; it != end && *it >= '0' && *it <= '9'; ++it) {
+            anyDigits = true;
+            if(significantDigits < 19) {
+                mantissa = mantissa*10 + (*it - '0');
+                if(mantissa) ++significantDigits;
+                --exponent;
+            }
+        }
     }
 
-    Math::Vector<size, Float> output;
+    if(anyDigits && it != end && (*it == 'e' || *it == 'E')) {
+        ++it;
+        bool negativeExponent = false;
+        if(it != end && (*it == '-' || *it == '+')) {
+            negativeExponent = *it == '-';
+            ++it;
+        }
+        /* An exponent without digits, such as `1e`, is left for the slow
+           path, which parses just the part before it */
+        if(it == end || *it < '0' || *it > '9') anyDigits = false;
+        else {
+            Int explicitExponent = 0;
+            for(; it != end && *it >= '0' && *it <= '9'; ++it)
+                if(explicitExponent < 100000)
+                    explicitExponent = explicitExponent*10 + (*it - '0');
+            exponent += negativeExponent ? -explicitExponent : explicitExponent;
+        }
+    }
+
+    /* Not a plain decimal number or there are trailing characters, try the
+       slow path. It needs a null-terminated string, which is copied to a
+       stack buffer except for unusually long tokens. */
+    if(!anyDigits || it != end) {
+        char buffer[32];
+        std::string longBuffer;
+        const char* data;
+        if(token.size() < sizeof(buffer)) {
+            std::memcpy(buffer, token.data(), token.size());
+            buffer[token.size()] = '\0';
+            data = buffer;
+        } else {
+            longBuffer.assign(token.data(), token.size());
+            data = longBuffer.data();
+        }
+        char* parsedEnd;
+        out = std::strtof(data, &parsedEnd);
+        return parsedEnd != data;
+    }
 
-    for(std::size_t i = 0; i != size; ++i)
-        output[i] = std::stof(data[i]);
+    Double value = Double(mantissa);
+    if(exponent >= 0 && exponent <= 22)
+        value *= ExactPowersOf10[exponent];
+    else if(exponent < 0 && exponent >= -22)
+        value /= ExactPowersOf10[-exponent];
+    else if(mantissa)
+        value *= std::pow(10.0, exponent);
+    out = Float(negative ? -value : value);
+    return true;
+}
+
+/* Parses an unsigned integer that spans the whole token */
+bool parseUnsignedInt(const Containers::ArrayView<const char> token, UnsignedInt& out) {
+    if(token.empty()) return false;
+    UnsignedLong value = 0;
+    for(const char c: token) {
+        if(c < '0' || c > '9') return false;
+        value = value*10 + (c - '0');
+        if(value > ~UnsignedInt{}) return false;
+    }
+    out = UnsignedInt(value);
+    return true;
+}
 
-    if(data.size() == size+1) {
+template<std::size_t size> bool extractFloatData(const char* const begin, const char* const end, Math::Vector<size, Float>& output, Float* extra = nullptr) {
+    Containers::ArrayView<const char> tokens[size + 1];
+    const std::size_t count = splitTokens(begin, end, tokens);
+    if(count < size || count > size + (extra ? 1 : 0)) {
+        Error() << "Trade::ObjImporter::mesh(): invalid float array size";
+        return false;
+    }
+
+    for(std::size_t i = 0; i != size; ++i) if(!parseFloat(tokens[i], output[i])) {
+        Error() << "Trade::ObjImporter::mesh(): error while converting numeric data";
+        return false;
+    }
+
+    if(count == size + 1) {
         /* This should be obvious from the first if, but add this just to make
            Clang Analyzer happy */
         CORRADE_INTERNAL_ASSERT(extra);
 
-        *extra = std::stof(data.back());
+        if(!parseFloat(tokens[size], *extra)) {
+            Error() << "Trade::ObjImporter::mesh(): error while converting numeric data";
+            return false;
+        }
     }
 
-    return output;
+    return true;
 }
 
 }
@@ -95,56 +298,94 @@ void ObjImporter::doClose() { _file.reset(); }
 bool ObjImporter::doIsOpened() const { return !!_file; }
 
 void ObjImporter::doOpenFile(const std::string& filename) {
-    Containers::Pointer<std::istream> in{new std::ifstream{filename, std::ios::binary}};
-    if(!in->good()) {
+    /* Check that the file exists and get its size. Empty files can't be
+       memory-mapped, so those are treated as empty data. */
+    std::size_t size;
+    {
+        std::ifstream in{filename, std::ios::binary|std::ios::ate};
+        if(!in.good()) {
+            Error() << "Trade::ObjImporter::openFile(): cannot open file" << filename;
+            return;
+        }
+        size = in.tellg();
+    }
+    if(!size) {
+        doOpenData(nullptr);
+        return;
+    }
+
+    /* Map the file into memory instead of reading it, so parsing huge files
+       doesn't need to copy them first */
+    #ifdef _MAGNUM_OBJIMPORTER_USE_MAPPING
+    Containers::Array<const char, Utility::Directory::MapDeleter> data = Utility::Directory::mapRead(filename);
+    if(!data) {
         Error() << "Trade::ObjImporter::openFile(): cannot open file" << filename;
         return;
     }
 
     _file.reset(new File);
-    _file->in = std::move(in);
+    _file->mappedData = std::move(data);
+    _file->in = _file->mappedData;
+    #else
+    _file.reset(new File);
+    _file->data = Utility::Directory::read(filename);
+    _file->in = _file->data;
+    #endif
+
     parseMeshNames();
+    parseMeshesConcurrently();
 }
 
 void ObjImporter::doOpenData(Containers::ArrayView<const char> data) {
     _file.reset(new File);
-    _file->in.reset(new std::istringstream{{data.begin(), data.size()}});
+
+    /* The data are not guaranteed to stay in scope after this call, so we
+       need to make a copy */
+    _file->data = Containers::Array<char>{Containers::NoInit, data.size()};
+    Utility::copy(data, _file->data);
+    _file->in = _file->data;
 
     parseMeshNames();
+    parseMeshesConcurrently();
 }
 
 void ObjImporter::parseMeshNames() {
+    /* The whole file is tokenized into lines and keywords just once here,
+       doMesh() then goes only through the recorded data lines of given mesh
+       and parses their contents */
+
     /* First mesh starts at the beginning, its indices start from 1. The end
-       offset will be updated to proper value later. */
+       will be updated to proper value later. */
     UnsignedInt positionIndexOffset = 1;
-    UnsignedInt normalIndexOffset = 1;
     UnsignedInt textureCoordinateIndexOffset = 1;
-    _file->meshes.emplace_back(0, 0, positionIndexOffset, normalIndexOffset, textureCoordinateIndexOffset);
+    UnsignedInt normalIndexOffset = 1;
+    _file->meshes.push_back({0, 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, 0, 0, 0, 0});
 
     /* The first mesh doesn't have name by default but we might find it later,
        so we need to track whether there are any data before first name */
     bool thisIsFirstMeshAndItHasNoData = true;
     _file->meshNames.emplace_back();
 
-    while(_file->in->good()) {
-        /* The previous object might end at the beginning of this line */
-        const std::streampos end = _file->in->tellg();
+    const char* const begin = _file->in.begin();
+    const char* const end = _file->in.end();
+    for(const char* it = begin; it != end; ) {
+        const char* const lineEnd = findLineEnd(it, end);
+        const char* const keywordBegin = skipWhitespace(it, lineEnd);
+        it = lineEnd == end ? end : lineEnd + 1;
 
-        /* Comment line */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
-            continue;
-        }
+        /* Skip empty lines and comments */
+        if(keywordBegin == lineEnd || *keywordBegin == '#') continue;
 
         /* Parse the keyword */
-        std::string keyword;
-        *_file->in >> keyword;
+        const char* const keywordEnd = findWhitespace(keywordBegin, lineEnd);
+        const Containers::ArrayView<const char> keyword{keywordBegin, std::size_t(keywordEnd - keywordBegin)};
 
         /* Mesh name */
-        if(keyword == "o") {
-            std::string name;
-            std::getline(*_file->in, name);
-            name = Utility::String::trim(name);
+        if(tokenEquals(keyword, "o")) {
+            const char* const nameBegin = skipWhitespace(keywordEnd, lineEnd);
+            const char* nameEnd = lineEnd;
+            while(nameEnd != nameBegin && isWhitespace(nameEnd[-1])) --nameEnd;
+            std::string name{nameBegin, nameEnd};
 
             /* This is the name of first mesh */
             if(thisIsFirstMeshAndItHasNoData) {
@@ -155,55 +396,79 @@ void ObjImporter::parseMeshNames() {
                     _file->meshesForName.emplace(name, _file->meshes.size() - 1);
                 _file->meshNames.back() = std::move(name);
 
-                /* Update its begin offset to be more precise */
-                std::get<0>(_file->meshes.back()) = _file->in->tellg();
+                /* Skip unknown keywords that might have been before the name,
+                   same as if the mesh would start after it */
+                _file->meshes.back().lineBegin = _file->lines.size();
 
             /* Otherwise this is a name of new mesh */
             } else {
                 /* Set end of the previous one */
-                std::get<1>(_file->meshes.back()) = end;
+                _file->meshes.back().lineEnd = _file->lines.size();
 
-                /* Save name and offset of the new one. The end offset will be
+                /* Save name and line range of the new one. The end will be
                    updated later. */
                 if(!name.empty())
                     _file->meshesForName.emplace(name, _file->meshes.size());
                 _file->meshNames.emplace_back(std::move(name));
-                _file->meshes.emplace_back(_file->in->tellg(), 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
+                _file->meshes.push_back({_file->lines.size(), 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, 0, 0, 0, 0});
             }
 
             continue;
+        }
 
-        /* If there are any data/indices before the first name, it means that
-           the first object is unnamed. We need to check for them. */
+        /* Classify the line. If there are any data/indices before the first
+           name, it means that the first object is unnamed. */
+        File::LineType type;
+        File::Mesh& mesh = _file->meshes.back();
 
         /* Vertex data, update index offset for the following meshes */
-        } else if(keyword == "v") {
+        if(tokenEquals(keyword, "v")) {
+            type = File::LineType::Position;
             ++positionIndexOffset;
+            ++mesh.positionCount;
             thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vt") {
+        } else if(tokenEquals(keyword, "vt")) {
+            type = File::LineType::TextureCoordinate;
             ++textureCoordinateIndexOffset;
+            ++mesh.textureCoordinateCount;
             thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vn") {
+        } else if(tokenEquals(keyword, "vn")) {
+            type = File::LineType::Normal;
             ++normalIndexOffset;
+            ++mesh.normalCount;
             thisIsFirstMeshAndItHasNoData = false;
 
-        /* Index data, just mark that we found something for first unnamed
-           object */
-        } else if(thisIsFirstMeshAndItHasNoData) for(const std::string& data: {"p", "l", "f"}) {
-            if(keyword == data) {
-                thisIsFirstMeshAndItHasNoData = false;
-                break;
-            }
+        /* Index data */
+        } else if(tokenEquals(keyword, "p")) {
+            type = File::LineType::Point;
+            ++mesh.primitiveCount;
+            thisIsFirstMeshAndItHasNoData = false;
+        } else if(tokenEquals(keyword, "l")) {
+            type = File::LineType::Line;
+            ++mesh.primitiveCount;
+            thisIsFirstMeshAndItHasNoData = false;
+        } else if(tokenEquals(keyword, "f")) {
+            type = File::LineType::Face;
+            ++mesh.primitiveCount;
+            thisIsFirstMeshAndItHasNoData = false;
+
+        /* Ignore unsupported keywords, remember unknown keywords so doMesh()
+           can error out on them */
+        } else if(tokenEquals(keyword, "mtllib") ||
+                  tokenEquals(keyword, "usemtl") ||
+                  tokenEquals(keyword, "g") ||
+                  tokenEquals(keyword, "s")) {
+            continue;
+        } else {
+            arrayAppend(_file->lines, File::Line{std::size_t(keywordBegin - begin), UnsignedInt(keyword.size()), File::LineType::Unknown});
+            continue;
         }
 
-        /* Ignore the rest of the line */
-        ignoreLine(*_file->in);
+        arrayAppend(_file->lines, File::Line{std::size_t(keywordEnd - begin), UnsignedInt(lineEnd - keywordEnd), type});
     }
 
     /* Set end of the last object */
-    _file->in->clear();
-    _file->in->seekg(0, std::ios::end);
-    std::get<1>(_file->meshes.back()) = _file->in->tellg();
+    _file->meshes.back().lineEnd = _file->lines.size();
 }
 
 UnsignedInt ObjImporter::doMeshCount() const { return _file->meshes.size(); }
@@ -233,47 +498,66 @@ template<class T> bool checkAndDuplicateInto(const Containers::StridedArrayView1
 
 }
 
+void ObjImporter::parseMeshesConcurrently() {
+    /* The error output redirection below needs to be thread-local, otherwise
+       the threads would be fighting over it */
+    #ifdef CORRADE_BUILD_MULTITHREADED
+    if(!configuration().hasValue("threads")) return;
+    const UnsignedInt meshCount = _file->meshes.size();
+    const UnsignedInt threadCount = Magnum::Implementation::parallelChunkCount(meshCount, configuration().value<UnsignedInt>("threads"));
+    if(threadCount <= 1) return;
+
+    /* Objects can have wildly different sizes, so instead of splitting them
+       into fixed ranges each thread picks the next unprocessed one */
+    _file->meshCache = Containers::Array<Containers::Optional<MeshData>>{meshCount};
+    std::atomic<UnsignedInt> next{0};
+    Magnum::Implementation::parallelFor(threadCount, threadCount, [&](std::size_t, std::size_t, UnsignedInt) {
+        /* Errors get reported again from doMesh() on the calling thread */
+        Error redirectError{nullptr};
+        for(UnsignedInt id; (id = next++) < meshCount; )
+            _file->meshCache[id] = parseMesh(id);
+    });
+    #endif
+}
+
 Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt) {
-    /* Seek the file, set mesh parsing parameters */
-    std::streampos begin, end;
-    UnsignedInt positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset;
-    std::tie(begin, end, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset) = _file->meshes[id];
-    _file->in->seekg(begin);
+    if(!_file->meshCache.empty() && _file->meshCache[id])
+        return MeshTools::owned(*_file->meshCache[id]);
+
+    return parseMesh(id);
+}
+
+Containers::Optional<MeshData> ObjImporter::parseMesh(const UnsignedInt id) const {
+    const File::Mesh& mesh = _file->meshes[id];
+    const UnsignedInt positionIndexOffset = mesh.positionIndexOffset;
+    const UnsignedInt textureCoordinateIndexOffset = mesh.textureCoordinateIndexOffset;
+    const UnsignedInt normalIndexOffset = mesh.normalIndexOffset;
 
+    /* The counts are known from parseMeshNames(), so allocate everything
+       upfront. For indices it's an upper bound, polygons are an error. */
     Containers::Optional<MeshPrimitive> primitive;
     Containers::Array<Vector3> positions;
+    arrayReserve(positions, mesh.positionCount);
     Containers::Array<Vector3> normals;
+    arrayReserve(normals, mesh.normalCount);
     Containers::Array<Vector2> textureCoordinates;
+    arrayReserve(textureCoordinates, mesh.textureCoordinateCount);
     /* Taking a shortcut as there's fortunately nothing else than just 3 types
        of data. First positions, then normals, then texture coordinates. */
     Containers::Array<Vector3ui> indices;
+    arrayReserve(indices, std::size_t(mesh.primitiveCount)*3);
     std::size_t textureCoordinateIndexCount = 0, normalIndexCount = 0;
 
-    try { while(_file->in->good() && _file->in->tellg() < end) {
-        /* Ignore comments */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
-            continue;
-        }
-
-        /* Get the line */
-        std::string line;
-        std::getline(*_file->in, line);
-        line = Utility::String::trim(line);
-
-        /* Ignore empty lines */
-        if(line.empty()) continue;
-
-        /* Split the line into keyword and contents */
-        const std::size_t keywordEnd = line.find(' ');
-        const std::string keyword = line.substr(0, keywordEnd);
-        const std::string contents = keywordEnd != std::string::npos ?
-            Utility::String::ltrim(line.substr(keywordEnd+1)) : "";
+    for(const File::Line& line: _file->lines.slice(mesh.lineBegin, mesh.lineEnd)) {
+        const char* const contentsBegin = _file->in.begin() + line.begin;
+        const char* const contentsEnd = contentsBegin + line.size;
 
         /* Vertex position */
-        if(keyword == "v") {
+        if(line.type == File::LineType::Position) {
+            Vector3 data;
             Float extra{1.0f};
-            const Vector3 data = extractFloatData<3>(contents, &extra);
+            if(!extractFloatData<3>(contentsBegin, contentsEnd, data, &extra))
+                return Containers::NullOpt;
             if(!Math::TypeTraits<Float>::equals(extra, 1.0f)) {
                 Error() << "Trade::ObjImporter::mesh(): homogeneous coordinates are not supported";
                 return Containers::NullOpt;
@@ -282,9 +566,11 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
             arrayAppend(positions, data);
 
         /* Texture coordinate */
-        } else if(keyword == "vt") {
+        } else if(line.type == File::LineType::TextureCoordinate) {
+            Vector2 data;
             Float extra{0.0f};
-            const Vector2 data = extractFloatData<2>(contents, &extra);
+            if(!extractFloatData<2>(contentsBegin, contentsEnd, data, &extra))
+                return Containers::NullOpt;
             if(!Math::TypeTraits<Float>::equals(extra, 0.0f)) {
                 Error() << "Trade::ObjImporter::mesh(): 3D texture coordinates are not supported";
                 return Containers::NullOpt;
@@ -293,15 +579,22 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
             arrayAppend(textureCoordinates, data);
 
         /* Normal */
-        } else if(keyword == "vn") {
-            arrayAppend(normals, Vector3{extractFloatData<3>(contents)});
+        } else if(line.type == File::LineType::Normal) {
+            Vector3 data;
+            if(!extractFloatData<3>(contentsBegin, contentsEnd, data))
+                return Containers::NullOpt;
+
+            arrayAppend(normals, data);
 
         /* Indices */
-        } else if(keyword == "p" || keyword == "l" || keyword == "f") {
-            const std::vector<std::string> indexTuples = Utility::String::splitWithoutEmptyParts(contents, ' ');
+        } else if(line.type == File::LineType::Point || line.type == File::LineType::Line || line.type == File::LineType::Face) {
+            /* Only up to four tuples are saved, which is enough to detect
+               polygons */
+            Containers::ArrayView<const char> indexTuples[4];
+            const std::size_t indexTupleCount = splitTokens(contentsBegin, contentsEnd, indexTuples);
 
             /* Points */
-            if(keyword == "p") {
+            if(line.type == File::LineType::Point) {
                 /* Check that we don't mix the primitives in one mesh */
                 if(primitive && primitive != MeshPrimitive::Points) {
                     Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Points;
@@ -309,7 +602,7 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() != 1) {
+                if(indexTupleCount != 1) {
                     Error() << "Trade::ObjImporter::mesh(): wrong index count for point";
                     return Containers::NullOpt;
                 }
@@ -317,7 +610,7 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
                 primitive = MeshPrimitive::Points;
 
             /* Lines */
-            } else if(keyword == "l") {
+            } else if(line.type == File::LineType::Line) {
                 /* Check that we don't mix the primitives in one mesh */
                 if(primitive && primitive != MeshPrimitive::Lines) {
                     Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Lines;
@@ -325,7 +618,7 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() != 2) {
+                if(indexTupleCount != 2) {
                     Error() << "Trade::ObjImporter::mesh(): wrong index count for line";
                     return Containers::NullOpt;
                 }
@@ -333,7 +626,7 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
                 primitive = MeshPrimitive::Lines;
 
             /* Faces */
-            } else if(keyword == "f") {
+            } else if(line.type == File::LineType::Face) {
                 /* Check that we don't mix the primitives in one mesh */
                 if(primitive && primitive != MeshPrimitive::Triangles) {
                     Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Triangles;
@@ -341,10 +634,10 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() < 3) {
+                if(indexTupleCount < 3) {
                     Error() << "Trade::ObjImporter::mesh(): wrong index count for triangle";
                     return Containers::NullOpt;
-                } else if(indexTuples.size() != 3) {
+                } else if(indexTupleCount != 3) {
                     Error() << "Trade::ObjImporter::mesh(): polygons are not supported";
                     return Containers::NullOpt;
                 }
@@ -353,50 +646,63 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
 
             } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 
-            for(const std::string& indexTuple: indexTuples) {
-                std::vector<std::string> indexStrings = Utility::String::split(indexTuple, '/');
-                if(indexStrings.size() > 3) {
-                    Error() << "Trade::ObjImporter::mesh(): invalid index data";
-                    return Containers::NullOpt;
+            for(std::size_t i = 0; i != indexTupleCount; ++i) {
+                /* Split the tuple on slashes, keeping empty parts */
+                const Containers::ArrayView<const char> indexTuple = indexTuples[i];
+                Containers::ArrayView<const char> indexStrings[3];
+                std::size_t indexStringCount = 0;
+                for(const char* partBegin = indexTuple.begin(); ; ) {
+                    const char* partEnd = partBegin;
+                    while(partEnd != indexTuple.end() && *partEnd != '/') ++partEnd;
+                    if(indexStringCount == 3) {
+                        Error() << "Trade::ObjImporter::mesh(): invalid index data";
+                        return Containers::NullOpt;
+                    }
+                    indexStrings[indexStringCount++] = {partBegin, std::size_t(partEnd - partBegin)};
+                    if(partEnd == indexTuple.end()) break;
+                    partBegin = partEnd + 1;
                 }
 
                 Vector3ui index;
+                UnsignedInt value;
 
                 /* Position indices */
-                index[0] = std::stoul(indexStrings[0]) - positionIndexOffset;
+                if(!parseUnsignedInt(indexStrings[0], value)) {
+                    Error() << "Trade::ObjImporter::mesh(): error while converting numeric data";
+                    return Containers::NullOpt;
+                }
+                index[0] = value - positionIndexOffset;
 
                 /* Texture coordinates */
-                if(indexStrings.size() == 2 || (indexStrings.size() == 3 && !indexStrings[1].empty())) {
-                    index[2] = std::stoul(indexStrings[1]) - textureCoordinateIndexOffset;
+                if(indexStringCount == 2 || (indexStringCount == 3 && !indexStrings[1].empty())) {
+                    if(!parseUnsignedInt(indexStrings[1], value)) {
+                        Error() << "Trade::ObjImporter::mesh(): error while converting numeric data";
+                        return Containers::NullOpt;
+                    }
+                    index[2] = value - textureCoordinateIndexOffset;
                     ++textureCoordinateIndexCount;
                 }
 
                 /* Normal indices */
-                if(indexStrings.size() == 3) {
-                    index[1] = std::stoul(indexStrings[2]) - normalIndexOffset;
+                if(indexStringCount == 3) {
+                    if(!parseUnsignedInt(indexStrings[2], value)) {
+                        Error() << "Trade::ObjImporter::mesh(): error while converting numeric data";
+                        return Containers::NullOpt;
+                    }
+                    index[1] = value - normalIndexOffset;
                     ++normalIndexCount;
                 }
 
                 arrayAppend(indices, index);
             }
 
-        /* Ignore unsupported keywords, error out on unknown keywords */
-        } else if(![&keyword](){
-            /* Using lambda to emulate for-else construct like in Python */
-            for(const std::string expected: {"mtllib", "usemtl", "g", "s"})
-                if(keyword == expected) return true;
-            return false;
-        }()) {
-            Error() << "Trade::ObjImporter::mesh(): unknown keyword" << keyword;
+        /* Unknown keywords. Unsupported keywords were already skipped in
+           parseMeshNames(). */
+        } else if(line.type == File::LineType::Unknown) {
+            Error() << "Trade::ObjImporter::mesh(): unknown keyword" << std::string{contentsBegin, contentsEnd};
             return Containers::NullOpt;
-        }
 
-    }} catch(const std::exception&) {
-        Error() << "Trade::ObjImporter::mesh(): error while converting numeric data";
-        return Containers::NullOpt;
-    } catch(...) {
-        /* Error message already printed */
-        return Containers::NullOpt;
+        } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
     }
 
     /* There should be at least indexed position data */
@@ -486,4 +792,4 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
 }}
 
 CORRADE_PLUGIN_REGISTER(ObjImporter, Magnum::Trade::ObjImporter,
-    "cz.mosra.magnum.Trade.AbstractImporter/0.3.2")
+    "cz.mosra.magnum.Trade.AbstractImporter/0.3.4")
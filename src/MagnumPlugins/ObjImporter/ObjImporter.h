@@ -98,6 +98,26 @@ positions with optional @ref VertexFormat::Vector3 normals and
 @ref VertexFormat::Vector2 texture coordinates, if present in the source file.
 
 Polygons (quads etc.) and material properties are currently not supported.
+
+The file is parsed in-place without copying individual lines or tokens. On
+platforms that support it, @ref openFile() memory-maps the file instead of
+reading it into memory, @ref openData() makes a single copy of the passed
+data.
+
+@section Trade-ObjImporter-configuration Plugin-specific configuration
+
+It's possible to tune various import options through @ref configuration().
+See below for all options and their default values.
+
+@snippet MagnumPlugins/ObjImporter/ObjImporter.conf config
+
+With the @cb{.ini} threads @ce option set to a value other than
+@cb{.ini} 1 @ce, all objects in the file are parsed concurrently right when
+the file is opened and @ref mesh() then returns a copy of the cached
+@ref MeshData. Objects that failed to import are parsed again on the calling
+thread during @ref mesh() to report the error. Parsing in multiple threads is
+available only if Corrade is built with `CORRADE_BUILD_MULTITHREADED`, in
+other cases the option is ignored.
 */
 class MAGNUM_OBJIMPORTER_EXPORT ObjImporter: public AbstractImporter {
     public:
@@ -125,6 +145,8 @@ class MAGNUM_OBJIMPORTER_EXPORT ObjImporter: public AbstractImporter {
         MAGNUM_OBJIMPORTER_LOCAL Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt level) override;
 
         MAGNUM_OBJIMPORTER_LOCAL void parseMeshNames();
+        MAGNUM_OBJIMPORTER_LOCAL void parseMeshesConcurrently();
+        MAGNUM_OBJIMPORTER_LOCAL Containers::Optional<MeshData> parseMesh(UnsignedInt id) const;
 
         Containers::Pointer<File> _file;
 };
@@ -25,6 +25,7 @@
 
 #include <sstream>
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/Utility/DebugStl.h>
@@ -57,6 +58,10 @@ struct ObjImporterTest: TestSuite::Tester {
     void namedMesh();
     void moreMeshes();
     void unnamedFirstMesh();
+    void openDataFloatFormats();
+    void openDataFloatTrailingCharacters();
+    void moreMeshesConcurrent();
+    void concurrentError();
 
     void wrongFloat();
     void wrongInteger();
@@ -92,6 +97,9 @@ struct ObjImporterTest: TestSuite::Tester {
     void unsupportedKeyword();
     void unknownKeyword();
 
+    void benchmarkOpenData();
+    void benchmarkMesh();
+
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
 };
@@ -112,6 +120,10 @@ ObjImporterTest::ObjImporterTest() {
               &ObjImporterTest::namedMesh,
               &ObjImporterTest::moreMeshes,
               &ObjImporterTest::unnamedFirstMesh,
+              &ObjImporterTest::openDataFloatFormats,
+              &ObjImporterTest::openDataFloatTrailingCharacters,
+              &ObjImporterTest::moreMeshesConcurrent,
+              &ObjImporterTest::concurrentError,
 
               &ObjImporterTest::wrongFloat,
               &ObjImporterTest::wrongInteger,
@@ -147,6 +159,9 @@ ObjImporterTest::ObjImporterTest() {
               &ObjImporterTest::unsupportedKeyword,
               &ObjImporterTest::unknownKeyword});
 
+    addBenchmarks({&ObjImporterTest::benchmarkOpenData,
+                   &ObjImporterTest::benchmarkMesh}, 10);
+
     #ifdef OBJIMPORTER_PLUGIN_FILENAME
     CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(OBJIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
     #endif
@@ -457,6 +472,98 @@ void ObjImporterTest::unnamedFirstMesh() {
     CORRADE_COMPARE(importer->meshForName("SecondMesh"), 1);
 }
 
+void ObjImporterTest::openDataFloatFormats() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+
+    /* Exercising the in-place number parsing on various formats, including
+       tabs, CRLF line endings and no newline at the end */
+    CORRADE_VERIFY(importer->openData(
+        "# comment\r\n"
+        "o\tFloats \r\n"
+        "v 1 -2. +.5\r\n"
+        "v\t1.5e2 -2.5E-1\t0.000001\n"
+        "  v 3.4028235e38 1e-3 -0\n"
+        "p 1\n"
+        "p 2\n"
+        "p 3"));
+    CORRADE_COMPARE(importer->meshCount(), 1);
+    CORRADE_COMPARE(importer->meshForName("Floats"), 0);
+
+    const Containers::Optional<MeshData> data = importer->mesh(0);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE_AS(data->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {1.0f, -2.0f, 0.5f},
+            {150.0f, -0.25f, 0.000001f},
+            {3.4028235e38f, 0.001f, 0.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void ObjImporterTest::openDataFloatTrailingCharacters() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+
+    /* Trailing characters after a number are ignored, the same as with
+       std::stof(). Includes a token that's too long for the stack buffer in
+       the slow path. */
+    CORRADE_VERIFY(importer->openData(
+        "o Floats\n"
+        "v 1.0f -2.5e 3e+\n"
+        "v 0.125abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz 1e1. -4x\n"
+        "p 1\n"
+        "p 2\n"));
+
+    const Containers::Optional<MeshData> data = importer->mesh(0);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE_AS(data->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {1.0f, -2.5f, 3.0f},
+            {0.125f, 10.0f, -4.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void ObjImporterTest::moreMeshesConcurrent() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    Containers::Pointer<AbstractImporter> concurrentImporter = _manager.instantiate("ObjImporter");
+    concurrentImporter->configuration().setValue("threads", 4);
+
+    CORRADE_VERIFY(importer->openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "moreMeshes.obj")));
+    CORRADE_VERIFY(concurrentImporter->openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "moreMeshes.obj")));
+    CORRADE_COMPARE(concurrentImporter->meshCount(), 3);
+
+    /* Each mesh should be the same as when imported serially, and stay the
+       same when queried repeatedly */
+    for(UnsignedInt i = 0; i != 3; ++i) for(std::size_t j = 0; j != 2; ++j) {
+        CORRADE_ITERATION(i);
+        CORRADE_ITERATION(j);
+        const Containers::Optional<MeshData> expected = importer->mesh(i);
+        const Containers::Optional<MeshData> data = concurrentImporter->mesh(i);
+        CORRADE_VERIFY(expected);
+        CORRADE_VERIFY(data);
+        CORRADE_COMPARE(data->primitive(), expected->primitive());
+        CORRADE_COMPARE(data->attributeCount(), expected->attributeCount());
+        CORRADE_COMPARE_AS(data->attribute<Vector3>(MeshAttribute::Position),
+            expected->attribute<Vector3>(MeshAttribute::Position),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(data->indices<UnsignedInt>(),
+            expected->indices<UnsignedInt>(),
+            TestSuite::Compare::Container);
+    }
+}
+
+void ObjImporterTest::concurrentError() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    importer->configuration().setValue("threads", 4);
+    CORRADE_VERIFY(importer->openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "wrongNumbers.obj")));
+    const Int id = importer->meshForName("WrongFloat");
+    CORRADE_VERIFY(id > -1);
+
+    /* The error should be printed only when the mesh is requested */
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh(id));
+    CORRADE_COMPARE(out.str(), "Trade::ObjImporter::mesh(): error while converting numeric data\n");
+}
+
 void ObjImporterTest::wrongFloat() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
     CORRADE_VERIFY(importer->openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "wrongNumbers.obj")));
@@ -797,6 +904,55 @@ void ObjImporterTest::unknownKeyword() {
     CORRADE_COMPARE(out.str(), "Trade::ObjImporter::mesh(): unknown keyword bleh\n");
 }
 
+std::string benchmarkData() {
+    /* A grid of 256x256 vertices with texture coordinates and normals */
+    constexpr Int Size = 256;
+    std::ostringstream out;
+    out << "o Grid\n";
+    for(Int y = 0; y != Size; ++y) for(Int x = 0; x != Size; ++x)
+        out << "v " << x*0.0137f << " " << y*0.0291f << " " << (x ^ y)*0.001f << "\n";
+    for(Int y = 0; y != Size; ++y) for(Int x = 0; x != Size; ++x)
+        out << "vt " << x/Float(Size - 1) << " " << y/Float(Size - 1) << "\n";
+    out << "vn 0.0 0.0 1.0\n";
+    for(Int y = 0; y != Size - 1; ++y) for(Int x = 0; x != Size - 1; ++x) {
+        const Int a = y*Size + x + 1;
+        const Int b = a + 1;
+        const Int c = a + Size;
+        const Int d = c + 1;
+        out << "f " << a << "/" << a << "/1 " << b << "/" << b << "/1 " << d << "/" << d << "/1\n"
+            << "f " << a << "/" << a << "/1 " << d << "/" << d << "/1 " << c << "/" << c << "/1\n";
+    }
+    return out.str();
+}
+
+void ObjImporterTest::benchmarkOpenData() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    const std::string data = benchmarkData();
+
+    UnsignedInt meshCount = 0;
+    CORRADE_BENCHMARK(10) {
+        CORRADE_VERIFY(importer->openData({data.data(), data.size()}));
+        meshCount += importer->meshCount();
+    }
+
+    CORRADE_COMPARE(meshCount, 10);
+}
+
+void ObjImporterTest::benchmarkMesh() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    const std::string data = benchmarkData();
+    CORRADE_VERIFY(importer->openData({data.data(), data.size()}));
+
+    UnsignedInt vertexCount = 0;
+    CORRADE_BENCHMARK(1) {
+        Containers::Optional<MeshData> mesh = importer->mesh(0);
+        CORRADE_VERIFY(mesh);
+        vertexCount += mesh->vertexCount();
+    }
+
+    CORRADE_COMPARE(vertexCount, 256*256);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::ObjImporterTest)
@@ -24,7 +24,7 @@
 */
 
 #include <sstream>
-#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
@@ -35,6 +35,7 @@
 #include "Magnum/PixelFormat.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImportBatch.h"
 
 #include "configure.h"
 
@@ -59,6 +60,12 @@ struct TgaImporterTest: TestSuite::Tester {
 
     void rleTooLarge();
 
+    void zeroCopyGrayscale();
+    void zeroCopyColor();
+    void zeroCopyFile();
+
+    void batch();
+
     void openTwice();
     void importTwice();
 
@@ -146,9 +153,15 @@ TgaImporterTest::TgaImporterTest() {
     addTests({&TgaImporterTest::grayscale8,
               &TgaImporterTest::grayscale8Rle,
 
-              &TgaImporterTest::rleTooLarge});
+              &TgaImporterTest::rleTooLarge,
+
+              &TgaImporterTest::zeroCopyGrayscale,
+              &TgaImporterTest::zeroCopyColor,
+              &TgaImporterTest::zeroCopyFile});
+
+    addTests({&TgaImporterTest::batch,
 
-    addTests({&TgaImporterTest::openTwice,
+              &TgaImporterTest::openTwice,
               &TgaImporterTest::importTwice});
 
     /* Load the plugin directly from the build tree. Otherwise it's static and
@@ -421,6 +434,90 @@ void TgaImporterTest::rleTooLarge() {
     CORRADE_COMPARE(out.str(), "Trade::TgaImporter::image2D(): RLE data larger than advertised Vector(2, 3) pixels at byte 28\n");
 }
 
+void TgaImporterTest::zeroCopyGrayscale() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    importer->setFlags(ImporterFlag::ZeroCopy);
+    const char data[] = {
+        0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        1, 2,
+        3, 4,
+        5, 6
+    };
+    CORRADE_VERIFY(importer->openData(data));
+
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->storage().alignment(), 1);
+    CORRADE_COMPARE(image->format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+
+    /* The data should be a view directly on the input */
+    CORRADE_COMPARE(image->dataFlags(), DataFlags{});
+    CORRADE_COMPARE(static_cast<const void*>(image->data().data()), data + 18);
+    CORRADE_COMPARE(image->data().size(), 6);
+}
+
+void TgaImporterTest::zeroCopyColor() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    importer->setFlags(ImporterFlag::ZeroCopy);
+    const char pixels[] = {
+        3, 2, 1, 4, 3, 2,
+        5, 4, 3, 6, 5, 4,
+        7, 6, 5, 8, 7, 6
+    };
+    CORRADE_VERIFY(importer->openData(Color24));
+
+    /* Color data need to be swizzled, so they're copied always */
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView(pixels),
+        TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::zeroCopyFile() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    importer->setFlags(ImporterFlag::ZeroCopy);
+    CORRADE_VERIFY(importer->openFile(Utility::Directory::join(TGAIMPORTER_TEST_DIR, "file.tga")));
+
+    /* The image references the memory-mapped file (or the file loaded by the
+       base implementation on platforms without mapping support) */
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->dataFlags(), DataFlags{});
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView<char>({
+        1, 2, 3, 4, 5, 6
+    }), TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::batch() {
+    /* Just a smoke test verifying the plugin works with ImportBatch, which is
+       tested thoroughly in Trade/Test/ImportBatchTest.cpp */
+    ImportBatch batch{_manager, "TgaImporter", 2};
+    CORRADE_VERIFY(batch.openData(Color24));
+
+    Containers::Array<Containers::Optional<ImageData2D>> images{4};
+    for(Containers::Optional<ImageData2D>& image: images)
+        batch.addImage2D(0, image);
+    CORRADE_VERIFY(batch.execute());
+
+    const char pixels[] = {
+        3, 2, 1, 4, 3, 2,
+        5, 4, 3, 6, 5, 4,
+        7, 6, 5, 8, 7, 6
+    };
+    for(std::size_t i = 0; i != images.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(images[i]);
+        CORRADE_COMPARE(images[i]->format(), PixelFormat::RGB8Unorm);
+        CORRADE_COMPARE(images[i]->size(), Vector2i(2, 3));
+        CORRADE_COMPARE_AS(images[i]->data(), Containers::arrayView(pixels),
+            TestSuite::Compare::Container);
+    }
+}
+
 void TgaImporterTest::openTwice() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
 
@@ -48,9 +48,12 @@ TgaImporter::~TgaImporter() = default;
 
 ImporterFeatures TgaImporter::doFeatures() const { return ImporterFeature::OpenData; }
 
-bool TgaImporter::doIsOpened() const { return _in; }
+bool TgaImporter::doIsOpened() const { return !_in.empty(); }
 
-void TgaImporter::doClose() { _in = nullptr; }
+void TgaImporter::doClose() {
+    _inData = nullptr;
+    _in = nullptr;
+}
 
 void TgaImporter::doOpenData(const Containers::ArrayView<const char> data) {
     /* Because here we're copying the data and using the _in to check if file
@@ -65,8 +68,16 @@ void TgaImporter::doOpenData(const Containers::ArrayView<const char> data) {
         return;
     }
 
-    _in = Containers::Array<char>{data.size()};
-    std::copy(data.begin(), data.end(), _in.begin());
+    /* With zero copy the caller guarantees the data stay alive until the
+       importer is closed, so we can reference them directly */
+    if(flags() & ImporterFlag::ZeroCopy) {
+        _in = data;
+        return;
+    }
+
+    _inData = Containers::Array<char>{Containers::NoInit, data.size()};
+    Utility::copy(data, _inData);
+    _in = _inData;
 }
 
 UnsignedInt TgaImporter::doImage2DCount() const { return 1; }
@@ -129,8 +140,12 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedIn
     const std::size_t pixelSize = header.bpp/8;
     const std::size_t outputSize = std::size_t(size.product())*pixelSize;
 
+    /* Adjust pixel storage if row size is not four byte aligned */
+    PixelStorage storage;
+    if((size.x()*header.bpp/8)%4 != 0)
+        storage.setAlignment(1);
+
     /* Copy data directly if not RLE */
-    Containers::Array<char> data{outputSize};
     Containers::ArrayView<const char> srcPixels = _in.suffix(sizeof(Implementation::TgaHeader));
     if(!rle) {
         /* Files that are larger are allowed in this case (but not for RLE) */
@@ -139,6 +154,14 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedIn
             return Containers::NullOpt;
         }
 
+        /* Grayscale data don't need any conversion, so with zero copy they
+           can be returned as a view on the original memory */
+        if(format == PixelFormat::R8Unorm && (flags() & ImporterFlag::ZeroCopy))
+            return ImageData2D{storage, format, size, DataFlags{}, srcPixels.prefix(outputSize)};
+    }
+
+    Containers::Array<char> data{outputSize};
+    if(!rle) {
         Utility::copy(srcPixels.prefix(data.size()), data);
 
     /* Otherwise decode */
@@ -183,11 +206,6 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedIn
         }
     }
 
-    /* Adjust pixel storage if row size is not four byte aligned */
-    PixelStorage storage;
-    if((size.x()*header.bpp/8)%4 != 0)
-        storage.setAlignment(1);
-
     if(format == PixelFormat::RGB8Unorm) {
         if(flags() & ImporterFlag::Verbose)
             Debug{} << "Trade::TgaImporter::image2D(): converting from BGR to RGB";
@@ -206,4 +224,4 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedIn
 }}
 
 CORRADE_PLUGIN_REGISTER(TgaImporter, Magnum::Trade::TgaImporter,
-    "cz.mosra.magnum.Trade.AbstractImporter/0.3.2")
+    "cz.mosra.magnum.Trade.AbstractImporter/0.3.4")
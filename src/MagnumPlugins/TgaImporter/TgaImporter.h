@@ -98,6 +98,14 @@ are imported with default @ref PixelStorage parameters except for alignment,
 which may be changed to `1` if the data require it.
 
 RLE compression is supported, paletted images are not.
+
+The data passed to @ref openData() are copied into the importer. With
+@ref ImporterFlag::ZeroCopy set, they're referenced directly instead and
+@ref openFile() memory-maps the file. Uncompressed grayscale images are then
+returned as a non-owned view on the input, with empty
+@ref ImageData::dataFlags(). Color images still need a BGR to RGB conversion
+and RLE-compressed images need decoding, so those are always returned as a
+newly allocated array.
 */
 class MAGNUM_TGAIMPORTER_EXPORT TgaImporter: public AbstractImporter {
     public:
@@ -117,7 +125,10 @@ class MAGNUM_TGAIMPORTER_EXPORT TgaImporter: public AbstractImporter {
         UnsignedInt MAGNUM_TGAIMPORTER_LOCAL doImage2DCount() const override;
         Containers::Optional<ImageData2D> MAGNUM_TGAIMPORTER_LOCAL doImage2D(UnsignedInt id, UnsignedInt level) override;
 
-        Containers::Array<char> _in;
+        /* Either a copy of the data passed to openData() or, with
+           ImporterFlag::ZeroCopy, directly the input */
+        Containers::Array<char> _inData;
+        Containers::ArrayView<const char> _in;
 };
 
 }}
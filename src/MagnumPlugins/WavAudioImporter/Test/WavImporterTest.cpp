@@ -37,6 +37,14 @@
 
 namespace Magnum { namespace Audio { namespace Test { namespace {
 
+constexpr struct {
+    const char* name;
+    bool file;
+} ReadFramesData[]{
+    {"data", false},
+    {"file", true}
+};
+
 struct WavImporterTest: TestSuite::Tester {
     explicit WavImporterTest();
 
@@ -78,6 +86,10 @@ struct WavImporterTest: TestSuite::Tester {
     void surround51Channel16();
     void surround71Channel24();
 
+    void readFrames();
+    void readFramesBigEndian();
+    void readFramesSeek();
+
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
 };
@@ -121,6 +133,11 @@ WavImporterTest::WavImporterTest() {
               &WavImporterTest::surround51Channel16,
               &WavImporterTest::surround71Channel24});
 
+    addInstancedTests({&WavImporterTest::readFrames,
+                       &WavImporterTest::readFramesBigEndian,
+                       &WavImporterTest::readFramesSeek},
+        Containers::arraySize(ReadFramesData));
+
     /* Load the plugin directly from the build tree. Otherwise it's static and
        already loaded. */
     #ifdef WAVAUDIOIMPORTER_PLUGIN_FILENAME
@@ -145,7 +162,7 @@ void WavImporterTest::wrongSignature() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "wrongSignature.wav")));
-    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): the file signature is invalid\n");
+    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openFile(): the file signature is invalid\n");
 }
 
 void WavImporterTest::unsupportedFormat() {
@@ -154,7 +171,7 @@ void WavImporterTest::unsupportedFormat() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "unsupportedFormat.wav")));
-    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): unsupported format Audio::WavAudioFormat::AdPcm\n");
+    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openFile(): unsupported format Audio::WavAudioFormat::AdPcm\n");
 }
 
 void WavImporterTest::unsupportedChannelCount() {
@@ -163,7 +180,7 @@ void WavImporterTest::unsupportedChannelCount() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "unsupportedChannelCount.wav")));
-    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): PCM with unsupported channel count 6 with 8 bits per sample\n");
+    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openFile(): PCM with unsupported channel count 6 with 8 bits per sample\n");
 }
 
 void WavImporterTest::invalidPadding() {
@@ -172,7 +189,7 @@ void WavImporterTest::invalidPadding() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "invalidPadding.wav")));
-    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): the file has improper size, expected 66 but got 73\n");
+    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openFile(): the file has improper size, expected 66 but got 73\n");
 }
 
 void WavImporterTest::invalidLength() {
@@ -181,7 +198,7 @@ void WavImporterTest::invalidLength() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "invalidLength.wav")));
-    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): the file has improper size, expected 160844 but got 80444\n");
+    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openFile(): the file has improper size, expected 160844 but got 80444\n");
 }
 
 void WavImporterTest::invalidDataChunk() {
@@ -190,7 +207,7 @@ void WavImporterTest::invalidDataChunk() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "invalidDataChunk.wav")));
-    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): the file contains no data chunk\n");
+    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openFile(): the file contains no data chunk\n");
 }
 
 void WavImporterTest::invalidFactChunk() {
@@ -222,7 +239,7 @@ void WavImporterTest::mono4() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "mono4.wav")));
-    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): unsupported format Audio::WavAudioFormat::AdPcm\n");
+    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openFile(): unsupported format Audio::WavAudioFormat::AdPcm\n");
 }
 
 void WavImporterTest::mono8() {
@@ -306,7 +323,7 @@ void WavImporterTest::stereo4() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo4.wav")));
-    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): unsupported format Audio::WavAudioFormat::AdPcm\n");
+    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openFile(): unsupported format Audio::WavAudioFormat::AdPcm\n");
 }
 
 void WavImporterTest::stereo8() {
@@ -353,7 +370,7 @@ void WavImporterTest::stereo12() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo12.wav")));
-    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): PCM with unsupported channel count 2 with 12 bits per sample\n");
+    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openFile(): PCM with unsupported channel count 2 with 12 bits per sample\n");
 }
 
 void WavImporterTest::stereo16() {
@@ -374,7 +391,7 @@ void WavImporterTest::stereo24() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo24.wav")));
-    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): PCM with unsupported channel count 2 with 24 bits per sample\n");
+    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openFile(): PCM with unsupported channel count 2 with 24 bits per sample\n");
 }
 
 void WavImporterTest::stereo32() {
@@ -383,7 +400,7 @@ void WavImporterTest::stereo32() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo32.wav")));
-    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): PCM with unsupported channel count 2 with 32 bits per sample\n");
+    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openFile(): PCM with unsupported channel count 2 with 32 bits per sample\n");
 }
 
 void WavImporterTest::mono32f() {
@@ -457,7 +474,7 @@ void WavImporterTest::surround51Channel16() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "surround51Channel16.wav")));
-    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): unsupported format Audio::WavAudioFormat::Extensible\n");
+    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openFile(): unsupported format Audio::WavAudioFormat::Extensible\n");
 }
 
 void WavImporterTest::surround71Channel24() {
@@ -466,7 +483,92 @@ void WavImporterTest::surround71Channel24() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "surround71Channel24.wav")));
-    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): unsupported format Audio::WavAudioFormat::Extensible\n");
+    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openFile(): unsupported format Audio::WavAudioFormat::Extensible\n");
+}
+
+bool openTestFile(AbstractImporter& importer, const std::string& filename, bool file) {
+    const std::string path = Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, filename);
+    return file ? importer.openFile(path) : importer.openData(Utility::Directory::read(path));
+}
+
+void WavImporterTest::readFrames() {
+    auto&& data = ReadFramesData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
+    CORRADE_VERIFY(importer->features() & ImporterFeature::Streaming);
+    /* The data chunk is preceded by a junk chunk, verifying the offset is
+       calculated correctly */
+    CORRADE_VERIFY(openTestFile(*importer, "mono8junk.wav", data.file));
+    CORRADE_COMPARE(importer->format(), BufferFormat::Mono8);
+
+    char out[6];
+    CORRADE_COMPARE(importer->readFrames(out), 6);
+    CORRADE_COMPARE_AS(Containers::arrayView(out).prefix(4), Containers::arrayView<char>({
+        '\x7f', '\x7f', '\x7f', '\x7f'
+    }), TestSuite::Compare::Container);
+
+    /* Reading the rest piece by piece gives the same result as data() */
+    const Containers::Array<char> expected = importer->data();
+    std::size_t offset = 6;
+    while(std::size_t count = importer->readFrames(out)) {
+        CORRADE_ITERATION(offset);
+        CORRADE_COMPARE_AS(Containers::arrayView(out).prefix(count),
+            expected.slice(offset, offset + count),
+            TestSuite::Compare::Container);
+        offset += count;
+    }
+    CORRADE_COMPARE(offset, expected.size());
+
+    /* Reading past the end doesn't do anything */
+    CORRADE_COMPARE(importer->readFrames(out), 0);
+}
+
+void WavImporterTest::readFramesBigEndian() {
+    auto&& data = ReadFramesData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
+    CORRADE_VERIFY(openTestFile(*importer, "stereo64fbe.wav", data.file));
+    CORRADE_COMPARE(importer->format(), BufferFormat::StereoDouble);
+
+    /* Space for one and a half frames, should read just one and swap the
+       endianness. The first two frames are all zeros, skip them. */
+    importer->seekFrame(2);
+    Double out[3];
+    CORRADE_COMPARE(importer->readFrames(Containers::arrayCast<char>(Containers::arrayView(out))), 1);
+    CORRADE_COMPARE_AS(Containers::arrayView(out).prefix(2),
+        Containers::arrayView<Double>({3.0517578125e-05, 6.103515625e-05}),
+        TestSuite::Compare::Container);
+}
+
+void WavImporterTest::readFramesSeek() {
+    auto&& data = ReadFramesData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
+    CORRADE_VERIFY(openTestFile(*importer, "mono16be.wav", data.file));
+
+    UnsignedShort out[2];
+    Containers::ArrayView<char> outBytes = Containers::arrayCast<char>(Containers::arrayView(out));
+    CORRADE_COMPARE(importer->readFrames(outBytes), 2);
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView<UnsignedShort>({0x101d, 0xc571}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(importer->readFrames(outBytes), 0);
+
+    /* Seeking back makes it possible to read again */
+    importer->seekFrame(1);
+    CORRADE_COMPARE(importer->readFrames(outBytes), 1);
+    CORRADE_COMPARE(out[0], 0xc571);
+
+    /* Seeking past the end is clamped */
+    importer->seekFrame(17);
+    CORRADE_COMPARE(importer->readFrames(outBytes), 0);
+
+    importer->seekFrame(0);
+    CORRADE_COMPARE(importer->readFrames(outBytes), 2);
+    CORRADE_COMPARE(out[0], 0x101d);
 }
 
 }}}}
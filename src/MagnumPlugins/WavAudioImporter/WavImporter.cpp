@@ -26,10 +26,14 @@
 
 #include "WavImporter.h"
 
+#include <cstring>
+#include <fstream>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Debug.h>
 #include <Corrade/Utility/EndiannessBatch.h>
 
+#include "Magnum/Math/Functions.h"
+
 #include "MagnumPlugins/WavAudioImporter/WavHeader.h"
 
 namespace Magnum { namespace Audio {
@@ -39,29 +43,46 @@ using Implementation::WavAudioFormat;
 using Implementation::WavFormatChunk;
 using Implementation::WavHeaderChunk;
 
-WavImporter::WavImporter() = default;
-
-WavImporter::WavImporter(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractImporter{manager, plugin} {}
-
-ImporterFeatures WavImporter::doFeatures() const { return ImporterFeature::OpenData; }
+namespace {
 
-bool WavImporter::doIsOpened() const { return !!_data; }
+void swapEndianness(const Containers::ArrayView<char> data, const UnsignedShort bitsPerSample) {
+    if(bitsPerSample == 16)
+        Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint16_t>(data));
+    else if(bitsPerSample == 32)
+        Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint32_t>(data));
+    else if(bitsPerSample == 64)
+        Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint64_t>(data));
+    else CORRADE_INTERNAL_ASSERT(bitsPerSample == 8);
+}
 
-void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
+struct WavInfo {
+    BufferFormat format;
+    UnsignedInt frequency;
+    std::size_t dataOffset, dataSize;
+    UnsignedShort bitsPerSample;
+    bool hasBigEndianData;
+};
+
+/* Parses the headers of a file of given size. The read() function is
+   expected to copy given size at given offset to the output and return
+   false if it's out of bounds, which allows the same code to be used both
+   for data in memory and for files streamed from disk. */
+template<class Read> Containers::Optional<WavInfo> parseHeaders(const char* const prefix, const std::size_t size, Read read) {
     /* Check file size */
-    if(data.size() < sizeof(WavHeaderChunk) + sizeof(WavFormatChunk) + sizeof(RiffChunk)) {
-        Error() << "Audio::WavImporter::openData(): the file is too short:" << data.size() << "bytes";
-        return;
+    if(size < sizeof(WavHeaderChunk) + sizeof(WavFormatChunk) + sizeof(RiffChunk)) {
+        Error() << prefix << "the file is too short:" << size << "bytes";
+        return {};
     }
 
     /* Get the RIFF/WAV header */
-    WavHeaderChunk header(*reinterpret_cast<const WavHeaderChunk*>(data.begin()));
+    WavHeaderChunk header;
+    CORRADE_INTERNAL_ASSERT_OUTPUT(read(0, &header, sizeof(WavHeaderChunk)));
 
     /* Check RIFF/WAV file signature */
     if((std::strncmp(header.chunk.chunkId, "RIFF", 4) != 0 && std::strncmp(header.chunk.chunkId, "RIFX", 4) != 0) ||
        std::strncmp(header.format, "WAVE", 4) != 0) {
-        Error() << "Audio::WavImporter::openData(): the file signature is invalid";
-        return;
+        Error() << prefix << "the file signature is invalid";
+        return {};
     }
 
     /* Check if the file is Big-Endian. While RIFX files are extremely rare,
@@ -73,16 +94,16 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
         Utility::Endianness::swapInPlace(header.chunk.chunkSize);
 
     /* Check file size */
-    if(header.chunk.chunkSize < 36 || header.chunk.chunkSize + 8 != data.size()) {
-        Error() << "Audio::WavImporter::openData(): the file has improper size, expected"
-                << header.chunk.chunkSize + 8 << "but got" << data.size();
-        return;
+    if(header.chunk.chunkSize < 36 || header.chunk.chunkSize + 8 != size) {
+        Error() << prefix << "the file has improper size, expected"
+                << header.chunk.chunkSize + 8 << "but got" << size;
+        return {};
     }
 
-    const RiffChunk* dataChunk = nullptr;
     /* We're doing endian-swapping on this, thus can't be just a reference to
        the original data */
     Containers::Optional<WavFormatChunk> formatChunk;
+    std::size_t dataChunkOffset = 0;
     UnsignedInt dataChunkSize = 0;
 
     const UnsignedInt headerSize = sizeof(WavHeaderChunk);
@@ -90,28 +111,29 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
 
     /* Skip any chunks that aren't the format or data chunk */
     while(headerSize + offset <= header.chunk.chunkSize) {
-        const RiffChunk* currChunk = reinterpret_cast<const RiffChunk*>(data.begin() + headerSize + offset);
-        UnsignedInt chunkSize = currChunk->chunkSize;
+        const std::size_t chunkOffset = headerSize + offset;
+        RiffChunk currChunk;
+        if(!read(chunkOffset, &currChunk, sizeof(RiffChunk))) break;
+        UnsignedInt chunkSize = currChunk.chunkSize;
         if(hasBigEndianData != Utility::Endianness::isBigEndian())
             Utility::Endianness::swapInPlace(chunkSize);
 
         offset += chunkSize + sizeof(RiffChunk);
 
-        if(std::strncmp(currChunk->chunkId, "fmt ", 4) == 0) {
+        if(std::strncmp(currChunk.chunkId, "fmt ", 4) == 0) {
             if(formatChunk) {
-                Error() << "Audio::WavImporter::openData(): the file contains too many format chunks";
-                return;
+                Error() << prefix << "the file contains too many format chunks";
+                return {};
             }
 
-            formatChunk = WavFormatChunk{*reinterpret_cast<const WavFormatChunk*>(currChunk)};
-
-        } else if(std::strncmp(currChunk->chunkId, "data", 4) == 0) {
-            if(dataChunk != nullptr) {
-                Error() << "Audio::WavImporter::openData(): the file contains too many data chunks";
-                return;
+            formatChunk.emplace();
+            if(!read(chunkOffset, &*formatChunk, sizeof(WavFormatChunk))) {
+                formatChunk = Containers::NullOpt;
+                break;
             }
 
-            dataChunk = currChunk;
+        } else if(std::strncmp(currChunk.chunkId, "data", 4) == 0) {
+            dataChunkOffset = chunkOffset + sizeof(RiffChunk);
             dataChunkSize = chunkSize;
             break;
         }
@@ -119,14 +141,14 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
 
     /* Make sure we actually got a format chunk */
     if(!formatChunk) {
-        Error() << "Audio::WavImporter::openData(): the file contains no format chunk";
-        return;
+        Error() << prefix << "the file contains no format chunk";
+        return {};
     }
 
     /* Make sure we actually got a data chunk */
-    if(dataChunk == nullptr) {
-        Error() << "Audio::WavImporter::openData(): the file contains no data chunk";
-        return;
+    if(!dataChunkOffset) {
+        Error() << prefix << "the file contains no data chunk";
+        return {};
     }
 
     /* Fix endianness on Format chunk */
@@ -137,119 +159,211 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
             formatChunk->byteRate, formatChunk->blockAlign,
             formatChunk->bitsPerSample);
 
+    BufferFormat format;
+
     /* Check PCM format */
     if(formatChunk->audioFormat == WavAudioFormat::Pcm) {
         /* Decide about format */
         if(formatChunk->numChannels == 1 && formatChunk->bitsPerSample == 8)
-            _format = BufferFormat::Mono8;
+            format = BufferFormat::Mono8;
         else if(formatChunk->numChannels == 1 && formatChunk->bitsPerSample == 16)
-            _format = BufferFormat::Mono16;
+            format = BufferFormat::Mono16;
         else if(formatChunk->numChannels == 2 && formatChunk->bitsPerSample == 8)
-            _format = BufferFormat::Stereo8;
+            format = BufferFormat::Stereo8;
         else if(formatChunk->numChannels == 2 && formatChunk->bitsPerSample == 16)
-             _format = BufferFormat::Stereo16;
+            format = BufferFormat::Stereo16;
         else {
-            Error() << "Audio::WavImporter::openData(): PCM with unsupported channel count"
+            Error() << prefix << "PCM with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return {};
         }
 
     /* Check IEEE Float format */
     } else if(formatChunk->audioFormat == WavAudioFormat::IeeeFloat) {
         if(formatChunk->numChannels == 1 && formatChunk->bitsPerSample == 32)
-            _format = BufferFormat::MonoFloat;
+            format = BufferFormat::MonoFloat;
         else if(formatChunk->numChannels == 2 && formatChunk->bitsPerSample == 32)
-            _format = BufferFormat::StereoFloat;
+            format = BufferFormat::StereoFloat;
         else if(formatChunk->numChannels == 1 && formatChunk->bitsPerSample == 64)
-            _format = BufferFormat::MonoDouble;
+            format = BufferFormat::MonoDouble;
         else if(formatChunk->numChannels == 2 && formatChunk->bitsPerSample == 64)
-            _format = BufferFormat::StereoDouble;
+            format = BufferFormat::StereoDouble;
         else {
-            Error() << "Audio::WavImporter::openData(): IEEE with unsupported channel count"
+            Error() << prefix << "IEEE with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return {};
         }
 
     /* Check A-Law format */
     } else if(formatChunk->audioFormat == WavAudioFormat::ALaw) {
         if(formatChunk->numChannels == 1)
-            _format = BufferFormat::MonoALaw;
+            format = BufferFormat::MonoALaw;
         else if(formatChunk->numChannels == 2)
-            _format = BufferFormat::StereoALaw;
+            format = BufferFormat::StereoALaw;
         else {
-            Error() << "Audio::WavImporter::openData(): ALaw with unsupported channel count"
+            Error() << prefix << "ALaw with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return {};
         }
 
     /* Check μ-Law format */
     } else if(formatChunk->audioFormat == WavAudioFormat::MuLaw) {
         if(formatChunk->numChannels == 1)
-            _format = BufferFormat::MonoMuLaw;
+            format = BufferFormat::MonoMuLaw;
         else if(formatChunk->numChannels == 2)
-            _format = BufferFormat::StereoMuLaw;
+            format = BufferFormat::StereoMuLaw;
         else {
-            Error() << "Audio::WavImporter::openData(): MuLaw with unsupported channel count"
+            Error() << prefix << "MuLaw with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return {};
         }
 
     /* Unknown/unimplemented format */
     } else {
-        Error() << "Audio::WavImporter::openData(): unsupported format" << formatChunk->audioFormat;
-        return;
+        Error() << prefix << "unsupported format" << formatChunk->audioFormat;
+        return {};
     }
 
     /* Size sanity checks */
-    if(headerSize + offset > data.size()) {
-        Error() << "Audio::WavImporter::openData(): file size doesn't match computed size";
-        return;
+    if(headerSize + offset > size) {
+        Error() << prefix << "file size doesn't match computed size";
+        return {};
     }
 
     /* Format sanity checks */
     if(formatChunk->blockAlign != formatChunk->numChannels * formatChunk->bitsPerSample / 8 ||
        formatChunk->byteRate != formatChunk->sampleRate * formatChunk->blockAlign) {
-        Error() << "Audio::WavImporter::openData(): the file is corrupted";
-        return;
+        Error() << prefix << "the file is corrupted";
+        return {};
     }
 
-    /* Save frequency */
-    _frequency = formatChunk->sampleRate;
+    return WavInfo{format, formatChunk->sampleRate, dataChunkOffset,
+        dataChunkSize, formatChunk->bitsPerSample, hasBigEndianData};
+}
+
+}
+
+WavImporter::WavImporter() = default;
+
+WavImporter::WavImporter(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractImporter{manager, plugin} {}
+
+WavImporter::~WavImporter() = default;
+
+ImporterFeatures WavImporter::doFeatures() const { return ImporterFeature::OpenData|ImporterFeature::Streaming; }
+
+bool WavImporter::doIsOpened() const { return _data || _file; }
+
+void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
+    const Containers::Optional<WavInfo> info = parseHeaders("Audio::WavImporter::openData():", data.size(),
+        [&data](const std::size_t offset, void* const out, const std::size_t size) {
+            if(offset + size > data.size()) return false;
+            std::memcpy(out, data.data() + offset, size);
+            return true;
+        });
+    if(!info) return;
 
     /* Copy the data */
-    const char* dataChunkPtr = reinterpret_cast<const char*>(dataChunk + 1);
-    _data = Containers::Array<char>(dataChunkSize);
-    std::copy(dataChunkPtr, dataChunkPtr+dataChunkSize, _data->begin());
+    _data = Containers::Array<char>(info->dataSize);
+    std::copy(data.begin() + info->dataOffset, data.begin() + info->dataOffset + info->dataSize, _data->begin());
 
     /* Fix the data endianness */
-    if(hasBigEndianData != Utility::Endianness::isBigEndian()) {
-        if(formatChunk->bitsPerSample == 16)
-            Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint16_t>(*_data));
-        else if(formatChunk->bitsPerSample == 32)
-            Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint32_t>(*_data));
-        else if(formatChunk->bitsPerSample == 64)
-            Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint64_t>(*_data));
-        else CORRADE_INTERNAL_ASSERT(formatChunk->bitsPerSample == 8);
+    _format = info->format;
+    _frequency = info->frequency;
+    _bitsPerSample = info->bitsPerSample;
+    _swapEndianness = false;
+    if(info->hasBigEndianData != Utility::Endianness::isBigEndian())
+        swapEndianness(*_data, _bitsPerSample);
+
+    _dataOffset = info->dataOffset;
+    _dataSize = info->dataSize;
+    _position = 0;
+}
+
+void WavImporter::doOpenFile(const std::string& filename) {
+    /* Keep the file opened and read the data from it only when requested,
+       instead of reading the whole file into memory */
+    Containers::Pointer<std::ifstream> file{new std::ifstream{filename, std::ios::binary}};
+    if(!*file) {
+        Error() << "Audio::WavImporter::openFile(): cannot open file" << filename;
+        return;
     }
+
+    file->seekg(0, std::ios::end);
+    const std::size_t size = file->tellg();
+
+    const Containers::Optional<WavInfo> info = parseHeaders("Audio::WavImporter::openFile():", size,
+        [&file, size](const std::size_t offset, void* const out, const std::size_t outSize) {
+            if(offset + outSize > size) return false;
+            file->seekg(offset);
+            file->read(static_cast<char*>(out), outSize);
+            return !!*file;
+        });
+    if(!info) return;
+
+    _file = std::move(file);
+    _format = info->format;
+    _frequency = info->frequency;
+    _bitsPerSample = info->bitsPerSample;
+    _swapEndianness = info->hasBigEndianData != Utility::Endianness::isBigEndian();
+    _dataOffset = info->dataOffset;
+    _dataSize = info->dataSize;
+    _position = 0;
 }
 
-void WavImporter::doClose() { _data = Containers::NullOpt; }
+void WavImporter::doClose() {
+    _data = Containers::NullOpt;
+    _file = nullptr;
+}
 
 BufferFormat WavImporter::doFormat() const { return _format; }
 
 UnsignedInt WavImporter::doFrequency() const { return _frequency; }
 
 Containers::Array<char> WavImporter::doData() {
-    Containers::Array<char> copy(_data->size());
-    std::copy(_data->begin(), _data->end(), copy.begin());
-    return copy;
+    Containers::Array<char> out{Containers::NoInit, _dataSize};
+    if(_data) std::copy(_data->begin(), _data->end(), out.begin());
+    else readFromFile(0, out);
+    return out;
+}
+
+std::size_t WavImporter::doReadFrames(const Containers::ArrayView<char> destination) {
+    /* If the data chunk size isn't a multiple of the frame size, ignore the
+       trailing incomplete frame */
+    const std::size_t frameSize = bufferFormatFrameSize(_format);
+    const std::size_t size = Math::min(destination.size(), _dataSize - _position)/frameSize*frameSize;
+
+    if(_data) std::copy(_data->begin() + _position, _data->begin() + _position + size, destination.begin());
+    else readFromFile(_position, destination.prefix(size));
+
+    _position += size;
+    return size/frameSize;
+}
+
+void WavImporter::doSeekFrame(const std::size_t frame) {
+    const std::size_t frameSize = bufferFormatFrameSize(_format);
+    _position = Math::min(frame, _dataSize/frameSize)*frameSize;
+}
+
+void WavImporter::readFromFile(const std::size_t offset, const Containers::ArrayView<char> destination) {
+    _file->seekg(_dataOffset + offset);
+    _file->read(destination.data(), destination.size());
+
+    /* If the file got truncated since it was opened, zero-fill the rest
+       instead of returning garbage */
+    const std::size_t readSize = _file->gcount();
+    if(readSize != destination.size()) {
+        std::fill(destination.begin() + readSize, destination.end(), '\0');
+        _file->clear();
+    }
+
+    if(_swapEndianness) swapEndianness(destination, _bitsPerSample);
 }
 
 }}
 
 CORRADE_PLUGIN_REGISTER(WavAudioImporter, Magnum::Audio::WavImporter,
-    "cz.mosra.magnum.Audio.AbstractImporter/0.1")
+    "cz.mosra.magnum.Audio.AbstractImporter/0.1.1")
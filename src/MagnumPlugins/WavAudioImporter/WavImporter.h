@@ -30,8 +30,10 @@
  * @brief Class @ref Magnum::Audio::WavImporter
  */
 
+#include <iosfwd>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pointer.h>
 
 #include "Magnum/Audio/AbstractImporter.h"
 
@@ -108,6 +110,15 @@ See @ref building, @ref cmake and @ref plugins for more information.
 @section Audio-WavImporter-limitations Behavior and limitations
 
 Multi-channel formats are not supported.
+
+The plugin supports @ref ImporterFeature::Streaming. With @ref openData(),
+the data chunk is copied into the importer and @ref readFrames() copies
+consecutive parts of it. With @ref openFile(), only the file headers are read
+when opening and the file is kept open, with @ref data() and
+@ref readFrames() reading from it on demand --- which means the file is never
+fully loaded into memory when streaming it through @ref Stream. Trailing bytes
+of a data chunk that don't form a whole frame are ignored by
+@ref readFrames().
 */
 class MAGNUM_WAVAUDIOIMPORTER_EXPORT WavImporter: public AbstractImporter {
     public:
@@ -117,19 +128,30 @@ class MAGNUM_WAVAUDIOIMPORTER_EXPORT WavImporter: public AbstractImporter {
         /** @brief Plugin manager constructor */
         explicit WavImporter(PluginManager::AbstractManager& manager, const std::string& plugin);
 
+        ~WavImporter();
+
     private:
         MAGNUM_WAVAUDIOIMPORTER_LOCAL ImporterFeatures doFeatures() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL bool doIsOpened() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL void doOpenData(Containers::ArrayView<const char> data) override;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL void doOpenFile(const std::string& filename) override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL void doClose() override;
 
         MAGNUM_WAVAUDIOIMPORTER_LOCAL BufferFormat doFormat() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL UnsignedInt doFrequency() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL Containers::Array<char> doData() override;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL std::size_t doReadFrames(Containers::ArrayView<char> destination) override;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL void doSeekFrame(std::size_t frame) override;
+
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL void readFromFile(std::size_t offset, Containers::ArrayView<char> destination);
 
         Containers::Optional<Containers::Array<char>> _data;
+        Containers::Pointer<std::ifstream> _file;
+        std::size_t _dataOffset, _dataSize, _position;
         BufferFormat _format;
         UnsignedInt _frequency;
+        UnsignedShort _bitsPerSample;
+        bool _swapEndianness;
 };
 
 }}